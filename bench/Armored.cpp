@@ -0,0 +1,101 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Bench.hpp"
+#include "internal/util/Base64.hpp"
+#include "opentxs/core/Armored.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+// NOTE signed XML interspersed with base64 signature blocks, similar to what
+// OTX messages and ledgers contain
+auto message(std::size_t size) -> ot::UnallocatedCString
+{
+    auto out = ot::UnallocatedCString{};
+    auto counter = std::uint64_t{0};
+
+    while (out.size() < size) {
+        const auto number = std::to_string(++counter);
+        out.append("<transaction type=\"transferReceipt\" number=\"");
+        out.append(number);
+        out.append("\" inReferenceTo=\"");
+        out.append(std::to_string(counter * 7919u));
+        out.append("\">\n<signature>\n");
+        auto noise = ot::UnallocatedCString{};
+
+        for (auto i = 0u; i < 48u; ++i) {
+            noise.push_back(static_cast<char>((counter * 131u + i * 17u)));
+        }
+
+        auto coded = ot::UnallocatedCString{};
+        coded.resize(
+            ot::base64::EncodedSize(noise.size(), ot::base64::line_width_));
+        coded.resize(
+            ot::base64::Encode(noise, coded.data(), ot::base64::line_width_));
+        out.append(coded);
+        out.append("</signature>\n</transaction>\n");
+    }
+
+    out.resize(size);
+
+    return out;
+}
+
+auto armored_encode(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto level = static_cast<std::int32_t>(state.range(1));
+    const auto in = ot::String::Factory(message(size));
+    auto armored = ot::Armored::Factory();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(armored->SetStringCompressed(in, level));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    state.counters["armored_bytes"] =
+        benchmark::Counter(static_cast<double>(armored->GetLength()));
+}
+
+auto armored_decode(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto level = static_cast<std::int32_t>(state.range(1));
+    const auto in = ot::String::Factory(message(size));
+    auto armored = ot::Armored::Factory();
+    armored->SetStringCompressed(in, level);
+    auto out = ot::String::Factory();
+
+    for (auto _ : state) { benchmark::DoNotOptimize(armored->GetString(out)); }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// NOTE payload sizes for a short message, a typical receipt, a populated box,
+// and a large contract
+auto armored_args(benchmark::internal::Benchmark* bench) -> void
+{
+    for (const auto size : {256, 4096, 65536, 1048576}) {
+        for (const auto level :
+             {ot::Armored::CompressFastest, ot::Armored::CompressSmallest}) {
+            bench->Args({size, level});
+        }
+    }
+}
+}  // namespace
+
+BENCHMARK(armored_encode)->Apply(armored_args);
+BENCHMARK(armored_decode)->Apply(armored_args);
+}  // namespace ottest
@@ -0,0 +1,64 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Bench.hpp"  // IWYU pragma: associated
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+
+namespace ottest
+{
+namespace
+{
+std::atomic<std::size_t> allocations_{0};
+}  // namespace
+
+auto AllocationCount() noexcept -> std::size_t
+{
+    return allocations_.load(std::memory_order_relaxed);
+}
+}  // namespace ottest
+
+// NOTE the array, nothrow and sized forms all forward to these two
+auto operator new(std::size_t size) -> void*
+{
+    ottest::allocations_.fetch_add(1, std::memory_order_relaxed);
+
+    if (auto* out = std::malloc((0u == size) ? 1u : size); nullptr != out) {
+
+        return out;
+    }
+
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+namespace ottest
+{
+auto BenchClient() noexcept -> const ot::api::session::Client&
+{
+    static const auto& client = ot::Context().StartClientSession(0);
+
+    return client;
+}
+
+auto BenchHash(std::uint64_t index, std::uint8_t domain) noexcept
+    -> ot::OTData
+{
+    auto bytes = std::array<std::uint8_t, 32>{};
+    bytes.fill(domain);
+    std::memcpy(bytes.data(), &index, sizeof(index));
+
+    return ot::Data::Factory(bytes.data(), bytes.size());
+}
+}  // namespace ottest
@@ -0,0 +1,45 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "opentxs/core/Data.hpp"
+
+namespace ot = opentxs;
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+namespace session
+{
+class Client;
+}  // namespace session
+}  // namespace api
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace ottest
+{
+/// Number of times the global operator new has been called by this process
+auto AllocationCount() noexcept -> std::size_t;
+/** Client session shared by every benchmark
+ *
+ *  The session is started the first time a benchmark asks for it so that
+ *  selecting a subset of benchmarks with --benchmark_filter does not pay for
+ *  setup which is never used.
+ */
+auto BenchClient() noexcept -> const ot::api::session::Client&;
+/// Deterministic 32 byte value which is unique for every input
+auto BenchHash(std::uint64_t index, std::uint8_t domain = 0) noexcept
+    -> ot::OTData;
+}  // namespace ottest
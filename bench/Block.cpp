@@ -0,0 +1,101 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "blockchain/bip158/Bip158.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+constexpr auto chain_{ot::blockchain::Type::Bitcoin_testnet3};
+
+auto raw_blocks() noexcept -> const ot::UnallocatedVector<ot::OTData>&
+{
+    static const auto output = [] {
+        const auto& api = BenchClient();
+        auto out = ot::UnallocatedVector<ot::OTData>{};
+
+        for (const auto& vector : bip_158_vectors_) {
+            out.emplace_back(vector.Block(api));
+        }
+
+        return out;
+    }();
+
+    return output;
+}
+
+auto block_parse(benchmark::State& state) -> void
+{
+    const auto& api = BenchClient();
+    const auto& blocks = raw_blocks();
+    auto bytes = std::size_t{0};
+
+    for (const auto& raw : blocks) { bytes += raw->size(); }
+
+    for (auto _ : state) {
+        for (const auto& raw : blocks) {
+            auto block = api.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+            if (false == bool(block)) {
+                state.SkipWithError("failed to parse block");
+
+                return;
+            }
+
+            benchmark::DoNotOptimize(block);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * blocks.size());
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+auto block_extract_elements(benchmark::State& state) -> void
+{
+    const auto& api = BenchClient();
+    auto blocks = ot::UnallocatedVector<
+        std::shared_ptr<const ot::blockchain::block::bitcoin::Block>>{};
+
+    for (const auto& raw : raw_blocks()) {
+        blocks.emplace_back(api.Factory().BitcoinBlock(chain_, raw->Bytes()));
+
+        if (false == bool(blocks.back())) {
+            state.SkipWithError("failed to parse block");
+
+            return;
+        }
+    }
+
+    for (auto _ : state) {
+        for (const auto& block : blocks) {
+            auto elements = block->Internal().ExtractElements(
+                ot::blockchain::filter::Type::Basic_BIP158);
+            benchmark::DoNotOptimize(elements);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * blocks.size());
+}
+}  // namespace
+
+BENCHMARK(block_parse);
+BENCHMARK(block_extract_elements);
+}  // namespace ottest
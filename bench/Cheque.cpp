@@ -0,0 +1,174 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "Bench.hpp"
+#include "internal/otx/common/Message.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Contacts.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Notary.hpp"
+#include "opentxs/api/session/OTX.hpp"
+#include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/core/UnitType.hpp"
+#include "opentxs/core/contract/ServerContract.hpp"
+#include "opentxs/core/contract/Unit.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Notary.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/otx/LastReplyStatus.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/SharedPimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Status = ot::otx::LastReplyStatus;
+
+// NOTE an issuer and a recipient which are both registered on the same local
+// notary and know each other's nyms
+struct Parties {
+    const ot::api::session::Notary& server_;
+    const ot::api::session::Client& alice_;
+    const ot::api::session::Client& issuer_;
+    ot::OTNymID alice_nym_{ot::identifier::Nym::Factory()};
+    ot::OTNymID issuer_nym_{ot::identifier::Nym::Factory()};
+    ot::OTIdentifier contact_{ot::Identifier::Factory()};
+    ot::OTIdentifier issuer_account_{ot::Identifier::Factory()};
+    bool ready_{false};
+
+    Parties()
+        : server_(ot::Context().StartNotarySession(0))
+        , alice_(BenchClient())
+        , issuer_(ot::Context().StartClientSession(1))
+    {
+        const auto contract = server_.Wallet().Server(server_.ID());
+        auto bytes = ot::Space{};
+        contract->Serialize(ot::writer(bytes), true);
+
+        for (const auto* client : {&alice_, &issuer_}) {
+            client->OTX().SetIntroductionServer(
+                client->Wallet().Server(ot::reader(bytes)));
+        }
+
+        auto reasonA = alice_.Factory().PasswordPrompt(__func__);
+        auto reasonI = issuer_.Factory().PasswordPrompt(__func__);
+        alice_nym_ = alice_.Wallet().Nym(reasonA, "Alice")->ID();
+        issuer_nym_ = issuer_.Wallet().Nym(reasonI, "Issuer")->ID();
+        auto registerAlice =
+            alice_.OTX().RegisterNymPublic(alice_nym_, server_.ID(), true);
+        auto registerIssuer =
+            issuer_.OTX().RegisterNymPublic(issuer_nym_, server_.ID(), true);
+
+        if ((Status::MessageSuccess != registerAlice.second.get().first) ||
+            (Status::MessageSuccess != registerIssuer.second.get().first)) {
+
+            return;
+        }
+
+        alice_.Wallet().Nym(issuer_nym_)->Serialize(ot::writer(bytes));
+        issuer_.Wallet().Nym(ot::reader(bytes));
+        alice_.Wallet().Nym(alice_nym_)->Serialize(ot::writer(bytes));
+        issuer_.Wallet().Nym(ot::reader(bytes));
+        issuer_.Wallet().Nym(issuer_nym_)->Serialize(ot::writer(bytes));
+        alice_.Wallet().Nym(ot::reader(bytes));
+        contact_ = issuer_.Contacts().NymToContact(alice_nym_);
+        const auto unit = issuer_.Wallet().CurrencyContract(
+            issuer_nym_->str(),
+            "Bench USD",
+            "bench",
+            ot::UnitType::Usd,
+            1,
+            reasonI);
+        auto [taskID, future] = issuer_.OTX().IssueUnitDefinition(
+            issuer_nym_,
+            server_.ID(),
+            ot::identifier::UnitDefinition::Factory(unit->ID()->str()));
+        const auto [status, reply] = future.get();
+
+        if ((0 == taskID) || (Status::MessageSuccess != status) ||
+            (false == bool(reply))) {
+
+            return;
+        }
+
+        issuer_account_->SetString(reply->m_strAcctID);
+        issuer_.OTX().ContextIdle(issuer_nym_, server_.ID()).get();
+        alice_.OTX().ContextIdle(alice_nym_, server_.ID()).get();
+        ready_ = true;
+    }
+};
+
+auto parties() -> const Parties&
+{
+    static const auto out = std::make_unique<Parties>();
+
+    return *out;
+}
+
+// NOTE the time from writing a cheque until the issuer has processed the
+// deposit receipt
+auto cheque_round_trip(benchmark::State& state) -> void
+{
+    const auto& p = parties();
+
+    if (false == p.ready_) {
+        state.SkipWithError("failed to set up notary and clients");
+
+        return;
+    }
+
+    for (auto _ : state) {
+        auto [sendID, sent] = p.issuer_.OTX().SendCheque(
+            p.issuer_nym_, p.issuer_account_, p.contact_, 10, "bench");
+
+        if ((0 == sendID) || (Status::MessageSuccess != sent.get().first)) {
+            state.SkipWithError("failed to send cheque");
+
+            break;
+        }
+
+        p.alice_.OTX()
+            .DownloadServerContract(
+                p.alice_nym_, p.server_.ID(), p.server_.ID())
+            .second.get();
+        p.alice_.OTX().ContextIdle(p.alice_nym_, p.server_.ID()).get();
+
+        if (1 != p.alice_.OTX().DepositCheques(p.alice_nym_)) {
+            state.SkipWithError("failed to deposit cheque");
+
+            break;
+        }
+
+        p.alice_.OTX().ContextIdle(p.alice_nym_, p.server_.ID()).get();
+        auto [processID, processed] = p.issuer_.OTX().ProcessInbox(
+            p.issuer_nym_, p.server_.ID(), p.issuer_account_);
+
+        if ((0 == processID) ||
+            (Status::MessageSuccess != processed.get().first)) {
+            state.SkipWithError("failed to process inbox");
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(cheque_round_trip)->Unit(benchmark::kMillisecond)->UseRealTime();
+}  // namespace ottest
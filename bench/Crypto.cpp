@@ -0,0 +1,142 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+#include "Bench.hpp"
+#include "internal/api/Crypto.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Secret.hpp"
+#include "opentxs/crypto/Bip32.hpp"
+#include "opentxs/crypto/Bip32Child.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/crypto/ParameterType.hpp"
+#include "opentxs/crypto/Parameters.hpp"
+#include "opentxs/crypto/Types.hpp"
+#include "opentxs/crypto/key/Asymmetric.hpp"
+#include "opentxs/crypto/key/asymmetric/Algorithm.hpp"
+#include "opentxs/crypto/key/asymmetric/Role.hpp"
+#include "opentxs/crypto/library/AsymmetricProvider.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Algorithm = ot::crypto::key::asymmetric::Algorithm;
+using Path = ot::crypto::Bip32::Path;
+
+constexpr auto hash_{ot::crypto::HashType::Sha256D};
+
+auto provider() noexcept -> const ot::crypto::AsymmetricProvider&
+{
+    return BenchClient().Crypto().Internal().AsymmetricProvider(
+        Algorithm::Secp256k1);
+}
+
+auto secp256k1_key(const ot::PasswordPrompt& reason) noexcept
+    -> ot::OTAsymmetricKey
+{
+    return BenchClient().Factory().AsymmetricKey(
+        ot::crypto::Parameters{ot::crypto::ParameterType::secp256k1},
+        reason,
+        ot::crypto::key::asymmetric::Role::Sign);
+}
+
+auto bip32_derive(benchmark::State& state) -> void
+{
+    const auto& api = BenchClient();
+    static constexpr auto hard =
+        static_cast<ot::Bip32Index>(ot::Bip32Child::HARDENED);
+    // NOTE BIP-32 test vector 1
+    const auto bytes = api.Factory().Data(
+        "000102030405060708090a0b0c0d0e0f", ot::StringStyle::Hex);
+    const auto seed = api.Factory().SecretFromBytes(bytes->Bytes());
+    // NOTE m/44'/0'/0'/0/n, the path used for bip44 receive addresses
+    auto path = Path{44u | hard, 0u | hard, 0u | hard, 0u, 0u};
+    auto index = ot::Bip32Index{0};
+
+    for (auto _ : state) {
+        path.back() = index++ % hard;
+        auto key = api.Crypto().BIP32().DeriveKey(
+            ot::EcdsaCurve::secp256k1, seed, path);
+        benchmark::DoNotOptimize(key);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+auto secp256k1_sign(benchmark::State& state) -> void
+{
+    const auto& api = BenchClient();
+    const auto& lib = provider();
+    const auto reason = api.Factory().PasswordPrompt(__func__);
+    const auto key = secp256k1_key(reason);
+    const auto seckey = key->PrivateKey(reason);
+    const auto plaintext = BenchHash(0);
+    auto sig = ot::Space{};
+
+    for (auto _ : state) {
+        sig.clear();
+        const auto rc =
+            lib.Sign(plaintext->Bytes(), seckey, hash_, ot::writer(sig));
+
+        if (false == rc) {
+            state.SkipWithError("failed to sign");
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+auto secp256k1_verify(benchmark::State& state) -> void
+{
+    const auto& api = BenchClient();
+    const auto& lib = provider();
+    const auto reason = api.Factory().PasswordPrompt(__func__);
+    const auto key = secp256k1_key(reason);
+    const auto plaintext = BenchHash(0);
+    const auto pubkey = key->PublicKey();
+    auto sig = ot::Space{};
+
+    if (false == lib.Sign(
+                     plaintext->Bytes(),
+                     key->PrivateKey(reason),
+                     hash_,
+                     ot::writer(sig))) {
+        state.SkipWithError("failed to sign");
+
+        return;
+    }
+
+    for (auto _ : state) {
+        const auto verified =
+            lib.Verify(plaintext->Bytes(), pubkey, ot::reader(sig), hash_);
+
+        if (false == verified) {
+            state.SkipWithError("failed to verify");
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(bip32_derive);
+BENCHMARK(secp256k1_sign);
+BENCHMARK(secp256k1_verify);
+}  // namespace ottest
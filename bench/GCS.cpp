@@ -0,0 +1,187 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "blockchain/bip158/Bip158.hpp"
+#include "blockchain/bip158/bch_filter_1307544.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/blockchain/GCS.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using FilterType = ot::blockchain::filter::Type;
+
+struct Elements {
+    ot::OTData key_;
+    ot::UnallocatedVector<ot::OTData> elements_;
+};
+
+// NOTE the block from the bip158 test vectors with the most filter elements
+auto largest_vector() noexcept -> const Elements&
+{
+    static const auto output = [] {
+        const auto& api = BenchClient();
+        auto out = Elements{api.Factory().Data(), {}};
+
+        for (const auto& vector : bip_158_vectors_) {
+            const auto raw = vector.Block(api);
+            const auto block = api.Factory().BitcoinBlock(
+                ot::blockchain::Type::Bitcoin_testnet3, raw->Bytes());
+
+            if (false == bool(block)) { continue; }
+
+            auto elements =
+                block->Internal().ExtractElements(FilterType::Basic_BIP158);
+
+            if (elements.size() > out.elements_.size()) {
+                out.key_ = api.Factory().Data(
+                    ot::blockchain::internal::BlockHashToFilterKey(
+                        block->ID().Bytes()));
+                out.elements_.clear();
+
+                for (const auto& element : elements) {
+                    out.elements_.emplace_back(
+                        api.Factory().Data(ot::reader(element)));
+                }
+            }
+        }
+
+        return out;
+    }();
+
+    return output;
+}
+
+// NOTE a mainnet BCH filter with several hundred thousand elements
+auto bch_filter() noexcept -> ot::ReadView
+{
+    return {
+        reinterpret_cast<const char*>(bch_filter_1307544_.data()),
+        bch_filter_1307544_.size()};
+}
+
+auto bch_key() noexcept -> const ot::OTData&
+{
+    static const auto output = [] {
+        const auto& api = BenchClient();
+        const auto hash = api.Factory().Data(
+            "a9df8e8b72336137aaf70ac0d390c2a57b2afc826201e9f78b00000000000000",
+            ot::StringStyle::Hex);
+
+        return api.Factory().Data(
+            ot::blockchain::internal::BlockHashToFilterKey(hash->Bytes()));
+    }();
+
+    return output;
+}
+
+auto decode_bch() noexcept -> std::unique_ptr<ot::blockchain::GCS>
+{
+    return ot::factory::GCS(
+        BenchClient(),
+        FilterType::Basic_BCHVariant,
+        bch_key()->Bytes(),
+        bch_filter());
+}
+
+auto targets(std::size_t count) noexcept -> ot::UnallocatedVector<ot::OTData>
+{
+    auto output = ot::UnallocatedVector<ot::OTData>{};
+    output.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        output.emplace_back(BenchHash(i, 0xff));
+    }
+
+    return output;
+}
+
+auto gcs_construct(benchmark::State& state) -> void
+{
+    const auto& api = BenchClient();
+    const auto& [key, elements] = largest_vector();
+    static const auto params =
+        ot::blockchain::internal::GetFilterParams(FilterType::Basic_BIP158);
+
+    for (auto _ : state) {
+        auto gcs = ot::factory::GCS(
+            api, params.first, params.second, key->Bytes(), elements);
+        benchmark::DoNotOptimize(gcs);
+    }
+
+    state.SetItemsProcessed(state.iterations() * elements.size());
+}
+
+auto gcs_decompress(benchmark::State& state) -> void
+{
+    const auto target = BenchHash(0, 0xff);
+    auto count = std::size_t{0};
+
+    for (auto _ : state) {
+        const auto gcs = decode_bch();
+
+        if (false == bool(gcs)) {
+            state.SkipWithError("failed to decode filter");
+
+            break;
+        }
+
+        // NOTE the first query expands the golomb coded set
+        benchmark::DoNotOptimize(gcs->Test(target));
+        count = gcs->ElementCount();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetBytesProcessed(state.iterations() * bch_filter().size());
+}
+
+auto gcs_match(benchmark::State& state) -> void
+{
+    const auto gcs = decode_bch();
+    const auto data = targets(static_cast<std::size_t>(state.range(0)));
+    auto query = ot::blockchain::GCS::Targets{};
+
+    if (false == bool(gcs)) {
+        state.SkipWithError("failed to decode filter");
+
+        return;
+    }
+
+    for (const auto& item : data) { query.emplace_back(item->Bytes()); }
+
+    // NOTE exclude the one time decompression from the measurement
+    gcs->Match(query);
+
+    for (auto _ : state) {
+        auto matches = gcs->Match(query);
+        benchmark::DoNotOptimize(matches);
+    }
+
+    state.SetItemsProcessed(state.iterations() * query.size());
+}
+}  // namespace
+
+BENCHMARK(gcs_construct);
+BENCHMARK(gcs_decompress)->Unit(benchmark::kMillisecond);
+BENCHMARK(gcs_match)->RangeMultiplier(10)->Range(1, 10000);
+}  // namespace ottest
@@ -0,0 +1,87 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "internal/blockchain/node/Factory.hpp"
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/node/HeaderOracle.hpp"
+#include "opentxs/blockchain/node/Manager.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Headers =
+    ot::UnallocatedVector<std::unique_ptr<ot::blockchain::block::Header>>;
+
+constexpr auto chain_{ot::blockchain::Type::UnitTest};
+
+auto header_oracle_add(benchmark::State& state) -> void
+{
+    const auto& api = BenchClient();
+    const auto batch = static_cast<std::size_t>(state.range(0));
+    // NOTE the oracle keeps every header it has accepted, so each batch extends
+    // the chain built by the previous iterations
+    static auto network = [&] {
+        static const auto config = ot::blockchain::node::internal::Config{};
+
+        return ot::factory::BlockchainNetworkBitcoin(
+            api, chain_, config, "do not init peers", "");
+    }();
+
+    if (false == bool(network)) {
+        state.SkipWithError("failed to start network");
+
+        return;
+    }
+
+    using Oracle = ot::blockchain::node::HeaderOracle;
+    auto& oracle = const_cast<Oracle&>(network->HeaderOracle());
+    oracle.DeleteCheckpoint();
+    static auto next = std::uint64_t{0};
+    auto headers = Headers{};
+    headers.reserve(batch);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        headers.clear();
+        auto parent = oracle.BestChain().second;
+
+        for (auto i = std::size_t{0}; i < batch; ++i) {
+            const auto hash = BenchHash(++next, 0x01);
+            auto& header = headers.emplace_back(
+                api.Factory().BlockHeaderForUnitTests(hash, parent, -1));
+            parent = header->Hash();
+        }
+
+        state.ResumeTiming();
+
+        if (false == oracle.AddHeaders(headers)) {
+            state.SkipWithError("failed to add headers");
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+}  // namespace
+
+BENCHMARK(header_oracle_add)->Arg(1)->Arg(100)->Arg(2000);
+}  // namespace ottest
@@ -0,0 +1,131 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/otx/Types.hpp"
+#include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/core/Armored.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Notary.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ottest
+{
+namespace
+{
+struct Inbox {
+    ot::OTNymID nym_{ot::identifier::Nym::Factory()};
+    ot::OTNotaryID server_{ot::identifier::Notary::Factory()};
+    // NOTE the same inbox in the armored XML form
+    ot::OTString xml_{ot::String::Factory()};
+};
+
+auto empty_ledger(const Inbox& box) -> std::unique_ptr<ot::Ledger>
+{
+    return BenchClient().Factory().InternalSession().Ledger(
+        box.nym_, box.nym_, box.server_);
+}
+
+// NOTE signs an inbox holding the specified number of transfer receipts and
+// saves it in the binary form
+auto make_inbox(std::int64_t count) -> Inbox
+{
+    const auto& client = BenchClient();
+    const auto reason = client.Factory().PasswordPrompt(__func__);
+    auto out = Inbox{};
+    out.nym_ = client.Wallet().Nym(reason, "Ledger")->ID();
+    out.server_->Randomize();
+    const auto nym = client.Wallet().Nym(out.nym_);
+    auto inbox = client.Factory().InternalSession().Ledger(
+        out.nym_, out.nym_, out.server_, ot::ledgerType::inbox, false);
+
+    for (auto i = std::int64_t{1}; i <= count; ++i) {
+        auto receipt = client.Factory().InternalSession().Transaction(
+            out.nym_,
+            out.nym_,
+            out.server_,
+            0,
+            ot::originType::not_applicable,
+            i,
+            i,
+            i,
+            ot::Clock::now(),
+            ot::transactionType::transferReceipt,
+            ot::String::Factory(ot::Identifier::Random()),
+            0,
+            i,
+            0,
+            0,
+            false);
+        inbox->AddTransaction(
+            std::shared_ptr<ot::OTTransaction>{receipt.release()});
+    }
+
+    inbox->ReleaseSignatures();
+    inbox->SignContract(*nym, reason);
+    inbox->SaveContract();
+    inbox->SaveInbox();
+    auto raw = ot::String::Factory();
+    inbox->SaveContractRaw(raw);
+    ot::Armored::Factory(raw)->WriteArmoredString(out.xml_, "LEDGER");
+
+    return out;
+}
+
+auto inbox(std::int64_t count) -> const Inbox&
+{
+    static auto boxes = ot::UnallocatedMap<std::int64_t, Inbox>{};
+    auto it = boxes.find(count);
+
+    if (boxes.end() == it) {
+        it = boxes.emplace(count, make_inbox(count)).first;
+    }
+
+    return it->second;
+}
+
+auto ledger_load_xml(benchmark::State& state) -> void
+{
+    const auto& box = inbox(state.range(0));
+
+    for (auto _ : state) {
+        auto ledger = empty_ledger(box);
+        benchmark::DoNotOptimize(ledger->LoadInboxFromString(box.xml_));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+auto ledger_load_binary(benchmark::State& state) -> void
+{
+    const auto& box = inbox(state.range(0));
+
+    for (auto _ : state) {
+        auto ledger = empty_ledger(box);
+        benchmark::DoNotOptimize(ledger->LoadInbox());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(ledger_load_xml)->Arg(1000)->Arg(10000);
+BENCHMARK(ledger_load_binary)->Arg(1000)->Arg(10000);
+}  // namespace ottest
@@ -0,0 +1,143 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "interface/ui/base/Items.hpp"
+#include "internal/interface/ui/UI.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using BenchRowID = std::uint64_t;
+using BenchSortKey = std::uint64_t;
+using BenchItems = ot::ui::implementation::
+    ListItems<BenchRowID, BenchSortKey, std::shared_ptr<ot::ui::internal::Row>>;
+}  // namespace ottest
+
+namespace opentxs::ui::implementation
+{
+template <>
+auto ListItems<
+    ottest::BenchRowID,
+    ottest::BenchSortKey,
+    std::shared_ptr<internal::Row>>::
+    compare_id(const ottest::BenchRowID& lhs, const ottest::BenchRowID& rhs)
+        const noexcept -> bool
+{
+    static const auto compare = std::less<ottest::BenchRowID>{};
+
+    return compare(lhs, rhs);
+}
+
+template <>
+auto ListItems<
+    ottest::BenchRowID,
+    ottest::BenchSortKey,
+    std::shared_ptr<internal::Row>>::
+    compare_key(
+        const ottest::BenchSortKey& lhs,
+        const ottest::BenchSortKey& rhs) const noexcept -> bool
+{
+    static const auto compare = std::less<ottest::BenchSortKey>{};
+
+    return compare(lhs, rhs);
+}
+}  // namespace opentxs::ui::implementation
+
+namespace ottest
+{
+namespace
+{
+// NOTE rows arrive in random order, as they do when an activity thread or
+// contact list is populated from storage
+auto keys(const std::size_t count) noexcept
+    -> ot::UnallocatedVector<BenchSortKey>
+{
+    auto output = ot::UnallocatedVector<BenchSortKey>{};
+    output.reserve(count);
+    auto rng = std::mt19937_64{count};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        output.emplace_back(rng());
+    }
+
+    return output;
+}
+
+auto populate(BenchItems& items, const ot::UnallocatedVector<BenchSortKey>& in)
+    -> void
+{
+    auto id = BenchRowID{0};
+
+    for (const auto& key : in) {
+        const auto [it, prev] = items.find_insert_position(key, id);
+        items.insert_before(it, key, id++, nullptr);
+    }
+}
+
+auto ui_rows_populate(benchmark::State& state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto input = keys(count);
+
+    for (auto _ : state) {
+        auto items = BenchItems{0, false};
+        populate(items, input);
+        benchmark::DoNotOptimize(items.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+auto ui_rows_at(benchmark::State& state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto items = BenchItems{0, false};
+    populate(items, keys(count));
+
+    for (auto _ : state) {
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            benchmark::DoNotOptimize(items.at(i));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+auto ui_rows_move(benchmark::State& state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto items = BenchItems{0, false};
+    populate(items, keys(count));
+    auto rng = std::mt19937_64{};
+
+    for (auto _ : state) {
+        const auto id = BenchRowID{rng() % count};
+        const auto key = BenchSortKey{rng()};
+        auto move = items.find_move_position(id, key, id);
+        auto& [from, to] = move.value();
+        items.move_before(id, from.first, key, id, to.first);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(ui_rows_populate)
+    ->Arg(1000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(ui_rows_at)->Arg(1000)->Arg(50000);
+BENCHMARK(ui_rows_move)->Arg(1000)->Arg(50000);
+}  // namespace ottest
@@ -0,0 +1,163 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <lmdb.h>
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+
+#include "Basic.hpp"
+#include "opentxs/util/Container.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace fs = boost::filesystem;
+
+namespace ottest
+{
+namespace
+{
+using Index = ot::util::IndexData;
+using LMDB = ot::storage::lmdb::LMDB;
+
+constexpr auto config_ = 0;
+constexpr auto free_ = 1;
+
+const auto names_ = ot::storage::lmdb::TableNames{
+    {config_, "config"},
+    {free_, "free"},
+};
+
+class Storage final : public ot::util::MappedFileStorage
+{
+public:
+    auto Compact(ot::UnallocatedVector<Index>& indices)
+        -> std::optional<ot::util::CompactionReport>
+    {
+        auto items = ot::UnallocatedVector<Item>{};
+        auto end = std::size_t{0};
+
+        for (const auto& index : indices) {
+            items.push_back({index, true});
+            end = std::max(end, index.position_ + index.size_);
+        }
+
+        auto tx = lmdb_.TransactionRW();
+
+        return compact(
+            tx,
+            items,
+            [&](auto&, auto item, const auto& index) {
+                indices.at(item) = index;
+
+                return true;
+            },
+            end);
+    }
+    auto Write(Index& index, std::size_t size, char fill) -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+        auto view = get_write_view(tx, index, size);
+
+        if (false == view.valid(size)) { return false; }
+
+        std::memset(view.data(), fill, size);
+
+        return tx.Finalize(true);
+    }
+
+    Storage(LMDB& lmdb, const ot::UnallocatedCString& path)
+        : MappedFileStorage(lmdb, path, "bench", config_, 0, free_)
+    {
+    }
+};
+
+// NOTE a storage file in which every other item has been resized, leaving a
+// hole behind each of them
+struct Fragmented {
+    const ot::UnallocatedCString path_;
+    LMDB lmdb_;
+    Storage storage_;
+    ot::UnallocatedVector<Index> indices_;
+
+    Fragmented(std::size_t count)
+        : path_([] {
+            const auto path = fs::path{Home()} /
+                              fs::unique_path("bench-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path.string();
+        }())
+        , lmdb_(
+              names_,
+              path_,
+              {{config_, MDB_INTEGERKEY},
+               {free_, MDB_DUPSORT | MDB_INTEGERKEY}})
+        , storage_(lmdb_, path_)
+        , indices_(count)
+    {
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            storage_.Write(indices_.at(i), 4096u + (i * 100u), 'a');
+        }
+
+        for (auto i = std::size_t{0}; i < count; i += 2u) {
+            storage_.Write(indices_.at(i), 9096u + (i * 100u), 'z');
+        }
+    }
+
+    ~Fragmented()
+    {
+        try {
+            fs::remove_all(path_);
+        } catch (...) {
+        }
+    }
+};
+
+auto storage_compact(benchmark::State& state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto report = std::optional<ot::util::CompactionReport>{};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto data = std::make_unique<Fragmented>(count);
+        state.ResumeTiming();
+        report = data->storage_.Compact(data->indices_);
+        state.PauseTiming();
+        data.reset();
+        state.ResumeTiming();
+
+        if (false == report.has_value()) {
+            state.SkipWithError("compaction failed");
+
+            break;
+        }
+    }
+
+    if (false == report.has_value()) { return; }
+
+    const auto& value = report.value();
+    state.counters["free_before"] =
+        benchmark::Counter(static_cast<double>(value.free_bytes_before_));
+    state.counters["free_after"] =
+        benchmark::Counter(static_cast<double>(value.free_bytes_after_));
+    state.counters["relocated"] =
+        benchmark::Counter(static_cast<double>(value.relocated_bytes_));
+    state.counters["trimmed"] =
+        benchmark::Counter(static_cast<double>(value.trimmed_bytes_));
+    state.counters["reclaimed"] =
+        benchmark::Counter(static_cast<double>(value.reclaimed_bytes_));
+    state.counters["fragmentation"] =
+        benchmark::Counter(value.FragmentationBefore());
+}
+}  // namespace
+
+BENCHMARK(storage_compact)->Arg(32)->Arg(1024)->Unit(benchmark::kMillisecond);
+}  // namespace ottest
@@ -0,0 +1,50 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/network/zeromq/message/Message.tpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/WorkType.hpp"
+
+namespace ottest
+{
+namespace
+{
+// NOTE the shape of a typical actor work message: a routing frame, the
+// delimiter, the work type, and a few arguments
+auto zmq_message_build(benchmark::State& state) -> void
+{
+    const auto frames = static_cast<std::size_t>(state.range(0));
+    const auto payload = BenchHash(0u);
+    const auto start = AllocationCount();
+
+    for (auto _ : state) {
+        auto message = ot::network::zeromq::Message{};
+        message.AddFrame(std::uint64_t{42u});
+        message.StartBody();
+        message.AddFrame(ot::WorkType::BlockchainNewHeader);
+
+        for (auto i = std::size_t{0}; i < frames; ++i) {
+            message.AddFrame(payload);
+        }
+
+        benchmark::DoNotOptimize(message.size());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["allocations_per_message"] = benchmark::Counter(
+        static_cast<double>(AllocationCount() - start) /
+        static_cast<double>(state.iterations()));
+}
+}  // namespace
+
+BENCHMARK(zmq_message_build)->Arg(1)->Arg(4)->Arg(16);
+}  // namespace ottest
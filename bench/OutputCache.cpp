@@ -0,0 +1,253 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <lmdb.h>
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Basic.hpp"
+#include "Bench.hpp"
+#include "blockchain/bip158/Bip158.hpp"
+#include "blockchain/database/wallet/OutputCache.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/database/Database.hpp"
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/node/TxoState.hpp"
+#include "opentxs/blockchain/node/TxoTag.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+
+namespace ottest
+{
+namespace
+{
+namespace db = ot::blockchain::database;
+
+using OutputCache = db::wallet::OutputCache;
+using State = ot::blockchain::node::TxoState;
+
+constexpr auto chain_{ot::blockchain::Type::Bitcoin_testnet3};
+
+// NOTE the subset of the tables from blockchain::implementation::Database
+// which OutputCache reads and writes
+const auto table_names_ = ot::storage::lmdb::TableNames{
+    {db::Config, "config"},
+    {db::WalletOutputs, "wallet_outputs"},
+    {db::AccountOutputs, "account_outputs"},
+    {db::NymOutputs, "nym_outputs"},
+    {db::PositionOutputs, "position_outputs"},
+    {db::StateOutputs, "state_outputs"},
+    {db::SubchainOutputs, "subchain_outputs"},
+    {db::KeyOutputs, "key_outputs"},
+};
+
+struct Fixture {
+    const fs::path path_;
+    ot::storage::lmdb::LMDB lmdb_;
+    std::shared_mutex lock_;
+    OutputCache cache_;
+    ot::UnallocatedVector<ot::blockchain::block::Outpoint> outpoints_;
+
+    auto Populate(std::size_t count) noexcept -> bool
+    {
+        const auto& api = BenchClient();
+        const auto outputs = [&] {
+            auto out = ot::UnallocatedVector<
+                std::unique_ptr<ot::blockchain::block::bitcoin::Output>>{};
+
+            for (const auto& vector : bip_158_vectors_) {
+                const auto raw = vector.Block(api);
+                const auto block =
+                    api.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+                if (false == bool(block)) { continue; }
+
+                for (const auto& tx : *block) {
+                    for (const auto& txout : tx->Outputs()) {
+                        out.emplace_back(txout.Internal().clone());
+                    }
+                }
+            }
+
+            return out;
+        }();
+
+        if (outputs.empty()) { return false; }
+
+        const auto position = ot::blockchain::block::Position{
+            1, api.Factory().Data(BenchHash(0, 0x02)->Bytes())};
+        auto lock = ot::eLock{lock_};
+        auto tx = lmdb_.TransactionRW();
+        outpoints_.reserve(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& outpoint = outpoints_.emplace_back(
+                BenchHash(i, 0x03)->Bytes(), static_cast<std::uint32_t>(i));
+            auto output = outputs.at(i % outputs.size())->Internal().clone();
+            output->SetState(State::ConfirmedNew);
+            output->SetMinedPosition(position);
+            output->AddTag(ot::blockchain::node::TxoTag::Normal);
+
+            if (false ==
+                cache_.AddOutput(lock, outpoint, tx, std::move(output))) {
+                return false;
+            }
+
+            if (false == cache_.AddToState(
+                             lock, State::ConfirmedNew, outpoint, tx)) {
+                return false;
+            }
+
+            if (false == cache_.AddToPosition(lock, position, outpoint, tx)) {
+                return false;
+            }
+        }
+
+        return tx.Finalize(true);
+    }
+
+    Fixture()
+        : path_([] {
+            auto path = fs::path{Home()} /
+                        fs::unique_path("outputcache-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path;
+        }())
+        , lmdb_(
+              table_names_,
+              path_.string(),
+              {
+                  {db::Config, MDB_INTEGERKEY},
+                  {db::WalletOutputs, 0},
+                  {db::AccountOutputs, MDB_DUPSORT},
+                  {db::NymOutputs, MDB_DUPSORT},
+                  {db::PositionOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                  {db::StateOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                  {db::SubchainOutputs, MDB_DUPSORT},
+                  {db::KeyOutputs, MDB_DUPSORT},
+              })
+        , lock_()
+        , cache_(
+              BenchClient(),
+              lmdb_,
+              chain_,
+              ot::make_blank<ot::blockchain::block::Position>::value(
+                  BenchClient()))
+        , outpoints_()
+    {
+    }
+
+    ~Fixture()
+    {
+        try {
+            fs::remove_all(path_);
+        } catch (...) {
+        }
+    }
+};
+
+// NOTE models a block being confirmed and later reorganized away: every
+// output moves between two states in a single write transaction per batch
+auto output_cache_change_state(benchmark::State& state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto fixture = std::make_unique<Fixture>();
+
+    if (false == fixture->Populate(count)) {
+        state.SkipWithError("failed to populate cache");
+
+        return;
+    }
+
+    auto& cache = fixture->cache_;
+    auto from = State::ConfirmedNew;
+    auto to = State::OrphanedNew;
+
+    for (auto _ : state) {
+        auto lock = ot::eLock{fixture->lock_};
+        auto tx = fixture->lmdb_.TransactionRW();
+
+        for (const auto& outpoint : fixture->outpoints_) {
+            if (false == cache.ChangeState(lock, from, to, outpoint, tx)) {
+                state.SkipWithError("failed to change state");
+
+                return;
+            }
+        }
+
+        if (false == tx.Finalize(true)) {
+            state.SkipWithError("failed to commit transaction");
+
+            return;
+        }
+
+        std::swap(from, to);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+auto output_cache_update(benchmark::State& state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto fixture = std::make_unique<Fixture>();
+
+    if (false == fixture->Populate(count)) {
+        state.SkipWithError("failed to populate cache");
+
+        return;
+    }
+
+    auto& cache = fixture->cache_;
+
+    for (auto _ : state) {
+        auto lock = ot::eLock{fixture->lock_};
+        auto tx = fixture->lmdb_.TransactionRW();
+
+        for (const auto& outpoint : fixture->outpoints_) {
+            const auto& output = cache.GetOutput(lock, outpoint);
+
+            if (false == cache.UpdateOutput(lock, outpoint, output, tx)) {
+                state.SkipWithError("failed to update output");
+
+                return;
+            }
+        }
+
+        if (false == tx.Finalize(true)) {
+            state.SkipWithError("failed to commit transaction");
+
+            return;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+}  // namespace
+
+BENCHMARK(output_cache_change_state)->Arg(100)->Arg(10000);
+BENCHMARK(output_cache_update)->Arg(100)->Arg(10000);
+}  // namespace ottest
@@ -0,0 +1,106 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <google/protobuf/arena.h>
+#include <cstddef>
+#include <optional>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "Proto.tpp"
+#include "blockchain/bip158/Bip158.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "serialization/protobuf/BlockchainTransaction.pb.h"
+
+namespace ottest
+{
+namespace
+{
+// NOTE serialized transactions from every bip158 test vector block
+auto transactions() noexcept
+    -> const ot::UnallocatedVector<ot::UnallocatedCString>&
+{
+    static const auto output = [] {
+        const auto& api = BenchClient();
+        auto out = ot::UnallocatedVector<ot::UnallocatedCString>{};
+
+        for (const auto& vector : bip_158_vectors_) {
+            const auto raw = vector.Block(api);
+            const auto block = api.Factory().BitcoinBlock(
+                ot::blockchain::Type::Bitcoin_testnet3, raw->Bytes());
+
+            if (false == bool(block)) { continue; }
+
+            for (auto i = std::size_t{0}; i < block->size(); ++i) {
+                const auto proto = block->at(i)->Internal().Serialize();
+
+                if (proto.has_value()) {
+                    out.emplace_back(proto->SerializeAsString());
+                }
+            }
+        }
+
+        return out;
+    }();
+
+    return output;
+}
+
+auto record(benchmark::State& state, const std::size_t start) -> void
+{
+    const auto count = state.iterations() * transactions().size();
+    state.SetItemsProcessed(count);
+    state.counters["allocations_per_message"] = benchmark::Counter(
+        static_cast<double>(AllocationCount() - start) /
+        static_cast<double>(count));
+}
+
+auto proto_parse_heap(benchmark::State& state) -> void
+{
+    const auto& input = transactions();
+    const auto start = AllocationCount();
+
+    for (auto _ : state) {
+        for (const auto& bytes : input) {
+            const auto proto =
+                ot::proto::Factory<ot::proto::BlockchainTransaction>(bytes);
+            benchmark::DoNotOptimize(proto.txid());
+        }
+    }
+
+    record(state, start);
+}
+
+auto proto_parse_arena(benchmark::State& state) -> void
+{
+    const auto& input = transactions();
+    const auto start = AllocationCount();
+
+    for (auto _ : state) {
+        for (const auto& bytes : input) {
+            auto arena = google::protobuf::Arena{};
+            const auto& proto =
+                ot::proto::ArenaFactory<ot::proto::BlockchainTransaction>(
+                    arena, bytes);
+            benchmark::DoNotOptimize(proto.txid());
+        }
+    }
+
+    record(state, start);
+}
+}  // namespace
+
+BENCHMARK(proto_parse_heap);
+BENCHMARK(proto_parse_arena);
+}  // namespace ottest
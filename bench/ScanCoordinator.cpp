@@ -0,0 +1,164 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "blockchain/node/wallet/subchain/ScanCoordinator.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/blockchain/GCS.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using ScanCoordinator = ot::blockchain::node::wallet::ScanCoordinator;
+using Position = ot::blockchain::block::Position;
+
+constexpr auto blocks_ = std::size_t{200};
+constexpr auto patterns_per_subchain_ = std::size_t{40};
+constexpr auto elements_per_block_ = std::size_t{400};
+constexpr auto max_subchains_ = std::size_t{100};
+
+// NOTE every block contains random elements plus one pattern from each of a
+// few subchains
+struct Chain {
+    ot::UnallocatedVector<Position> positions_{};
+    ot::UnallocatedVector<ot::Space> filters_{};
+    ot::UnallocatedVector<ot::OTIdentifier> subchains_{};
+    ot::UnallocatedVector<ScanCoordinator::pTargets> targets_{};
+    // NOTE backing storage for the views in targets_
+    ot::UnallocatedVector<ot::UnallocatedVector<ot::OTData>> patterns_{};
+
+    Chain()
+    {
+        const auto& api = BenchClient();
+        const auto [bits, fpRate] = ot::blockchain::internal::GetFilterParams(
+            ot::blockchain::filter::Type::Basic_BIP158);
+        auto rng = std::mt19937_64{0x5c4e};
+        const auto random = [&] {
+            auto words = ot::UnallocatedVector<std::uint64_t>(4u);
+
+            for (auto& word : words) { word = rng(); }
+
+            return ot::Data::Factory(words.data(), 32u);
+        };
+
+        for (auto i = std::size_t{0}; i < max_subchains_; ++i) {
+            subchains_.emplace_back(ot::Identifier::Random());
+            auto& patterns = patterns_.emplace_back();
+            auto targets = std::make_shared<ScanCoordinator::Targets>();
+
+            for (auto j = std::size_t{0}; j < patterns_per_subchain_; ++j) {
+                targets->emplace_back(patterns.emplace_back(random())->Bytes());
+            }
+
+            targets_.emplace_back(std::move(targets));
+        }
+
+        for (auto height = std::size_t{0}; height < blocks_; ++height) {
+            const auto hash = random();
+            auto elements = ot::UnallocatedVector<ot::OTData>{};
+
+            for (auto i = std::size_t{0}; i < elements_per_block_; ++i) {
+                elements.emplace_back(random());
+            }
+
+            for (auto i = height % 7u; i < max_subchains_; i += 7u) {
+                const auto& patterns = patterns_.at(i);
+                elements.emplace_back(
+                    patterns.at((height + i) % patterns.size()));
+            }
+
+            const auto gcs = ot::factory::GCS(
+                api,
+                bits,
+                fpRate,
+                ot::blockchain::internal::BlockHashToFilterKey(hash->Bytes()),
+                elements);
+            positions_.emplace_back(
+                static_cast<ot::blockchain::block::Height>(height), hash);
+            gcs->Serialize(ot::writer(filters_.emplace_back()));
+        }
+    }
+
+    auto Load(const Position& position) const noexcept
+        -> std::unique_ptr<const ot::blockchain::GCS>
+    {
+        return ot::factory::GCS(
+            BenchClient(),
+            ot::reader(filters_.at(static_cast<std::size_t>(position.first))));
+    }
+};
+
+auto chain() noexcept -> const Chain&
+{
+    static const auto out = std::make_unique<Chain>();
+
+    return *out;
+}
+
+// NOTE every subchain loads and decodes each filter for itself
+auto scan_separate(benchmark::State& state) -> void
+{
+    const auto& data = chain();
+    const auto subchains = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        for (auto i = std::size_t{0}; i < subchains; ++i) {
+            const auto& targets = *data.targets_.at(i);
+
+            for (const auto& position : data.positions_) {
+                benchmark::DoNotOptimize(
+                    data.Load(position)->Match(targets).size());
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * subchains * blocks_);
+}
+
+auto scan_shared(benchmark::State& state) -> void
+{
+    const auto& data = chain();
+    const auto subchains = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        auto coordinator = ScanCoordinator{
+            [&](const auto& position) { return data.Load(position); }};
+
+        for (auto i = std::size_t{0}; i < subchains; ++i) {
+            coordinator.Update(data.subchains_.at(i), 0, data.targets_.at(i));
+        }
+
+        for (auto i = std::size_t{0}; i < subchains; ++i) {
+            for (const auto& position : data.positions_) {
+                benchmark::DoNotOptimize(
+                    coordinator.Match(data.subchains_.at(i), position).second);
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * subchains * blocks_);
+}
+}  // namespace
+
+BENCHMARK(scan_separate)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(scan_shared)->Arg(1)->Arg(10)->Arg(100);
+}  // namespace ottest
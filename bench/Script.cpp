@@ -0,0 +1,84 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Bench.hpp"
+#include "blockchain/bip158/Bip158.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Script.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Position = ot::blockchain::block::bitcoin::Script::Position;
+
+constexpr auto chain_{ot::blockchain::Type::Bitcoin_testnet3};
+
+// NOTE every output script found in the bip158 test vectors, which cover
+// all the standard script types plus a few nonstandard ones
+auto output_scripts() noexcept -> const ot::UnallocatedVector<ot::Space>&
+{
+    static const auto output = [] {
+        const auto& api = BenchClient();
+        auto out = ot::UnallocatedVector<ot::Space>{};
+
+        for (const auto& vector : bip_158_vectors_) {
+            const auto raw = vector.Block(api);
+            const auto block = api.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+            if (false == bool(block)) { continue; }
+
+            for (const auto& tx : *block) {
+                for (const auto& txout : tx->Outputs()) {
+                    txout.Script().Serialize(ot::writer(out.emplace_back()));
+                }
+            }
+        }
+
+        return out;
+    }();
+
+    return output;
+}
+
+auto script_classify(benchmark::State& state) -> void
+{
+    const auto& scripts = output_scripts();
+
+    for (auto _ : state) {
+        for (const auto& bytes : scripts) {
+            const auto script = ot::factory::BitcoinScript(
+                chain_, ot::reader(bytes), Position::Output);
+
+            if (false == bool(script)) {
+                state.SkipWithError("failed to parse script");
+
+                return;
+            }
+
+            benchmark::DoNotOptimize(script->Type());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * scripts.size());
+}
+}  // namespace
+
+BENCHMARK(script_classify);
+}  // namespace ottest
@@ -0,0 +1,27 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include "Basic.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/util/Options.hpp"
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+
+    auto& args = const_cast<ot::Options&>(ottest::Args(false));
+    args.SetQtRootObject(ottest::GetQT());
+    ot::InitContext(args);
+    ::benchmark::RunSpecifiedBenchmarks();
+    ot::Cleanup();
+    ottest::WipeHome();
+    ottest::StopQT();
+
+    return 0;
+}
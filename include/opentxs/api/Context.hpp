@@ -99,6 +99,12 @@ public:
         ShutdownCallback* callback = nullptr) const noexcept -> void = 0;
     OPENTXS_NO_EXPORT virtual auto Internal() const noexcept
         -> const internal::Context& = 0;
+    /** Current values of the internal metrics in Prometheus text format
+     *
+     *  If Options::MetricsEndpoint() is set the same text is also published
+     *  periodically on that endpoint as a MetricsSnapshot tagged message.
+     */
+    virtual auto Metrics() const noexcept -> UnallocatedCString = 0;
     /** Throws std::out_of_range if the specified session does not exist. */
     virtual auto NotarySession(const int instance) const noexcept(false)
         -> const session::Notary& = 0;
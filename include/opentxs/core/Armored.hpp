@@ -68,6 +68,12 @@ extern const char* OT_BEGIN_SIGNED_escaped;
 class OPENTXS_EXPORT Armored : virtual public String
 {
 public:
+    // zlib compression levels for SetStringCompressed. Most armored data is
+    // transient so SetString favors speed over size.
+    static constexpr std::int32_t CompressFastest{1};
+    static constexpr std::int32_t CompressSmallest{9};
+    static constexpr std::int32_t DefaultCompression{CompressFastest};
+
     static auto Factory() -> opentxs::Pimpl<opentxs::Armored>;
     static auto Factory(const String& in) -> opentxs::Pimpl<opentxs::Armored>;
 
@@ -86,6 +92,10 @@ public:
         const String& strInput,
         UnallocatedCString str_bookend = "-----BEGIN") -> bool;
 
+    /** level must be between 0 (no compression) and CompressSmallest */
+    auto SetStringCompressed(const String& theData, std::int32_t level)
+        -> bool;
+
     virtual auto GetData(Data& theData, bool bLineBreaks = true) const
         -> bool = 0;
     virtual auto GetString(String& theData, bool bLineBreaks = true) const
@@ -7,6 +7,8 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
+
 #include "opentxs/Types.hpp"
 #include "opentxs/interface/rpc/request/Base.hpp"
 #include "opentxs/util/Container.hpp"
@@ -33,12 +35,23 @@ public:
     static auto DefaultVersion() noexcept -> VersionNumber;
 
     auto Accounts() const noexcept -> const Identifiers&;
+    /// Position returned by a previous page, or empty for the first page
+    auto Cursor() const noexcept -> const UnallocatedCString&;
+    /// Maximum number of events to return, or zero for every event
+    auto Limit() const noexcept -> std::size_t;
 
     /// throws std::runtime_error for invalid constructor arguments
     GetAccountActivity(
         SessionIndex session,
         const Identifiers& accounts,
         const AssociateNyms& nyms = {}) noexcept(false);
+    /// throws std::runtime_error for invalid constructor arguments
+    GetAccountActivity(
+        SessionIndex session,
+        const UnallocatedCString& account,
+        std::size_t limit,
+        const UnallocatedCString& cursor = {},
+        const AssociateNyms& nyms = {}) noexcept(false);
     OPENTXS_NO_EXPORT GetAccountActivity(
         const proto::RPCCommand& serialized) noexcept(false);
     GetAccountActivity() noexcept;
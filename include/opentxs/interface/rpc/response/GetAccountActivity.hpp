@@ -43,12 +43,16 @@ public:
     using Events = UnallocatedVector<AccountEvent>;
 
     auto Activity() const noexcept -> const Events&;
+    /// Pass to a subsequent request for the next page, empty if there are no
+    /// more events
+    auto Cursor() const noexcept -> UnallocatedCString;
 
     /// throws std::runtime_error for invalid constructor arguments
     OPENTXS_NO_EXPORT GetAccountActivity(
         const request::GetAccountActivity& request,
         Responses&& response,
-        Events&& events) noexcept(false);
+        Events&& events,
+        const UnallocatedCString& cursor = {}) noexcept(false);
     OPENTXS_NO_EXPORT GetAccountActivity(
         const proto::RPCResponse& serialized) noexcept(false);
     GetAccountActivity() noexcept;
@@ -11,6 +11,8 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 
 #include "opentxs/Types.hpp"
@@ -96,7 +98,17 @@ public:
     template <typename T>
     auto operator()(const T& in) const noexcept -> const Log&
     {
-        return this->operator()(std::to_string(in));
+        // NOTE arithmetic values are stored as they are and converted to text
+        // later by the log consumer thread
+        if constexpr (std::is_floating_point_v<T>) {
+            return floating_point(static_cast<double>(in));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return signed_integer(static_cast<std::int64_t>(in));
+        } else if constexpr (std::is_integral_v<T>) {
+            return unsigned_integer(static_cast<std::uint64_t>(in));
+        } else {
+            return this->operator()(std::to_string(in));
+        }
     }
     OPENTXS_NO_EXPORT auto Internal() const noexcept -> const internal::Log&;
 
@@ -119,6 +131,11 @@ public:
 private:
     Imp* imp_;
 
+    auto floating_point(const double in) const noexcept -> const Log&;
+    auto signed_integer(const std::int64_t in) const noexcept -> const Log&;
+    auto unsigned_integer(const std::uint64_t in) const noexcept
+        -> const Log&;
+
     Log() = delete;
     Log(const Log&) = delete;
     Log(Log&&) = delete;
@@ -41,6 +41,7 @@ public:
     auto Ipv4ConnectionMode() const noexcept -> ConnectionMode;
     auto Ipv6ConnectionMode() const noexcept -> ConnectionMode;
     auto LogLevel() const noexcept -> int;
+    auto MetricsEndpoint() const noexcept -> const char*;
     auto NotaryBindIP() const noexcept -> const char*;
     auto NotaryBindPort() const noexcept -> std::uint16_t;
     auto NotaryInproc() const noexcept -> bool;
@@ -62,6 +63,8 @@ public:
     auto RemoteLogEndpoint() const noexcept -> const char*;
     auto StoragePrimaryPlugin() const noexcept -> const char*;
     auto TestMode() const noexcept -> bool;
+    /// Minimum number of milliseconds between notifications for one widget
+    auto UIUpdateInterval() const noexcept -> int;
 
     auto AddBlockchainIpv4Bind(const char* endpoint) noexcept -> Options&;
     auto AddBlockchainIpv6Bind(const char* endpoint) noexcept -> Options&;
@@ -84,6 +87,7 @@ public:
     auto SetIpv6ConnectionMode(ConnectionMode mode) noexcept -> Options&;
     auto SetLogEndpoint(const char* endpoint) noexcept -> Options&;
     auto SetLogLevel(int level) noexcept -> Options&;
+    auto SetMetricsEndpoint(const char* endpoint) noexcept -> Options&;
     auto SetNotaryBindIP(const char* value) noexcept -> Options&;
     auto SetNotaryBindPort(std::uint16_t port) noexcept -> Options&;
     auto SetNotaryInproc(bool inproc) noexcept -> Options&;
@@ -93,6 +97,7 @@ public:
     auto SetQtRootObject(QObject*) noexcept -> Options&;
     auto SetStoragePlugin(const char* name) noexcept -> Options&;
     auto SetTestMode(bool test) noexcept -> Options&;
+    auto SetUIUpdateInterval(int milliseconds) noexcept -> Options&;
 
     Options() noexcept;
     Options(int argc, char** argv) noexcept;
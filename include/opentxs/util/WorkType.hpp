@@ -28,6 +28,7 @@ enum class WorkType : OTZMQWorkType {
     WorkflowAccountUpdate = 10,
     MessageLoaded = 11,
     SeedUpdated = 12,
+    MetricsSnapshot = 13,
     BlockchainAccountCreated = 128,
     BlockchainBalance = 129,
     BlockchainNewHeader = 130,
@@ -142,6 +143,10 @@ constexpr auto value(const WorkType in) noexcept
  *       * Additional frames:
  *          1: seed id as Identifier (encoded as byte sequence)
  *
+ *   MetricsSnapshot: periodic copy of the process metrics registry
+ *       * Additional frames:
+ *          1: metrics in Prometheus text exposition format as string
+ *
  *   BlockchainAccountCreated: reports the creation of a new blockchain account
  *       * Additional frames:
  *          1: chain type as blockchain::Type
@@ -7,6 +7,7 @@
 
 #include "Proto.hpp"  // IWYU pragma: associated
 
+#include <google/protobuf/arena.h>
 #include <cassert>
 #include <cstddef>
 #include <iostream>
@@ -85,6 +86,55 @@ std::unique_ptr<Output> DynamicFactory(const Input& input)
     return DynamicFactory<Output>(input.data(), input.size());
 }
 
+/** Parse a message which is owned by the supplied arena
+ *
+ *  The message and all of its submessages and strings are allocated from the
+ *  arena and released together when the arena is destroyed. Use this for
+ *  messages which are decoded, inspected and discarded on hot paths.
+ */
+template <typename Output>
+Output& ArenaFactory(
+    google::protobuf::Arena& arena,
+    const void* input,
+    const std::size_t size)
+{
+    static_assert(sizeof(int) <= sizeof(std::size_t));
+    assert(size <= static_cast<std::size_t>(std::numeric_limits<int>::max()));
+
+    auto* output = google::protobuf::Arena::CreateMessage<Output>(&arena);
+
+    assert(nullptr != output);
+
+    output->ParseFromArray(input, static_cast<int>(size));
+
+    return *output;
+}
+
+template <typename Output, typename Input>
+Output& ArenaFactory(google::protobuf::Arena& arena, const Input& input)
+{
+    return ArenaFactory<Output>(arena, input.data(), input.size());
+}
+
+/// Equivalent to DynamicFactory except that the message is allocated from an
+/// arena which lives as long as the returned pointer
+template <typename Output>
+std::shared_ptr<Output> SharedArenaFactory(
+    const void* input,
+    const std::size_t size)
+{
+    if (std::numeric_limits<int>::max() < size) {
+        std::cerr << __func__ << ": input too large\n";
+
+        return {};
+    }
+
+    auto arena = std::make_shared<google::protobuf::Arena>();
+    auto& output = ArenaFactory<Output>(*arena, input, size);
+
+    return {arena, &output};
+}
+
 template <typename Output>
 Output StringToProto(const String& input)
 {
@@ -39,7 +39,7 @@ auto Log(const zmq::Context& zmq, const UnallocatedCString& endpoint) noexcept
     -> std::unique_ptr<api::internal::Log>
 {
     using ReturnType = api::imp::Log;
-    internal::Log::Start();
+    internal::Log::Start(zmq);
 
     return std::make_unique<ReturnType>(zmq, endpoint);
 }
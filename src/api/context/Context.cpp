@@ -49,6 +49,9 @@
 #include "opentxs/util/PasswordCallback.hpp"
 #include "opentxs/util/PasswordCaller.hpp"
 #include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/WorkType.hpp"
+#include "util/Metrics.hpp"
+#include "util/Work.hpp"
 
 namespace opentxs::factory
 {
@@ -94,6 +97,7 @@ Context::Context(
     , zmq_context_(opentxs::factory::ZMQContext())
     , signal_handler_(nullptr)
     , log_(factory::Log(*zmq_context_, args_.RemoteLogEndpoint()))
+    , metrics_(zmq_context_->PublishSocket())
     , asio_()
     , crypto_(nullptr)
     , factory_(nullptr)
@@ -185,6 +189,7 @@ auto Context::ProfileId() const noexcept -> UnallocatedCString
 auto Context::Init() noexcept -> void
 {
     Init_Log();
+    Init_Metrics();
     Init_Asio();
     init_pid();
     Init_Crypto();
@@ -271,6 +276,33 @@ auto Context::Init_Log() -> void
     opentxs::internal::Log::SetVerbosity(static_cast<int>(level));
 }
 
+auto Context::Init_Metrics() -> void
+{
+    const auto endpoint = UnallocatedCString{args_.MetricsEndpoint()};
+
+    if (endpoint.empty()) { return; }
+
+    if (false == metrics_->Start(endpoint)) {
+        LogError()(OT_PRETTY_CLASS())("failed to bind metrics endpoint ")(
+            endpoint)
+            .Flush();
+
+        return;
+    }
+
+    Schedule(
+        metrics_interval_,
+        [this]() -> void {
+            metrics_->Send([&] {
+                auto out = MakeWork(WorkType::MetricsSnapshot);
+                out.AddFrame(Metrics());
+
+                return out;
+            }());
+        },
+        std::chrono::seconds{0});
+}
+
 auto Context::init_pid() const -> void
 {
     try {
@@ -301,6 +333,11 @@ auto Context::Init_Zap() -> void
     OT_ASSERT(zap_);
 }
 
+auto Context::Metrics() const noexcept -> UnallocatedCString
+{
+    return metrics::Get().Prometheus();
+}
+
 auto Context::NotarySession(const int instance) const -> const session::Notary&
 {
     auto& output = server_.at(instance);
@@ -33,6 +33,7 @@
 #include "opentxs/interface/rpc/request/Base.hpp"
 #include "opentxs/interface/rpc/response/Base.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Options.hpp"
@@ -114,6 +115,7 @@ public:
     {
         return *legacy_;
     }
+    auto Metrics() const noexcept -> UnallocatedCString final;
     auto NotarySession(const int instance) const noexcept(false)
         -> const api::session::Notary& final;
     auto NotarySessionCount() const noexcept -> std::size_t final
@@ -159,6 +161,8 @@ private:
     using ConfigMap =
         UnallocatedMap<UnallocatedCString, std::unique_ptr<api::Settings>>;
 
+    static constexpr auto metrics_interval_ = std::chrono::seconds{10};
+
     const Options args_;
     const UnallocatedCString home_;
     mutable std::mutex config_lock_;
@@ -168,6 +172,7 @@ private:
     std::unique_ptr<opentxs::network::zeromq::Context> zmq_context_;
     mutable std::unique_ptr<Signals> signal_handler_;
     std::unique_ptr<api::internal::Log> log_;
+    OTZMQPublishSocket metrics_;
     std::unique_ptr<network::Asio> asio_;
     std::unique_ptr<api::Crypto> crypto_;
     std::unique_ptr<api::Factory> factory_;
@@ -196,6 +201,7 @@ private:
     auto Init_Crypto() -> void;
     auto Init_Factory() -> void;
     auto Init_Log() -> void;
+    auto Init_Metrics() -> void;
     auto Init_Rlimit() noexcept -> void;
     auto Init_Profile() -> void;
     auto Init_Zap() -> void;
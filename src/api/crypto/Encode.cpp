@@ -8,15 +8,14 @@
 #include "api/crypto/Encode.hpp"  // IWYU pragma: associated
 
 #include <cstddef>
-#include <limits>
 #include <memory>
 #include <regex>
 #include <sstream>
 #include <string_view>
 
 #include "base58/base58.h"
-#include "base64/base64.h"
 #include "internal/api/crypto/Factory.hpp"
+#include "internal/util/Base64.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
@@ -57,26 +56,21 @@ auto Encode::Base64Encode(
     const std::size_t& size) const -> UnallocatedCString
 {
     auto output = UnallocatedCString{};
+    output.resize(base64::EncodedSize(size, base64::line_width_));
+    const auto written = base64::Encode(
+        {reinterpret_cast<const char*>(inputStart), size},
+        output.data(),
+        base64::line_width_);
 
-    if (std::numeric_limits<int>::max() < size) { return {}; }
+    OT_ASSERT(written == output.size());
 
-    const auto bytes = static_cast<int>(size);
-    output.resize(::Base64encode_len(bytes));
-    ::Base64encode(
-        const_cast<char*>(output.data()),
-        reinterpret_cast<const char*>(inputStart),
-        bytes);
-
-    return BreakLines(output);
+    return output;
 }
 
-auto Encode::Base64Decode(const UnallocatedCString&& input, RawData& output)
-    const -> bool
+auto Encode::Base64Decode(const ReadView input, RawData& output) const -> bool
 {
-    output.resize(::Base64decode_len(input.data()), 0x0);
-
-    const size_t decoded =
-        ::Base64decode(reinterpret_cast<char*>(output.data()), input.data());
+    output.resize(base64::DecodedSize(input.size()));
+    const auto decoded = base64::Decode(input, output.data());
 
     if (0 == decoded) { return false; }
 
@@ -87,29 +81,6 @@ auto Encode::Base64Decode(const UnallocatedCString&& input, RawData& output)
     return true;
 }
 
-auto Encode::BreakLines(const UnallocatedCString& input) const
-    -> UnallocatedCString
-{
-    UnallocatedCString output;
-
-    if (0 == input.size()) { return output; }
-
-    std::size_t width = 0;
-
-    for (auto& character : input) {
-        output.push_back(character);
-
-        if (++width >= LineWidth) {
-            output.push_back('\n');
-            width = 0;
-        }
-    }
-
-    if ('\n' != output.back()) { output.push_back('\n'); }
-
-    return output;
-}
-
 auto Encode::DataEncode(const UnallocatedCString& input) const
     -> UnallocatedCString
 {
@@ -128,7 +99,7 @@ auto Encode::DataDecode(const UnallocatedCString& input) const
 {
     RawData decoded;
 
-    if (Base64Decode(SanatizeBase64(input), decoded)) {
+    if (Base64Decode(input, decoded)) {
 
         return UnallocatedCString(
             reinterpret_cast<const char*>(decoded.data()), decoded.size());
@@ -14,6 +14,7 @@
 #include "opentxs/api/crypto/Encode.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -71,17 +72,12 @@ public:
     ~Encode() final = default;
 
 private:
-    static const std::uint8_t LineWidth{72};
-
     const api::Crypto& crypto_;
 
     auto Base64Encode(
         const std::uint8_t* inputStart,
         const std::size_t& inputSize) const -> UnallocatedCString;
-    auto Base64Decode(const UnallocatedCString&& input, RawData& output) const
-        -> bool;
-    auto BreakLines(const UnallocatedCString& input) const
-        -> UnallocatedCString;
+    auto Base64Decode(const ReadView input, RawData& output) const -> bool;
     auto IdentifierEncode(const Secret& input) const -> UnallocatedCString;
     auto IdentifierEncode(const void* data, const std::size_t size) const
         -> UnallocatedCString;
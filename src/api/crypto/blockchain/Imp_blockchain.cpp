@@ -242,7 +242,7 @@ auto BlockchainImp::broadcast_update_signal(
         std::begin(transactions),
         std::end(transactions),
         [this, &db](const auto& txid) {
-            const auto tx = db.LoadTransaction(txid->Bytes());
+            const auto tx = db.LoadTransactionShared(txid->Bytes());
 
             OT_ASSERT(tx);
 
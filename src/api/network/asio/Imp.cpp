@@ -75,14 +75,7 @@ Asio::Imp::Imp(const zmq::Context& zmq) noexcept
     , buffers_()
     , lock_()
     , io_context_()
-    , thread_pools_([] {
-        auto out = UnallocatedMap<ThreadPool, asio::Context>{};
-        out[ThreadPool::General];
-        out[ThreadPool::Storage];
-        out[ThreadPool::Blockchain];
-
-        return out;
-    }())
+    , executor_()
     , acceptors_(*this, io_context_)
     , notify_()
     , ipv4_promise_()
@@ -241,15 +234,12 @@ auto Asio::Imp::Init() noexcept -> void
         std::max<unsigned int>(std::thread::hardware_concurrency(), 1u);
     io_context_.Init(
         std::max<unsigned int>(threads / 8u, 1u), ThreadPriority::Normal);
-    thread_pools_.at(ThreadPool::General)
-        .Init(
-            std::max<unsigned int>(threads - 1u, 1u),
-            ThreadPriority::AboveNormal);
-    thread_pools_.at(ThreadPool::Storage)
-        .Init(
-            std::max<unsigned int>(threads / 4u, 2u), ThreadPriority::Highest);
-    thread_pools_.at(ThreadPool::Blockchain)
-        .Init(std::max<unsigned int>(threads, 1u), ThreadPriority::Lowest);
+    // NOTE storage jobs are high priority and general jobs often block while
+    // waiting for them, so some workers are reserved for high priority jobs
+    // in order to keep the normal and low priority jobs from starving them
+    const auto reserved = std::max<unsigned int>(threads / 4u, 2u);
+    executor_ =
+        std::make_unique<Executor>("asio", threads + reserved, reserved);
 }
 
 auto Asio::Imp::NotificationEndpoint() const noexcept -> const char*
@@ -263,20 +253,42 @@ auto Asio::Imp::Post(ThreadPool type, Asio::Callback cb) noexcept -> bool
 
     if (shutdown()) { return false; }
 
-    auto& pool = [&]() -> auto&
-    {
-        if (ThreadPool::Network == type) {
+    switch (type) {
+        case ThreadPool::Network: {
+            boost::asio::post(io_context_.get(), std::move(cb));
 
-            return io_context_;
-        } else {
+            return true;
+        }
+        case ThreadPool::Storage: {
+
+            return post(Executor::Priority::High, std::move(cb));
+        }
+        case ThreadPool::General: {
+
+            return post(Executor::Priority::Normal, std::move(cb));
+        }
+        case ThreadPool::Blockchain: {
+
+            return post(Executor::Priority::Low, std::move(cb));
+        }
+        default: {
+            LogError()(OT_PRETTY_CLASS())("invalid thread pool").Flush();
 
-            return thread_pools_.at(type);
+            return false;
         }
     }
-    ();
-    boost::asio::post(pool.get(), std::move(cb));
+}
 
-    return true;
+auto Asio::Imp::post(Executor::Priority priority, Asio::Callback cb) noexcept
+    -> bool
+{
+    if (false == bool(executor_)) {
+        LogError()(OT_PRETTY_CLASS())("executor is not initialized").Flush();
+
+        return false;
+    }
+
+    return executor_->Post(priority, std::move(cb));
 }
 
 auto Asio::Imp::process_address_query(
@@ -578,14 +590,14 @@ auto Asio::Imp::Shutdown() noexcept -> void
 {
     Stop().get();
 
+    // NOTE queued jobs are executed before the executor stops and they must
+    // be able to call Post without blocking on lock_
+    if (executor_) { executor_->Stop(); }
+
     {
         auto lock = eLock{lock_};
         acceptors_.Stop();
         io_context_.Stop();
-
-        for (auto& [type, pool] : thread_pools_) { pool.Stop(); }
-
-        thread_pools_.clear();
         data_socket_->Close();
     }
 }
@@ -42,6 +42,7 @@
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/Executor.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace boost
@@ -166,7 +167,7 @@ private:
     asio::Buffers buffers_;
     mutable std::shared_mutex lock_;
     mutable asio::Context io_context_;
-    mutable UnallocatedMap<ThreadPool, asio::Context> thread_pools_;
+    std::unique_ptr<Executor> executor_;
     mutable asio::Acceptors acceptors_;
     mutable NotificationMap notify_;
     std::promise<OTData> ipv4_promise_;
@@ -174,6 +175,8 @@ private:
     std::shared_future<OTData> ipv4_future_;
     std::shared_future<OTData> ipv6_future_;
 
+    auto post(Executor::Priority priority, Asio::Callback cb) noexcept
+        -> bool;
     auto process_address_query(
         const ResponseType type,
         std::shared_ptr<std::promise<OTData>> promise,
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <ctime>
 #include <iterator>
 #include <utility>
 
@@ -34,6 +35,7 @@
 #include "opentxs/util/Options.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/MappedFileStorage.hpp"
 #include "util/Work.hpp"
 
 namespace opentxs::api::network
@@ -131,6 +133,8 @@ BlockchainImp::BlockchainImp(
     , init_promise_()
     , init_(init_promise_.get_future())
     , running_(true)
+    , compaction_(std::make_shared<Compaction>())
+    , compaction_task_(-1)
 {
 }
 
@@ -162,6 +166,24 @@ auto BlockchainImp::Disable(const Chain type) const noexcept -> bool
     return disable(lock, type);
 }
 
+auto BlockchainImp::compact(Compaction& state) noexcept -> void
+{
+    auto lock = Lock{state.lock_};
+
+    if (nullptr == state.db_) { return; }
+
+    const auto report = state.db_->CompactStorage(compaction_budget_);
+
+    if (false == report.has_value()) { return; }
+
+    LogDetail()("Compacted blockchain storage: relocated ")(
+        report->relocated_bytes_)(" bytes, trimmed ")(report->trimmed_bytes_)(
+        " bytes, reclaimed ")(report->reclaimed_bytes_)(
+        " bytes, fragmentation ")(report->FragmentationBefore())(" -> ")(
+        report->FragmentationAfter())
+        .Flush();
+}
+
 auto BlockchainImp::disable(const Lock& lock, const Chain type) const noexcept
     -> bool
 {
@@ -286,6 +308,11 @@ auto BlockchainImp::Init(
 
     OT_ASSERT(db_);
 
+    compaction_->db_ = db_.get();
+    compaction_task_ = api_.Schedule(
+        compaction_interval_,
+        [state = compaction_] { compact(*state); },
+        std::chrono::seconds{std::time(nullptr)});
     const_cast<std::unique_ptr<Config>&>(base_config_) = [&] {
         auto out = std::make_unique<Config>();
         auto& output = *out;
@@ -424,6 +451,16 @@ auto BlockchainImp::Shutdown() noexcept -> void
         networks_.clear();
     }
 
+    if (0 <= compaction_task_) {
+        api_.Cancel(compaction_task_);
+        compaction_task_ = -1;
+    }
+
+    {
+        auto lock = Lock{compaction_->lock_};
+        compaction_->db_ = nullptr;
+    }
+
     Imp::Shutdown();
 }
 
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <memory>
@@ -191,6 +193,17 @@ private:
     using pNode = std::unique_ptr<opentxs::blockchain::node::internal::Network>;
     using Chains = UnallocatedVector<Chain>;
 
+    // NOTE shared with the periodic task which compacts the bulk storage files
+    // since a run may still be in progress after the task has been cancelled
+    struct Compaction {
+        std::mutex lock_{};
+        const opentxs::blockchain::database::common::Database* db_{};
+    };
+
+    static constexpr auto compaction_budget_ =
+        std::size_t{64u * 1024u * 1024u};
+    static constexpr auto compaction_interval_ = std::chrono::hours{24};
+
     const api::Session& api_;
     const api::crypto::Blockchain* crypto_;
     std::unique_ptr<opentxs::blockchain::database::common::Database> db_;
@@ -213,6 +226,10 @@ private:
     std::promise<void> init_promise_;
     std::shared_future<void> init_;
     std::atomic_bool running_;
+    std::shared_ptr<Compaction> compaction_;
+    int compaction_task_;
+
+    static auto compact(Compaction& state) noexcept -> void;
 
     auto disable(const Lock& lock, const Chain type) const noexcept -> bool;
     auto enable(
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <chrono>
 #include <ctime>
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <string_view>
@@ -129,15 +130,8 @@
     }
 
 #define SHUTDOWN_OTX()                                                         \
-    {                                                                          \
-        YIELD_OTX(50);                                                         \
-    }
-
-#define YIELD_OTX(a)                                                           \
     {                                                                          \
         if (!running_) { return false; }                                       \
-                                                                               \
-        Sleep(std::chrono::milliseconds(a));                                   \
     }
 
 #define CONTACT_REFRESH_DAYS 1
@@ -811,16 +805,13 @@ auto OTX::CheckTransactionNumbers(
 
         if (0 == taskID) { return false; }
 
-        auto status = Status(taskID);
+        const auto& future = output.second;
 
-        while (ThreadStatus::RUNNING == status) {
-            Sleep(100ms);
-            status = Status(taskID);
+        while (std::future_status::ready != future.wait_for(100ms)) {
+            if (!running_) { return false; }
         }
 
-        if (ThreadStatus::FINISHED_SUCCESS == status) { return true; }
-
-        return false;
+        return ThreadStatus::FINISHED_SUCCESS == Status(taskID);
     } catch (...) {
 
         return false;
@@ -1646,19 +1637,33 @@ void OTX::process_notification(const zmq::Message& message) const
         return;
     }
 
-    auto context = api_.Wallet().Internal().mutable_ServerContext(
-        nymID, serverID, reason_);
+    {
+        auto context = api_.Wallet().Internal().mutable_ServerContext(
+            nymID, serverID, reason_);
 
-    switch (notification->Type()) {
-        case otx::ServerReplyType::Push: {
-            context.get().ProcessNotification(api_, notification, reason_);
-        } break;
-        default: {
-            LogError()(OT_PRETTY_CLASS())(": Unsupported server reply type: ")(
-                value(notification->Type()))(".")
-                .Flush();
+        switch (notification->Type()) {
+            case otx::ServerReplyType::Push: {
+                context.get().ProcessNotification(api_, notification, reason_);
+            } break;
+            default: {
+                LogError()(OT_PRETTY_CLASS())(
+                    ": Unsupported server reply type: ")(
+                    value(notification->Type()))(".")
+                    .Flush();
+
+                return;
+            }
         }
     }
+
+    if (shutdown_.load()) { return; }
+
+    // Tasks which are waiting on the new box item can proceed now instead of
+    // at the next refresh
+    try {
+        get_operations({nymID, serverID}).Trigger();
+    } catch (...) {
+    }
 }
 
 auto OTX::publish_messagability(
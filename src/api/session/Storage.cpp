@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"           // IWYU pragma: associated
 #include "api/session/Storage.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <functional>
@@ -35,6 +36,7 @@
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "otx/common/OTStorage.hpp"
+#include "serialization/protobuf/AccountEvent.pb.h"
 #include "serialization/protobuf/Bip47Channel.pb.h"
 #include "serialization/protobuf/Ciphertext.pb.h"
 #include "serialization/protobuf/Contact.pb.h"
@@ -53,6 +55,7 @@
 #include "serialization/protobuf/StorageThreadItem.pb.h"
 #include "serialization/protobuf/UnitDefinition.pb.h"
 #include "util/storage/Config.hpp"
+#include "util/storage/tree/AccountEvents.hpp"
 #include "util/storage/tree/Accounts.hpp"
 #include "util/storage/tree/Bip47Channels.hpp"
 #include "util/storage/tree/Contacts.hpp"
@@ -131,6 +134,29 @@ auto Storage::AccountAlias(const Identifier& accountID) const
     return Root().Tree().Accounts().Alias(accountID.str());
 }
 
+auto Storage::AccountEvents(
+    const UnallocatedCString& nymID,
+    const UnallocatedCString& accountID,
+    const UnallocatedCString& cursor,
+    const std::size_t limit,
+    UnallocatedVector<proto::AccountEvent>& events,
+    UnallocatedCString& next,
+    bool& indexed) const noexcept -> bool
+{
+    events.clear();
+    next.clear();
+    indexed = false;
+
+    if (false == Root().Tree().Nyms().Exists(nymID)) {
+        LogError()(OT_PRETTY_CLASS())("Nym ")(nymID)(" doesn't exist.").Flush();
+
+        return true;
+    }
+
+    return Root().Tree().Nyms().Nym(nymID).AccountEvents().Page(
+        accountID, cursor, limit, events, next, indexed);
+}
+
 auto Storage::AccountList() const -> ObjectList
 {
     return Root().Tree().Accounts().List();
@@ -1595,6 +1621,29 @@ auto Storage::SetAccountAlias(
         .SetAlias(id, alias);
 }
 
+auto Storage::SetAccountEventsIndexed(
+    const UnallocatedCString& nymID,
+    const UnallocatedCString& accountID) const noexcept -> bool
+{
+    if (false == Root().Tree().Nyms().Exists(nymID)) {
+        LogError()(OT_PRETTY_CLASS())("Nym ")(nymID)(" doesn't exist.").Flush();
+
+        return false;
+    }
+
+    return mutable_Root()
+        .get()
+        .mutable_Tree()
+        .get()
+        .mutable_Nyms()
+        .get()
+        .mutable_Nym(nymID)
+        .get()
+        .mutable_AccountEvents()
+        .get()
+        .SetIndexed(accountID);
+}
+
 auto Storage::SetContactAlias(
     const UnallocatedCString& id,
     const UnallocatedCString& alias) const -> bool
@@ -2269,6 +2318,32 @@ auto Storage::Store(
     return false;
 }
 
+auto Storage::StoreAccountEvents(
+    const UnallocatedCString& nymID,
+    const UnallocatedCString& accountID,
+    const UnallocatedCString& source,
+    const UnallocatedVector<proto::AccountEvent>& events) const noexcept
+    -> bool
+{
+    if (false == Root().Tree().Nyms().Exists(nymID)) {
+        LogError()(OT_PRETTY_CLASS())("Nym ")(nymID)(" doesn't exist.").Flush();
+
+        return false;
+    }
+
+    return mutable_Root()
+        .get()
+        .mutable_Tree()
+        .get()
+        .mutable_Nyms()
+        .get()
+        .mutable_Nym(nymID)
+        .get()
+        .mutable_AccountEvents()
+        .get()
+        .Store(accountID, source, events);
+}
+
 auto Storage::ThreadList(const UnallocatedCString& nymID, const bool unreadOnly)
     const -> ObjectList
 {
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <iosfwd>
@@ -79,6 +80,7 @@ class UnitDefinition;
 
 namespace proto
 {
+class AccountEvent;
 class Bip47Channel;
 class Ciphertext;
 class Contact;
@@ -145,6 +147,14 @@ class Storage final : public internal::Storage
 public:
     auto AccountAlias(const Identifier& accountID) const
         -> UnallocatedCString final;
+    auto AccountEvents(
+        const UnallocatedCString& nymID,
+        const UnallocatedCString& accountID,
+        const UnallocatedCString& cursor,
+        const std::size_t limit,
+        UnallocatedVector<proto::AccountEvent>& events,
+        UnallocatedCString& next,
+        bool& indexed) const noexcept -> bool final;
     auto AccountList() const -> ObjectList final;
     auto AccountContract(const Identifier& accountID) const -> OTUnitID final;
     auto AccountIssuer(const Identifier& accountID) const -> OTNymID final;
@@ -390,6 +400,9 @@ public:
     auto SetAccountAlias(
         const UnallocatedCString& id,
         const UnallocatedCString& alias) const -> bool final;
+    auto SetAccountEventsIndexed(
+        const UnallocatedCString& nymID,
+        const UnallocatedCString& accountID) const noexcept -> bool final;
     auto SetContactAlias(
         const UnallocatedCString& id,
         const UnallocatedCString& alias) const -> bool final;
@@ -482,6 +495,12 @@ public:
     auto Store(
         const proto::UnitDefinition& data,
         const UnallocatedCString& alias = {}) const -> bool final;
+    auto StoreAccountEvents(
+        const UnallocatedCString& nymID,
+        const UnallocatedCString& accountID,
+        const UnallocatedCString& source,
+        const UnallocatedVector<proto::AccountEvent>& events) const noexcept
+        -> bool final;
     auto ThreadList(const UnallocatedCString& nymID, const bool unreadOnly)
         const -> ObjectList final;
     auto ThreadAlias(
@@ -25,6 +25,7 @@
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/api/session/Session.hpp"
 #include "internal/core/Core.hpp"
+#include "internal/core/identifier/Fixed.hpp"
 #include "internal/identity/Identity.hpp"
 #include "internal/network/p2p/Factory.hpp"
 #include "internal/network/p2p/Types.hpp"
@@ -137,6 +138,8 @@ Wallet::Wallet(const api::Session& api)
     , nymfile_lock_()
     , purse_lock_()
     , purse_map_()
+    , verified_credentials_lock_()
+    , verified_credentials_()
     , account_publisher_(api_.Network().ZeroMQ().PublishSocket())
     , issuer_publisher_(api_.Network().ZeroMQ().PublishSocket())
     , nym_publisher_(api_.Network().ZeroMQ().PublishSocket())
@@ -235,7 +238,7 @@ auto Wallet::account(
 {
     OT_ASSERT(CheckLock(lock, account_map_lock_))
 
-    auto& row = account_map_[account];
+    auto& row = account_map_[identifier::Fixed{account}];
     auto& [rowMutex, pAccount] = row;
 
     if (pAccount) {
@@ -440,6 +443,18 @@ auto Wallet::AccountPartialMatch(const UnallocatedCString& hint) const
     return Identifier::Factory();
 }
 
+auto Wallet::AddVerifiedCredential(const Identifier& hash) const noexcept
+    -> void
+{
+    Lock lock(verified_credentials_lock_);
+
+    if (verified_credentials_.size() >= verified_credentials_limit_) {
+        verified_credentials_.clear();
+    }
+
+    verified_credentials_.emplace(hash);
+}
+
 auto Wallet::BasketContract(
     const identifier::UnitDefinition& id,
     const std::chrono::milliseconds& timeout) const noexcept(false)
@@ -572,6 +587,14 @@ auto Wallet::DeleteAccount(const Identifier& accountID) const -> bool
     return false;
 }
 
+auto Wallet::IsVerifiedCredential(const Identifier& hash) const noexcept
+    -> bool
+{
+    Lock lock(verified_credentials_lock_);
+
+    return 0 < verified_credentials_.count(hash);
+}
+
 auto Wallet::IssuerAccount(const identifier::UnitDefinition& unitID) const
     -> SharedAccount
 {
@@ -1104,8 +1127,9 @@ auto Wallet::Nym(
         return nullptr;
     }
 
+    const auto key = identifier::Fixed{id};
     auto mapLock = Lock{nym_map_lock_};
-    bool inMap = (nym_map_.find(id) != nym_map_.end());
+    bool inMap = (nym_map_.find(key) != nym_map_.end());
     bool valid = false;
 
     if (!inMap) {
@@ -1114,14 +1138,14 @@ auto Wallet::Nym(
         bool loaded = api_.Storage().Load(id, serialized, alias, true);
 
         if (loaded) {
-            auto& pNym = nym_map_[id].second;
+            auto& pNym = nym_map_[key].second;
             pNym.reset(opentxs::Factory::Nym(api_, serialized, alias));
 
             if (pNym && pNym->CompareID(id)) {
                 valid = pNym->VerifyPseudonym();
                 pNym->SetAliasStartup(alias);
             } else {
-                nym_map_.erase(id);
+                nym_map_.erase(key);
             }
         } else {
             search_nym(id);
@@ -1135,7 +1159,7 @@ auto Wallet::Nym(
                 while (std::chrono::high_resolution_clock::now() < end) {
                     std::this_thread::sleep_for(interval);
                     mapLock.lock();
-                    bool found = (nym_map_.find(id) != nym_map_.end());
+                    bool found = (nym_map_.find(key) != nym_map_.end());
                     mapLock.unlock();
 
                     if (found) { break; }
@@ -1146,11 +1170,11 @@ auto Wallet::Nym(
             }
         }
     } else {
-        auto& pNym = nym_map_[id].second;
+        auto& pNym = nym_map_[key].second;
         if (pNym) { valid = pNym->VerifyPseudonym(); }
     }
 
-    if (valid) { return nym_map_[id].second; }
+    if (valid) { return nym_map_[key].second; }
 
     return nullptr;
 }
@@ -1189,7 +1213,7 @@ auto Wallet::Nym(const proto::Nym& serialized) const -> Nym_p
             candidate.WriteCredentials();
             SaveCredentialIDs(candidate);
             auto mapLock = Lock{nym_map_lock_};
-            auto& mapNym = nym_map_[nymID].second;
+            auto& mapNym = nym_map_[identifier::Fixed{nymID}].second;
             // TODO update existing nym rather than destroying it
             mapNym.reset(pCandidate.release());
             notify_new(nymID);
@@ -1255,7 +1279,7 @@ auto Wallet::Nym(
 
         {
             auto mapLock = Lock{nym_map_lock_};
-            auto it = nym_map_.find(id);
+            auto it = nym_map_.find(identifier::Fixed{id});
 
             if (nym_map_.end() != it) { return it->second.second; }
         }
@@ -1278,7 +1302,7 @@ auto Wallet::Nym(
 
             {
                 auto mapLock = Lock{nym_map_lock_};
-                auto& pMapNym = nym_map_[id].second;
+                auto& pMapNym = nym_map_[identifier::Fixed{id}].second;
                 pMapNym = pNym;
                 nym_created_publisher_->Send([&] {
                     auto work = opentxs::network::zeromq::tagged_message(
@@ -1313,7 +1337,7 @@ auto Wallet::mutable_Nym(
     }
 
     auto mapLock = Lock{nym_map_lock_};
-    auto it = nym_map_.find(id);
+    auto it = nym_map_.find(identifier::Fixed{id});
 
     if (nym_map_.end() == it) { OT_FAIL }
 
@@ -2730,7 +2754,7 @@ auto Wallet::SetNymAlias(
     const UnallocatedCString& alias) const -> bool
 {
     auto mapLock = Lock{nym_map_lock_};
-    auto& nym = nym_map_[id].second;
+    auto& nym = nym_map_[identifier::Fixed{id}].second;
     nym->SetAlias(alias);
 
     return api_.Storage().SetNymAlias(id, alias);
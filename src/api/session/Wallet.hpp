@@ -10,6 +10,7 @@
 
 #include <cs_deferred_guarded.h>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <functional>
@@ -23,6 +24,7 @@
 
 #include "Proto.hpp"
 #include "internal/api/session/Wallet.hpp"
+#include "internal/core/identifier/Fixed.hpp"
 #include "internal/identity/Identity.hpp"
 #include "internal/network/zeromq/Handle.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
@@ -156,6 +158,8 @@ class Wallet : virtual public internal::Wallet, public Lockable
 {
 public:
     auto Account(const Identifier& accountID) const -> SharedAccount final;
+    auto AddVerifiedCredential(const Identifier& hash) const noexcept
+        -> void final;
     auto AccountPartialMatch(const UnallocatedCString& hint) const
         -> OTIdentifier final;
     auto CreateAccount(
@@ -170,6 +174,8 @@ public:
     auto DeleteAccount(const Identifier& accountID) const -> bool final;
     auto IssuerAccount(const identifier::UnitDefinition& unitID) const
         -> SharedAccount final;
+    auto IsVerifiedCredential(const Identifier& hash) const noexcept
+        -> bool final;
     auto mutable_Account(
         const Identifier& accountID,
         const PasswordPrompt& reason,
@@ -452,10 +458,10 @@ protected:
     Wallet(const api::Session& api);
 
 private:
-    using AccountMap = UnallocatedMap<OTIdentifier, AccountLock>;
+    using AccountMap = identifier::FixedNodeMap<AccountLock>;
     using NymLock =
         std::pair<std::mutex, std::shared_ptr<identity::internal::Nym>>;
-    using NymMap = UnallocatedMap<OTNymID, NymLock>;
+    using NymMap = identifier::FixedNodeMap<NymLock>;
     using ServerMap =
         UnallocatedMap<OTNotaryID, std::shared_ptr<contract::Server>>;
     using UnitMap = UnallocatedMap<OTUnitID, std::shared_ptr<contract::Unit>>;
@@ -475,6 +481,10 @@ private:
         opentxs::network::zeromq::socket::Raw,
         std::shared_mutex>;
 
+    // Bounds the memory used by the verified credential cache. Reaching the
+    // limit empties the cache.
+    static constexpr auto verified_credentials_limit_ = std::size_t{65536};
+
     mutable AccountMap account_map_;
     mutable NymMap nym_map_;
     mutable ServerMap server_map_;
@@ -492,6 +502,8 @@ private:
     mutable UnallocatedMap<OTIdentifier, std::mutex> nymfile_lock_;
     mutable std::mutex purse_lock_;
     mutable PurseMap purse_map_;
+    mutable std::mutex verified_credentials_lock_;
+    mutable UnallocatedSet<OTIdentifier> verified_credentials_;
     OTZMQPublishSocket account_publisher_;
     OTZMQPublishSocket issuer_publisher_;
     OTZMQPublishSocket nym_publisher_;
@@ -19,6 +19,7 @@
 #include "Proto.tpp"
 #include "internal/api/session/Factory.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
+#include "internal/api/session/Storage.hpp"
 #include "internal/api/session/Types.hpp"
 #include "internal/network/zeromq/message/Message.hpp"
 #include "internal/otx/Types.hpp"
@@ -27,6 +28,7 @@
 #include "internal/otx/common/Message.hpp"
 #include "internal/otx/common/OTTransaction.hpp"
 #include "internal/serialization/protobuf/Check.hpp"
+#include "internal/serialization/protobuf/verify/AccountEvent.hpp"
 #include "internal/serialization/protobuf/verify/PaymentWorkflow.hpp"
 #include "internal/serialization/protobuf/verify/RPCPush.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -37,9 +39,12 @@
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/api/session/Storage.hpp"
+#include "opentxs/api/session/Wallet.hpp"
 #include "opentxs/api/session/Workflow.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/core/contract/Unit.hpp"
+#include "opentxs/core/display/Definition.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
@@ -68,6 +73,7 @@
 #include "serialization/protobuf/RPCPush.pb.h"
 
 #define RPC_ACCOUNT_EVENT_VERSION 1
+#define INDEXED_ACCOUNT_EVENT_VERSION 2
 #define RPC_PUSH_VERSION 1
 
 namespace zmq = opentxs::network::zeromq;
@@ -1952,6 +1958,92 @@ auto Workflow::ExportCheque(const opentxs::Cheque& cheque) const -> bool
     return save_workflow(nymID, cheque.GetSenderAcctID(), *workflow);
 }
 
+// NOTE produces the same rows as the custodial account activity widget
+auto Workflow::extract_account_events(const proto::PaymentWorkflow& workflow)
+    -> UnallocatedVector<std::pair<proto::PaymentEventType, Time>>
+{
+    using Key = std::pair<PaymentWorkflowType, PaymentWorkflowState>;
+    using Type = PaymentWorkflowType;
+    using State = PaymentWorkflowState;
+    static const auto map =
+        UnallocatedMap<Key, UnallocatedVector<proto::PaymentEventType>>{
+            {{Type::OutgoingCheque, State::Unsent},
+             {proto::PAYMENTEVENTTYPE_CREATE}},
+            {{Type::OutgoingCheque, State::Conveyed},
+             {proto::PAYMENTEVENTTYPE_CREATE}},
+            {{Type::OutgoingCheque, State::Expired},
+             {proto::PAYMENTEVENTTYPE_CREATE}},
+            {{Type::OutgoingCheque, State::Cancelled},
+             {proto::PAYMENTEVENTTYPE_CREATE, proto::PAYMENTEVENTTYPE_CANCEL}},
+            {{Type::OutgoingCheque, State::Accepted},
+             {proto::PAYMENTEVENTTYPE_CREATE, proto::PAYMENTEVENTTYPE_ACCEPT}},
+            {{Type::OutgoingCheque, State::Completed},
+             {proto::PAYMENTEVENTTYPE_CREATE, proto::PAYMENTEVENTTYPE_ACCEPT}},
+            {{Type::IncomingCheque, State::Conveyed},
+             {proto::PAYMENTEVENTTYPE_CONVEY}},
+            {{Type::IncomingCheque, State::Expired},
+             {proto::PAYMENTEVENTTYPE_CONVEY}},
+            {{Type::IncomingCheque, State::Completed},
+             {proto::PAYMENTEVENTTYPE_CONVEY}},
+            {{Type::OutgoingTransfer, State::Acknowledged},
+             {proto::PAYMENTEVENTTYPE_ACKNOWLEDGE}},
+            {{Type::OutgoingTransfer, State::Accepted},
+             {proto::PAYMENTEVENTTYPE_ACKNOWLEDGE}},
+            {{Type::OutgoingTransfer, State::Completed},
+             {proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
+              proto::PAYMENTEVENTTYPE_COMPLETE}},
+            {{Type::IncomingTransfer, State::Conveyed},
+             {proto::PAYMENTEVENTTYPE_CONVEY}},
+            {{Type::IncomingTransfer, State::Completed},
+             {proto::PAYMENTEVENTTYPE_CONVEY, proto::PAYMENTEVENTTYPE_ACCEPT}},
+            {{Type::InternalTransfer, State::Acknowledged},
+             {proto::PAYMENTEVENTTYPE_ACKNOWLEDGE}},
+            {{Type::InternalTransfer, State::Conveyed},
+             {proto::PAYMENTEVENTTYPE_ACKNOWLEDGE}},
+            {{Type::InternalTransfer, State::Accepted},
+             {proto::PAYMENTEVENTTYPE_ACKNOWLEDGE}},
+            {{Type::InternalTransfer, State::Completed},
+             {proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
+              proto::PAYMENTEVENTTYPE_COMPLETE}},
+        };
+    auto output = UnallocatedVector<std::pair<proto::PaymentEventType, Time>>{};
+    const auto rows =
+        map.find({translate(workflow.type()), translate(workflow.state())});
+
+    if (map.end() == rows) { return output; }
+
+    for (const auto type : rows->second) {
+        // NOTE the most recent successful event of the type is preferred
+        const proto::PaymentEvent* found{nullptr};
+
+        for (const auto& event : workflow.event()) {
+            if (type != event.type()) { continue; }
+
+            if (nullptr == found) {
+                found = &event;
+            } else if (event.success() && (false == found->success())) {
+                found = &event;
+            } else if (
+                (event.success() == found->success()) &&
+                (event.time() > found->time())) {
+                found = &event;
+            }
+        }
+
+        if (nullptr == found) {
+            LogError()(OT_PRETTY_STATIC(Workflow))("Workflow ")(workflow.id())(
+                " does not contain an event of type ")(type)
+                .Flush();
+
+            continue;
+        }
+
+        output.emplace_back(type, Clock::from_time_t(found->time()));
+    }
+
+    return output;
+}
+
 auto Workflow::extract_conveyed_time(const proto::PaymentWorkflow& workflow)
     -> Time
 {
@@ -2382,6 +2474,181 @@ auto Workflow::isCheque(const opentxs::Cheque& cheque) -> bool
     return true;
 }
 
+auto Workflow::index_account_events(
+    const UnallocatedCString& nymID,
+    const proto::PaymentWorkflow& workflow) const noexcept -> bool
+{
+    if (0 == workflow.account_size()) { return true; }
+
+    auto amount = Amount{0};
+    auto memo = UnallocatedCString{};
+    auto destination = UnallocatedCString{};
+
+    switch (translate(workflow.type())) {
+        case PaymentWorkflowType::OutgoingCheque:
+        case PaymentWorkflowType::IncomingCheque: {
+            [[maybe_unused]] const auto [state, cheque] =
+                session::Workflow::InstantiateCheque(api_, workflow);
+
+            if (false == bool(cheque)) { return false; }
+
+            amount = cheque->GetAmount();
+            memo = cheque->GetMemo().Get();
+        } break;
+        case PaymentWorkflowType::OutgoingTransfer:
+        case PaymentWorkflowType::IncomingTransfer:
+        case PaymentWorkflowType::InternalTransfer: {
+            [[maybe_unused]] const auto [state, transfer] =
+                InstantiateTransfer(api_, workflow);
+
+            if (false == bool(transfer)) { return false; }
+
+            amount = transfer->GetAmount();
+            auto note = String::Factory();
+            transfer->GetNote(note);
+            memo = note->Get();
+            destination = transfer->GetDestinationAcctID().str();
+        } break;
+        case PaymentWorkflowType::Error:
+        case PaymentWorkflowType::OutgoingInvoice:
+        case PaymentWorkflowType::IncomingInvoice:
+        case PaymentWorkflowType::OutgoingCash:
+        case PaymentWorkflowType::IncomingCash:
+        default: {
+
+            return true;
+        }
+    }
+
+    const auto rows = extract_account_events(workflow);
+    const auto uuid = UUID(api_, workflow)->str();
+    const auto contact = [&]() -> UnallocatedCString {
+        if (0 < workflow.party_size()) {
+            const auto party = identifier::Nym::Factory(workflow.party(0));
+
+            return contact_.NymToContact(party)->str();
+        } else if (
+            PaymentWorkflowType::InternalTransfer ==
+            translate(workflow.type())) {
+
+            return contact_.ContactID(identifier::Nym::Factory(nymID))->str();
+        }
+
+        return {};
+    }();
+    auto output{true};
+
+    for (const auto& accountID : workflow.account()) {
+        const auto incoming = [&] {
+            switch (translate(workflow.type())) {
+                case PaymentWorkflowType::IncomingCheque:
+                case PaymentWorkflowType::IncomingTransfer: {
+
+                    return true;
+                }
+                case PaymentWorkflowType::InternalTransfer: {
+
+                    return accountID == destination;
+                }
+                default: {
+
+                    return false;
+                }
+            }
+        }();
+        const auto type = [&] {
+            switch (translate(workflow.type())) {
+                case PaymentWorkflowType::OutgoingCheque:
+                case PaymentWorkflowType::IncomingCheque: {
+
+                    return incoming ? proto::ACCOUNTEVENT_INCOMINGCHEQUE
+                                    : proto::ACCOUNTEVENT_OUTGOINGCHEQUE;
+                }
+                default: {
+
+                    return incoming ? proto::ACCOUNTEVENT_INCOMINGTRANSFER
+                                    : proto::ACCOUNTEVENT_OUTGOINGTRANSFER;
+                }
+            }
+        }();
+        const auto effective = incoming ? amount : amount * -1;
+        const auto formatted = [&] {
+            auto out = UnallocatedCString{};
+
+            try {
+                const auto unit = api_.Wallet().UnitDefinition(
+                    api_.Storage().AccountContract(
+                        Identifier::Factory(accountID)));
+                out = display::GetDefinition(unit->UnitOfAccount())
+                          .Format(effective);
+            } catch (...) {
+            }
+
+            if (out.empty()) { effective.Serialize(writer(out)); }
+
+            return out;
+        }();
+        auto events = UnallocatedVector<proto::AccountEvent>{};
+
+        for (const auto& [eventType, time] : rows) {
+            auto& event = events.emplace_back();
+            event.set_version(INDEXED_ACCOUNT_EVENT_VERSION);
+            event.set_id(accountID);
+            event.set_type(type);
+
+            if (false == contact.empty()) { event.set_contact(contact); }
+
+            event.set_workflow(workflow.id());
+            effective.Serialize(writer(event.mutable_amount()));
+            effective.Serialize(writer(event.mutable_pendingamount()));
+            event.set_timestamp(Clock::to_time_t(time));
+            event.set_memo(memo);
+            event.set_uuid(uuid);
+            event.set_state(workflow.state());
+            event.set_amountformatted(formatted);
+            event.set_pendingamountformatted(formatted);
+
+            if (false == proto::Validate(event, VERBOSE)) {
+                LogError()(OT_PRETTY_CLASS())("Invalid event for workflow ")(
+                    workflow.id())
+                    .Flush();
+                events.pop_back();
+            }
+        }
+
+        output &= api_.Storage().Internal().StoreAccountEvents(
+            nymID, accountID, workflow.id(), events);
+    }
+
+    return output;
+}
+
+auto Workflow::IndexAccountEvents(
+    const identifier::Nym& nymID,
+    const Identifier& accountID) const noexcept -> bool
+{
+    auto output{true};
+
+    for (const auto& id : WorkflowsByAccount(nymID, accountID)) {
+        const auto workflow = get_workflow_by_id(nymID.str(), id->str());
+
+        if (false == bool(workflow)) {
+            output = false;
+
+            continue;
+        }
+
+        output &= index_account_events(nymID.str(), *workflow);
+    }
+
+    if (output) {
+        output &= api_.Storage().Internal().SetAccountEventsIndexed(
+            nymID.str(), accountID.str());
+    }
+
+    return output;
+}
+
 auto Workflow::isInternalTransfer(
     const Identifier& sourceAccount,
     const Identifier& destinationAccount) const -> bool
@@ -2660,6 +2927,12 @@ auto Workflow::save_workflow(
 
     OT_ASSERT(saved)
 
+    if (false == index_account_events(nymID, workflow)) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Failed to update account events for workflow ")(workflow.id())
+            .Flush();
+    }
+
     if (false == accountID.empty()) {
         account_publisher_->Send([&] {
             auto work = opentxs::network::zeromq::tagged_message(
@@ -130,6 +130,9 @@ public:
     auto ImportCheque(
         const identifier::Nym& nymID,
         const opentxs::Cheque& cheque) const -> OTIdentifier final;
+    auto IndexAccountEvents(
+        const identifier::Nym& nymID,
+        const Identifier& accountID) const noexcept -> bool final;
     auto InstantiateCheque(
         const identifier::Nym& nymID,
         const Identifier& workflowID) const -> Cheque final;
@@ -250,6 +253,8 @@ private:
     static auto can_finish_cheque(const proto::PaymentWorkflow& workflow)
         -> bool;
     static auto cheque_deposit_success(const Message* message) -> bool;
+    static auto extract_account_events(const proto::PaymentWorkflow& workflow)
+        -> UnallocatedVector<std::pair<proto::PaymentEventType, Time>>;
     static auto extract_conveyed_time(const proto::PaymentWorkflow& workflow)
         -> Time;
     static auto isCheque(const opentxs::Cheque& cheque) -> bool;
@@ -371,6 +376,9 @@ private:
     // Unlocks global after successfully locking the workflow-specific mutex
     auto get_workflow_lock(Lock& global, const UnallocatedCString& id) const
         -> eLock;
+    auto index_account_events(
+        const UnallocatedCString& nymID,
+        const proto::PaymentWorkflow& workflow) const noexcept -> bool;
     auto isInternalTransfer(
         const Identifier& sourceAccount,
         const Identifier& destinationAccount) const -> bool;
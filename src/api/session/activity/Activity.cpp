@@ -17,40 +17,51 @@
 
 #include "Proto.hpp"
 #include "internal/api/session/Factory.hpp"
+#include "internal/api/session/Storage.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/otx/common/Cheque.hpp"  // IWYU pragma: keep
 #include "internal/otx/common/Item.hpp"    // IWYU pragma: keep
 #include "internal/otx/common/Message.hpp"
+#include "internal/serialization/protobuf/Check.hpp"
+#include "internal/serialization/protobuf/verify/AccountEvent.hpp"
 #include "internal/util/LogMacros.hpp"
-#include "opentxs/Types.hpp"
+#include "opentxs/api/crypto/Blockchain.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Contacts.hpp"
+#include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/api/session/Storage.hpp"
 #include "opentxs/api/session/Wallet.hpp"
 #include "opentxs/api/session/Workflow.hpp"
-#include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/crypto/Account.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Contact.hpp"
-#include "opentxs/core/Data.hpp"
-#include "opentxs/core/String.hpp"
-#include "opentxs/core/contract/Unit.hpp"
 #include "opentxs/core/contract/peer/PeerObject.hpp"
+#include "opentxs/core/contract/Unit.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/display/Definition.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/network/zeromq/message/Message.tpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/otx/client/PaymentWorkflowType.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/PasswordPrompt.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "serialization/protobuf/AccountEvent.pb.h"
 #include "serialization/protobuf/PaymentWorkflow.pb.h"
+#include "serialization/protobuf/PaymentWorkflowEnums.pb.h"
 #include "serialization/protobuf/StorageThread.pb.h"
 #include "serialization/protobuf/StorageThreadItem.pb.h"
 
@@ -176,6 +187,8 @@ auto Activity::add_blockchain_transaction(
         api_.Storage().UnaffiliatedBlockchainTransaction(nym, txid);
     }
 
+    output &= index_account_events(nym, transaction, incoming);
+
     std::for_each(std::begin(chains), std::end(chains), [&](const auto& chain) {
         get_blockchain(lock, nym).Send([&] {
             auto out = opentxs::network::zeromq::tagged_message(
@@ -420,6 +433,122 @@ auto Activity::get_publisher(
     return publisher->second.get();
 }
 
+auto Activity::IndexAccountEvents(
+    const identifier::Nym& nym,
+    const opentxs::blockchain::Type chain) const noexcept -> bool
+{
+#if OT_BLOCKCHAIN
+    auto output{true};
+    const auto& blockchain = api_.Crypto().Blockchain();
+
+    for (const auto& txid : api_.Storage().BlockchainTransactionList(nym)) {
+        const auto pTX = blockchain.LoadTransactionBitcoin(txid);
+
+        if (false == bool(pTX)) {
+            output = false;
+
+            continue;
+        }
+
+        const auto& tx = *pTX;
+        const auto chains = tx.Chains();
+
+        if (chains.end() == std::find(chains.begin(), chains.end(), chain)) {
+            continue;
+        }
+
+        output &= index_account_events(
+            nym, tx, api_.Storage().BlockchainThreadMap(nym, txid));
+    }
+
+    try {
+        const auto& account = blockchain.Account(nym, chain).AccountID();
+
+        if (output) {
+            output &= api_.Storage().Internal().SetAccountEventsIndexed(
+                nym.str(), account.str());
+        }
+    } catch (...) {
+
+        return false;
+    }
+
+    return output;
+#else
+    return false;
+#endif  // OT_BLOCKCHAIN
+}
+
+#if OT_BLOCKCHAIN
+auto Activity::index_account_events(
+    const identifier::Nym& nym,
+    const blockchain::block::bitcoin::Transaction& transaction,
+    const UnallocatedVector<OTIdentifier>& contacts) const noexcept -> bool
+{
+    const auto& txid = transaction.ID();
+    const auto amount = transaction.NetBalanceChange(nym);
+    const auto contact = [&]() -> UnallocatedCString {
+        for (const auto& id : contacts) {
+            if (false == id->empty()) { return id->str(); }
+        }
+
+        return {};
+    }();
+    auto output{true};
+
+    for (const auto chain : transaction.Chains()) {
+        const auto account = [&]() -> UnallocatedCString {
+            try {
+
+                return api_.Crypto()
+                    .Blockchain()
+                    .Account(nym, chain)
+                    .AccountID()
+                    .str();
+            } catch (...) {
+
+                return {};
+            }
+        }();
+
+        if (account.empty()) { continue; }
+
+        const auto formatted = blockchain::internal::Format(chain, amount);
+        auto event = proto::AccountEvent{};
+        event.set_version(indexed_account_event_version_);
+        event.set_id(account);
+        event.set_type(
+            (0 > amount) ? proto::ACCOUNTEVENT_OUTGOINGBLOCKCHAIN
+                         : proto::ACCOUNTEVENT_INCOMINGBLOCKCHAIN);
+
+        if (false == contact.empty()) { event.set_contact(contact); }
+
+        amount.Serialize(writer(event.mutable_amount()));
+        amount.Serialize(writer(event.mutable_pendingamount()));
+        event.set_timestamp(Clock::to_time_t(transaction.Timestamp()));
+        event.set_memo(transaction.Memo());
+        event.set_uuid(blockchain::HashToNumber(txid));
+        event.set_state(proto::PAYMENTWORKFLOWSTATE_ERROR);
+        event.set_amountformatted(formatted);
+        event.set_pendingamountformatted(formatted);
+
+        if (false == proto::Validate(event, VERBOSE)) {
+            LogError()(OT_PRETTY_CLASS())("Invalid event for transaction ")(
+                txid.asHex())
+                .Flush();
+            output = false;
+
+            continue;
+        }
+
+        output &= api_.Storage().Internal().StoreAccountEvents(
+            nym.str(), account, txid.asHex(), {event});
+    }
+
+    return output;
+}
+#endif  // OT_BLOCKCHAIN
+
 auto Activity::Mail(
     const identifier::Nym& nym,
     const Message& mail,
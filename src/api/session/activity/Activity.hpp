@@ -21,11 +21,13 @@
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/api/session/Activity.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
+#include "opentxs/util/Numbers.hpp"
 #include "opentxs/util/PasswordPrompt.hpp"
 #include "opentxs/util/Time.hpp"
 
@@ -91,6 +93,9 @@ public:
         const Identifier& itemID,
         const Identifier& workflowID,
         Time time) const noexcept -> bool final;
+    auto IndexAccountEvents(
+        const identifier::Nym& nym,
+        const opentxs::blockchain::Type chain) const noexcept -> bool final;
     auto Mail(
         const identifier::Nym& nym,
         const Identifier& id,
@@ -178,6 +183,8 @@ public:
     ~Activity() final;
 
 private:
+    static constexpr auto indexed_account_event_version_ = VersionNumber{2};
+
     const api::Session& api_;
     const session::Contacts& contact_;
     const OTZMQPublishSocket message_loaded_;
@@ -203,6 +210,11 @@ private:
         const identifier::Nym& nym,
         const blockchain::block::bitcoin::Transaction& transaction)
         const noexcept -> bool;
+    auto index_account_events(
+        const identifier::Nym& nym,
+        const blockchain::block::bitcoin::Transaction& transaction,
+        const UnallocatedVector<OTIdentifier>& contacts) const noexcept
+        -> bool;
 #endif  // OT_BLOCKCHAIN
     auto nym_to_contact(const UnallocatedCString& nymID) const noexcept
         -> std::shared_ptr<const Contact>;
@@ -7,17 +7,26 @@
 #include "1_Internal.hpp"                    // IWYU pragma: associated
 #include "api/session/ui/UpdateManager.hpp"  // IWYU pragma: associated
 
+#include <boost/system/error_code.hpp>
+#include <algorithm>
+#include <chrono>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string_view>
 #include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Timer.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Client.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Session.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Pipeline.hpp"
@@ -28,7 +37,11 @@
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Options.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/Gatekeeper.hpp"
+#include "util/Metrics.hpp"
 
 namespace zmq = opentxs::network::zeromq;
 
@@ -38,8 +51,7 @@ struct UpdateManager::Imp {
     auto ActivateUICallback(const Identifier& id) const noexcept -> void
     {
         pipeline_.Push([&] {
-            auto out = opentxs::network::zeromq::Message{};
-            out.StartBody();
+            auto out = zmq::tagged_message(Work::activate);
             out.AddFrame(id);
 
             return out;
@@ -74,7 +86,7 @@ struct UpdateManager::Imp {
 
         if (cb) {
             auto lock = Lock{lock_};
-            map_[id].emplace_back(cb);
+            map_[id].callbacks_.emplace_back(cb);
         } else {
             LogError()(OT_PRETTY_CLASS())("Invalid callback").Flush();
         }
@@ -82,8 +94,21 @@ struct UpdateManager::Imp {
 
     Imp(const api::session::Client& api) noexcept
         : api_(api)
+        , interval_(
+              std::chrono::milliseconds{api.GetOptions().UIUpdateInterval()})
         , lock_()
         , map_()
+        , alive_(std::make_shared<Gatekeeper>())
+        , timer_(api.Network().Asio().Internal().GetTimer())
+        , flush_scheduled_(std::nullopt)
+        , delivered_(metrics::Get().AddCounter(
+              "opentxs_ui_updates_total",
+              "Number of widget update requests",
+              {{"result", "delivered"}}))
+        , suppressed_(metrics::Get().AddCounter(
+              "opentxs_ui_updates_total",
+              "Number of widget update requests",
+              {{"result", "suppressed"}}))
         , publisher_(api.Network().ZeroMQ().PublishSocket())
         , pipeline_(api.Network().ZeroMQ().Internal().Pipeline(
               [this](auto&& in) { pipeline(std::move(in)); }))
@@ -93,44 +118,168 @@ struct UpdateManager::Imp {
             .Flush();
     }
 
+    ~Imp()
+    {
+        // NOTE waits for a timer callback which is already running and
+        // prevents any which have not yet started from accessing this object
+        alive_->shutdown();
+        timer_.Cancel();
+        pipeline_.Close();
+    }
+
 private:
+    enum class Work : OTZMQWorkType {
+        activate = OT_ZMQ_INTERNAL_SIGNAL + 0,
+        flush = OT_ZMQ_INTERNAL_SIGNAL + 1,
+    };
+
+    // NOTE a dirty widget has received an update request which has not yet
+    // been delivered because it was last notified less than interval_ ago
+    struct Widget {
+        UnallocatedVector<SimpleCallback> callbacks_{};
+        Time last_{};
+        bool dirty_{false};
+    };
+
     const api::session::Client& api_;
+    const std::chrono::milliseconds interval_;
     mutable std::mutex lock_;
-    mutable UnallocatedMap<OTIdentifier, UnallocatedVector<SimpleCallback>>
-        map_;
+    mutable UnallocatedMap<OTIdentifier, Widget> map_;
+    const std::shared_ptr<Gatekeeper> alive_;
+    Timer timer_;
+    std::optional<Time> flush_scheduled_;
+    const std::shared_ptr<metrics::Counter> delivered_;
+    const std::shared_ptr<metrics::Counter> suppressed_;
     OTZMQPublishSocket publisher_;
     opentxs::network::zeromq::Pipeline pipeline_;
 
-    auto pipeline(zmq::Message&& in) noexcept -> void
+    auto activate(const Lock& lock, const Identifier& id) noexcept -> void
     {
-        const auto body = in.Body();
-
-        OT_ASSERT(0u < body.size());
+        auto it = map_.find(id);
 
-        auto& idFrame = body.at(0);
+        if (map_.end() == it) { return; }
 
-        OT_ASSERT(0u < idFrame.size());
+        auto& widget = it->second;
 
-        const auto id = api_.Factory().Identifier(idFrame);
-        auto lock = Lock{lock_};
-        auto it = map_.find(id);
+        if (widget.dirty_) {
+            suppressed_->Increment();
 
-        if (map_.end() == it) { return; }
+            return;
+        }
 
-        const auto& callbacks = it->second;
+        const auto now = Clock::now();
 
-        for (const auto& cb : callbacks) {
+        if (due(widget, now)) {
+            deliver(lock, id, widget, now);
+        } else {
+            widget.dirty_ = true;
+            schedule_flush(lock, widget.last_ + interval_);
+        }
+    }
+    auto deliver(
+        const Lock&,
+        const Identifier& id,
+        Widget& widget,
+        const Time now) noexcept -> void
+    {
+        for (const auto& cb : widget.callbacks_) {
             if (cb) { cb(); }
         }
 
         const auto& socket = publisher_.get();
         socket.Send([&] {
-            auto work = opentxs::network::zeromq::tagged_message(
-                WorkType::UIModelUpdated);
-            work.AddFrame(std::move(idFrame));
+            auto work = zmq::tagged_message(WorkType::UIModelUpdated);
+            work.AddFrame(id);
 
             return work;
         }());
+        widget.last_ = now;
+        widget.dirty_ = false;
+        delivered_->Increment();
+    }
+    auto due(const Widget& widget, const Time now) const noexcept -> bool
+    {
+        // NOTE the system clock may have been adjusted backwards
+        return (now < widget.last_) || ((now - widget.last_) >= interval_);
+    }
+    auto flush(const Lock& lock) noexcept -> void
+    {
+        flush_scheduled_ = std::nullopt;
+        const auto now = Clock::now();
+        auto next = std::optional<Time>{};
+
+        for (auto& [id, widget] : map_) {
+            if (false == widget.dirty_) { continue; }
+
+            if (due(widget, now)) {
+                deliver(lock, id, widget, now);
+            } else {
+                const auto time = widget.last_ + interval_;
+                next = next.has_value() ? std::min(*next, time) : time;
+            }
+        }
+
+        if (next.has_value()) { schedule_flush(lock, *next); }
+    }
+    auto pipeline(zmq::Message&& in) noexcept -> void
+    {
+        const auto body = in.Body();
+
+        OT_ASSERT(0u < body.size());
+
+        const auto work = [&] {
+            try {
+
+                return body.at(0).as<Work>();
+            } catch (...) {
+
+                OT_FAIL;
+            }
+        }();
+        auto lock = Lock{lock_};
+
+        switch (work) {
+            case Work::activate: {
+                OT_ASSERT(1u < body.size());
+
+                const auto& idFrame = body.at(1);
+
+                OT_ASSERT(0u < idFrame.size());
+
+                activate(lock, api_.Factory().Identifier(idFrame));
+            } break;
+            case Work::flush: {
+                flush(lock);
+            } break;
+            default: {
+                LogError()(OT_PRETTY_CLASS())("Unhandled type").Flush();
+
+                OT_FAIL;
+            }
+        }
+    }
+    auto schedule_flush(const Lock&, const Time when) noexcept -> void
+    {
+        if (flush_scheduled_.has_value() && (*flush_scheduled_ <= when)) {
+            return;
+        }
+
+        // NOTE resetting the expiry time cancels the previous wait, if any
+        flush_scheduled_ = when;
+        timer_.SetAbsolute(when);
+        timer_.Wait([this, alive = alive_](const auto& error) {
+            const auto ticket = alive->get();
+
+            if (ticket) { return; }
+
+            if (error) {
+                if (boost::system::errc::operation_canceled != error.value()) {
+                    LogError()(OT_PRETTY_CLASS())(error).Flush();
+                }
+            } else {
+                pipeline_.Push(zmq::tagged_message(Work::flush));
+            }
+        });
     }
 };
 
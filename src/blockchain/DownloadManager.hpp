@@ -7,17 +7,24 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <optional>
 
+#include "blockchain/DownloadScheduler.hpp"
 #include "blockchain/DownloadTask.hpp"
 #include "core/Worker.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/Types.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Time.hpp"
+#include "util/Metrics.hpp"
 #include "util/Work.hpp"
 
 namespace opentxs::blockchain::download
@@ -54,6 +61,9 @@ public:
         dm_known_ = position;
         buffer_.clear();
         next_ = 0;
+        in_flight_.clear();
+        holders_.clear();
+        update_metrics(lock);
         downcast().update_tip(position, dm_previous_.get());
     }
     auto Start() noexcept { enabled_ = true; }
@@ -100,30 +110,7 @@ protected:
             ++last_batch_,
             [&] {
                 auto output = typename BatchType::Vector{};
-                auto i = buffer_.begin();
-                std::advance(i, next_);
-
-                for (; i != buffer_.end(); ++i) {
-                    const auto& task = *i;
-
-                    if (auto expected{State::New};
-                        false == task->state_.compare_exchange_strong(
-                                     expected, State::Downloading)) {
-                        if (0 == output.size()) {
-                            continue;
-                        } else {
-                            break;
-                        }
-                    }
-
-                    LogTrace()(OT_PRETTY_CLASS())("queueing ")(
-                        log_)(" item at height ")(task->position_.first)(
-                        " for download")
-                        .Flush();
-                    output.emplace_back(task);
-
-                    if (output.size() == size) { break; }
-                }
+                claim(lock, size, buffer_.size(), output);
 
                 return output;
             }(),
@@ -142,6 +129,92 @@ protected:
 
         return output;
     }
+    // NOTE when the manager was constructed without scheduler parameters
+    // this is equivalent to allocate_batch
+    auto schedule_batch(const Scheduler::PeerID peer, ExtraData extra = {})
+        noexcept -> BatchType
+    {
+        if (false == bool(scheduler_)) {
+
+            return allocate_batch(std::move(extra));
+        }
+
+        auto lock = Lock{dm_lock_};
+
+        if (caught_up(lock)) {
+            LogTrace()(OT_PRETTY_CLASS())(log_)(" caught up").Flush();
+
+            return {};
+        }
+
+        OT_ASSERT(0 < buffer_.size());
+
+        auto& scheduler = *scheduler_;
+        const auto now = Clock::now();
+        const auto end = std::min(buffer_.size(), scheduler.Window());
+        const auto size = scheduler.BatchSize(
+            peer, downcast().batch_size(unallocated(lock)));
+
+        if (0 == size) { return {}; }
+
+        auto data = typename BatchType::Vector{};
+        auto reassigned = std::size_t{0};
+
+        // NOTE items closest to the tip which are held by a peer that missed
+        // its deadline are requested again if this peer is faster
+        for (auto i = std::size_t{0}; (i < end) && (data.size() < size); ++i) {
+            const auto& task = buffer_.at(i);
+
+            if (State::Downloading != task->state_.load()) { continue; }
+
+            const auto h = holders_.find(task.get());
+
+            if ((holders_.end() == h) || (1 != h->second.size())) { continue; }
+
+            const auto f = in_flight_.find(h->second.front());
+
+            if (in_flight_.end() == f) { continue; }
+
+            const auto& holder = f->second;
+
+            if (now < holder.deadline_) { continue; }
+
+            if (false == scheduler.IsFaster(peer, holder.peer_)) { continue; }
+
+            data.emplace_back(task);
+            ++reassigned;
+        }
+
+        const auto allocated = claim(lock, size - data.size(), end, data);
+
+        if (0 == data.size()) { return {}; }
+
+        next_ += allocated;
+
+        OT_ASSERT(next_ <= buffer_.size());
+
+        auto output = BatchType{
+            ++last_batch_,
+            std::move(data),
+            [=](const auto& batch) { finish_downloading(batch); },
+            std::move(extra)};
+        const auto deadline =
+            now + std::chrono::duration_cast<Clock::duration>(
+                      scheduler.Deadline(peer, output.data_.size()));
+        in_flight_.try_emplace(output.id_, peer, deadline);
+
+        for (const auto& task : output.data_) {
+            holders_[task.get()].emplace_back(output.id_);
+        }
+
+        if (0 < reassigned) {
+            LogVerbose()(OT_PRETTY_CLASS())("requesting ")(reassigned)(
+                " stalled ")(log_)(" items from peer ")(peer)
+                .Flush();
+        }
+
+        return output;
+    }
     auto run_if_enabled() noexcept -> void
     {
         if (enabled_) { downcast().do_work(); }
@@ -240,6 +313,7 @@ protected:
         }
 
         dm_known_ = buffer_.back()->position_;
+        update_metrics(lock);
 
         OT_ASSERT(dm_done_.first <= dm_known_.first);
 
@@ -247,13 +321,26 @@ protected:
     }
 
     Manager(
+        const blockchain::Type chain,
         const Position& position,
         Finished&& previous,
         const UnallocatedCString& log,
         const std::size_t max,
-        const std::size_t min) noexcept
+        const std::size_t min,
+        std::optional<Scheduler::Params> scheduler = std::nullopt) noexcept
         : log_(log)
         , max_queue_(max)
+        , buffer_metric_(metrics::Get().AddGauge(
+              "opentxs_blockchain_download_buffer",
+              "Number of items queued by a download manager",
+              {{"chain", print(chain)}, {"type", log_}}))
+        , processed_metric_(metrics::Get().AddCounter(
+              "opentxs_blockchain_download_processed_total",
+              "Number of items fully processed by a download manager",
+              {{"chain", print(chain)}, {"type", log_}}))
+        , scheduler_(
+              scheduler.has_value() ? std::make_unique<Scheduler>(*scheduler)
+                                    : nullptr)
         , dm_lock_()
         , dm_previous_(std::move(previous))
         , dm_done_(position)
@@ -261,6 +348,8 @@ protected:
         , last_batch_(-1)
         , buffer_()
         , next_(0)
+        , in_flight_()
+        , holders_()
         , enabled_(false)
     {
     }
@@ -279,12 +368,26 @@ private:
         }
     };
 
+    struct InFlight {
+        Scheduler::PeerID peer_;
+        Time deadline_;
+
+        InFlight(Scheduler::PeerID peer, Time deadline) noexcept
+            : peer_(peer)
+            , deadline_(deadline)
+        {
+        }
+    };
+
     using TaskPtr = std::shared_ptr<TaskType>;
     using Buffer = UnallocatedDeque<TaskPtr>;
     using BatchID = typename BatchType::ID;
 
     const UnallocatedCString log_;
     const std::size_t max_queue_;
+    const std::shared_ptr<metrics::Gauge> buffer_metric_;
+    const std::shared_ptr<metrics::Counter> processed_metric_;
+    const std::unique_ptr<Scheduler> scheduler_;
     mutable std::mutex dm_lock_;
     Finished dm_previous_;
     Position dm_done_;
@@ -292,6 +395,8 @@ private:
     BatchID last_batch_;
     Buffer buffer_;
     std::size_t next_;
+    UnallocatedMap<BatchID, InFlight> in_flight_;
+    UnallocatedMap<const TaskType*, UnallocatedVector<BatchID>> holders_;
     std::atomic_bool enabled_;
 
     // Functions to implement in child class:
@@ -315,6 +420,10 @@ private:
     {
         return dm_done_ == dm_known_;
     }
+    inline auto held(const Lock&, const TaskType& task) const noexcept -> bool
+    {
+        return 0 < holders_.count(&task);
+    }
     inline auto unallocated(const Lock&) const noexcept -> std::size_t
     {
         const auto outstanding =
@@ -330,9 +439,44 @@ private:
     {
         return static_cast<CRTP&>(*this);
     }
+    // NOTE move up to count new items from the range [next_, end) into output
+    // and return the number of items moved
+    auto claim(
+        const Lock&,
+        const std::size_t count,
+        const std::size_t end,
+        typename BatchType::Vector& output) noexcept -> std::size_t
+    {
+        auto claimed = std::size_t{0};
+
+        for (auto i = next_; (i < end) && (claimed < count); ++i) {
+            const auto& task = buffer_.at(i);
+
+            if (auto expected{State::New};
+                false == task->state_.compare_exchange_strong(
+                             expected, State::Downloading)) {
+                if (0 == claimed) {
+                    continue;
+                } else {
+                    break;
+                }
+            }
+
+            LogTrace()(OT_PRETTY_CLASS())("queueing ")(log_)(
+                " item at height ")(task->position_.first)(" for download")
+                .Flush();
+            output.emplace_back(task);
+            ++claimed;
+        }
+
+        return claimed;
+    }
     auto finish_downloading(const BatchType& batch) noexcept -> void
     {
         auto lock = Lock{dm_lock_};
+
+        if (scheduler_) { finish_scheduled(lock, batch); }
+
         // Make sure all tasks in batch actually got downloaded
         const auto& data = batch.data_;
 
@@ -369,7 +513,10 @@ private:
             } else {
                 next_ = std::min(next_, index);
 
-                if (State::Downloading == expect) {
+                // NOTE another batch may still be downloading a reassigned
+                // item
+                if ((State::Downloading == expect) &&
+                    (false == held(lock, task))) {
                     state.compare_exchange_strong(expect, State::New);
                 }
             }
@@ -377,6 +524,42 @@ private:
 
         downcast().trigger_state_machine();
     }
+    auto finish_scheduled(const Lock&, const BatchType& batch) noexcept
+        -> void
+    {
+        for (const auto& task : batch.data_) {
+            const auto i = holders_.find(task.get());
+
+            if (holders_.end() == i) { continue; }
+
+            auto& ids = i->second;
+            ids.erase(
+                std::remove(ids.begin(), ids.end(), batch.id_), ids.end());
+
+            if (ids.empty()) { holders_.erase(i); }
+        }
+
+        const auto i = in_flight_.find(batch.id_);
+
+        if (in_flight_.end() == i) { return; }
+
+        const auto peer = i->second.peer_;
+        in_flight_.erase(i);
+        using Duration = Scheduler::Duration;
+        const auto delivered = batch.downloaded_.load();
+        const auto started = batch.Started();
+        const auto finished = (delivered == batch.data_.size())
+                                  ? batch.LastActivity()
+                                  : Clock::now();
+        const auto latency = (0 < delivered)
+                                 ? (batch.FirstActivity() - started)
+                                 : Clock::duration{};
+        scheduler_->Record(
+            peer,
+            delivered,
+            std::chrono::duration_cast<Duration>(latency),
+            std::chrono::duration_cast<Duration>(finished - started));
+    }
     auto state_machine(const Lock& lock) noexcept -> bool
     {
         if (caught_up(lock)) { return false; }
@@ -418,6 +601,8 @@ private:
                 }
 
                 buffer_.erase(first, std::next(last));
+                processed_metric_->Add(toDelete);
+                update_metrics(lock);
 
                 if (next_ >= toDelete) {
                     next_ -= toDelete;
@@ -459,6 +644,10 @@ private:
         dm_done_ = std::move(pos);
         dm_previous_ = std::move(data);
     }
+    auto update_metrics(const Lock&) noexcept -> void
+    {
+        buffer_metric_->Set(static_cast<std::int64_t>(buffer_.size()));
+    }
 
     Manager(const Manager& rhs) = delete;
     Manager(Manager&& rhs) = delete;
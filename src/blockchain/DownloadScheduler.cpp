@@ -0,0 +1,144 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                      // IWYU pragma: associated
+#include "1_Internal.hpp"                    // IWYU pragma: associated
+#include "blockchain/DownloadScheduler.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <ratio>
+
+namespace opentxs::blockchain::download
+{
+Scheduler::Scheduler(const Params& params) noexcept
+    : params_(params)
+    , peers_()
+{
+}
+
+auto Scheduler::BatchSize(const PeerID peer, const std::size_t limit)
+    const noexcept -> std::size_t
+{
+    if (0u == limit) { return limit; }
+
+    const auto i = peers_.find(peer);
+
+    if (peers_.end() == i) { return limit; }
+
+    using Seconds = std::chrono::duration<double>;
+    const auto target =
+        i->second.rate_ * std::chrono::duration_cast<Seconds>(params_.target_)
+                              .count();
+
+    return std::clamp<std::size_t>(
+        static_cast<std::size_t>(target), 1u, limit);
+}
+
+auto Scheduler::Deadline(const PeerID peer, const std::size_t items)
+    const noexcept -> Duration
+{
+    const auto& min = params_.min_deadline_;
+    const auto& max = params_.max_deadline_;
+    const auto i = peers_.find(peer);
+
+    if (peers_.end() == i) { return max; }
+
+    const auto& [rate, latency, updated] = i->second;
+
+    if (0.0 >= rate) { return max; }
+
+    using Seconds = std::chrono::duration<double>;
+    const auto transfer = std::chrono::duration_cast<Duration>(
+        Seconds{static_cast<double>(items) / rate});
+    // NOTE allow twice the expected time before declaring a batch stalled
+    const auto expected = 2 * (latency + transfer);
+
+    return std::clamp<Duration>(expected, min, max);
+}
+
+auto Scheduler::expire(const Time now) noexcept -> void
+{
+    for (auto i = peers_.begin(); i != peers_.end();) {
+        if ((now - i->second.updated_) > expire_) {
+            i = peers_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+auto Scheduler::IsFaster(const PeerID candidate, const PeerID holder)
+    const noexcept -> bool
+{
+    if (candidate == holder) { return false; }
+
+    const auto h = peers_.find(holder);
+
+    // NOTE a peer with no history which has missed its deadline may be
+    // replaced by anyone
+    if (peers_.end() == h) { return true; }
+
+    const auto c = peers_.find(candidate);
+
+    if (peers_.end() == c) { return false; }
+
+    return c->second.rate_ > h->second.rate_;
+}
+
+auto Scheduler::Latency(const PeerID peer) const noexcept -> Duration
+{
+    if (const auto i = peers_.find(peer); peers_.end() != i) {
+
+        return i->second.latency_;
+    }
+
+    return {};
+}
+
+auto Scheduler::Record(
+    const PeerID peer,
+    const std::size_t delivered,
+    const Duration latency,
+    const Duration elapsed) noexcept -> void
+{
+    const auto now = Clock::now();
+    expire(now);
+    auto [i, added] = peers_.try_emplace(peer);
+    auto& [rate, lastLatency, updated] = i->second;
+    updated = now;
+    using Seconds = std::chrono::duration<double>;
+    static constexpr auto minimum = std::chrono::milliseconds{1};
+    const auto seconds = std::chrono::duration_cast<Seconds>(
+                             std::max<Duration>(elapsed, minimum))
+                             .count();
+    const auto sample = static_cast<double>(delivered) / seconds;
+
+    if (added) {
+        rate = sample;
+    } else {
+        rate = (smoothing_ * sample) + ((1.0 - smoothing_) * rate);
+    }
+
+    // NOTE a batch which delivered nothing says nothing about round trip time
+    if (0u == delivered) { return; }
+
+    if (added || (Duration{} == lastLatency)) {
+        lastLatency = latency;
+    } else {
+        lastLatency = std::chrono::duration_cast<Duration>(
+            (smoothing_ * latency) + ((1.0 - smoothing_) * lastLatency));
+    }
+}
+
+auto Scheduler::Throughput(const PeerID peer) const noexcept -> double
+{
+    if (const auto i = peers_.find(peer); peers_.end() != i) {
+
+        return i->second.rate_;
+    }
+
+    return {};
+}
+}  // namespace opentxs::blockchain::download
@@ -0,0 +1,83 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace opentxs::blockchain::download
+{
+// NOTE the scheduler is not thread safe. download::Manager only calls it while
+// holding its own mutex.
+class Scheduler
+{
+public:
+    using PeerID = int;
+    using Duration = std::chrono::nanoseconds;
+
+    struct Params {
+        // number of items past the current tip which may be requested
+        std::size_t window_;
+        // amount of work a batch should represent for a known peer
+        std::chrono::milliseconds target_;
+        // bounds on how long a peer may hold a batch before its remaining
+        // items may be requested from a faster peer
+        std::chrono::milliseconds min_deadline_;
+        std::chrono::milliseconds max_deadline_;
+    };
+
+    auto BatchSize(const PeerID peer, const std::size_t limit) const noexcept
+        -> std::size_t;
+    auto Deadline(const PeerID peer, const std::size_t items) const noexcept
+        -> Duration;
+    auto IsFaster(const PeerID candidate, const PeerID holder) const noexcept
+        -> bool;
+    auto Latency(const PeerID peer) const noexcept -> Duration;
+    auto Throughput(const PeerID peer) const noexcept -> double;
+    auto Window() const noexcept -> std::size_t { return params_.window_; }
+
+    /// Update peer statistics from a finished batch
+    ///
+    /// \param latency time between allocating the batch and the first
+    ///                delivered item
+    /// \param elapsed time between allocating the batch and the last
+    ///                delivered item, or until the batch was abandoned if
+    ///                it was not fully delivered
+    auto Record(
+        const PeerID peer,
+        const std::size_t delivered,
+        const Duration latency,
+        const Duration elapsed) noexcept -> void;
+
+    Scheduler(const Params& params) noexcept;
+
+    ~Scheduler() = default;
+
+private:
+    struct Stats {
+        double rate_{};
+        Duration latency_{};
+        Time updated_{};
+    };
+
+    static constexpr auto smoothing_ = 0.3;
+    static constexpr auto expire_ = std::chrono::minutes{10};
+
+    const Params params_;
+    UnallocatedMap<PeerID, Stats> peers_;
+
+    auto expire(const Time now) noexcept -> void;
+
+    Scheduler() = delete;
+    Scheduler(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    auto operator=(const Scheduler&) -> Scheduler& = delete;
+    auto operator=(Scheduler&&) -> Scheduler& = delete;
+};
+}  // namespace opentxs::blockchain::download
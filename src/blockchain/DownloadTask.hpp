@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <functional>
@@ -227,12 +228,25 @@ public:
     operator bool() const noexcept { return 0 < data_.size(); }
 
     auto Elapsed() const noexcept { return Clock::now() - last_activity_; }
+    auto FirstActivity() const noexcept { return first_activity_; }
     auto isDownloaded() const noexcept -> bool
     {
         const auto size = data_.size();
 
-        return (0 < size) && (downloaded_.load() == size);
+        if (0 == size) { return false; }
+
+        if (downloaded_.load() == size) { return true; }
+
+        // NOTE items held by a stalled batch may have been delivered to
+        // another batch by the download scheduler
+        return std::all_of(data_.begin(), data_.end(), [](const auto& task) {
+            const auto state = task->state_.load();
+
+            return (State::New != state) && (State::Downloading != state);
+        });
     }
+    auto LastActivity() const noexcept { return last_activity_; }
+    auto Started() const noexcept { return started_; }
 
     auto Download(
         const Position& item,
@@ -240,7 +254,8 @@ public:
         std::optional<ExtraData> check = std::nullopt) -> bool
     {
         if (data_.at(index_.at(item))->download(std::move(data), check)) {
-            ++downloaded_;
+            if (0 == downloaded_++) { first_activity_ = Clock::now(); }
+
             last_activity_ = Clock::now();
 
             return true;
@@ -278,6 +293,7 @@ public:
         , cb_(cb)
         , index_(index(data_))
         , started_(Clock::now())
+        , first_activity_(started_)
         , last_activity_(started_)
     {
     }
@@ -289,6 +305,7 @@ public:
         , cb_(rhs.cb_)
         , index_(std::move(const_cast<Index&>(rhs.index_)))
         , started_(rhs.started_)
+        , first_activity_(rhs.first_activity_)
         , last_activity_(rhs.last_activity_)
     {
         rhs.cb_ = {};
@@ -311,6 +328,7 @@ public:
             std::swap(
                 const_cast<Index&>(index_), const_cast<Index&>(rhs.index_));
             std::swap(started_, rhs.started_);
+            std::swap(first_activity_, rhs.first_activity_);
             std::swap(last_activity_, rhs.last_activity_);
         }
 
@@ -325,6 +343,7 @@ private:
     Callback cb_;
     const Index index_;
     Time started_;
+    Time first_activity_;
     Time last_activity_;
 
     static auto index(const Vector& in) noexcept -> Index
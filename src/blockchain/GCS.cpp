@@ -205,6 +205,27 @@ auto GCS(
         return nullptr;
     }
 }
+
+auto GCS(
+    const api::Session& api,
+    const std::uint8_t bits,
+    const std::uint32_t fpRate,
+    const ReadView key,
+    UnallocatedVector<std::uint64_t>&& siphashes) noexcept
+    -> std::unique_ptr<blockchain::GCS>
+{
+    using ReturnType = blockchain::implementation::GCS;
+
+    try {
+
+        return std::make_unique<ReturnType>(
+            api, bits, fpRate, key, std::move(siphashes));
+    } catch (const std::exception& e) {
+        LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
+
+        return nullptr;
+    }
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::gcs
@@ -218,11 +239,6 @@ auto golomb_encode(
     const std::uint8_t P,
     const std::uint64_t value,
     BitWriter& stream) noexcept -> void;
-auto siphash(
-    const api::Session& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t;
-
 auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(false)
     -> std::uint64_t
 {
@@ -293,33 +309,13 @@ auto GolombEncode(
     return output;
 }
 
-auto siphash(
-    const api::Session& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t
-{
-    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
-
-    auto output = std::uint64_t{};
-    auto writer = preallocated(sizeof(output), &output);
-
-    if (false == api.Crypto().Hash().HMAC(
-                     crypto::HashType::SipHash24, key, item, writer)) {
-        throw std::runtime_error("siphash failed");
-    }
-
-    return output;
-}
-
 auto HashToRange(
     const api::Session& api,
     const ReadView key,
     const std::uint64_t range,
     const ReadView item) noexcept(false) -> std::uint64_t
 {
-    return ((bmp::uint128_t{siphash(api, key, item)} * bmp::uint128_t{range}) >>
-            64u)
-        .convert_to<std::uint64_t>();
+    return MapToRange(Siphash(api, key, item), range);
 }
 
 auto HashedSetConstruct(
@@ -342,6 +338,46 @@ auto HashedSetConstruct(
 
     return output;
 }
+
+auto HashedSetConstruct(
+    const std::uint32_t N,
+    const std::uint32_t M,
+    UnallocatedVector<std::uint64_t>&& siphashes) noexcept
+    -> UnallocatedVector<std::uint64_t>
+{
+    auto output = std::move(siphashes);
+
+    for (auto& hash : output) { hash = MapToRange(hash, range(N, M)); }
+
+    std::sort(output.begin(), output.end());
+
+    return output;
+}
+
+auto MapToRange(const std::uint64_t siphash, const std::uint64_t range) noexcept
+    -> std::uint64_t
+{
+    return ((bmp::uint128_t{siphash} * bmp::uint128_t{range}) >> 64u)
+        .convert_to<std::uint64_t>();
+}
+
+auto Siphash(
+    const api::Session& api,
+    const ReadView key,
+    const ReadView item) noexcept(false) -> std::uint64_t
+{
+    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
+
+    auto output = std::uint64_t{};
+    auto writer = preallocated(sizeof(output), &output);
+
+    if (false == api.Crypto().Hash().HMAC(
+                     crypto::HashType::SipHash24, key, item, writer)) {
+        throw std::runtime_error("siphash failed");
+    }
+
+    return output;
+}
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::implementation
@@ -404,6 +440,31 @@ GCS::GCS(
     }
 }
 
+GCS::GCS(
+    const api::Session& api,
+    const std::uint8_t bits,
+    const std::uint32_t fpRate,
+    const ReadView key,
+    UnallocatedVector<std::uint64_t>&& siphashes) noexcept(false)
+    : version_(1)
+    , api_(api)
+    , bits_(bits)
+    , false_positive_rate_(fpRate)
+    , count_(static_cast<std::uint32_t>(siphashes.size()))
+    , elements_(gcs::HashedSetConstruct(
+          count_,
+          false_positive_rate_,
+          std::move(siphashes)))
+    , compressed_(
+          api_.Factory().Data(reader(gcs::GolombEncode(bits_, *elements_))))
+    , key_(api_.Factory().Data(key))
+{
+    if (16u != key_->size()) {
+        throw std::runtime_error(
+            "Invalid key size: " + std::to_string(key_->size()));
+    }
+}
+
 auto GCS::Compressed() const noexcept -> Space
 {
     return {
@@ -476,29 +537,30 @@ auto GCS::Header(const ReadView previous) const noexcept -> OTData
 
 auto GCS::Match(const Targets& targets) const noexcept -> Matches
 {
+    using Hashed = std::pair<std::uint64_t, Targets::const_iterator>;
     auto output = Matches{};
-    auto hashed = UnallocatedVector<std::uint64_t>{};
-    auto matches = UnallocatedVector<std::uint64_t>{};
-    auto map = UnallocatedMap<std::uint64_t, Targets::const_iterator>{};
+    auto hashed = UnallocatedVector<Hashed>{};
+    hashed.reserve(targets.size());
     const auto& set = decompress();
 
     for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(hash_to_range(*i));
-        map.emplace(hash, i);
+        hashed.emplace_back(hash_to_range(*i), i);
     }
 
-    std::sort(std::begin(hashed), std::end(hashed));
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
-    std::transform(
-        std::begin(matches),
-        std::end(matches),
-        std::back_inserter(output),
-        [&](const auto& in) { return map.at(in); });
+    std::sort(
+        std::begin(hashed), std::end(hashed), [](const auto& l, const auto& r) {
+            return l.first < r.first;
+        });
+    // NOTE every target is reported, including targets which share a hash
+    auto element = std::begin(set);
+
+    for (const auto& [hash, it] : hashed) {
+        element = std::lower_bound(element, std::end(set), hash);
+
+        if (std::end(set) == element) { break; }
+
+        if (*element == hash) { output.emplace_back(it); }
+    }
 
     return output;
 }
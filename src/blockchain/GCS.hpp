@@ -70,6 +70,12 @@ public:
         const ReadView key,
         const UnallocatedVector<ReadView>& elements)
     noexcept(false);
+    GCS(const api::Session& api,
+        const std::uint8_t bits,
+        const std::uint32_t fpRate,
+        const ReadView key,
+        UnallocatedVector<std::uint64_t>&& siphashes)
+    noexcept(false);
 
     ~GCS() final = default;
 
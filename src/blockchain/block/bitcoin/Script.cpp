@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
@@ -45,141 +46,21 @@ auto BitcoinScript(
     -> std::unique_ptr<blockchain::block::bitcoin::internal::Script>
 {
     using ReturnType = blockchain::block::bitcoin::implementation::Script;
-    auto elements = blockchain::block::bitcoin::ScriptElements{};
 
     if ((nullptr == bytes.data()) || (0 == bytes.size()) ||
         (ReturnType::Position::Coinbase == role)) {
         return std::make_unique<ReturnType>(
-            chain, role, std::move(elements), 0);
+            chain, role, Space{}, ReturnType::Offsets{});
     }
 
-    elements.reserve(bytes.size());
-    auto it = reinterpret_cast<const std::byte*>(bytes.data());
-    auto read = std::size_t{0};
-    const auto target = bytes.size();
     const auto& logger = mute ? LogTrace() : LogVerbose();
+    auto offsets = ReturnType::index(bytes, allowInvalidOpcodes, logger);
 
-    try {
-        while (read < target) {
-            auto& element = elements.emplace_back();
-            auto& [opcode, invalid, size, data] = element;
-
-            try {
-                opcode = ReturnType::decode(*it);
-            } catch (...) {
-                if (allowInvalidOpcodes) {
-                    opcode = blockchain::block::bitcoin::OP::INVALIDOPCODE;
-                    invalid = *it;
-                } else {
-                    throw;
-                }
-            }
-
-            read += 1;
-            std::advance(it, 1);
-            const auto direct = ReturnType::is_direct_push(opcode);
-
-            if (direct.has_value()) {
-                const auto& pushSize = direct.value();
-                const auto remaining = target - read;
-                const auto effectiveSize = allowInvalidOpcodes
-                                               ? std::min(pushSize, remaining)
-                                               : pushSize;
-
-                if (((read + effectiveSize) > target)) {
-                    logger("opentxs::factory::")(__func__)(
-                        ": Incomplete direct data push")
-                        .Flush();
-
-                    return {};
-                }
-
-                data = space(effectiveSize);
-
-                if (0u < effectiveSize) {
-                    std::memcpy(data.value().data(), it, effectiveSize);
-                }
-
-                read += effectiveSize;
-                std::advance(it, effectiveSize);
-
-                continue;
-            }
-
-            const auto push = ReturnType::is_push(opcode);
-
-            if (push.has_value()) {
-                auto buf = be::little_uint32_buf_t{};
-
-                {
-                    const auto& sizeBytes = push.value();
-
-                    OT_ASSERT(0 < sizeBytes);
-                    OT_ASSERT(5 > sizeBytes);
-
-                    const auto remaining = target - read;
-                    const auto effectiveSize =
-                        allowInvalidOpcodes ? std::min(sizeBytes, remaining)
-                                            : sizeBytes;
-
-                    if ((read + effectiveSize) > target) {
-                        logger("opentxs::factory::")(__func__)(
-                            ": Incomplete data push")
-                            .Flush();
-
-                        return {};
-                    }
-
-                    if (0u < effectiveSize) {
-                        size = space(effectiveSize);
-                        std::memcpy(size.value().data(), it, effectiveSize);
-                        read += effectiveSize;
-                        std::advance(it, effectiveSize);
-                        std::memcpy(
-                            static_cast<void*>(&buf),
-                            size.value().data(),
-                            effectiveSize);
-                    }
-                }
-
-                {
-                    const auto pushSize = std::size_t{buf.value()};
-                    const auto remaining = target - read;
-                    const auto effectiveSize =
-                        allowInvalidOpcodes ? std::min(pushSize, remaining)
-                                            : pushSize;
-
-                    if ((read + effectiveSize) > target) {
-                        logger("opentxs::factory::")(__func__)(
-                            ": Data push bytes missing")
-                            .Flush();
-
-                        return {};
-                    }
-
-                    if (0u < effectiveSize) {
-                        data = space(effectiveSize);
-                        std::memcpy(data.value().data(), it, effectiveSize);
-                    }
-
-                    read += effectiveSize;
-                    std::advance(it, effectiveSize);
-                }
-
-                continue;
-            }
-        }
-    } catch (...) {
-        logger("opentxs::factory::")(__func__)(": Unknown opcode").Flush();
-
-        return {};
-    }
-
-    elements.shrink_to_fit();
+    if (false == offsets.has_value()) { return {}; }
 
     try {
         return std::make_unique<ReturnType>(
-            chain, role, std::move(elements), bytes.size());
+            chain, role, space(bytes), std::move(offsets.value()));
     } catch (const std::exception& e) {
         LogVerbose()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
 
@@ -208,9 +89,7 @@ auto BitcoinScript(
         return {};
     }
 
-    elements.shrink_to_fit();
-
-    return std::make_unique<ReturnType>(chain, role, std::move(elements));
+    return std::make_unique<ReturnType>(chain, role, elements);
 }
 }  // namespace opentxs::factory
 
@@ -240,22 +119,40 @@ namespace opentxs::blockchain::block::bitcoin::implementation
 Script::Script(
     const blockchain::Type chain,
     const Position role,
-    ScriptElements&& elements,
-    std::optional<std::size_t> size) noexcept
+    Space&& bytes,
+    Offsets&& offsets) noexcept
+    : chain_(chain)
+    , role_(role)
+    , bytes_(std::move(bytes))
+    , offsets_(std::move(offsets))
+    , decoded_()
+    , elements_()
+    , type_(get_type())
+{
+}
+
+Script::Script(
+    const blockchain::Type chain,
+    const Position role,
+    const ScriptElements& elements) noexcept
     : chain_(chain)
     , role_(role)
-    , elements_(std::move(elements))
-    , type_(get_type(role_, elements_))
-    , size_(size)
+    , bytes_(serialize(elements))
+    , offsets_(index(reader(bytes_), true, LogTrace()).value_or(Offsets{}))
+    , decoded_()
+    , elements_()
+    , type_(get_type())
 {
 }
 
 Script::Script(const Script& rhs) noexcept
     : chain_(rhs.chain_)
     , role_(rhs.role_)
-    , elements_(rhs.elements_)
+    , bytes_(rhs.bytes_)
+    , offsets_(rhs.offsets_)
+    , decoded_()
+    , elements_()
     , type_(rhs.type_)
-    , size_(rhs.size_)
 {
 }
 
@@ -296,9 +193,7 @@ auto Script::CalculateHash160(
 
 auto Script::CalculateSize() const noexcept -> std::size_t
 {
-    if (false == size_.has_value()) { size_ = bytes(elements_); }
-
-    return size_.value();
+    return bytes_.size();
 }
 
 auto Script::decode(const std::byte in) noexcept(false) -> OP
@@ -500,6 +395,33 @@ auto Script::decode(const std::byte in) noexcept(false) -> OP
     return map.at(std::to_integer<std::uint8_t>(in));
 }
 
+auto Script::elements() const noexcept -> const ScriptElements&
+{
+    std::call_once(decoded_, [this] {
+        const auto bytes = reader(bytes_);
+        elements_.reserve(offsets_.size());
+
+        for (const auto offset : offsets_) {
+            auto view = ElementView{};
+            // NOTE the script was validated when the offsets were calculated
+            read(bytes, offset, true, LogTrace(), view);
+            auto& element = elements_.emplace_back();
+            element.opcode_ = view.opcode_;
+            element.invalid_ = view.invalid_;
+
+            if (view.bytes_.has_value()) {
+                element.bytes_ = space(view.bytes_.value());
+            }
+
+            if (view.data_.has_value()) {
+                element.data_ = space(view.data_.value());
+            }
+        }
+    });
+
+    return elements_;
+}
+
 auto Script::evaluate_data(const ScriptElements& script) noexcept -> Pattern
 {
     OT_ASSERT(2 <= script.size());
@@ -627,7 +549,7 @@ auto Script::evaluate_segwit(const ScriptElements& script) noexcept -> Pattern
 auto Script::ExtractElements(const filter::Type style) const noexcept
     -> UnallocatedVector<Space>
 {
-    if (0 == elements_.size()) {
+    if (0 == offsets_.size()) {
         LogTrace()(OT_PRETTY_CLASS())("skipping empty script").Flush();
 
         return {};
@@ -639,10 +561,12 @@ auto Script::ExtractElements(const filter::Type style) const noexcept
         case filter::Type::ES: {
             LogTrace()(OT_PRETTY_CLASS())("processing data pushes").Flush();
 
-            for (const auto& element : *this) {
+            for (auto i = std::size_t{0}; i < offsets_.size(); ++i) {
+                const auto element = get_view(i);
+
                 if (is_data_push(element)) {
                     const auto& data = element.data_.value();
-                    auto it{data.data()};
+                    auto it = reinterpret_cast<const std::byte*>(data.data());
 
                     switch (data.size()) {
                         case 65: {
@@ -658,7 +582,7 @@ auto Script::ExtractElements(const filter::Type style) const noexcept
                         case 33:
                         case 32:
                         case 20: {
-                            output.emplace_back(data.cbegin(), data.cend());
+                            output.emplace_back(space(data));
                         } break;
                         default: {
                         }
@@ -677,7 +601,7 @@ auto Script::ExtractElements(const filter::Type style) const noexcept
         case filter::Type::Basic_BIP158:
         case filter::Type::Basic_BCHVariant:
         default: {
-            if (OP::RETURN == elements_.at(0).opcode_) {
+            if (OP::RETURN == get_opcode(0)) {
                 LogTrace()(OT_PRETTY_CLASS())("skipping null data script")
                     .Flush();
 
@@ -686,8 +610,7 @@ auto Script::ExtractElements(const filter::Type style) const noexcept
 
             LogTrace()(OT_PRETTY_CLASS())("processing serialized script")
                 .Flush();
-            auto& script = output.emplace_back();
-            Serialize(writer(script));
+            output.emplace_back(bytes_);
         }
     }
 
@@ -722,27 +645,25 @@ auto Script::first_opcode(const ScriptElements& script) noexcept -> OP
 auto Script::get_data(const std::size_t position) const noexcept(false)
     -> ReadView
 {
-    auto& data = elements_.at(position).data_;
+    const auto element = get_view(position);
 
-    if (false == data.has_value()) {
+    if (false == element.data_.has_value()) {
         throw std::out_of_range("No data at specified script position");
     }
 
-    return reader(data.value());
+    return element.data_.value();
 }
 
 auto Script::get_opcode(const std::size_t position) const noexcept(false) -> OP
 {
-    return elements_.at(position).opcode_;
+    return get_view(position).opcode_;
 }
 
-auto Script::get_type(
-    const Position role,
-    const ScriptElements& script) noexcept -> Pattern
+auto Script::get_type() const noexcept -> Pattern
 {
-    if (0 == script.size()) { return Pattern::Empty; }
+    if (0 == offsets_.size()) { return Pattern::Empty; }
 
-    switch (role) {
+    switch (role_) {
         case Position::Coinbase: {
 
             return Pattern::Coinbase;
@@ -753,6 +674,13 @@ auto Script::get_type(
         }
         case Position::Redeem:
         case Position::Output: {
+            if (const auto type = match_template(reader(bytes_)); type) {
+
+                return type.value();
+            }
+
+            const auto& script = elements();
+
             if (potential_pubkey_hash(script)) {
                 return evaluate_pubkey_hash(script);
             } else if (potential_script_hash(script)) {
@@ -775,6 +703,40 @@ auto Script::get_type(
     }
 }
 
+auto Script::get_view(const std::size_t position) const noexcept(false)
+    -> ElementView
+{
+    auto output = ElementView{};
+    read(reader(bytes_), offsets_.at(position), true, LogTrace(), output);
+
+    return output;
+}
+
+auto Script::index(
+    const ReadView bytes,
+    const bool allowInvalidOpcodes,
+    const Log& logger) noexcept -> std::optional<Offsets>
+{
+    auto output = Offsets{};
+    auto element = ElementView{};
+    auto offset = std::size_t{0};
+
+    // NOTE most scripts are standard templates with five or fewer elements
+    output.reserve(std::min<std::size_t>(bytes.size(), 5u));
+
+    while (offset < bytes.size()) {
+        output.emplace_back(static_cast<std::uint32_t>(offset));
+        const auto next =
+            read(bytes, offset, allowInvalidOpcodes, logger, element);
+
+        if (false == next.has_value()) { return std::nullopt; }
+
+        offset = next.value();
+    }
+
+    return output;
+}
+
 auto Script::IsNotification(
     const std::uint8_t version,
     const PaymentCode& recipient) const noexcept -> bool
@@ -804,11 +766,16 @@ auto Script::IsNotification(
     return 0 == std::memcmp(expect.data(), std::next(bytes.data()), 32);
 }
 
-auto Script::is_data_push(const value_type& element) noexcept -> bool
+auto Script::is_data_push(const ElementView& element) noexcept -> bool
 {
     return validate(element, true);
 }
 
+auto Script::is_data_push(const value_type& element) noexcept -> bool
+{
+    return is_data_push(view(element));
+}
+
 auto Script::is_direct_push(const OP opcode) noexcept(false)
     -> std::optional<std::size_t>
 {
@@ -835,14 +802,19 @@ auto Script::is_push(const OP opcode) noexcept(false)
     return std::nullopt;
 }
 
-auto Script::is_hash160(const value_type& element) noexcept -> bool
+auto Script::is_hash160(const ElementView& element) noexcept -> bool
 {
     if (false == is_data_push(element)) { return false; }
 
     return 20 == element.data_->size();
 }
 
-auto Script::is_public_key(const value_type& element) noexcept -> bool
+auto Script::is_hash160(const value_type& element) noexcept -> bool
+{
+    return is_hash160(view(element));
+}
+
+auto Script::is_public_key(const ElementView& element) noexcept -> bool
 {
     if (false == is_data_push(element)) { return false; }
 
@@ -851,6 +823,11 @@ auto Script::is_public_key(const value_type& element) noexcept -> bool
     return (33 == size) || (65 == size);
 }
 
+auto Script::is_public_key(const value_type& element) noexcept -> bool
+{
+    return is_public_key(view(element));
+}
+
 auto Script::last_opcode(const ScriptElements& script) noexcept -> OP
 {
     return script.crbegin()->opcode_;
@@ -899,21 +876,20 @@ auto Script::LikelyPubkeyHashes(const api::Session& api) const noexcept
         case Pattern::NullData:
         case Pattern::Input:
         default: {
-            for (const auto& element : elements_) {
+            for (auto i = std::size_t{0}; i < offsets_.size(); ++i) {
+                const auto element = get_view(i);
+
                 if (is_hash160(element)) {
                     OT_ASSERT(element.data_.has_value());
 
                     output.emplace_back(
-                        api.Factory().Data(reader(element.data_.value())));
+                        api.Factory().Data(element.data_.value()));
                 } else if (is_public_key(element)) {
                     OT_ASSERT(element.data_.has_value());
 
                     auto hash = api.Factory().Data();
                     blockchain::PubkeyHash(
-                        api,
-                        chain_,
-                        reader(element.data_.value()),
-                        hash->WriteInto());
+                        api, chain_, element.data_.value(), hash->WriteInto());
                     output.emplace_back(std::move(hash));
                 }
             }
@@ -923,6 +899,66 @@ auto Script::LikelyPubkeyHashes(const api::Session& api) const noexcept
     return output;
 }
 
+auto Script::match_template(const ReadView bytes) noexcept
+    -> std::optional<Pattern>
+{
+    const auto* b = reinterpret_cast<const std::uint8_t*>(bytes.data());
+    const auto is = [&](std::size_t position, OP opcode) {
+        return static_cast<std::uint8_t>(opcode) == b[position];
+    };
+
+    switch (bytes.size()) {
+        case 22: {
+            if (is(0, OP::ZERO) && is(1, OP::PUSHDATA_20)) {
+
+                return Pattern::PayToWitnessPubkeyHash;
+            }
+        } break;
+        case 23: {
+            if (is(0, OP::HASH160) && is(1, OP::PUSHDATA_20) &&
+                is(22, OP::EQUAL)) {
+
+                return Pattern::PayToScriptHash;
+            }
+        } break;
+        case 25: {
+            if (is(0, OP::DUP) && is(1, OP::HASH160) &&
+                is(2, OP::PUSHDATA_20) && is(23, OP::EQUALVERIFY) &&
+                is(24, OP::CHECKSIG)) {
+
+                return Pattern::PayToPubkeyHash;
+            }
+        } break;
+        case 34: {
+            if (is(0, OP::ZERO) && is(1, OP::PUSHDATA_32)) {
+
+                return Pattern::PayToWitnessScriptHash;
+            }
+
+            if (is(0, OP::ONE) && is(1, OP::PUSHDATA_32)) {
+
+                return Pattern::PayToTaproot;
+            }
+        } break;
+        case 35: {
+            if (is(0, OP::PUSHDATA_33) && is(34, OP::CHECKSIG)) {
+
+                return Pattern::PayToPubkey;
+            }
+        } break;
+        case 67: {
+            if (is(0, OP::PUSHDATA_65) && is(66, OP::CHECKSIG)) {
+
+                return Pattern::PayToPubkey;
+            }
+        } break;
+        default: {
+        }
+    }
+
+    return std::nullopt;
+}
+
 auto Script::M() const noexcept -> std::optional<std::uint8_t>
 {
     if (Pattern::PayToMultisig != type_) { return {}; }
@@ -946,7 +982,7 @@ auto Script::N() const noexcept -> std::optional<std::uint8_t>
 {
     if (Pattern::PayToMultisig != type_) { return {}; }
 
-    return to_number(get_opcode(elements_.size() - 2));
+    return to_number(get_opcode(offsets_.size() - 2));
 }
 
 auto Script::potential_data(const ScriptElements& script) noexcept -> bool
@@ -1019,7 +1055,7 @@ auto Script::Print() const noexcept -> UnallocatedCString
 {
     auto output = std::stringstream{};
 
-    for (const auto& [opcode, invalid, push, data] : elements_) {
+    for (const auto& [opcode, invalid, push, data] : elements()) {
         output << "      op: "
                << std::to_string(static_cast<std::uint8_t>(opcode));
 
@@ -1080,17 +1116,119 @@ auto Script::PubkeyHash() const noexcept -> std::optional<ReadView>
     }
 }
 
+auto Script::read(
+    const ReadView bytes,
+    const std::size_t offset,
+    const bool allowInvalidOpcodes,
+    const Log& logger,
+    ElementView& out) noexcept -> std::optional<std::size_t>
+{
+    const auto* it = reinterpret_cast<const std::byte*>(bytes.data());
+    const auto target = bytes.size();
+    auto read = offset;
+    out = {};
+
+    OT_ASSERT(read < target);
+
+    std::advance(it, read);
+
+    try {
+        out.opcode_ = decode(*it);
+    } catch (...) {
+        if (false == allowInvalidOpcodes) {
+            logger(OT_PRETTY_STATIC(Script))("Unknown opcode").Flush();
+
+            return std::nullopt;
+        }
+
+        out.opcode_ = OP::INVALIDOPCODE;
+        out.invalid_ = *it;
+    }
+
+    read += 1;
+    std::advance(it, 1);
+    const auto get = [&](std::size_t size) {
+        return ReadView{reinterpret_cast<const char*>(it), size};
+    };
+
+    if (const auto direct = is_direct_push(out.opcode_); direct.has_value()) {
+        const auto& pushSize = direct.value();
+        const auto remaining = target - read;
+        const auto effectiveSize =
+            allowInvalidOpcodes ? std::min(pushSize, remaining) : pushSize;
+
+        if ((read + effectiveSize) > target) {
+            logger(OT_PRETTY_STATIC(Script))("Incomplete direct data push")
+                .Flush();
+
+            return std::nullopt;
+        }
+
+        out.data_ = get(effectiveSize);
+
+        return read + effectiveSize;
+    }
+
+    if (const auto push = is_push(out.opcode_); push.has_value()) {
+        auto buf = be::little_uint32_buf_t{};
+
+        {
+            const auto& sizeBytes = push.value();
+
+            OT_ASSERT(0 < sizeBytes);
+            OT_ASSERT(5 > sizeBytes);
+
+            const auto remaining = target - read;
+            const auto effectiveSize =
+                allowInvalidOpcodes ? std::min(sizeBytes, remaining)
+                                    : sizeBytes;
+
+            if ((read + effectiveSize) > target) {
+                logger(OT_PRETTY_STATIC(Script))("Incomplete data push")
+                    .Flush();
+
+                return std::nullopt;
+            }
+
+            if (0u < effectiveSize) {
+                out.bytes_ = get(effectiveSize);
+                std::memcpy(static_cast<void*>(&buf), it, effectiveSize);
+                read += effectiveSize;
+                std::advance(it, effectiveSize);
+            }
+        }
+
+        const auto pushSize = std::size_t{buf.value()};
+        const auto remaining = target - read;
+        const auto effectiveSize =
+            allowInvalidOpcodes ? std::min(pushSize, remaining) : pushSize;
+
+        if ((read + effectiveSize) > target) {
+            logger(OT_PRETTY_STATIC(Script))("Data push bytes missing")
+                .Flush();
+
+            return std::nullopt;
+        }
+
+        if (0u < effectiveSize) { out.data_ = get(effectiveSize); }
+
+        return read + effectiveSize;
+    }
+
+    return read;
+}
+
 auto Script::RedeemScript() const noexcept -> std::unique_ptr<bitcoin::Script>
 {
     if (Position::Input != role_) { return {}; }
-    if (0 == elements_.size()) { return {}; }
+    if (0 == offsets_.size()) { return {}; }
 
-    const auto& element = *elements_.crbegin();
+    const auto element = get_view(offsets_.size() - 1u);
 
     if (false == is_data_push(element)) { return {}; }
 
     return factory::BitcoinScript(
-        chain_, reader(element.data_.value()), Position::Redeem, true, true);
+        chain_, element.data_.value(), Position::Redeem, true, true);
 }
 
 auto Script::ScriptHash() const noexcept -> std::optional<ReadView>
@@ -1127,9 +1265,17 @@ auto Script::Serialize(const AllocateOutput destination) const noexcept -> bool
         return false;
     }
 
-    auto it = static_cast<std::byte*>(output.data());
+    std::memcpy(output.data(), bytes_.data(), size);
+
+    return true;
+}
+
+auto Script::serialize(const ScriptElements& script) noexcept -> Space
+{
+    auto output = space(bytes(script));
+    auto it = output.data();
 
-    for (const auto& element : elements_) {
+    for (const auto& element : script) {
         const auto& [opcode, invalid, bytes, data] = element;
 
         if (invalid.has_value()) {
@@ -1158,7 +1304,7 @@ auto Script::Serialize(const AllocateOutput destination) const noexcept -> bool
         }
     }
 
-    return true;
+    return output;
 }
 
 auto Script::SigningSubscript(const blockchain::Type chain) const noexcept
@@ -1178,7 +1324,7 @@ auto Script::SigningSubscript(const blockchain::Type chain) const noexcept
             }();
 
             return std::make_unique<Script>(
-                chain_, Position::Output, std::move(elements));
+                chain_, Position::Output, elements);
         }
         default: {
             // TODO handle OP_CODESEPERATOR shit
@@ -1202,14 +1348,14 @@ auto Script::to_number(const OP opcode) noexcept -> std::uint8_t
 auto Script::validate(const ScriptElements& elements) noexcept -> bool
 {
     for (const auto& element : elements) {
-        if (false == validate(element, false)) { return false; }
+        if (false == validate(view(element), false)) { return false; }
     }
 
     return true;
 }
 
 auto Script::validate(
-    const ScriptElement& element,
+    const ElementView& element,
     const bool checkForData) noexcept -> bool
 {
     const auto& [opcode, invalid, bytes, data] = element;
@@ -1261,8 +1407,20 @@ auto Script::Value(const std::size_t position) const noexcept
 
     const auto index = position + 1u;
 
-    if (index > elements_.size()) { return {}; }
+    if (index > offsets_.size()) { return {}; }
 
     return get_data(index);
 }
+
+auto Script::view(const value_type& element) noexcept -> ElementView
+{
+    const auto& [opcode, invalid, bytes, data] = element;
+    auto output = ElementView{opcode, invalid, std::nullopt, std::nullopt};
+
+    if (bytes.has_value()) { output.bytes_ = reader(bytes.value()); }
+
+    if (data.has_value()) { output.data_ = reader(data.value()); }
+
+    return output;
+}
 }  // namespace opentxs::blockchain::block::bitcoin::implementation
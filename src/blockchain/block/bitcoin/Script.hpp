@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
@@ -37,18 +38,33 @@ class Session;
 }  // namespace api
 
 class PaymentCode;
+class Log;
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
 namespace opentxs::blockchain::block::bitcoin::implementation
 {
+/** Bitcoin script stored as its serialized bytes
+ *
+ *  The position of every element is recorded in an offsets table when the
+ *  script is parsed, and data pushes are returned as views of the serialized
+ *  bytes. Standard output templates are recognized directly from the bytes.
+ *  The ScriptElements form is only decoded on first use of the element
+ *  accessors, which during wallet scanning means non-standard scripts.
+ */
 class Script final : public internal::Script
 {
 public:
+    using Offsets = UnallocatedVector<std::uint32_t>;
+
     static auto decode(const std::byte in) noexcept(false) -> OP;
     static auto is_direct_push(const OP opcode) noexcept(false)
         -> std::optional<std::size_t>;
+    static auto index(
+        const ReadView bytes,
+        const bool allowInvalidOpcodes,
+        const Log& logger) noexcept -> std::optional<Offsets>;
     static auto is_push(const OP opcode) noexcept(false)
         -> std::optional<std::size_t>;
     static auto validate(const ScriptElements& elements) noexcept -> bool;
@@ -56,7 +72,7 @@ public:
     auto at(const std::size_t position) const noexcept(false)
         -> const value_type& final
     {
-        return elements_.at(position);
+        return elements().at(position);
     }
     auto begin() const noexcept -> const_iterator final { return cbegin(); }
     auto CalculateHash160(const api::Session& api, const AllocateOutput output)
@@ -68,7 +84,7 @@ public:
     }
     auto cend() const noexcept -> const_iterator final
     {
-        return const_iterator(this, elements_.size());
+        return const_iterator(this, offsets_.size());
     }
     auto end() const noexcept -> const_iterator final { return cend(); }
     auto ExtractElements(const filter::Type style) const noexcept
@@ -99,7 +115,7 @@ public:
         -> bool final;
     auto SigningSubscript(const blockchain::Type chain) const noexcept
         -> std::unique_ptr<internal::Script> final;
-    auto size() const noexcept -> std::size_t final { return elements_.size(); }
+    auto size() const noexcept -> std::size_t final { return offsets_.size(); }
     auto Type() const noexcept -> Pattern final { return type_; }
     auto Value(const std::size_t position) const noexcept
         -> std::optional<ReadView> final;
@@ -107,23 +123,40 @@ public:
     Script(
         const blockchain::Type chain,
         const Position role,
-        ScriptElements&& elements,
-        std::optional<std::size_t> size = {}) noexcept;
+        Space&& bytes,
+        Offsets&& offsets) noexcept;
+    Script(
+        const blockchain::Type chain,
+        const Position role,
+        const ScriptElements& elements) noexcept;
     Script(const Script&) noexcept;
 
     ~Script() final = default;
 
 private:
+    // A script element which refers to the serialized bytes
+    struct ElementView {
+        OP opcode_{};
+        std::optional<std::byte> invalid_{};
+        std::optional<ReadView> bytes_{};
+        std::optional<ReadView> data_{};
+    };
+
     const blockchain::Type chain_;
     const Position role_;
-    const ScriptElements elements_;
+    const Space bytes_;
+    const Offsets offsets_;
+    mutable std::once_flag decoded_;
+    mutable ScriptElements elements_;
     const Pattern type_;
-    mutable std::optional<std::size_t> size_;
 
     static auto bytes(const value_type& element) noexcept -> std::size_t;
     static auto bytes(const ScriptElements& script) noexcept -> std::size_t;
+    static auto is_data_push(const ElementView& element) noexcept -> bool;
     static auto is_data_push(const value_type& element) noexcept -> bool;
+    static auto is_hash160(const ElementView& element) noexcept -> bool;
     static auto is_hash160(const value_type& element) noexcept -> bool;
+    static auto is_public_key(const ElementView& element) noexcept -> bool;
     static auto is_public_key(const value_type& element) noexcept -> bool;
     static auto evaluate_data(const ScriptElements& script) noexcept -> Pattern;
     static auto evaluate_multisig(const ScriptElements& script) noexcept
@@ -137,10 +170,9 @@ private:
     static auto evaluate_segwit(const ScriptElements& script) noexcept
         -> Pattern;
     static auto first_opcode(const ScriptElements& script) noexcept -> OP;
-    static auto get_type(
-        const Position role,
-        const ScriptElements& script) noexcept -> Pattern;
     static auto last_opcode(const ScriptElements& script) noexcept -> OP;
+    static auto match_template(const ReadView bytes) noexcept
+        -> std::optional<Pattern>;
     static auto potential_data(const ScriptElements& script) noexcept -> bool;
     static auto potential_multisig(const ScriptElements& script) noexcept
         -> bool;
@@ -150,13 +182,25 @@ private:
     static auto potential_script_hash(const ScriptElements& script) noexcept
         -> bool;
     static auto potential_segwit(const ScriptElements& script) noexcept -> bool;
+    static auto read(
+        const ReadView bytes,
+        const std::size_t offset,
+        const bool allowInvalidOpcodes,
+        const Log& logger,
+        ElementView& out) noexcept -> std::optional<std::size_t>;
+    static auto serialize(const ScriptElements& script) noexcept -> Space;
     static auto to_number(const OP opcode) noexcept -> std::uint8_t;
     static auto validate(
-        const ScriptElement& element,
+        const ElementView& element,
         const bool checkForData = false) noexcept -> bool;
+    static auto view(const value_type& element) noexcept -> ElementView;
 
+    auto elements() const noexcept -> const ScriptElements&;
     auto get_data(const std::size_t position) const noexcept(false) -> ReadView;
     auto get_opcode(const std::size_t position) const noexcept(false) -> OP;
+    auto get_type() const noexcept -> Pattern;
+    auto get_view(const std::size_t position) const noexcept(false)
+        -> ElementView;
 
     Script() = delete;
     Script(Script&&) = delete;
@@ -82,6 +82,46 @@ auto Blocks::LoadBitcoin(const block::Hash& block) const noexcept
     }
 }
 
+auto Blocks::LoadRaw(
+    const block::Hash& block,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    auto write = [&](const ReadView bytes) {
+        if (false == copy(bytes, destination)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to copy block").Flush();
+
+            return false;
+        }
+
+        return true;
+    };
+
+    if (block == genesis_) {
+        const auto& hex = params::Data::Chains().at(chain_).genesis_block_hex_;
+        const auto data = api_.Factory().Data(hex, StringStyle::Hex);
+
+        if (data->empty()) {
+            LogError()(OT_PRETTY_CLASS())("Invalid genesis hex").Flush();
+
+            return false;
+        }
+
+        return write(data->Bytes());
+    } else {
+        const auto bytes = common_.BlockLoad(block);
+
+        if (false == bytes.valid()) {
+            LogDebug()(OT_PRETTY_CLASS())("block ")(block.asHex())(
+                " not found.")
+                .Flush();
+
+            return false;
+        }
+
+        return write(bytes.get());
+    }
+}
+
 auto Blocks::SetTip(const block::Position& position) const noexcept -> bool
 {
     return lmdb_
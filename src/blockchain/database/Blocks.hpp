@@ -85,6 +85,9 @@ class Blocks
 public:
     auto LoadBitcoin(const block::Hash& block) const noexcept
         -> std::shared_ptr<const block::bitcoin::Block>;
+    /// Copy the serialized block from storage without parsing it
+    auto LoadRaw(const block::Hash& block, const AllocateOutput destination)
+        const noexcept -> bool;
     auto SetTip(const block::Position& position) const noexcept -> bool;
     auto Store(const block::Block& block) const noexcept -> bool;
     auto Tip() const noexcept -> block::Position;
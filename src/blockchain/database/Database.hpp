@@ -193,6 +193,12 @@ public:
     {
         return blocks_.LoadBitcoin(block);
     }
+    auto BlockLoadRaw(
+        const block::Hash& block,
+        const AllocateOutput destination) const noexcept -> bool final
+    {
+        return blocks_.LoadRaw(block, destination);
+    }
     auto BlockPolicy() const noexcept -> database::BlockStorage final
     {
         return common_.BlockPolicy();
@@ -379,6 +385,13 @@ public:
     {
         return filters_.LoadFilter(type, block);
     }
+    auto LoadFilterBytes(
+        const filter::Type type,
+        const ReadView block,
+        const AllocateOutput destination) const noexcept -> bool final
+    {
+        return filters_.LoadFilterBytes(type, block, destination);
+    }
     auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash final
     {
@@ -444,6 +457,15 @@ public:
     {
         return wallet_.ReserveUTXO(spender, proposal, policy);
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const node::wallet::SelectionTarget& target,
+        node::internal::SpendPolicy& policy) const noexcept
+        -> std::optional<UnallocatedVector<UTXO>> final
+    {
+        return wallet_.ReserveUTXOs(spender, proposal, target, policy);
+    }
     auto SetBlockTip(const block::Position& position) const noexcept
         -> bool final
     {
@@ -152,6 +152,14 @@ auto Filters::LoadFilter(const filter::Type type, const ReadView block)
     return common_.LoadFilter(type, block);
 }
 
+auto Filters::LoadFilterBytes(
+    const filter::Type type,
+    const ReadView block,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    return common_.LoadFilterBytes(type, block, destination);
+}
+
 auto Filters::LoadFilterHash(const filter::Type type, const ReadView block)
     const noexcept -> Hash
 {
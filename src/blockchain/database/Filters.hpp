@@ -85,6 +85,10 @@ public:
         const noexcept -> bool;
     auto LoadFilter(const filter::Type type, const ReadView block)
         const noexcept -> std::unique_ptr<const blockchain::GCS>;
+    auto LoadFilterBytes(
+        const filter::Type type,
+        const ReadView block,
+        const AllocateOutput destination) const noexcept -> bool;
     auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash;
     auto LoadFilterHeader(const filter::Type type, const ReadView block)
@@ -281,6 +281,23 @@ auto Wallet::ReserveUTXO(
     return outputs_.ReserveUTXO(spender, id, policy);
 }
 
+auto Wallet::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& id,
+    const node::wallet::SelectionTarget& target,
+    node::internal::SpendPolicy& policy) const noexcept
+    -> std::optional<UnallocatedVector<UTXO>>
+{
+    if (false == proposals_.Exists(id)) {
+        LogError()(OT_PRETTY_CLASS())("Proposal ")(id)(" does not exist")
+            .Flush();
+
+        return std::nullopt;
+    }
+
+    return outputs_.ReserveUTXOs(spender, id, target, policy);
+}
+
 auto Wallet::SubchainAddElements(
     const SubchainIndex& index,
     const ElementMap& elements) const noexcept -> bool
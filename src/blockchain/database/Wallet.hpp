@@ -201,6 +201,12 @@ public:
         const Identifier& proposal,
         node::internal::SpendPolicy& policy) const noexcept
         -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const node::wallet::SelectionTarget& target,
+        node::internal::SpendPolicy& policy) const noexcept
+        -> std::optional<UnallocatedVector<UTXO>>;
     auto SubchainAddElements(
         const SubchainIndex& index,
         const ElementMap& elements) const noexcept -> bool;
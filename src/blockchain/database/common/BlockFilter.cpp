@@ -7,7 +7,9 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "blockchain/database/common/BlockFilter.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <cstring>
+#include <iterator>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -20,6 +22,7 @@
 #include "internal/util/TSV.hpp"
 #include "opentxs/blockchain/GCS.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "serialization/protobuf/BlockchainFilterHeader.pb.h"
@@ -70,28 +73,47 @@ auto BlockFilter::LoadFilter(const filter::Type type, const ReadView blockHash)
     auto output = std::unique_ptr<const opentxs::blockchain::GCS>{};
 
     try {
-        const auto index = [&] {
-            auto out = util::IndexData{};
-            auto cb = [&out](const ReadView in) {
-                if (sizeof(out) != in.size()) { return; }
+        output = factory::GCS(api_, load(type, blockHash));
+    } catch (const std::exception& e) {
+        LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
 
-                std::memcpy(static_cast<void*>(&out), in.data(), in.size());
-            };
-            lmdb_.Load(translate_filter(type), blockHash, cb);
+    return output;
+}
 
-            if (0 == out.size_) {
-                throw std::out_of_range("Cfilter not found");
-            }
+auto BlockFilter::LoadFilterBytes(
+    const filter::Type type,
+    const ReadView blockHash,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    using CompactSize = network::blockchain::bitcoin::CompactSize;
 
-            return out;
-        }();
-        output = factory::GCS(
-            api_, proto::Factory<proto::GCS>(bulk_.ReadView(index)));
+    try {
+        const auto proto = load(type, blockHash);
+        const auto count = CompactSize{proto.count()}.Encode();
+        const auto& filter = proto.filter();
+
+        if (false == bool(destination)) {
+            throw std::runtime_error("Invalid output allocator");
+        }
+
+        auto out = destination(count.size() + filter.size());
+
+        if (false == out.valid(count.size() + filter.size())) {
+            throw std::runtime_error("Failed to allocate space for output");
+        }
+
+        auto* it = out.as<std::byte>();
+        std::memcpy(it, count.data(), count.size());
+        std::advance(it, count.size());
+        std::memcpy(it, filter.data(), filter.size());
+
+        return true;
     } catch (const std::exception& e) {
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
-    }
 
-    return output;
+        return false;
+    }
 }
 
 auto BlockFilter::LoadFilterHash(
@@ -156,6 +178,29 @@ auto BlockFilter::LoadFilterHeader(
     return output;
 }
 
+auto BlockFilter::load(const filter::Type type, const ReadView blockHash) const
+    noexcept(false) -> proto::GCS
+{
+    // NOTE the extent may be relocated or reused as soon as the bulk lock is
+    // released so the index must be read and the filter parsed while it is held
+    auto lock = Lock{bulk_.Mutex()};
+    const auto index = [&] {
+        auto out = util::IndexData{};
+        auto cb = [&out](const ReadView in) {
+            if (sizeof(out) != in.size()) { return; }
+
+            std::memcpy(static_cast<void*>(&out), in.data(), in.size());
+        };
+        lmdb_.Load(translate_filter(type), blockHash, cb);
+
+        if (0 == out.size_) { throw std::out_of_range("Cfilter not found"); }
+
+        return out;
+    }();
+
+    return proto::Factory<proto::GCS>(bulk_.ReadView(lock, index));
+}
+
 auto BlockFilter::store(
     const Lock& lock,
     storage::lmdb::LMDB::Transaction& tx,
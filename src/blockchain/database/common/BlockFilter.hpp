@@ -41,6 +41,11 @@ class Bulk;
 class GCS;
 }  // namespace blockchain
 
+namespace proto
+{
+class GCS;
+}  // namespace proto
+
 namespace storage
 {
 namespace lmdb
@@ -63,6 +68,12 @@ public:
         const noexcept -> bool;
     auto LoadFilter(const filter::Type type, const ReadView blockHash)
         const noexcept -> std::unique_ptr<const opentxs::blockchain::GCS>;
+    /// Write the BIP157 encoding of a filter (element count followed by the
+    /// Golomb-coded set) without constructing a GCS object
+    auto LoadFilterBytes(
+        const filter::Type type,
+        const ReadView blockHash,
+        const AllocateOutput destination) const noexcept -> bool;
     auto LoadFilterHash(
         const filter::Type type,
         const ReadView blockHash,
@@ -102,6 +113,8 @@ private:
     static auto translate_header(const filter::Type type) noexcept(false)
         -> Table;
 
+    auto load(const filter::Type type, const ReadView blockHash) const
+        noexcept(false) -> proto::GCS;
     auto store(
         const Lock& lock,
         storage::lmdb::LMDB::Transaction& tx,
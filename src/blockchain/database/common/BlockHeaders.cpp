@@ -44,6 +44,9 @@ auto BlockHeader::Exists(
 auto BlockHeader::Load(const opentxs::blockchain::block::Hash& hash) const
     noexcept(false) -> proto::BlockchainBlockHeader
 {
+    // NOTE the extent may be relocated or reused as soon as the bulk lock is
+    // released so the index must be read and the header parsed while it is held
+    auto lock = Lock{bulk_.Mutex()};
     const auto index = [&] {
         auto out = util::IndexData{};
         auto cb = [&out](const ReadView in) {
@@ -60,7 +63,8 @@ auto BlockHeader::Load(const opentxs::blockchain::block::Hash& hash) const
         return out;
     }();
 
-    return proto::Factory<proto::BlockchainBlockHeader>(bulk_.ReadView(index));
+    return proto::Factory<proto::BlockchainBlockHeader>(
+        bulk_.ReadView(lock, index));
 }
 
 auto BlockHeader::Store(
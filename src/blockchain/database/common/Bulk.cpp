@@ -7,16 +7,67 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "blockchain/database/common/Bulk.hpp"  // IWYU pragma: associated
 
+#include <cstring>
+#include <exception>
 #include <mutex>
 #include <utility>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/TSV.hpp"
+#include "opentxs/util/Log.hpp"
 #include "util/MappedFileStorage.hpp"
 
 namespace opentxs::blockchain::database::common
 {
 struct Bulk::Imp final : private util::MappedFileStorage {
+    auto Compact(std::size_t budget) const noexcept
+        -> std::optional<util::CompactionReport>
+    {
+        try {
+            // NOTE the same lock order as every other writer
+            auto tx = lmdb_.TransactionRW();
+            auto lock = Lock{lock_};
+            auto items = UnallocatedVector<Item>{};
+            auto keys = UnallocatedVector<std::pair<Table, Space>>{};
+
+            for (const auto& [table, movable] : tables_) {
+                lmdb_.Read(
+                    table,
+                    [&](const auto key, const auto value) {
+                        auto& item = items.emplace_back();
+                        item.movable_ = movable;
+                        keys.emplace_back(table, space(key));
+
+                        if (sizeof(item.index_) == value.size()) {
+                            std::memcpy(
+                                static_cast<void*>(&item.index_),
+                                value.data(),
+                                value.size());
+                        }
+
+                        return true;
+                    },
+                    storage::lmdb::LMDB::Dir::Forward);
+            }
+
+            return compact(
+                tx,
+                items,
+                [&](auto& tx, auto item, const auto& index) {
+                    const auto& [table, key] = keys.at(item);
+
+                    return lmdb_.Store(table, reader(key), tsv(index), tx)
+                        .first;
+                },
+                budget);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return std::nullopt;
+        }
+    }
     auto Mutex() const noexcept -> std::mutex& { return lock_; }
     auto ReadView(const Lock&, const util::IndexData& index) const noexcept
         -> opentxs::ReadView
@@ -40,12 +91,23 @@ struct Bulk::Imp final : private util::MappedFileStorage {
               path,
               "blk",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextBlockAddress))
+              static_cast<std::size_t>(Database::Key::NextBlockAddress),
+              Table::BulkFreeSpace)
         , lock_()
     {
     }
 
 private:
+    // NOTE every table which stores the index of an item in these files
+    static constexpr std::pair<Table, bool> tables_[] = {
+        {Table::BlockIndex, false},
+        {Table::HeaderIndex, true},
+        {Table::FilterIndexBasic, true},
+        {Table::FilterIndexBCH, true},
+        {Table::FilterIndexES, true},
+        {Table::TransactionIndex, true},
+    };
+
     mutable std::mutex lock_;
 };
 
@@ -55,6 +117,12 @@ Bulk::Bulk(storage::lmdb::LMDB& lmdb, const UnallocatedCString& path) noexcept(
 {
 }
 
+auto Bulk::Compact(std::size_t budget) const noexcept
+    -> std::optional<util::CompactionReport>
+{
+    return imp_->Compact(budget);
+}
+
 auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
 
 auto Bulk::ReadView(const util::IndexData& index) const noexcept
@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 #include "opentxs/Types.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -30,6 +31,7 @@ class LMDB;
 
 namespace util
 {
+struct CompactionReport;
 struct IndexData;
 }  // namespace util
 // }  // namespace v1
@@ -44,7 +46,20 @@ public:
     using UpdateCallback =
         std::function<bool(storage::lmdb::LMDB::Transaction&)>;
 
+    /** Relocate up to budget bytes of items and release unused space
+     *
+     *  Blocks are never relocated since BlockWriter fills its view after the
+     *  lock has been released.
+     */
+    auto Compact(std::size_t budget) const noexcept
+        -> std::optional<util::CompactionReport>;
     auto Mutex() const noexcept -> std::mutex&;
+    /** Only valid for items which are never relocated, such as blocks
+     *
+     *  Views of any other item must be obtained and consumed while holding
+     *  Mutex() since Compact or a replacement may reuse the extent once the
+     *  lock has been released.
+     */
     auto ReadView(const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
     auto ReadView(const Lock& lock, const util::IndexData& index) const noexcept
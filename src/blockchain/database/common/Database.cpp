@@ -44,6 +44,7 @@ extern "C" {
 #include "opentxs/util/Pimpl.hpp"
 #include "serialization/protobuf/BlockchainBlockHeader.pb.h"
 #include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
 
 constexpr auto false_byte_ = std::byte{0x0};
 constexpr auto true_byte_ = std::byte{0x1};
@@ -303,6 +304,8 @@ struct Database::Imp {
                       {Table::FilterIndexBCH, 0},
                       {Table::FilterIndexES, 0},
                       {Table::TransactionIndex, 0},
+                      {Table::BulkFreeSpace, MDB_DUPSORT | MDB_INTEGERKEY},
+                      {Table::SyncFreeSpace, MDB_DUPSORT | MDB_INTEGERKEY},
                   };
 
                   for (const auto& [table, name] : SyncTables()) {
@@ -364,6 +367,8 @@ const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
         {Table::FilterIndexBCH, "block_filters_bch_2"},
         {Table::FilterIndexES, "block_filters_opentxs_2"},
         {Table::TransactionIndex, "transactions"},
+        {Table::BulkFreeSpace, "bulk_free_space"},
+        {Table::SyncFreeSpace, "sync_free_space"},
     };
 
     for (const auto& [table, name] : SyncTables()) {
@@ -435,6 +440,12 @@ auto Database::BlockStore(const BlockHash& block, const std::size_t bytes)
     return imp_.blocks_.Store(block, bytes);
 }
 
+auto Database::CompactStorage(std::size_t budget) const noexcept
+    -> std::optional<util::CompactionReport>
+{
+    return imp_.bulk_.Compact(budget);
+}
+
 auto Database::DeleteSyncServer(
     const UnallocatedCString& endpoint) const noexcept -> bool
 {
@@ -516,6 +527,14 @@ auto Database::LoadFilter(const filter::Type type, const ReadView blockHash)
     return imp_.filters_.LoadFilter(type, blockHash);
 }
 
+auto Database::LoadFilterBytes(
+    const filter::Type type,
+    const ReadView blockHash,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    return imp_.filters_.LoadFilterBytes(type, blockHash, destination);
+}
+
 auto Database::LoadFilterHash(
     const filter::Type type,
     const ReadView blockHash,
@@ -538,6 +557,12 @@ auto Database::LoadTransaction(const ReadView txid) const noexcept
     return imp_.wallet_.LoadTransaction(txid);
 }
 
+auto Database::LoadTransactionShared(const ReadView txid) const noexcept
+    -> std::shared_ptr<const block::bitcoin::Transaction>
+{
+    return imp_.wallet_.LoadTransactionShared(txid);
+}
+
 auto Database::LookupContact(const Data& pubkeyHash) const noexcept
     -> UnallocatedSet<OTIdentifier>
 {
@@ -648,6 +673,12 @@ auto Database::SyncTip(const Chain chain) const noexcept -> Height
     return imp_.sync_.Tip(chain);
 }
 
+auto Database::TransactionCacheStats() const noexcept
+    -> TransactionCache::Statistics
+{
+    return imp_.wallet_.TransactionCacheStats();
+}
+
 auto Database::UpdateContact(const Contact& contact) const noexcept
     -> UnallocatedVector<pTxid>
 {
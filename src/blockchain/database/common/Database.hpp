@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "Proto.hpp"
+#include "blockchain/database/common/TransactionCache.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/crypto/Crypto.hpp"
 #include "internal/blockchain/database/Database.hpp"
@@ -75,6 +76,11 @@ class Data;
 }  // namespace p2p
 }  // namespace network
 
+namespace util
+{
+struct CompactionReport;
+}  // namespace util
+
 class Contact;
 class Data;
 class Options;
@@ -122,6 +128,8 @@ public:
     auto BlockPolicy() const noexcept -> BlockStorage;
     auto BlockStore(const BlockHash& block, const std::size_t bytes)
         const noexcept -> BlockWriter;
+    auto CompactStorage(std::size_t budget) const noexcept
+        -> std::optional<util::CompactionReport>;
     auto DeleteSyncServer(const UnallocatedCString& endpoint) const noexcept
         -> bool;
     auto Disable(const Chain type) const noexcept -> bool;
@@ -144,6 +152,10 @@ public:
     auto LoadEnabledChains() const noexcept -> UnallocatedVector<EnabledChain>;
     auto LoadFilter(const filter::Type type, const ReadView blockHash)
         const noexcept -> std::unique_ptr<const opentxs::blockchain::GCS>;
+    auto LoadFilterBytes(
+        const filter::Type type,
+        const ReadView blockHash,
+        const AllocateOutput destination) const noexcept -> bool;
     auto LoadFilterHash(
         const filter::Type type,
         const ReadView blockHash,
@@ -158,6 +170,8 @@ public:
         opentxs::network::p2p::Data& output) const noexcept -> bool;
     auto LoadTransaction(const ReadView txid) const noexcept
         -> std::unique_ptr<block::bitcoin::Transaction>;
+    auto LoadTransactionShared(const ReadView txid) const noexcept
+        -> std::shared_ptr<const block::bitcoin::Transaction>;
     auto LookupContact(const Data& pubkeyHash) const noexcept
         -> UnallocatedSet<OTIdentifier>;
     auto LookupTransactions(const PatternID pattern) const noexcept
@@ -182,6 +196,8 @@ public:
     auto StoreTransaction(const block::bitcoin::Transaction& tx) const noexcept
         -> bool;
     auto SyncTip(const Chain chain) const noexcept -> Height;
+    auto TransactionCacheStats() const noexcept
+        -> TransactionCache::Statistics;
     auto UpdateContact(const Contact& contact) const noexcept
         -> UnallocatedVector<pTxid>;
     auto UpdateMergedContact(const Contact& parent, const Contact& child)
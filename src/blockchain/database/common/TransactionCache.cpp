@@ -0,0 +1,119 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/database/common/TransactionCache.hpp"  // IWYU pragma: associated
+
+#include <iterator>
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/Types.hpp"
+
+namespace opentxs::blockchain::database::common
+{
+TransactionCache::TransactionCache(std::size_t budget) noexcept
+    : budget_(budget)
+    , lock_()
+    , lru_()
+    , index_()
+    , stats_()
+    , generation_(0)
+{
+}
+
+auto TransactionCache::Add(
+    const ReadView txid,
+    pTransaction tx,
+    std::size_t bytes,
+    std::size_t generation) const noexcept -> void
+{
+    if ((false == bool(tx)) || (bytes > budget_)) { return; }
+
+    auto lock = Lock{lock_};
+
+    if (generation != generation_) { return; }
+
+    if (auto i = index_.find(txid); index_.end() != i) { erase(i); }
+
+    lru_.push_front({UnallocatedCString{txid}, std::move(tx), bytes});
+    index_.emplace(lru_.front().txid_, lru_.begin());
+    stats_.bytes_ += bytes;
+    trim();
+}
+
+auto TransactionCache::Clear() const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    index_.clear();
+    lru_.clear();
+    stats_.bytes_ = 0;
+}
+
+auto TransactionCache::erase(Index::iterator it) const noexcept -> void
+{
+    const auto entry = it->second;
+    stats_.bytes_ -= entry->bytes_;
+    index_.erase(it);
+    lru_.erase(entry);
+}
+
+auto TransactionCache::Find(const ReadView txid) const noexcept -> pTransaction
+{
+    auto lock = Lock{lock_};
+    const auto i = index_.find(txid);
+
+    if (index_.end() == i) {
+        ++stats_.misses_;
+
+        return {};
+    }
+
+    ++stats_.hits_;
+    lru_.splice(lru_.begin(), lru_, i->second);
+
+    return i->second->tx_;
+}
+
+auto TransactionCache::Generation() const noexcept -> std::size_t
+{
+    auto lock = Lock{lock_};
+
+    return generation_;
+}
+
+auto TransactionCache::Remove(const ReadView txid) const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    ++generation_;
+
+    if (auto i = index_.find(txid); index_.end() != i) { erase(i); }
+}
+
+auto TransactionCache::Stats() const noexcept -> Statistics
+{
+    auto lock = Lock{lock_};
+    auto output = stats_;
+    output.items_ = lru_.size();
+
+    return output;
+}
+
+auto TransactionCache::trim() const noexcept -> void
+{
+    while (stats_.bytes_ > budget_) {
+        const auto& last = lru_.back();
+        const auto i = index_.find(last.txid_);
+
+        OT_ASSERT(index_.end() != i);
+
+        erase(i);
+        ++stats_.evictions_;
+    }
+}
+
+TransactionCache::~TransactionCache() = default;
+}  // namespace opentxs::blockchain::database::common
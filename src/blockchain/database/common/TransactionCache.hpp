@@ -0,0 +1,108 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace blockchain
+{
+namespace block
+{
+namespace bitcoin
+{
+class Transaction;
+}  // namespace bitcoin
+}  // namespace block
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::database::common
+{
+/** Recently used decoded transactions
+ *
+ *  Entries are immutable and weighted by the size of their serialized form.
+ *  When the total weight exceeds the budget the least recently used entries
+ *  are evicted. Stored transactions are only replaced or removed by the
+ *  caller when the underlying record changes.
+ */
+class TransactionCache
+{
+public:
+    using pTransaction = std::shared_ptr<const block::bitcoin::Transaction>;
+
+    struct Statistics {
+        std::size_t hits_{};
+        std::size_t misses_{};
+        std::size_t evictions_{};
+        std::size_t items_{};
+        std::size_t bytes_{};
+    };
+
+    static constexpr auto default_budget_ = std::size_t{32u * 1024u * 1024u};
+
+    /** Insert a transaction which was decoded from storage
+     *
+     *  The entry is discarded if any Remove() call happened after generation
+     *  was obtained, since the transaction may have been decoded from a
+     *  record which was overwritten in the meantime.
+     */
+    auto Add(
+        const ReadView txid,
+        pTransaction tx,
+        std::size_t bytes,
+        std::size_t generation) const noexcept -> void;
+    auto Budget() const noexcept { return budget_; }
+    auto Clear() const noexcept -> void;
+    auto Find(const ReadView txid) const noexcept -> pTransaction;
+    auto Generation() const noexcept -> std::size_t;
+    auto Remove(const ReadView txid) const noexcept -> void;
+    auto Stats() const noexcept -> Statistics;
+
+    TransactionCache(std::size_t budget) noexcept;
+
+    ~TransactionCache();
+
+private:
+    struct Entry {
+        UnallocatedCString txid_{};
+        pTransaction tx_{};
+        std::size_t bytes_{};
+    };
+
+    using LRU = UnallocatedList<Entry>;
+    // NOTE std::less<> permits lookups by ReadView without a copy
+    using Index = std::map<UnallocatedCString, LRU::iterator, std::less<>>;
+
+    const std::size_t budget_;
+    mutable std::mutex lock_;
+    mutable LRU lru_;
+    mutable Index index_;
+    mutable Statistics stats_;
+    mutable std::size_t generation_;
+
+    auto erase(Index::iterator it) const noexcept -> void;
+    auto trim() const noexcept -> void;
+
+    TransactionCache(const TransactionCache&) = delete;
+    TransactionCache(TransactionCache&&) = delete;
+    auto operator=(const TransactionCache&) -> TransactionCache& = delete;
+    auto operator=(TransactionCache&&) -> TransactionCache& = delete;
+};
+}  // namespace opentxs::blockchain::database::common
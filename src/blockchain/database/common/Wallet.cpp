@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                         // IWYU pragma: associated
 #include "blockchain/database/common/Wallet.hpp"  // IWYU pragma: associated
 
+#include <google/protobuf/arena.h>
 #include <algorithm>
 #include <cstring>
 #include <iterator>
@@ -46,6 +47,7 @@ Wallet::Wallet(
     , lmdb_(lmdb)
     , bulk_(bulk)
     , transaction_table_(Table::TransactionIndex)
+    , transactions_(TransactionCache::default_budget_)
     , lock_()
     , contact_to_element_()
     , element_to_contact_()
@@ -116,29 +118,49 @@ auto Wallet::AssociateTransaction(
 auto Wallet::LoadTransaction(const ReadView txid) const noexcept
     -> std::unique_ptr<block::bitcoin::Transaction>
 {
-    try {
-        const auto proto = [&] {
-            const auto index = [&] {
-                auto out = util::IndexData{};
-                auto cb = [&out](const ReadView in) {
-                    if (sizeof(out) != in.size()) { return; }
+    if (const auto tx = LoadTransactionShared(txid); tx) { return tx->clone(); }
 
-                    std::memcpy(static_cast<void*>(&out), in.data(), in.size());
-                };
-                lmdb_.Load(transaction_table_, txid, cb);
+    return {};
+}
 
-                if (0 == out.size_) {
-                    throw std::out_of_range("Transaction not found");
-                }
+auto Wallet::LoadTransactionShared(const ReadView txid) const noexcept
+    -> TransactionCache::pTransaction
+{
+    if (auto cached = transactions_.Find(txid); cached) { return cached; }
 
-                return out;
-            }();
+    try {
+        const auto generation = transactions_.Generation();
+        // NOTE the extent may be relocated or reused as soon as the bulk lock
+        // is released so the index must be read and the transaction parsed
+        // while it is held
+        auto lock = Lock{bulk_.Mutex()};
+        const auto index = [&] {
+            auto out = util::IndexData{};
+            auto cb = [&out](const ReadView in) {
+                if (sizeof(out) != in.size()) { return; }
+
+                std::memcpy(static_cast<void*>(&out), in.data(), in.size());
+            };
+            lmdb_.Load(transaction_table_, txid, cb);
 
-            return proto::Factory<proto::BlockchainTransaction>(
-                bulk_.ReadView(index));
+            if (0 == out.size_) {
+                throw std::out_of_range("Transaction not found");
+            }
+
+            return out;
         }();
+        auto arena = google::protobuf::Arena{};
+        const auto& proto = proto::ArenaFactory<proto::BlockchainTransaction>(
+            arena, bulk_.ReadView(lock, index));
+        lock.unlock();
+        auto output = TransactionCache::pTransaction{
+            factory::BitcoinTransaction(api_, proto)};
+
+        if (output) {
+            transactions_.Add(txid, output, index.size_, generation);
+        }
 
-        return factory::BitcoinTransaction(api_, proto);
+        return output;
     } catch (const std::exception& e) {
         LogTrace()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -231,6 +253,10 @@ auto Wallet::StoreTransaction(
             throw std::runtime_error{"Database update error"};
         }
 
+        // NOTE also discards any concurrent load which may have decoded the
+        // previous version of this transaction
+        transactions_.Remove(hash);
+
         return true;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
@@ -239,6 +265,12 @@ auto Wallet::StoreTransaction(
     }
 }
 
+auto Wallet::TransactionCacheStats() const noexcept
+    -> TransactionCache::Statistics
+{
+    return transactions_.Stats();
+}
+
 auto Wallet::update_contact(
     const Lock& lock,
     const UnallocatedSet<OTData>& existing,
@@ -9,6 +9,7 @@
 #include <mutex>
 #include <optional>
 
+#include "blockchain/database/common/TransactionCache.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/core/Data.hpp"
@@ -75,14 +76,19 @@ public:
     auto AssociateTransaction(
         const Txid& txid,
         const UnallocatedVector<PatternID>& patterns) const noexcept -> bool;
+    /// returns a mutable copy of the cached transaction
     auto LoadTransaction(const ReadView txid) const noexcept
         -> std::unique_ptr<block::bitcoin::Transaction>;
+    auto LoadTransactionShared(const ReadView txid) const noexcept
+        -> TransactionCache::pTransaction;
     auto LookupContact(const Data& pubkeyHash) const noexcept
         -> UnallocatedSet<OTIdentifier>;
     auto LookupTransactions(const PatternID pattern) const noexcept
         -> UnallocatedVector<pTxid>;
     auto StoreTransaction(const block::bitcoin::Transaction& tx) const noexcept
         -> bool;
+    auto TransactionCacheStats() const noexcept
+        -> TransactionCache::Statistics;
     auto UpdateContact(const Contact& contact) const noexcept
         -> UnallocatedVector<pTxid>;
     auto UpdateMergedContact(const Contact& parent, const Contact& child)
@@ -111,6 +117,7 @@ private:
     storage::lmdb::LMDB& lmdb_;
     Bulk& bulk_;
     const int transaction_table_;
+    const TransactionCache transactions_;
     mutable std::mutex lock_;
     mutable ContactToElement contact_to_element_;
     mutable ElementToContact element_to_contact_;
@@ -14,6 +14,7 @@
 #include <iterator>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <shared_mutex>
 #include <stdexcept>
 #include <string_view>
@@ -29,6 +30,8 @@
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/node/Node.hpp"
+#include "internal/blockchain/node/wallet/CoinSelection.hpp"
+#include "internal/core/identifier/Fixed.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
@@ -835,57 +838,16 @@ struct Output::Imp {
         auto lock = eLock{lock_};
 
         try {
-            // TODO implement smarter selection algorithm using policy
             auto tx = lmdb_.TransactionRW();
             const auto choose =
                 [&](const auto outpoint) -> std::optional<UTXO> {
-                auto& existing = cache_.GetOutput(lock, outpoint);
-
                 if (const auto& s = cache_.GetNym(lock, spender);
                     0u == s.count(outpoint)) {
 
                     return std::nullopt;
                 }
 
-                auto output = std::make_optional<UTXO>(
-                    std::make_pair(outpoint, existing.clone()));
-                auto rc = change_state(
-                    lock,
-                    tx,
-                    outpoint,
-                    existing,
-                    node::TxoState::UnconfirmedSpend,
-                    blank_);
-
-                if (false == rc) {
-                    throw std::runtime_error{"Failed to update outpoint state"};
-                }
-
-                rc = lmdb_
-                         .Store(
-                             proposal_spent_, id.Bytes(), outpoint.Bytes(), tx)
-                         .first;
-
-                if (false == rc) {
-                    throw std::runtime_error{
-                        "Failed to update proposal spent index"};
-                }
-
-                rc = lmdb_
-                         .Store(
-                             output_proposal_, outpoint.Bytes(), id.Bytes(), tx)
-                         .first;
-
-                if (false == rc) {
-                    throw std::runtime_error{
-                        "Failed to update outpoint proposal index"};
-                }
-
-                LogVerbose()(OT_PRETTY_CLASS())("proposal ")(id.str())(
-                    " consumed outpoint ")(outpoint.str())
-                    .Flush();
-
-                return output;
+                return reserve(lock, tx, id, outpoint);
             };
             const auto select = [&](const auto& group,
                                     const bool changeOnly =
@@ -941,6 +903,131 @@ struct Output::Imp {
             return std::nullopt;
         }
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& id,
+        const node::wallet::SelectionTarget& target,
+        node::internal::SpendPolicy& policy) noexcept
+        -> std::optional<UnallocatedVector<UTXO>>
+    {
+        using State = node::TxoState;
+        const auto spendUnconfirmed =
+            policy.unconfirmed_incoming_ || policy.unconfirmed_change_;
+        const auto changeOnly = (false == policy.unconfirmed_incoming_);
+
+        // NOTE coins are selected from a snapshot taken under a shared lock
+        // so that selection does not block other wallet operations. If any
+        // selected output changed state before the exclusive lock was
+        // acquired then selection is repeated with a new snapshot.
+        for (auto attempt = std::size_t{0}; attempt < reserve_attempts_;
+             ++attempt) {
+            auto candidates = UnallocatedVector<SpendableOutput>{};
+            auto unconfirmed = UnallocatedVector<SpendableOutput>{};
+
+            {
+                auto lock = sLock{lock_};
+
+                for (const auto& utxo : cache_.GetSpendable(lock, spender)) {
+                    if (false == utxo.bytes_.has_value()) { continue; }
+
+                    switch (utxo.state_) {
+                        case State::ConfirmedNew: {
+                            candidates.emplace_back(utxo);
+                        } break;
+                        case State::UnconfirmedNew: {
+                            if (false == spendUnconfirmed) { break; }
+
+                            if (changeOnly && (false == utxo.change_)) {
+                                break;
+                            }
+
+                            unconfirmed.emplace_back(utxo);
+                        } break;
+                        default: {
+                        }
+                    }
+                }
+            }
+
+            auto coins = UnallocatedVector<node::wallet::Coin>{};
+            coins.reserve(candidates.size() + unconfirmed.size());
+
+            for (const auto& utxo : candidates) {
+                coins.push_back({utxo.value_, utxo.bytes_.value()});
+            }
+
+            // NOTE unconfirmed outputs are only considered if the confirmed
+            // outputs are insufficient
+            auto selection =
+                node::wallet::SelectCoins(policy.selection_, target, coins);
+
+            if ((false == selection.has_value()) &&
+                (false == unconfirmed.empty())) {
+                for (auto& utxo : unconfirmed) {
+                    coins.push_back({utxo.value_, utxo.bytes_.value()});
+                    candidates.emplace_back(std::move(utxo));
+                }
+
+                selection =
+                    node::wallet::SelectCoins(policy.selection_, target, coins);
+            }
+
+            if (false == selection.has_value()) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Insufficient spendable outputs for specified nym")
+                    .Flush();
+
+                return std::nullopt;
+            }
+
+            auto lock = eLock{lock_};
+
+            if (false == unchanged(lock, candidates, *selection)) {
+                LogVerbose()(OT_PRETTY_CLASS())(
+                    "selected outputs changed state, retrying")
+                    .Flush();
+
+                continue;
+            }
+
+            try {
+                auto output = UnallocatedVector<UTXO>{};
+                output.reserve(selection->coins_.size());
+                auto tx = lmdb_.TransactionRW();
+
+                for (const auto i : selection->coins_) {
+                    output.emplace_back(
+                        reserve(lock, tx, id, candidates.at(i).outpoint_));
+                }
+
+                if (false == tx.Finalize(true)) {
+                    throw std::runtime_error{
+                        "Failed to commit database transaction"};
+                }
+
+                const auto strategy = UnallocatedCString{
+                    node::wallet::print(selection->strategy_)};
+                LogVerbose()(OT_PRETTY_CLASS())("proposal ")(id.str())(
+                    " selected ")(output.size())(" of ")(coins.size())(
+                    " outputs using ")(strategy)(" with excess value ")(
+                    selection->excess_)
+                    .Flush();
+
+                return output;
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                cache_.Clear(lock);
+
+                return std::nullopt;
+            }
+        }
+
+        LogError()(OT_PRETTY_CLASS())(
+            "Spendable outputs changed during every selection attempt")
+            .Flush();
+
+        return std::nullopt;
+    }
     auto StartReorg(
         MDB_txn* tx,
         const SubchainID& subchain,
@@ -1040,10 +1127,14 @@ struct Output::Imp {
               params::Data::Chains().at(chain_).maturation_interval_)
         , lock_()
         , cache_(api_, lmdb_, chain_, blank_)
+        , published_()
+        , published_nyms_()
     {
     }
 
 private:
+    static constexpr auto reserve_attempts_ = std::size_t{3};
+
     const api::Session& api_;
     const storage::lmdb::LMDB& lmdb_;
     const blockchain::Type chain_;
@@ -1053,6 +1144,8 @@ private:
     const block::Height maturation_target_;
     mutable std::shared_mutex lock_;
     mutable OutputCache cache_;
+    mutable std::optional<Balance> published_;
+    mutable identifier::FixedNodeMap<Balance> published_nyms_;
 
     static auto states(node::TxoState in) noexcept -> States
     {
@@ -1108,17 +1201,15 @@ private:
     template <typename LockType>
     auto get_balance(const LockType& lock) const noexcept -> Balance
     {
-        static const auto blank = api_.Factory().NymID();
-
-        return get_balance<LockType>(lock, blank);
+        return cache_.GetBalance(lock);
     }
     template <typename LockType>
     auto get_balance(const LockType& lock, const identifier::Nym& owner)
         const noexcept -> Balance
     {
-        static const auto blank = api_.Factory().Identifier();
+        if (owner.empty()) { return cache_.GetBalance(lock); }
 
-        return get_balance<LockType>(lock, owner, blank, nullptr);
+        return cache_.GetNymBalance(lock, owner);
     }
     template <typename LockType>
     auto get_balance(
@@ -1127,6 +1218,18 @@ private:
         const AccountID& account,
         const crypto::Key* key) const noexcept -> Balance
     {
+        // NOTE the cache maintains running totals for the chain, each nym,
+        // and each account. Only balances for individual keys require
+        // visiting outputs.
+        if (nullptr == key) {
+            if (false == account.empty()) {
+
+                return cache_.GetAccountBalance(lock, account);
+            }
+
+            return get_balance(lock, owner);
+        }
+
         auto output = Balance{};
         auto& [confirmed, unconfirmed] = output;
         const auto* pNym = owner.empty() ? nullptr : &owner;
@@ -1178,26 +1281,6 @@ private:
 
         return output;
     }
-    auto get_balances(const eLock& lock) const noexcept -> NymBalances
-    {
-        auto output = NymBalances{};
-
-        for (const auto& nym : cache_.GetNyms(lock)) {
-            output[nym] = get_balance(lock, nym);
-        }
-
-        return output;
-    }
-    auto get_balances(const sLock& lock) const noexcept -> NymBalances
-    {
-        auto output = NymBalances{};
-
-        for (const auto& nym : cache_.GetNyms()) {
-            output[nym] = get_balance(lock, nym);
-        }
-
-        return output;
-    }
     auto get_outputs(
         const sLock& lock,
         const States states,
@@ -1316,13 +1399,28 @@ private:
 
         return output;
     }
+    // NOTE only balances which changed since they were last published are
+    // sent to the balance oracle
     auto publish_balance(const eLock& lock) const noexcept -> void
     {
         const auto& api = api_.Crypto().Blockchain();
-        api.Internal().UpdateBalance(chain_, get_balance(lock));
 
-        for (const auto& [nym, balance] : get_balances(lock)) {
+        if (auto balance = get_balance(lock); published_ != balance) {
+            api.Internal().UpdateBalance(chain_, balance);
+            published_ = std::move(balance);
+        }
+
+        for (const auto& nym : cache_.GetNyms(lock)) {
+            auto balance = get_balance(lock, nym.get());
+            const auto key = identifier::Fixed{nym};
+            auto i = published_nyms_.find(key);
+
+            if ((published_nyms_.end() != i) && (i->second == balance)) {
+                continue;
+            }
+
             api.Internal().UpdateBalance(nym, chain_, balance);
+            published_nyms_.insert_or_assign(key, std::move(balance));
         }
     }
     auto translate(UnallocatedVector<UTXO>&& outputs) const noexcept
@@ -1734,6 +1832,68 @@ private:
         return true;
     }
 
+    auto reserve(
+        const eLock& lock,
+        MDB_txn* tx,
+        const Identifier& proposal,
+        const block::Outpoint& id) noexcept(false) -> UTXO
+    {
+        auto& existing = cache_.GetOutput(lock, id);
+        auto output = std::make_pair(id, existing.clone());
+        auto rc = change_state(
+            lock, tx, id, existing, node::TxoState::UnconfirmedSpend, blank_);
+
+        if (false == rc) {
+            throw std::runtime_error{"Failed to update outpoint state"};
+        }
+
+        rc = lmdb_.Store(proposal_spent_, proposal.Bytes(), id.Bytes(), tx)
+                 .first;
+
+        if (false == rc) {
+            throw std::runtime_error{"Failed to update proposal spent index"};
+        }
+
+        rc = lmdb_.Store(output_proposal_, id.Bytes(), proposal.Bytes(), tx)
+                 .first;
+
+        if (false == rc) {
+            throw std::runtime_error{
+                "Failed to update outpoint proposal index"};
+        }
+
+        LogVerbose()(OT_PRETTY_CLASS())("proposal ")(proposal.str())(
+            " consumed outpoint ")(id.str())
+            .Flush();
+
+        return output;
+    }
+
+    // NOTE detects outputs which were spent or reserved after the snapshot
+    // used for selection was taken
+    auto unchanged(
+        const eLock& lock,
+        const UnallocatedVector<SpendableOutput>& candidates,
+        const node::wallet::Selection& selection) noexcept -> bool
+    {
+        try {
+            for (const auto i : selection.coins_) {
+                const auto& utxo = candidates.at(i);
+
+                if (cache_.GetOutput(lock, utxo.outpoint_).State() !=
+                    utxo.state_) {
+
+                    return false;
+                }
+            }
+
+            return true;
+        } catch (...) {
+
+            return false;
+        }
+    }
+
     Imp() = delete;
     Imp(const Imp&) = delete;
     auto operator=(const Imp&) -> Imp& = delete;
@@ -1891,6 +2051,16 @@ auto Output::ReserveUTXO(
     return imp_->ReserveUTXO(spender, proposal, policy);
 }
 
+auto Output::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& proposal,
+    const node::wallet::SelectionTarget& target,
+    node::internal::SpendPolicy& policy) noexcept
+    -> std::optional<UnallocatedVector<UTXO>>
+{
+    return imp_->ReserveUTXOs(spender, proposal, target, policy);
+}
+
 auto Output::StartReorg(
     MDB_txn* tx,
     const SubchainID& subchain,
@@ -148,6 +148,12 @@ public:
         const identifier::Nym& spender,
         const Identifier& proposal,
         node::internal::SpendPolicy& policy) noexcept -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const node::wallet::SelectionTarget& target,
+        node::internal::SpendPolicy& policy) noexcept
+        -> std::optional<UnallocatedVector<UTXO>>;
     auto StartReorg(
         MDB_txn* tx,
         const SubchainID& subchain,
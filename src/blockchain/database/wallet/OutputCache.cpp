@@ -24,6 +24,8 @@
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/database/Database.hpp"
+#include "internal/blockchain/node/wallet/CoinSelection.hpp"
+#include "internal/core/Amount.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/TSV.hpp"
 #include "opentxs/Types.hpp"
@@ -33,6 +35,8 @@
 #include "opentxs/blockchain/block/bitcoin/Output.hpp"
 #include "opentxs/blockchain/block/bitcoin/Script.hpp"
 #include "opentxs/blockchain/crypto/Types.hpp"
+#include "opentxs/blockchain/node/TxoState.hpp"
+#include "opentxs/blockchain/node/TxoTag.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Data.hpp"
@@ -63,6 +67,25 @@ auto all_states() noexcept -> const States&
     return data;
 }
 
+auto DescendingValue::operator()(
+    const SpendableOutput& lhs,
+    const SpendableOutput& rhs) const noexcept -> bool
+{
+    return std::tie(rhs.value_, rhs.outpoint_) <
+           std::tie(lhs.value_, lhs.outpoint_);
+}
+
+auto operator==(const SpendableOutput& lhs, const SpendableOutput& rhs) noexcept
+    -> bool
+{
+    const auto tie = [](const auto& in) {
+        return std::tie(
+            in.value_, in.outpoint_, in.state_, in.bytes_, in.change_);
+    };
+
+    return tie(lhs) == tie(rhs);
+}
+
 template <typename MapKeyType, typename DBKeyType, typename MapType>
 auto OutputCache::load_output_index(
     const Table table,
@@ -72,9 +95,11 @@ auto OutputCache::load_output_index(
     const UnallocatedCString& keyName,
     MapType& map) noexcept -> Outpoints&
 {
-    if (auto it = map.find(key); map.end() != it) { return it->second; }
+    const auto mapKey = typename MapType::key_type{key};
 
-    auto [row, added] = map.try_emplace(key, Outpoints{});
+    if (auto it = map.find(mapKey); map.end() != it) { return it->second; }
+
+    auto [row, added] = map.try_emplace(mapKey, Outpoints{});
 
     OT_ASSERT(added);
 
@@ -103,12 +128,247 @@ auto OutputCache::load_output_index(
 
     return set;
 }
+
+auto OutputCache::is_spendable(const node::TxoState state) noexcept -> bool
+{
+    using State = node::TxoState;
+
+    return (State::ConfirmedNew == state) || (State::UnconfirmedNew == state);
+}
+
+auto OutputCache::make_spendable(
+    const block::Outpoint& id,
+    const block::bitcoin::internal::Output& output,
+    const node::TxoState state) noexcept -> SpendableOutput
+{
+    return {
+        output.Value().Internal().ExtractInt64(),
+        id,
+        state,
+        node::wallet::InputBytes(output),
+        0u < output.Tags().count(node::TxoTag::Change)};
+}
+
+auto OutputCache::owners(
+    const OwnerMap& map,
+    const block::Outpoint& id) noexcept -> const Owners&
+{
+    if (auto it = map.find(id); map.end() != it) { return it->second; }
+
+    return empty_owners_;
+}
+
+auto OutputCache::add(Spendable& index, const block::Outpoint& id) noexcept
+    -> bool
+{
+    try {
+        const auto& output = load_output(id);
+        const auto state = output.State();
+
+        if (is_spendable(state)) {
+            index.emplace(make_spendable(id, output, state));
+        }
+
+        return true;
+    } catch (...) {
+        LogError()(OT_PRETTY_CLASS())("failed to load output ")(id.str())
+            .Flush();
+
+        return false;
+    }
+}
+
+auto OutputCache::add(Totals& totals, const block::Outpoint& id) noexcept
+    -> bool
+{
+    try {
+        const auto& output = load_output(id);
+        totals.Add(output.State(), output.Value());
+
+        return true;
+    } catch (...) {
+        LogError()(OT_PRETTY_CLASS())("failed to load output ")(id.str())
+            .Flush();
+
+        return false;
+    }
+}
+
+template <typename LockType>
+auto OutputCache::get_account_totals(
+    const LockType& lock,
+    const AccountID& id) noexcept -> Totals&
+{
+    const auto key = identifier::Fixed{id};
+
+    if (auto it = account_totals_.find(key); account_totals_.end() != it) {
+
+        return it->second;
+    }
+
+    return account_totals_.try_emplace(key, sum(lock, GetAccount(lock, id)))
+        .first->second;
+}
+
+template <typename LockType>
+auto OutputCache::get_chain_totals(const LockType& lock) noexcept -> Totals&
+{
+    if (chain_totals_.has_value()) { return chain_totals_.value(); }
+
+    auto& out = chain_totals_.emplace();
+
+    for (const auto state : all_states()) {
+        for (const auto& id : GetState(lock, state)) {
+            try {
+                out.Add(state, GetOutput(lock, id).Value());
+            } catch (...) {
+                LogError()(OT_PRETTY_CLASS())("failed to load output ")(
+                    id.str())
+                    .Flush();
+            }
+        }
+    }
+
+    return out;
+}
+
+template <typename LockType>
+auto OutputCache::get_nym_totals(
+    const LockType& lock,
+    const identifier::Nym& id) noexcept -> Totals&
+{
+    const auto key = identifier::Fixed{id};
+
+    if (auto it = nym_totals_.find(key); nym_totals_.end() != it) {
+
+        return it->second;
+    }
+
+    return nym_totals_.try_emplace(key, sum(lock, GetNym(lock, id)))
+        .first->second;
+}
+
+template <typename LockType>
+auto OutputCache::get_spendable(
+    const LockType& lock,
+    const identifier::Nym& id) noexcept -> Spendable&
+{
+    const auto key = identifier::Fixed{id};
+
+    if (auto it = spendable_.find(key); spendable_.end() != it) {
+
+        return it->second;
+    }
+
+    auto out = Spendable{};
+
+    for (const auto& outpoint : GetNym(lock, id)) {
+        try {
+            const auto& output = GetOutput(lock, outpoint);
+            const auto state = output.State();
+
+            if (is_spendable(state)) {
+                out.emplace(make_spendable(outpoint, output, state));
+            }
+        } catch (...) {
+            LogError()(OT_PRETTY_CLASS())("failed to load output ")(
+                outpoint.str())
+                .Flush();
+        }
+    }
+
+    return spendable_.try_emplace(key, std::move(out)).first->second;
+}
+
+template <typename LockType>
+auto OutputCache::sum(const LockType& lock, const Outpoints& outputs) noexcept
+    -> Totals
+{
+    auto out = Totals{};
+
+    for (const auto& id : outputs) {
+        try {
+            const auto& output = GetOutput(lock, id);
+            out.Add(output.State(), output.Value());
+        } catch (...) {
+            LogError()(OT_PRETTY_CLASS())("failed to load output ")(id.str())
+                .Flush();
+        }
+    }
+
+    return out;
+}
+}  // namespace opentxs::blockchain::database::wallet
+
+namespace opentxs::blockchain::database::wallet
+{
+auto OutputCache::Totals::Add(
+    const node::TxoState state,
+    const Amount& value) noexcept -> void
+{
+    const auto index = static_cast<std::size_t>(state);
+
+    if (states_ <= index) { return; }
+
+    try {
+        data_[index] += value;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
+}
+
+auto OutputCache::Totals::Balance() const noexcept -> blockchain::Balance
+{
+    using State = node::TxoState;
+    const auto get = [this](const auto state) -> const Amount& {
+        return data_[static_cast<std::size_t>(state)];
+    };
+
+    try {
+        const auto& confirmed = get(State::ConfirmedNew);
+
+        // NOTE an output which is being spent by an unconfirmed transaction
+        // still counts towards the confirmed balance
+        return {
+            confirmed + get(State::UnconfirmedSpend),
+            confirmed + get(State::UnconfirmedNew)};
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return {};
+    }
+}
+
+auto OutputCache::Totals::Move(
+    const node::TxoState from,
+    const node::TxoState to,
+    const Amount& value) noexcept -> void
+{
+    Remove(from, value);
+    Add(to, value);
+}
+
+auto OutputCache::Totals::Remove(
+    const node::TxoState state,
+    const Amount& value) noexcept -> void
+{
+    const auto index = static_cast<std::size_t>(state);
+
+    if (states_ <= index) { return; }
+
+    try {
+        data_[index] -= value;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
+}
 }  // namespace opentxs::blockchain::database::wallet
 
 namespace opentxs::blockchain::database::wallet
 {
 const Outpoints OutputCache::empty_outputs_{};
 const Nyms OutputCache::empty_nyms_{};
+const OutputCache::Owners OutputCache::empty_owners_{};
 
 OutputCache::OutputCache(
     const api::Session& api,
@@ -125,10 +385,12 @@ OutputCache::OutputCache(
     , outputs_()
     , account_lock_()
     , accounts_()
+    , account_owners_()
     , key_lock_()
     , keys_()
     , nym_lock_()
     , nyms_()
+    , nym_owners_()
     , nym_list_()
     , positions_lock_()
     , positions_()
@@ -136,6 +398,11 @@ OutputCache::OutputCache(
     , states_()
     , subchain_lock_()
     , subchains_()
+    , balance_lock_()
+    , chain_totals_()
+    , account_totals_()
+    , nym_totals_()
+    , spendable_()
 {
     outputs_.reserve(reserve_);
     keys_.reserve(reserve_);
@@ -169,8 +436,7 @@ auto OutputCache::AddToAccount(
 #endif  // defined OPENTXS_DETAILED_DEBUG
 
     try {
-        auto& set = load_output_index(
-            wallet::accounts_, id, id.Bytes(), "account", id.str(), accounts_);
+        auto& set = load_account_index(id);
         auto rc = lmdb_.Store(wallet::accounts_, id.Bytes(), output.Bytes(), tx)
                       .first;
 
@@ -178,7 +444,17 @@ auto OutputCache::AddToAccount(
             throw std::runtime_error{"Failed to update account index"};
         }
 
-        set.emplace(output);
+        const auto [it, added] = set.emplace(output);
+
+        if (added) {
+            const auto key = identifier::Fixed{id};
+            account_owners_[output].emplace_back(key);
+            auto& map = account_totals_;
+
+            if (auto i = map.find(key); map.end() != i) {
+                if (false == add(i->second, output)) { map.erase(i); }
+            }
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -233,8 +509,7 @@ auto OutputCache::AddToNym(
     OT_ASSERT(false == id.empty());
 
     try {
-        auto& index = load_output_index(
-            wallet::nyms_, id, id.Bytes(), "nym", id.str(), nyms_);
+        auto& index = load_nym_index(id);
         auto& list = load_nyms();
         auto rc =
             lmdb_.Store(wallet::nyms_, id.Bytes(), output.Bytes(), tx).first;
@@ -243,9 +518,22 @@ auto OutputCache::AddToNym(
             throw std::runtime_error{"Failed to update nym index"};
         }
 
-        index.emplace(output);
+        const auto [it, added] = index.emplace(output);
         list.emplace(id);
 
+        if (added) {
+            const auto key = identifier::Fixed{id};
+            nym_owners_[output].emplace_back(key);
+
+            if (auto i = nym_totals_.find(key); nym_totals_.end() != i) {
+                if (false == add(i->second, output)) { nym_totals_.erase(i); }
+            }
+
+            if (auto i = spendable_.find(key); spendable_.end() != i) {
+                if (false == add(i->second, output)) { spendable_.erase(i); }
+            }
+        }
+
         return true;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
@@ -327,7 +615,15 @@ auto OutputCache::AddToState(
             throw std::runtime_error{"Failed to update key index"};
         }
 
-        set.emplace(output);
+        const auto [it, added] = set.emplace(output);
+
+        if (added && chain_totals_.has_value()) {
+            if (const auto amount = value(output); amount.has_value()) {
+                chain_totals_->Add(id, *amount);
+            } else {
+                chain_totals_ = std::nullopt;
+            }
+        }
 #if defined OPENTXS_DETAILED_DEBUG
         LogTrace()(OT_PRETTY_CLASS())("output ")(output.str())(
             " added to index for state ")(opentxs::print(id))
@@ -475,6 +771,57 @@ auto OutputCache::ChangeState(
 
         if (0u == from.size()) { states_.erase(oldState); }
 
+        // NOTE entries are replaced even if the output remains spendable
+        // since they record its state
+        if (const auto spendable = is_spendable(newState);
+            is_spendable(oldState) || spendable) {
+            if (const auto entry = spendable_entry(id, newState);
+                entry.has_value()) {
+                for (const auto& nym : owners(nym_owners_, id)) {
+                    const auto i = spendable_.find(nym);
+
+                    if (spendable_.end() == i) { continue; }
+
+                    i->second.erase(*entry);
+
+                    if (spendable) { i->second.emplace(*entry); }
+                }
+            } else {
+                // NOTE the indices will be rebuilt on the next query
+                spendable_.clear();
+            }
+        }
+
+        const auto amount = value(id);
+
+        if (false == amount.has_value()) {
+            // NOTE the totals will be recalculated on the next query
+            chain_totals_ = std::nullopt;
+            account_totals_.clear();
+            nym_totals_.clear();
+
+            return rc;
+        }
+
+        if (chain_totals_.has_value()) {
+            chain_totals_->Move(oldState, newState, *amount);
+        }
+
+        // NOTE totals only exist for accounts and nyms whose index has been
+        // loaded, so the owner lists contain every total which must change
+        for (const auto& account : owners(account_owners_, id)) {
+            if (auto i = account_totals_.find(account);
+                account_totals_.end() != i) {
+                i->second.Move(oldState, newState, *amount);
+            }
+        }
+
+        for (const auto& nym : owners(nym_owners_, id)) {
+            if (auto i = nym_totals_.find(nym); nym_totals_.end() != i) {
+                i->second.Move(oldState, newState, *amount);
+            }
+        }
+
         return rc;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
@@ -489,11 +836,17 @@ auto OutputCache::Clear(const eLock&) noexcept -> void
     nym_list_ = std::nullopt;
     outputs_.clear();
     accounts_.clear();
+    account_owners_.clear();
     keys_.clear();
     nyms_.clear();
+    nym_owners_.clear();
     positions_.clear();
     states_.clear();
     subchains_.clear();
+    chain_totals_ = std::nullopt;
+    account_totals_.clear();
+    nym_totals_.clear();
+    spendable_.clear();
 }
 
 auto OutputCache::GetAccount(const sLock&, const AccountID& id) noexcept
@@ -507,8 +860,7 @@ auto OutputCache::GetAccount(const sLock&, const AccountID& id) noexcept
     try {
         auto lock = Lock{account_lock_};
 
-        return load_output_index(
-            wallet::accounts_, id, id.Bytes(), "account", id.str(), accounts_);
+        return load_account_index(id);
     } catch (...) {
 
         return empty_outputs_;
@@ -524,14 +876,41 @@ auto OutputCache::GetAccount(const eLock&, const AccountID& id) noexcept
 #endif  // defined OPENTXS_DETAILED_DEBUG
 
     try {
-        return load_output_index(
-            wallet::accounts_, id, id.Bytes(), "account", id.str(), accounts_);
+        return load_account_index(id);
     } catch (...) {
 
         return empty_outputs_;
     }
 }
 
+auto OutputCache::GetAccountBalance(
+    const sLock& lock,
+    const AccountID& id) noexcept -> Balance
+{
+    auto guard = Lock{balance_lock_};
+
+    return get_account_totals(lock, id).Balance();
+}
+
+auto OutputCache::GetAccountBalance(
+    const eLock& lock,
+    const AccountID& id) noexcept -> Balance
+{
+    return get_account_totals(lock, id).Balance();
+}
+
+auto OutputCache::GetBalance(const sLock& lock) noexcept -> Balance
+{
+    auto guard = Lock{balance_lock_};
+
+    return get_chain_totals(lock).Balance();
+}
+
+auto OutputCache::GetBalance(const eLock& lock) noexcept -> Balance
+{
+    return get_chain_totals(lock).Balance();
+}
+
 auto OutputCache::GetKey(const sLock&, const crypto::Key& id) noexcept
     -> const Outpoints&
 {
@@ -587,8 +966,7 @@ auto OutputCache::GetNym(const sLock&, const identifier::Nym& id) noexcept
     try {
         auto lock = Lock{nym_lock_};
 
-        return load_output_index(
-            wallet::nyms_, id, id.Bytes(), "nym", id.str(), nyms_);
+        return load_nym_index(id);
     } catch (...) {
 
         return empty_outputs_;
@@ -603,14 +981,29 @@ auto OutputCache::GetNym(const eLock&, const identifier::Nym& id) noexcept
 #endif  // defined OPENTXS_DETAILED_DEBUG
 
     try {
-        return load_output_index(
-            wallet::nyms_, id, id.Bytes(), "nym", id.str(), nyms_);
+        return load_nym_index(id);
     } catch (...) {
 
         return empty_outputs_;
     }
 }
 
+auto OutputCache::GetNymBalance(
+    const sLock& lock,
+    const identifier::Nym& id) noexcept -> Balance
+{
+    auto guard = Lock{balance_lock_};
+
+    return get_nym_totals(lock, id).Balance();
+}
+
+auto OutputCache::GetNymBalance(
+    const eLock& lock,
+    const identifier::Nym& id) noexcept -> Balance
+{
+    return get_nym_totals(lock, id).Balance();
+}
+
 auto OutputCache::GetNyms() noexcept -> const Nyms&
 {
 #if defined OPENTXS_DETAILED_DEBUG
@@ -732,6 +1125,22 @@ auto OutputCache::get_position() noexcept -> const db::Position&
     return null;
 }
 
+auto OutputCache::GetSpendable(
+    const sLock& lock,
+    const identifier::Nym& id) noexcept -> const Spendable&
+{
+    auto guard = Lock{spendable_lock_};
+
+    return get_spendable(lock, id);
+}
+
+auto OutputCache::GetSpendable(
+    const eLock& lock,
+    const identifier::Nym& id) noexcept -> const Spendable&
+{
+    return get_spendable(lock, id);
+}
+
 auto OutputCache::GetState(const sLock&, const node::TxoState id) noexcept
     -> const Outpoints&
 {
@@ -866,6 +1275,40 @@ auto OutputCache::load_nyms() noexcept -> Nyms&
     return nym_list_.value();
 }
 
+auto OutputCache::load_account_index(const AccountID& id) noexcept
+    -> Outpoints&
+{
+    const auto key = identifier::Fixed{id};
+    const auto loaded = (accounts_.end() != accounts_.find(key));
+    auto& set = load_output_index(
+        wallet::accounts_, id, id.Bytes(), "account", id.str(), accounts_);
+
+    if (false == loaded) {
+        for (const auto& output : set) {
+            account_owners_[output].emplace_back(key);
+        }
+    }
+
+    return set;
+}
+
+auto OutputCache::load_nym_index(const identifier::Nym& id) noexcept
+    -> Outpoints&
+{
+    const auto key = identifier::Fixed{id};
+    const auto loaded = (nyms_.end() != nyms_.find(key));
+    auto& set = load_output_index(
+        wallet::nyms_, id, id.Bytes(), "nym", id.str(), nyms_);
+
+    if (false == loaded) {
+        for (const auto& output : set) {
+            nym_owners_[output].emplace_back(key);
+        }
+    }
+
+    return set;
+}
+
 auto OutputCache::load_output(const block::Outpoint& id) noexcept(false)
     -> block::bitcoin::internal::Output&
 {
@@ -1045,7 +1488,7 @@ auto OutputCache::Print(const eLock&) const noexcept -> void
     log(OT_PRETTY_CLASS())("Outputs by nym:\n");
 
     for (const auto& [id, outputs] : nyms_) {
-        log("  * ")(id->str())("\n");
+        log("  * ")(id.str())("\n");
 
         for (const auto& outpoint : outputs) {
             log("    * ")(outpoint.str())("\n");
@@ -1056,7 +1499,7 @@ auto OutputCache::Print(const eLock&) const noexcept -> void
     log(OT_PRETTY_CLASS())("Outputs by subaccount:\n");
 
     for (const auto& [id, outputs] : accounts_) {
-        log("  * ")(id->str())("\n");
+        log("  * ")(id.str())("\n");
 
         for (const auto& outpoint : outputs) {
             log("    * ")(outpoint.str())("\n");
@@ -1067,7 +1510,7 @@ auto OutputCache::Print(const eLock&) const noexcept -> void
     log(OT_PRETTY_CLASS())("Outputs by subchain:\n");
 
     for (const auto& [id, outputs] : subchains_) {
-        log("  * ")(id->str())("\n");
+        log("  * ")(id.str())("\n");
 
         for (const auto& outpoint : outputs) {
             log("    * ")(outpoint.str())("\n");
@@ -1158,6 +1601,35 @@ auto OutputCache::UpdatePosition(
     }
 }
 
+auto OutputCache::spendable_entry(
+    const block::Outpoint& id,
+    const node::TxoState state) noexcept -> std::optional<SpendableOutput>
+{
+    try {
+
+        return make_spendable(id, load_output(id), state);
+    } catch (...) {
+        LogError()(OT_PRETTY_CLASS())("failed to load output ")(id.str())
+            .Flush();
+
+        return std::nullopt;
+    }
+}
+
+auto OutputCache::value(const block::Outpoint& id) noexcept
+    -> std::optional<Amount>
+{
+    try {
+
+        return load_output(id).Value();
+    } catch (...) {
+        LogError()(OT_PRETTY_CLASS())("failed to load output ")(id.str())
+            .Flush();
+
+        return std::nullopt;
+    }
+}
+
 auto OutputCache::write_output(
     const block::Outpoint& id,
     const block::bitcoin::Output& output,
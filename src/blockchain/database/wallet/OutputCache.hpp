@@ -11,15 +11,21 @@
 
 #include <robin_hood.h>
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <set>
+#include <utility>
 
 #include "blockchain/database/wallet/Output.hpp"
 #include "blockchain/database/wallet/Position.hpp"
 #include "blockchain/database/wallet/Types.hpp"
 #include "internal/blockchain/database/Database.hpp"
+#include "internal/core/identifier/Fixed.hpp"
 #include "internal/util/TSV.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
@@ -28,6 +34,7 @@
 #include "opentxs/blockchain/crypto/Types.hpp"
 #include "opentxs/blockchain/node/TxoState.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -89,6 +96,26 @@ using Matches = UnallocatedVector<block::Outpoint>;
 using Outpoints = robin_hood::unordered_node_set<block::Outpoint>;
 using NymBalances = UnallocatedMap<OTNymID, Balance>;
 using Nyms = robin_hood::unordered_node_set<OTNymID>;
+/// The details of an unspent output which are needed for coin selection
+struct SpendableOutput {
+    std::int64_t value_{};
+    block::Outpoint outpoint_{};
+    node::TxoState state_{};
+    /// Estimated size of an input which spends the output, or nothing if the
+    /// transaction builder can not spend it
+    std::optional<std::size_t> bytes_{};
+    bool change_{};
+};
+/// Orders outputs by descending value, ignoring every other detail
+struct DescendingValue {
+    auto operator()(const SpendableOutput& lhs, const SpendableOutput& rhs)
+        const noexcept -> bool;
+};
+/// Unspent outputs ordered by descending value
+using Spendable = std::set<SpendableOutput, DescendingValue>;
+
+auto operator==(const SpendableOutput& lhs, const SpendableOutput& rhs) noexcept
+    -> bool;
 
 auto all_states() noexcept -> const States&;
 
@@ -149,6 +176,12 @@ public:
         -> const Outpoints&;
     auto GetAccount(const eLock&, const AccountID& id) noexcept
         -> const Outpoints&;
+    auto GetAccountBalance(const sLock&, const AccountID& id) noexcept
+        -> Balance;
+    auto GetAccountBalance(const eLock&, const AccountID& id) noexcept
+        -> Balance;
+    auto GetBalance(const sLock&) noexcept -> Balance;
+    auto GetBalance(const eLock&) noexcept -> Balance;
     auto GetKey(const sLock&, const crypto::Key& id) noexcept
         -> const Outpoints&;
     auto GetKey(const eLock&, const crypto::Key& id) noexcept
@@ -158,6 +191,10 @@ public:
         -> const Outpoints&;
     auto GetNym(const eLock&, const identifier::Nym& id) noexcept
         -> const Outpoints&;
+    auto GetNymBalance(const sLock&, const identifier::Nym& id) noexcept
+        -> Balance;
+    auto GetNymBalance(const eLock&, const identifier::Nym& id) noexcept
+        -> Balance;
     auto GetNyms() noexcept -> const Nyms&;
     auto GetNyms(const eLock&) noexcept -> const Nyms&;
     auto GetOutput(const sLock&, const block::Outpoint& id) noexcept(false)
@@ -169,6 +206,10 @@ public:
         -> const Outpoints&;
     auto GetPosition(const eLock&, const block::Position& id) noexcept
         -> const Outpoints&;
+    auto GetSpendable(const sLock&, const identifier::Nym& id) noexcept
+        -> const Spendable&;
+    auto GetSpendable(const eLock&, const identifier::Nym& id) noexcept
+        -> const Spendable&;
     auto GetState(const sLock&, const node::TxoState id) noexcept
         -> const Outpoints&;
     auto GetState(const eLock&, const node::TxoState id) noexcept
@@ -196,9 +237,40 @@ public:
     ~OutputCache();
 
 private:
+    /// Sum of output values in each state, indexed by node::TxoState
+    ///
+    /// Totals are calculated from the output indices the first time they
+    /// are requested and afterwards are adjusted whenever an output is added
+    /// to an index or changes state, so balance queries do not need to visit
+    /// every output.
+    class Totals
+    {
+    public:
+        auto Add(const node::TxoState state, const Amount& value) noexcept
+            -> void;
+        auto Balance() const noexcept -> blockchain::Balance;
+        auto Move(
+            const node::TxoState from,
+            const node::TxoState to,
+            const Amount& value) noexcept -> void;
+        auto Remove(const node::TxoState state, const Amount& value) noexcept
+            -> void;
+
+    private:
+        static constexpr auto states_ =
+            static_cast<std::size_t>(node::TxoState::Immature) + 1u;
+
+        std::array<Amount, states_> data_{};
+    };
+
+    /// The accounts or nyms whose indices contain an output
+    using Owners = UnallocatedVector<identifier::Fixed>;
+    using OwnerMap = robin_hood::unordered_node_map<block::Outpoint, Owners>;
+
     static constexpr std::size_t reserve_{10000u};
     static const Outpoints empty_outputs_;
     static const Nyms empty_nyms_;
+    static const Owners empty_owners_;
 
     // NOTE if an exclusive lock is being held in the parent then locking
     // these mutexes is redundant
@@ -214,20 +286,55 @@ private:
         std::unique_ptr<block::bitcoin::Output>>
         outputs_;
     std::mutex account_lock_;
-    robin_hood::unordered_node_map<OTIdentifier, Outpoints> accounts_;
+    identifier::FixedNodeMap<Outpoints> accounts_;
+    // NOTE only contains entries for accounts whose index has been loaded
+    OwnerMap account_owners_;
     std::mutex key_lock_;
     robin_hood::unordered_node_map<crypto::Key, Outpoints> keys_;
     std::mutex nym_lock_;
-    robin_hood::unordered_node_map<OTNymID, Outpoints> nyms_;
+    identifier::FixedNodeMap<Outpoints> nyms_;
+    // NOTE only contains entries for nyms whose index has been loaded
+    OwnerMap nym_owners_;
     std::optional<Nyms> nym_list_;
     std::mutex positions_lock_;
     robin_hood::unordered_node_map<block::Position, Outpoints> positions_;
     std::mutex state_lock_;
     robin_hood::unordered_node_map<node::TxoState, Outpoints> states_;
     std::mutex subchain_lock_;
-    robin_hood::unordered_node_map<OTIdentifier, Outpoints> subchains_;
+    identifier::FixedNodeMap<Outpoints> subchains_;
+    std::mutex balance_lock_;
+    std::optional<Totals> chain_totals_;
+    identifier::FixedNodeMap<Totals> account_totals_;
+    identifier::FixedNodeMap<Totals> nym_totals_;
+    std::mutex spendable_lock_;
+    identifier::FixedNodeMap<Spendable> spendable_;
 
+    static auto is_spendable(const node::TxoState state) noexcept -> bool;
+    static auto make_spendable(
+        const block::Outpoint& id,
+        const block::bitcoin::internal::Output& output,
+        const node::TxoState state) noexcept -> SpendableOutput;
+    static auto owners(const OwnerMap& map, const block::Outpoint& id) noexcept
+        -> const Owners&;
+
+    auto add(Spendable& index, const block::Outpoint& id) noexcept -> bool;
+    auto add(Totals& totals, const block::Outpoint& id) noexcept -> bool;
+    template <typename LockType>
+    auto get_account_totals(const LockType& lock, const AccountID& id) noexcept
+        -> Totals&;
+    template <typename LockType>
+    auto get_chain_totals(const LockType& lock) noexcept -> Totals&;
+    template <typename LockType>
+    auto get_nym_totals(
+        const LockType& lock,
+        const identifier::Nym& id) noexcept -> Totals&;
     auto get_position() noexcept -> const db::Position&;
+    template <typename LockType>
+    auto get_spendable(
+        const LockType& lock,
+        const identifier::Nym& id) noexcept -> Spendable&;
+    auto load_account_index(const AccountID& id) noexcept -> Outpoints&;
+    auto load_nym_index(const identifier::Nym& id) noexcept -> Outpoints&;
     auto load_output(const block::Outpoint& id) noexcept(false)
         -> block::bitcoin::internal::Output&;
     template <typename MapKeyType, typename DBKeyType, typename MapType>
@@ -240,6 +347,14 @@ private:
         MapType& map) noexcept -> Outpoints&;
     auto load_nyms() noexcept -> Nyms&;
     auto load_position() noexcept -> void;
+    template <typename LockType>
+    auto sum(const LockType& lock, const Outpoints& outputs) noexcept
+        -> Totals;
+    auto spendable_entry(
+        const block::Outpoint& id,
+        const node::TxoState state) noexcept
+        -> std::optional<SpendableOutput>;
+    auto value(const block::Outpoint& id) noexcept -> std::optional<Amount>;
     auto write_output(
         const block::Outpoint& id,
         const block::bitcoin::Output& output,
@@ -80,11 +80,11 @@ BlockOracle::BlockOracle(
     init_executor({shutdown});
 }
 
-auto BlockOracle::GetBlockJob() const noexcept -> BlockJob
+auto BlockOracle::GetBlockJob(const int peer) const noexcept -> BlockJob
 {
     if (block_downloader_) {
 
-        return block_downloader_->NextBatch();
+        return block_downloader_->NextBatch(peer);
     } else {
 
         return {};
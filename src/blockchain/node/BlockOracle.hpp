@@ -30,6 +30,7 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/Metrics.hpp"
 #include "util/Work.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -87,7 +88,7 @@ public:
     {
         return cache_.DownloadQueue();
     }
-    auto GetBlockJob() const noexcept -> BlockJob final;
+    auto GetBlockJob(const int peer) const noexcept -> BlockJob final;
     auto Heartbeat() const noexcept -> void final;
     auto Internal() const noexcept -> const internal::BlockOracle& final
     {
@@ -97,6 +98,11 @@ public:
         -> BitcoinBlockFuture final;
     auto LoadBitcoin(const BlockHashes& hashes) const noexcept
         -> BitcoinBlockFutures final;
+    auto LoadRaw(const block::Hash& block, const AllocateOutput destination)
+        const noexcept -> bool final
+    {
+        return db_.BlockLoadRaw(block, destination);
+    }
     auto SubmitBlock(const ReadView in) const noexcept -> void final;
     auto Tip() const noexcept -> block::Position final
     {
@@ -181,6 +187,7 @@ private:
         const network::zeromq::socket::Publish& block_available_;
         const network::zeromq::socket::Publish& cache_size_publisher_;
         const blockchain::Type chain_;
+        const std::shared_ptr<metrics::Gauge> queue_metric_;
         mutable std::mutex lock_;
         mutable Pending pending_;
         mutable Mem mem_;
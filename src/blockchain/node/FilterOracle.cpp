@@ -10,10 +10,12 @@
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <future>
 #include <iterator>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -29,6 +31,7 @@
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/block/Block.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/node/Factory.hpp"
 #include "internal/blockchain/node/Node.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -43,6 +46,7 @@
 #include "opentxs/blockchain/GCS.hpp"
 #include "opentxs/blockchain/block/Header.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/blockchain/node/HeaderOracle.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/network/p2p/Block.hpp"
@@ -306,6 +310,42 @@ auto FilterOracle::compare_tips_to_header_chain() noexcept -> bool
     return true;
 }
 
+auto FilterOracle::ExtractElements(
+    BlockIndexerData& data,
+    const std::size_t index) const noexcept -> void
+{
+    auto post = ScopeGuard{[&] { --data.job_counter_; }};
+    auto& chunk = data.chunks_.at(index);
+
+    try {
+        const auto& block = *data.block_;
+        const auto key =
+            blockchain::internal::BlockHashToFilterKey(block.ID().Bytes());
+
+        for (auto i = chunk.first_; i < chunk.last_; ++i) {
+            const auto& pTx = block.at(i);
+
+            if (false == bool(pTx)) {
+                throw std::runtime_error(
+                    "missing transaction " + std::to_string(i));
+            }
+
+            auto elements = pTx->Internal().ExtractElements(data.type_);
+
+            for (auto& element : elements) {
+                if (element.empty()) { continue; }
+
+                chunk.siphashes_.emplace_back(
+                    gcs::Siphash(api_, key, reader(element)));
+                chunk.elements_.emplace_back(std::move(element));
+            }
+        }
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        chunk.failed_ = true;
+    }
+}
+
 auto FilterOracle::GetFilterJob() const noexcept -> CfilterJob
 {
     auto lock = rLock{lock_};
@@ -481,9 +521,7 @@ auto FilterOracle::ProcessBlock(BlockIndexerData& data) const noexcept -> void
         auto& [blockHash, filterHeader, filterHashView] = data.header_data_;
         blockHash = block;
         blockHashView = blockHash->Bytes();
-        const auto pBlock = task.data_.get();
-
-        if (false == bool(pBlock)) {
+        if (false == bool(data.block_)) {
             LogError()(OT_PRETTY_CLASS())("Failed to load ")(
                 DisplayString(chain_))(" block #")(height)
                 .Flush();
@@ -493,7 +531,7 @@ auto FilterOracle::ProcessBlock(BlockIndexerData& data) const noexcept -> void
                 blockHash->asHex());
         }
 
-        pGCS = process_block(data.type_, *pBlock);
+        pGCS = process_block(data);
 
         if (false == bool(pGCS)) {
             LogError()(OT_PRETTY_CLASS())("Failed to instantiate ")(
@@ -787,6 +825,51 @@ auto FilterOracle::process_block(
         elements);
 }
 
+auto FilterOracle::process_block(const BlockIndexerData& data) const
+    noexcept(false) -> std::unique_ptr<const GCS>
+{
+    using Element = std::pair<ReadView, std::uint64_t>;
+    auto elements = UnallocatedVector<Element>{};
+
+    for (const auto& chunk : data.chunks_) {
+        if (chunk.failed_) {
+            throw std::runtime_error("failed to extract filter elements");
+        }
+
+        for (auto i = std::size_t{0}; i < chunk.elements_.size(); ++i) {
+            elements.emplace_back(
+                reader(chunk.elements_.at(i)), chunk.siphashes_.at(i));
+        }
+    }
+
+    // NOTE the hashed set is defined over unique elements so duplicates must
+    // be removed by value before the siphash values can be used
+    std::sort(elements.begin(), elements.end());
+    elements.erase(
+        std::unique(
+            elements.begin(),
+            elements.end(),
+            [](const auto& lhs, const auto& rhs) {
+                return lhs.first == rhs.first;
+            }),
+        elements.end());
+    auto siphashes = UnallocatedVector<std::uint64_t>{};
+    siphashes.reserve(elements.size());
+    std::transform(
+        elements.begin(),
+        elements.end(),
+        std::back_inserter(siphashes),
+        [](const auto& element) { return element.second; });
+    const auto params = blockchain::internal::GetFilterParams(data.type_);
+
+    return factory::GCS(
+        api_,
+        params.first,
+        params.second,
+        blockchain::internal::BlockHashToFilterKey(data.block_->ID().Bytes()),
+        std::move(siphashes));
+}
+
 auto FilterOracle::reset_tips_to(
     const filter::Type type,
     const block::Position& position,
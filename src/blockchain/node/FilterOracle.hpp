@@ -8,6 +8,7 @@
 #include <boost/circular_buffer.hpp>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <iosfwd>
@@ -124,6 +125,8 @@ public:
     {
         return default_type_;
     }
+    auto ExtractElements(BlockIndexerData& data, const std::size_t chunk)
+        const noexcept -> void;
     auto FilterTip(const filter::Type type) const noexcept
         -> block::Position final
     {
@@ -137,6 +140,13 @@ public:
     {
         return database_.LoadFilter(type, block.Bytes());
     }
+    auto LoadFilterBytes(
+        const filter::Type type,
+        const block::Hash& block,
+        const AllocateOutput destination) const noexcept -> bool final
+    {
+        return database_.LoadFilterBytes(type, block.Bytes(), destination);
+    }
     auto LoadFilterHeader(const filter::Type type, const block::Hash& block)
         const noexcept -> Header final
     {
@@ -215,6 +225,8 @@ private:
         const filter::Type type,
         const block::bitcoin::Block& block) const noexcept
         -> std::unique_ptr<const GCS>;
+    auto process_block(const BlockIndexerData& data) const noexcept(false)
+        -> std::unique_ptr<const GCS>;
     auto reset_tips_to(
         const filter::Type type,
         const block::Position& position,
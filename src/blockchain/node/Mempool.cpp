@@ -55,6 +55,23 @@ struct Mempool::Imp {
             return {};
         }
     }
+    auto Snapshot() const noexcept -> UnallocatedVector<
+        std::shared_ptr<const block::bitcoin::Transaction>>
+    {
+        auto output = UnallocatedVector<
+            std::shared_ptr<const block::bitcoin::Transaction>>{};
+        auto lock = sLock{lock_};
+        output.reserve(active_.size());
+
+        for (const auto& txid : active_) {
+            if (const auto i = transactions_.find(txid);
+                (transactions_.end() != i) && i->second) {
+                output.emplace_back(i->second);
+            }
+        }
+
+        return output;
+    }
     auto Submit(ReadView txid) const noexcept -> bool
     {
         const auto input = UnallocatedVector<ReadView>{txid};
@@ -246,6 +263,12 @@ auto Mempool::Query(ReadView txid) const noexcept
     return imp_->Query(txid);
 }
 
+auto Mempool::Snapshot() const noexcept
+    -> UnallocatedVector<std::shared_ptr<const block::bitcoin::Transaction>>
+{
+    return imp_->Snapshot();
+}
+
 auto Mempool::Submit(ReadView txid) const noexcept -> bool
 {
     return imp_->Submit(txid);
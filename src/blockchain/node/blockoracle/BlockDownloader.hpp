@@ -12,6 +12,7 @@
 #include <functional>
 
 #include "blockchain/DownloadManager.hpp"
+#include "blockchain/DownloadScheduler.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
@@ -39,7 +40,10 @@ class BlockOracle::BlockDownloader : public BlockDMBlock,
                                      public BlockWorkerBlock
 {
 public:
-    auto NextBatch() noexcept { return allocate_batch(0); }
+    auto NextBatch(const download::Scheduler::PeerID peer) noexcept
+    {
+        return schedule_batch(peer, 0);
+    }
     auto Shutdown() noexcept -> std::shared_future<void>
     {
         return signal_shutdown();
@@ -53,6 +57,7 @@ public:
         const blockchain::Type chain,
         const UnallocatedCString& shutdown) noexcept
         : BlockDMBlock(
+              chain,
               [&] { return db.BlockTip(); }(),
               [&] {
                   auto promise = std::promise<int>{};
@@ -62,7 +67,8 @@ public:
               }(),
               "block",
               2000,
-              1000)
+              1000,
+              download::Scheduler::Params{1000, 10s, 5s, 60s})
         , BlockWorkerBlock(api, 20ms)
         , db_(db)
         , header_(header)
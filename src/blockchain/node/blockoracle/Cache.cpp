@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 
@@ -19,6 +20,7 @@
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/node/BlockOracle.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
@@ -49,6 +51,10 @@ BlockOracle::Cache::Cache(
     , block_available_(blockAvailable)
     , cache_size_publisher_(downloadCache)
     , chain_(chain)
+    , queue_metric_(metrics::Get().AddGauge(
+          "opentxs_blockchain_block_download_queue",
+          "Number of blocks waiting to be downloaded",
+          {{"chain", print(chain_)}}))
     , lock_()
     , pending_()
     , mem_(cache_limit_)
@@ -65,6 +71,7 @@ auto BlockOracle::Cache::DownloadQueue() const noexcept -> std::size_t
 
 auto BlockOracle::Cache::publish(std::size_t size) const noexcept -> void
 {
+    queue_metric_->Set(static_cast<std::int64_t>(size));
     cache_size_publisher_.Send([&] {
         auto work = network::zeromq::tagged_message(
             WorkType::BlockchainBlockDownloadQueue);
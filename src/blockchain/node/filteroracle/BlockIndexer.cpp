@@ -9,10 +9,12 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <exception>
 #include <optional>
 #include <stdexcept>
 #include <tuple>
+#include <utility>
 
 #include "blockchain/DownloadManager.hpp"
 #include "blockchain/DownloadTask.hpp"
@@ -53,6 +55,7 @@ FilterOracle::BlockIndexer::BlockIndexer(
     const UnallocatedCString& shutdown,
     const NotifyCallback& notify) noexcept
     : BlockDMFilter(
+          chain,
           [&] { return db.FilterTip(type); }(),
           [&] {
               auto promise = std::promise<filter::pHeader>{};
@@ -126,7 +129,10 @@ auto FilterOracle::BlockIndexer::calculate_cfheaders(
                 throw std::runtime_error("timeout");
             }
 
-            OT_ASSERT(pGCS);
+            if (false == bool(pGCS)) {
+
+                throw std::runtime_error("missing cfilter");
+            }
 
             const auto& gcs = *pGCS;
             filterHeader = gcs.Header(previous.get()->Bytes());
@@ -323,6 +329,19 @@ auto FilterOracle::BlockIndexer::queue_processing(
         static const auto blank = api_.Factory().Data();
         static const auto blankView = ReadView{};
 
+        const auto post = [&](auto&& cb) {
+            ++jobCounter;
+            const auto queued = api_.Network().Asio().Internal().Post(
+                ThreadPool::General, std::forward<decltype(cb)>(cb));
+
+            if (false == queued) { --jobCounter; }
+
+            return queued;
+        };
+
+        // NOTE element extraction and siphash calculation for every block in
+        // the batch are split into transaction ranges so large blocks do not
+        // serialize the batch on a single thread
         for (const auto& task : data) {
             if (false == running_.load()) { return; }
 
@@ -330,16 +349,22 @@ auto FilterOracle::BlockIndexer::queue_processing(
             auto& header = headers.emplace_back(blank, blank, blankView);
             auto& job = cache.emplace_back(
                 blank, *task, type_, filter, header, jobCounter);
-            ++jobCounter;
-            const auto queued = api_.Network().Asio().Internal().Post(
-                ThreadPool::General, [&] { parent_.ProcessBlock(job); });
 
-            if (false == queued) {
-                --jobCounter;
+            for (auto i = std::size_t{0}; i < job.chunks_.size(); ++i) {
+                const auto queued =
+                    post([&, i] { parent_.ExtractElements(job, i); });
 
-                return;
+                if (false == queued) { return; }
             }
         }
+
+        jobCounter.wait_for_finished();
+
+        for (auto& job : cache) {
+            if (false == running_.load()) { return; }
+
+            if (false == post([&] { parent_.ProcessBlock(job); })) { return; }
+        }
     }
 
     if (false == calculate_cfheaders(cache)) { return; }
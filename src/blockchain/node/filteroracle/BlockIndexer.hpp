@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <future>
@@ -28,6 +30,7 @@
 #include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Time.hpp"
 #include "util/JobCounter.hpp"
@@ -142,13 +145,37 @@ private:
 
 struct FilterOracle::BlockIndexerData {
     using Task = FilterOracle::BlockIndexer::BatchType::TaskType;
+    using Block = std::shared_ptr<const block::bitcoin::Block>;
+
+    // NOTE filter elements for a contiguous range of transactions, extracted
+    // and hashed independently of the rest of the block
+    struct Chunk {
+        const std::size_t first_;
+        const std::size_t last_;
+        UnallocatedVector<Space> elements_;
+        UnallocatedVector<std::uint64_t> siphashes_;
+        bool failed_;
+
+        Chunk(const std::size_t first, const std::size_t last) noexcept
+            : first_(first)
+            , last_(last)
+            , elements_()
+            , siphashes_()
+            , failed_(false)
+        {
+        }
+    };
+
+    static constexpr auto transactions_per_chunk_ = std::size_t{256};
 
     const Task& incoming_data_;
     const filter::Type type_;
+    const Block block_;
     filter::pHash filter_hash_;
     internal::FilterDatabase::Filter& filter_data_;
     internal::FilterDatabase::Header& header_data_;
     Outstanding& job_counter_;
+    UnallocatedVector<Chunk> chunks_;
 
     BlockIndexerData(
         OTData blank,
@@ -159,11 +186,42 @@ struct FilterOracle::BlockIndexerData {
         Outstanding& jobCounter) noexcept
         : incoming_data_(data)
         , type_(type)
+        , block_(load(data))
         , filter_hash_(std::move(blank))
         , filter_data_(filter)
         , header_data_(header)
         , job_counter_(jobCounter)
+        , chunks_(split(block_))
     {
     }
+
+private:
+    static auto load(const Task& data) noexcept -> Block
+    {
+        try {
+
+            return data.data_.get();
+        } catch (...) {
+
+            return {};
+        }
+    }
+    static auto split(const Block& block) noexcept -> UnallocatedVector<Chunk>
+    {
+        auto output = UnallocatedVector<Chunk>{};
+
+        if (false == bool(block)) { return output; }
+
+        const auto count = block->size();
+        output.reserve((count / transactions_per_chunk_) + 1u);
+
+        for (auto i = std::size_t{0}; i < count;
+             i += transactions_per_chunk_) {
+            output.emplace_back(
+                i, std::min(i + transactions_per_chunk_, count));
+        }
+
+        return output;
+    }
 };
 }  // namespace opentxs::blockchain::node::implementation
@@ -72,6 +72,7 @@ public:
         const UnallocatedCString& shutdown,
         const NotifyCallback& notify) noexcept
         : FilterDM(
+              chain,
               [&] { return db.FilterTip(type); }(),
               [&] {
                   auto promise = std::promise<filter::pHeader>{};
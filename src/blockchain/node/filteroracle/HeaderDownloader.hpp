@@ -50,6 +50,7 @@ public:
         const UnallocatedCString& shutdown,
         Callback&& cb) noexcept
         : HeaderDM(
+              chain,
               [&] { return db.FilterHeaderTip(type); }(),
               [&] {
                   auto promise = std::promise<filter::pHeader>{};
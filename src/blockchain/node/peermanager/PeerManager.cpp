@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "blockchain/node/peermanager/PeerManager.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <optional>
@@ -108,6 +109,8 @@ PeerManager::PeerManager(
           peer_target(chain, policy))
     , verified_lock_()
     , verified_peers_()
+    , high_bandwidth_lock_()
+    , high_bandwidth_peers_()
     , init_promise_()
     , init_(init_promise_.get_future())
 {
@@ -217,6 +220,14 @@ auto PeerManager::init() noexcept -> void
     trigger();
 }
 
+auto PeerManager::IsHighBandwidthPeer(const int id) const noexcept -> bool
+{
+    auto lock = Lock{high_bandwidth_lock_};
+    const auto& peers = high_bandwidth_peers_;
+
+    return peers.end() != std::find(peers.begin(), peers.end(), id);
+}
+
 auto PeerManager::JobReady(const Task type) const noexcept -> void
 {
     switch (type) {
@@ -265,6 +276,17 @@ auto PeerManager::LookupIncomingSocket(const int id) const noexcept(false)
     return peers_.LookupIncomingSocket(id);
 }
 
+auto PeerManager::PromoteHighBandwidthPeer(const int id) const noexcept
+    -> void
+{
+    auto lock = Lock{high_bandwidth_lock_};
+    auto& peers = high_bandwidth_peers_;
+    peers.erase(std::remove(peers.begin(), peers.end(), id), peers.end());
+    peers.emplace_front(id);
+
+    while (high_bandwidth_limit_ < peers.size()) { peers.pop_back(); }
+}
+
 auto PeerManager::peer_target(
     const Type chain,
     const database::BlockStorage policy) noexcept -> std::size_t
@@ -317,6 +339,13 @@ auto PeerManager::pipeline(zmq::Message&& message) noexcept -> void
                 verified_peers_.erase(id);
             }
 
+            {
+                auto lock = Lock{high_bandwidth_lock_};
+                auto& peers = high_bandwidth_peers_;
+                peers.erase(
+                    std::remove(peers.begin(), peers.end(), id), peers.end());
+            }
+
             peers_.Disconnect(id);
             api_.Network().Blockchain().Internal().UpdatePeer(chain_, "");
             do_work();
@@ -44,6 +44,7 @@
 #include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "util/Gatekeeper.hpp"
+#include "util/Metrics.hpp"
 #include "util/Work.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -192,6 +193,7 @@ public:
         UnallocatedMap<int, Peer> peers_;
         UnallocatedMap<OTIdentifier, int> active_;
         std::atomic<std::size_t> count_;
+        const std::shared_ptr<metrics::Gauge> count_metric_;
         Addresses connected_;
         std::unique_ptr<IncomingConnectionManager> incoming_zmq_;
         std::unique_ptr<IncomingConnectionManager> incoming_tcp_;
@@ -260,10 +262,12 @@ public:
     {
         jobs_.Dispatch(Task::Heartbeat);
     }
+    auto IsHighBandwidthPeer(const int id) const noexcept -> bool final;
     auto JobReady(const Task type) const noexcept -> void final;
     auto Listen(const p2p::Address& address) const noexcept -> bool final;
     auto LookupIncomingSocket(const int id) const noexcept(false)
         -> opentxs::network::asio::Socket final;
+    auto PromoteHighBandwidthPeer(const int id) const noexcept -> void final;
     auto RequestBlock(const block::Hash& block) const noexcept -> bool final;
     auto RequestBlocks(const UnallocatedVector<ReadView>& hashes) const noexcept
         -> bool final;
@@ -338,9 +342,14 @@ private:
     mutable Peers peers_;
     mutable std::mutex verified_lock_;
     mutable UnallocatedSet<int> verified_peers_;
+    mutable std::mutex high_bandwidth_lock_;
+    mutable UnallocatedDeque<int> high_bandwidth_peers_;
     std::promise<void> init_promise_;
     std::shared_future<void> init_;
 
+    // NOTE BIP152 recommends selecting at most three high bandwidth peers
+    static constexpr auto high_bandwidth_limit_ = std::size_t{3};
+
     static auto peer_target(
         const Type chain,
         const database::BlockStorage policy) noexcept -> std::size_t;
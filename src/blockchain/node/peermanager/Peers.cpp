@@ -13,6 +13,7 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <random>
@@ -90,6 +91,10 @@ PeerManager::Peers::Peers(
     , peers_()
     , active_()
     , count_()
+    , count_metric_(metrics::Get().AddGauge(
+          "opentxs_blockchain_peers",
+          "Number of connected peers",
+          {{"chain", print(chain_)}}))
     , connected_()
     , incoming_zmq_()
     , incoming_tcp_()
@@ -156,6 +161,7 @@ auto PeerManager::Peers::adjust_count(int adjustment) noexcept -> void
         count_.store(0);
     }
 
+    count_metric_->Set(static_cast<std::int64_t>(count_.load()));
     connected_peers_.Send([&] {
         auto work =
             network::zeromq::tagged_message(WorkType::BlockchainPeerConnected);
@@ -84,6 +84,7 @@ Account::Imp::Imp(
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
     const node::internal::Mempool& mempool,
+    std::shared_ptr<ScanCoordinator> coordinator,
     const network::zeromq::BatchID batch,
     const Type chain,
     const filter::Type filter,
@@ -125,6 +126,7 @@ Account::Imp::Imp(
     , node_(node)
     , db_(db)
     , mempool_(mempool)
+    , scan_coordinator_(std::move(coordinator))
     , chain_(chain)
     , filter_type_(node_.FilterOracleInternal().DefaultType())
     , shutdown_endpoint_(shutdown, alloc)
@@ -147,6 +149,7 @@ Account::Imp::Imp(
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
     const node::internal::Mempool& mempool,
+    std::shared_ptr<ScanCoordinator> coordinator,
     const network::zeromq::BatchID batch,
     const Type chain,
     const filter::Type filter,
@@ -159,6 +162,7 @@ Account::Imp::Imp(
           node,
           db,
           mempool,
+          coordinator,
           batch,
           chain,
           filter,
@@ -235,6 +239,7 @@ auto Account::Imp::instantiate(
             node_,
             db_,
             mempool_,
+            scan_coordinator_,
             subaccount,
             filter_type_,
             subchain,
@@ -572,6 +577,7 @@ Account::Account(
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
     const node::internal::Mempool& mempool,
+    std::shared_ptr<ScanCoordinator> coordinator,
     const Type chain,
     const filter::Type filter,
     const std::string_view shutdown,
@@ -591,6 +597,7 @@ Account::Account(
             node,
             db,
             mempool,
+            coordinator,
             batchID,
             chain,
             filter,
@@ -70,6 +70,7 @@ struct WalletDatabase;
 
 namespace wallet
 {
+class ScanCoordinator;
 class Subchain;
 }  // namespace wallet
 }  // namespace node
@@ -110,6 +111,7 @@ public:
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
         const node::internal::Mempool& mempool,
+        std::shared_ptr<ScanCoordinator> coordinator,
         const network::zeromq::BatchID batch,
         const Type chain,
         const filter::Type filter,
@@ -151,6 +153,7 @@ private:
     const node::internal::Network& node_;
     const node::internal::WalletDatabase& db_;
     const node::internal::Mempool& mempool_;
+    const std::shared_ptr<ScanCoordinator> scan_coordinator_;
     const Type chain_;
     const filter::Type filter_type_;
     const CString shutdown_endpoint_;
@@ -201,6 +204,7 @@ private:
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
         const node::internal::Mempool& mempool,
+        std::shared_ptr<ScanCoordinator> coordinator,
         const network::zeromq::BatchID batch,
         const Type chain,
         const filter::Type filter,
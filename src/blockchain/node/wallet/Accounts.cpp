@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include <utility>
 
+#include "blockchain/node/wallet/subchain/ScanCoordinator.hpp"
 #include "internal/blockchain/node/HeaderOracle.hpp"
 #include "internal/blockchain/node/Node.hpp"
 #include "internal/blockchain/node/wallet/Account.hpp"
@@ -128,6 +129,11 @@ Accounts::Imp::Imp(
     , mempool_(mempool)
     , chain_(chain)
     , filter_type_(node_.FilterOracleInternal().DefaultType())
+    , scan_coordinator_(std::make_shared<ScanCoordinator>(
+          [&node, type = filter_type_](const block::Position& position) {
+              return node.FilterOracleInternal().LoadFilterOrResetTip(
+                  type, position);
+          }))
     , shutdown_endpoint_(shutdown, alloc)
     , to_children_endpoint_(std::move(toChildren))
     , from_children_endpoint_(std::move(fromChildren))
@@ -264,6 +270,7 @@ auto Accounts::Imp::index_nym(const identifier::Nym& id) noexcept -> void
             node_,
             db_,
             mempool_,
+            scan_coordinator_,
             id,
             filter_type_,
             batchID,
@@ -341,6 +348,7 @@ auto Accounts::Imp::process_nym(const identifier::Nym& nym) noexcept -> bool
         node_,
         db_,
         mempool_,
+        scan_coordinator_,
         chain_,
         filter_type_,
         shutdown_endpoint_,
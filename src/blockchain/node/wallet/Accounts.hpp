@@ -56,6 +56,7 @@ namespace wallet
 {
 class Account;
 class NotificationStateData;
+class ScanCoordinator;
 class Subchain;
 }  // namespace wallet
 }  // namespace node
@@ -141,6 +142,7 @@ private:
     const node::internal::Mempool& mempool_;
     const Type chain_;
     const filter::Type filter_type_;
+    const std::shared_ptr<ScanCoordinator> scan_coordinator_;
     const CString shutdown_endpoint_;
     const CString to_children_endpoint_;
     const CString from_children_endpoint_;
@@ -85,6 +85,26 @@ struct BitcoinTransactionBuilder::Imp {
     {
         return sender_->ID();
     }
+    auto Target() const noexcept -> std::optional<SelectionTarget>
+    {
+        try {
+            const auto required =
+                (output_value_ + required_fee()) - input_value_;
+
+            // NOTE IsFunded requires the input value to exceed the output
+            // value plus the fee. The fee for each additional input is
+            // calculated by the selector. Excess value which does not
+            // exceed the dust limit is not returned as change.
+            return SelectionTarget{
+                required.Internal().ExtractInt64() + 1,
+                fee_rate_.Internal().ExtractInt64(),
+                static_cast<std::int64_t>(dust())};
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return std::nullopt;
+        }
+    }
 
     auto AddChange(const Proposal& data) noexcept -> bool
     {
@@ -1328,5 +1348,11 @@ auto BitcoinTransactionBuilder::Spender() const noexcept
     return imp_->Spender();
 }
 
+auto BitcoinTransactionBuilder::Target() const noexcept
+    -> std::optional<SelectionTarget>
+{
+    return imp_->Target();
+}
+
 BitcoinTransactionBuilder::~BitcoinTransactionBuilder() = default;
 }  // namespace opentxs::blockchain::node::wallet
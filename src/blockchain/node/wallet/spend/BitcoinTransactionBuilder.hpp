@@ -31,6 +31,7 @@
 #include "internal/blockchain/node/Node.hpp"
 #include "internal/blockchain/node/wallet/Account.hpp"
 #include "internal/blockchain/node/wallet/Accounts.hpp"
+#include "internal/blockchain/node/wallet/CoinSelection.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -112,6 +113,8 @@ public:
 
     auto IsFunded() const noexcept -> bool;
     auto Spender() const noexcept -> const identifier::Nym&;
+    /// Value which additional inputs must provide to fund the transaction
+    auto Target() const noexcept -> std::optional<SelectionTarget>;
 
     auto AddChange(const Proposal& proposal) noexcept -> bool;
     auto AddInput(const UTXO& utxo) noexcept -> bool;
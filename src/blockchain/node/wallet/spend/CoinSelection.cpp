@@ -0,0 +1,424 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/blockchain/node/wallet/CoinSelection.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Script.hpp"
+#include "opentxs/blockchain/crypto/Types.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node::wallet
+{
+namespace
+{
+// NOTE limits the number of nodes visited by branch and bound so that
+// selecting from a very large wallet finishes in bounded time
+constexpr auto bnb_tries_ = std::size_t{100000};
+constexpr auto knapsack_iterations_ = std::size_t{1000};
+
+struct Candidate {
+    std::size_t index_{};
+    std::int64_t effective_{};
+    std::int64_t fee_{};
+};
+
+using Candidates = UnallocatedVector<Candidate>;
+using Positions = UnallocatedVector<std::size_t>;
+
+auto fee(const std::int64_t rate, const std::size_t bytes) noexcept
+    -> std::int64_t
+{
+    // NOTE rounded up so the sum of the input fees is never less than the fee
+    // calculated by the transaction builder
+    const auto total = std::max<std::int64_t>(rate, 0) *
+                       static_cast<std::int64_t>(bytes);
+
+    return (total + 999) / 1000;
+}
+
+// NOTE returns coins with a positive effective value ordered by descending
+// effective value
+auto candidates(
+    const SelectionTarget& target,
+    const UnallocatedVector<Coin>& coins) noexcept -> Candidates
+{
+    auto out = Candidates{};
+    out.reserve(coins.size());
+
+    for (auto i = std::size_t{0}; i < coins.size(); ++i) {
+        const auto& coin = coins[i];
+        const auto cost = fee(target.fee_rate_, coin.bytes_);
+
+        if (coin.value_ <= cost) { continue; }
+
+        out.push_back({i, coin.value_ - cost, cost});
+    }
+
+    std::sort(out.begin(), out.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.effective_ == rhs.effective_) {
+
+            return lhs.index_ < rhs.index_;
+        }
+
+        return lhs.effective_ > rhs.effective_;
+    });
+
+    return out;
+}
+
+auto total(const Candidates& in) noexcept -> std::int64_t
+{
+    auto out = std::int64_t{0};
+
+    for (const auto& coin : in) { out += coin.effective_; }
+
+    return out;
+}
+
+// NOTE a depth first search through the inclusion and omission of each
+// candidate, largest first, for a set whose effective value falls between
+// the target and the target plus the cost of a change output. Branches are
+// abandoned as soon as they overshoot or can no longer reach the target.
+auto branch_and_bound(
+    const SelectionTarget& target,
+    const Candidates& in) noexcept -> std::optional<Positions>
+{
+    const auto lower = target.value_;
+    const auto upper = lower + std::max<std::int64_t>(target.change_cost_, 0);
+    auto available = total(in);
+
+    if (available < lower) { return std::nullopt; }
+
+    auto value = std::int64_t{0};
+    auto path = Positions{};
+    auto best = std::optional<Positions>{};
+    auto bestExcess = std::numeric_limits<std::int64_t>::max();
+
+    for (auto tries = std::size_t{0}, i = std::size_t{0}; tries < bnb_tries_;
+         ++tries, ++i) {
+        auto backtrack = false;
+
+        if (((value + available) < lower) || (value > upper)) {
+            backtrack = true;
+        } else if (value >= lower) {
+            const auto excess = value - lower;
+
+            if (excess < bestExcess) {
+                best = path;
+                bestExcess = excess;
+            }
+
+            if (0 == excess) { break; }
+
+            backtrack = true;
+        }
+
+        if (backtrack) {
+            if (path.empty()) { break; }
+
+            // NOTE the candidates omitted after the last included candidate
+            // become available again before its omission branch is explored
+            for (--i; i > path.back(); --i) { available += in[i].effective_; }
+
+            value -= in[i].effective_;
+            path.pop_back();
+        } else {
+            const auto& coin = in[i];
+            available -= coin.effective_;
+            // NOTE including a candidate after omitting an equal one would
+            // repeat a branch which has already been searched
+            const auto duplicate =
+                (0u < i) && (path.empty() || ((i - 1u) != path.back())) &&
+                (coin.effective_ == in[i - 1u].effective_);
+
+            if (false == duplicate) {
+                path.push_back(i);
+                value += coin.effective_;
+            }
+        }
+    }
+
+    return best;
+}
+
+// NOTE approximates the smallest subset of the candidates which reaches the
+// goal by repeatedly including candidates at random and then in order
+auto approximate(
+    const Candidates& in,
+    const Positions& subset,
+    const std::int64_t subsetTotal,
+    const std::int64_t goal) noexcept -> Positions
+{
+    auto rng = std::mt19937_64{std::random_device{}()};
+    auto included = UnallocatedVector<bool>(subset.size(), false);
+    auto best = UnallocatedVector<bool>(subset.size(), true);
+    auto bestValue = subsetTotal;
+
+    for (auto iteration = std::size_t{0};
+         (iteration < knapsack_iterations_) && (bestValue != goal);
+         ++iteration) {
+        std::fill(included.begin(), included.end(), false);
+        auto value = std::int64_t{0};
+        auto reached = false;
+
+        for (auto pass = 0; (pass < 2) && (false == reached); ++pass) {
+            auto bits = std::uint64_t{0};
+
+            for (auto i = std::size_t{0}; i < subset.size(); ++i) {
+                if (0u == (i % 64u)) { bits = rng(); }
+
+                const auto include =
+                    (0 == pass) ? (1u == (bits & 1u)) : (false == included[i]);
+                bits >>= 1u;
+
+                if (false == include) { continue; }
+
+                value += in[subset[i]].effective_;
+                included[i] = true;
+
+                if (value >= goal) {
+                    reached = true;
+
+                    if (value < bestValue) {
+                        bestValue = value;
+                        best = included;
+                    }
+
+                    value -= in[subset[i]].effective_;
+                    included[i] = false;
+                }
+            }
+        }
+    }
+
+    auto out = Positions{};
+
+    for (auto i = std::size_t{0}; i < subset.size(); ++i) {
+        if (best[i]) { out.push_back(subset[i]); }
+    }
+
+    return out;
+}
+
+auto knapsack(const SelectionTarget& target, const Candidates& in) noexcept
+    -> std::optional<Positions>
+{
+    const auto goal = target.value_;
+    const auto threshold =
+        goal + std::max<std::int64_t>(target.change_cost_, 0);
+    auto smaller = Positions{};
+    auto smallerTotal = std::int64_t{0};
+    auto lowestLarger = std::optional<std::size_t>{};
+
+    for (auto i = std::size_t{0}; i < in.size(); ++i) {
+        const auto value = in[i].effective_;
+
+        if (value == goal) {
+
+            return Positions{i};
+        } else if (value < threshold) {
+            smaller.push_back(i);
+            smallerTotal += value;
+        } else {
+            // NOTE candidates are in descending order so the last one seen
+            // is the smallest
+            lowestLarger = i;
+        }
+    }
+
+    if (smallerTotal == goal) { return smaller; }
+
+    if (smallerTotal < goal) {
+        if (lowestLarger.has_value()) { return Positions{*lowestLarger}; }
+
+        return std::nullopt;
+    }
+
+    auto best = approximate(in, smaller, smallerTotal, goal);
+    auto bestValue = std::int64_t{0};
+
+    for (const auto i : best) { bestValue += in[i].effective_; }
+
+    if (lowestLarger.has_value() && (bestValue != goal) &&
+        (in[*lowestLarger].effective_ <= bestValue)) {
+
+        return Positions{*lowestLarger};
+    }
+
+    return best;
+}
+
+auto largest_first(const SelectionTarget& target, const Candidates& in) noexcept
+    -> std::optional<Positions>
+{
+    auto out = Positions{};
+    auto value = std::int64_t{0};
+
+    for (auto i = std::size_t{0}; i < in.size(); ++i) {
+        if (value >= target.value_) { break; }
+
+        out.push_back(i);
+        value += in[i].effective_;
+    }
+
+    if (value < target.value_) { return std::nullopt; }
+
+    return out;
+}
+
+auto make_selection(
+    const SelectionStrategy strategy,
+    const SelectionTarget& target,
+    const Candidates& in,
+    const Positions& chosen) noexcept -> Selection
+{
+    auto out = Selection{};
+    out.coins_.reserve(chosen.size());
+    out.strategy_ = strategy;
+    auto value = std::int64_t{0};
+
+    for (const auto i : chosen) {
+        const auto& coin = in[i];
+        out.coins_.push_back(coin.index_);
+        out.fee_ += coin.fee_;
+        value += coin.effective_;
+    }
+
+    out.excess_ = value - target.value_;
+
+    return out;
+}
+}  // namespace
+
+auto InputBytes(const block::bitcoin::Output& output) noexcept
+    -> std::optional<std::size_t>
+{
+    using CompactSize = network::blockchain::bitcoin::CompactSize;
+    using Pattern = block::bitcoin::Script::Pattern;
+    // NOTE these match the placeholder signatures and keys used by
+    // factory::BitcoinTransactionInput. Witness bytes are counted at full
+    // size.
+    static constexpr auto outpoint = std::size_t{36};
+    static constexpr auto sequence = std::size_t{4};
+    static constexpr auto signature = std::size_t{1u + 72u};
+    static constexpr auto pubkey = std::size_t{1u + 33u};
+    const auto input = [](const std::size_t script) {
+        return outpoint + CompactSize{script}.Total() + sequence;
+    };
+
+    switch (output.Script().Type()) {
+        case Pattern::PayToPubkey: {
+
+            return input(signature);
+        }
+        case Pattern::PayToPubkeyHash: {
+
+            return input(signature + pubkey);
+        }
+        case Pattern::PayToMultisig: {
+
+            return input(signature * output.Keys().size());
+        }
+        case Pattern::PayToWitnessPubkeyHash: {
+            static constexpr auto items = std::size_t{1};
+
+            return input(0u) + items + signature + pubkey;
+        }
+        default: {
+
+            return std::nullopt;
+        }
+    }
+}
+
+auto print(SelectionStrategy strategy) noexcept -> std::string_view
+{
+    using namespace std::literals;
+
+    switch (strategy) {
+        case SelectionStrategy::Automatic: {
+
+            return "automatic"sv;
+        }
+        case SelectionStrategy::BranchAndBound: {
+
+            return "branch and bound"sv;
+        }
+        case SelectionStrategy::Knapsack: {
+
+            return "knapsack"sv;
+        }
+        case SelectionStrategy::LargestFirst: {
+
+            return "largest first"sv;
+        }
+        default: {
+
+            return "error"sv;
+        }
+    }
+}
+
+auto SelectCoins(
+    const SelectionStrategy strategy,
+    const SelectionTarget& target,
+    const UnallocatedVector<Coin>& coins) noexcept -> std::optional<Selection>
+{
+    const auto in = candidates(target, coins);
+    const auto select = [&](const auto type, const auto& chosen) {
+        return std::make_optional(make_selection(type, target, in, chosen));
+    };
+
+    if (0 >= target.value_) { return select(strategy, Positions{}); }
+
+    switch (strategy) {
+        case SelectionStrategy::Automatic: {
+            using Type = SelectionStrategy;
+
+            if (auto out = branch_and_bound(target, in); out.has_value()) {
+
+                return select(Type::BranchAndBound, *out);
+            }
+
+            if (auto out = knapsack(target, in); out.has_value()) {
+
+                return select(Type::Knapsack, *out);
+            }
+        } break;
+        case SelectionStrategy::BranchAndBound: {
+            if (auto out = branch_and_bound(target, in); out.has_value()) {
+
+                return select(strategy, *out);
+            }
+        } break;
+        case SelectionStrategy::Knapsack: {
+            if (auto out = knapsack(target, in); out.has_value()) {
+
+                return select(strategy, *out);
+            }
+        } break;
+        case SelectionStrategy::LargestFirst: {
+            if (auto out = largest_first(target, in); out.has_value()) {
+
+                return select(strategy, *out);
+            }
+        } break;
+        default: {
+        }
+    }
+
+    return std::nullopt;
+}
+}  // namespace opentxs::blockchain::node::wallet
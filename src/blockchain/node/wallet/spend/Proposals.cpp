@@ -246,6 +246,27 @@ private:
             return output;
         }
 
+        if (const auto target = builder.Target(); target.has_value()) {
+            auto policy = node::internal::SpendPolicy{};
+            const auto utxos =
+                db_.ReserveUTXOs(builder.Spender(), id, *target, policy);
+
+            if (utxos.has_value()) {
+                for (const auto& utxo : *utxos) {
+                    if (false == builder.AddInput(utxo)) {
+                        LogError()(OT_PRETTY_CLASS())("Failed to add input")
+                            .Flush();
+                        output = BuildResult::PermanentFailure;
+                        rc = SendResult::InputCreationError;
+
+                        return output;
+                    }
+                }
+            }
+        }
+
+        // NOTE the selection relies on estimated input sizes so it may fall
+        // slightly short, in which case inputs are added one at a time
         while (false == builder.IsFunded()) {
             auto policy = node::internal::SpendPolicy{};
             auto utxo = db_.ReserveUTXO(builder.Spender(), id, policy);
@@ -51,6 +51,7 @@ DeterministicStateData::DeterministicStateData(
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
     const node::internal::Mempool& mempool,
+    std::shared_ptr<ScanCoordinator> coordinator,
     const crypto::Deterministic& subaccount,
     const filter::Type filter,
     const Subchain subchain,
@@ -64,6 +65,7 @@ DeterministicStateData::DeterministicStateData(
           node,
           db,
           mempool,
+          coordinator,
           subaccount.Type(),
           filter,
           subchain,
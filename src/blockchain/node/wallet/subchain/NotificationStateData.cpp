@@ -61,6 +61,7 @@ NotificationStateData::NotificationStateData(
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
     const node::internal::Mempool& mempool,
+    std::shared_ptr<ScanCoordinator> coordinator,
     const identifier::Nym& nym,
     const filter::Type filter,
     const network::zeromq::BatchID batch,
@@ -76,6 +77,7 @@ NotificationStateData::NotificationStateData(
           node,
           db,
           mempool,
+          coordinator,
           crypto::SubaccountType::Notification,
           filter,
           Subchain::Notification,
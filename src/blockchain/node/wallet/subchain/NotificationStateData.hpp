@@ -76,6 +76,7 @@ class Accounts;
 class Progress;
 class Rescan;
 class Scan;
+class ScanCoordinator;
 }  // namespace wallet
 }  // namespace node
 }  // namespace blockchain
@@ -116,6 +117,7 @@ public:
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
         const node::internal::Mempool& mempool,
+        std::shared_ptr<ScanCoordinator> coordinator,
         const identifier::Nym& nym,
         const filter::Type filter,
         const network::zeromq::BatchID batch,
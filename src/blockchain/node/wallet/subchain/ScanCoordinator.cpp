@@ -0,0 +1,261 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/wallet/subchain/ScanCoordinator.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+
+namespace opentxs::blockchain::node::wallet
+{
+namespace
+{
+// NOTE approximate cost of an entry before its filter is loaded: the map and
+// queue nodes, the entry itself, and the results for a few subchains
+constexpr auto entry_overhead_ = std::size_t{512};
+}  // namespace
+
+ScanCoordinator::ScanCoordinator(Loader&& loader, std::size_t capacity) noexcept
+    : load_(std::move(loader))
+    , capacity_(std::max<std::size_t>(capacity, entry_overhead_))
+    , lock_()
+    , subscribers_()
+    , entries_()
+    , order_()
+    , bytes_(0)
+{
+}
+
+auto ScanCoordinator::charge(
+    const block::Position& position,
+    const Entry& entry,
+    std::size_t bytes) const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    const auto i = entries_.find(position.second);
+
+    // NOTE the entry may have been evicted while its filter was loading
+    if ((entries_.end() == i) || (i->second.get() != &entry)) { return; }
+
+    i->second->bytes_ += bytes;
+    bytes_ += bytes;
+    trim();
+}
+
+auto ScanCoordinator::footprint(const GCS& filter) noexcept -> std::size_t
+{
+    // NOTE a filter which has been matched holds its decoded set of 64 bit
+    // hashes as well as the Golomb coded set, which takes less than three
+    // bytes per element with the BIP-158 parameters
+    return static_cast<std::size_t>(filter.ElementCount()) *
+           (sizeof(std::uint64_t) + 3u);
+}
+
+auto ScanCoordinator::get(const block::Position& position) const noexcept
+    -> std::shared_ptr<Entry>
+{
+    auto lock = Lock{lock_};
+    auto [it, added] = entries_.try_emplace(position.second, nullptr);
+
+    if (added) {
+        auto out = std::make_shared<Entry>();
+        out->bytes_ = entry_overhead_;
+        it->second = out;
+        bytes_ += entry_overhead_;
+        order_.emplace_back(position.second);
+        trim();
+
+        return out;
+    }
+
+    return it->second;
+}
+
+auto ScanCoordinator::horizon() const noexcept -> std::size_t
+{
+    if (order_.empty() || (0u == bytes_)) {
+
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+    // NOTE the number of blocks which fit in the budget at the current
+    // average cost per block
+    const auto average = std::max<std::size_t>(bytes_ / order_.size(), 1u);
+
+    return capacity_ / average;
+}
+
+auto ScanCoordinator::Match(
+    const Identifier& subchain,
+    const block::Position& position) const noexcept -> std::pair<Filter, bool>
+{
+    const auto generation = [&]() -> std::optional<std::size_t> {
+        auto lock = Lock{lock_};
+
+        if (auto i = subscribers_.find(subchain); subscribers_.end() != i) {
+
+            return i->second.generation_;
+        }
+
+        return std::nullopt;
+    }();
+    const auto pEntry = get(position);
+    auto& entry = *pEntry;
+    auto lock = Lock{entry.lock_};
+    const auto cached = [&] {
+        if (false == generation.has_value()) { return false; }
+
+        const auto i = entry.results_.find(subchain);
+
+        if (entry.results_.end() == i) { return false; }
+
+        return i->second.generation_ == generation.value();
+    }();
+
+    if (false == cached) { match(subchain, position, entry); }
+
+    if (false == bool(entry.filter_)) { return {nullptr, false}; }
+
+    if (false == generation.has_value()) { return {entry.filter_, false}; }
+
+    if (auto i = entry.results_.find(subchain); entry.results_.end() != i) {
+
+        return {entry.filter_, i->second.match_};
+    }
+
+    return {entry.filter_, false};
+}
+
+auto ScanCoordinator::match(
+    const Identifier& requester,
+    const block::Position& position,
+    Entry& entry) const noexcept -> void
+{
+    if (false == bool(entry.filter_)) {
+        entry.filter_ = load_(position);
+
+        if (false == bool(entry.filter_)) { return; }
+
+        charge(position, entry, footprint(*entry.filter_));
+    }
+
+    auto candidates = UnallocatedVector<std::pair<OTIdentifier, Subscriber>>{};
+
+    {
+        auto lock = Lock{lock_};
+
+        for (const auto& [id, subscriber] : subscribers_) {
+            const auto include = (id == requester)
+                                     ? bool(subscriber.targets_)
+                                     : needs(id, subscriber, position, entry);
+
+            if (include) { candidates.emplace_back(id, subscriber); }
+        }
+    }
+
+    if (candidates.empty()) { return; }
+
+    auto targets = Targets{};
+    // NOTE owners[i] is the candidate which supplied targets[i]
+    auto owners = UnallocatedVector<std::size_t>{};
+    auto matched = UnallocatedVector<bool>(candidates.size(), false);
+
+    for (auto i = std::size_t{0}; i < candidates.size(); ++i) {
+        const auto& subset = *candidates[i].second.targets_;
+        std::copy(subset.begin(), subset.end(), std::back_inserter(targets));
+        owners.insert(owners.end(), subset.size(), i);
+    }
+
+    for (const auto& it : entry.filter_->Match(targets)) {
+        const auto index = std::distance(targets.cbegin(), it);
+        matched[owners[static_cast<std::size_t>(index)]] = true;
+    }
+
+    for (auto i = std::size_t{0}; i < candidates.size(); ++i) {
+        const auto& [id, subscriber] = candidates[i];
+        entry.results_[id] = Result{subscriber.generation_, matched[i]};
+    }
+}
+
+auto ScanCoordinator::needs(
+    const Identifier& id,
+    const Subscriber& subscriber,
+    const block::Position& position,
+    const Entry& entry) const noexcept -> bool
+{
+    if (false == bool(subscriber.targets_)) { return false; }
+
+    if (auto i = entry.results_.find(id); entry.results_.end() != i) {
+        if (i->second.generation_ == subscriber.generation_) { return false; }
+    }
+
+    const auto& height = position.first;
+
+    // NOTE a subchain which is far behind would not reach this block before
+    // the result is evicted
+    if ((height < subscriber.from_) ||
+        (static_cast<std::size_t>(height - subscriber.from_) >= horizon())) {
+
+        return false;
+    }
+
+    return true;
+}
+
+auto ScanCoordinator::Remove(const Identifier& subchain) const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    subscribers_.erase(subchain);
+}
+
+auto ScanCoordinator::same(const Targets& lhs, const Targets& rhs) noexcept
+    -> bool
+{
+    return std::equal(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](auto l, auto r) {
+            return l == r;
+        });
+}
+
+auto ScanCoordinator::trim() const noexcept -> void
+{
+    // NOTE the most recently added entry is never evicted
+    while ((bytes_ > capacity_) && (1u < order_.size())) {
+        if (auto i = entries_.find(order_.front()); entries_.end() != i) {
+            bytes_ -= i->second->bytes_;
+            entries_.erase(i);
+        }
+
+        order_.pop_front();
+    }
+}
+
+auto ScanCoordinator::Update(
+    const Identifier& subchain,
+    const block::Height from,
+    pTargets targets) const noexcept -> void
+{
+    auto lock = Lock{lock_};
+    auto& subscriber = subscribers_[subchain];
+    subscriber.from_ = from;
+
+    const auto& current = subscriber.targets_;
+
+    if (current && targets && same(*current, *targets)) { return; }
+
+    subscriber.targets_ = std::move(targets);
+    ++subscriber.generation_;
+}
+
+ScanCoordinator::~ScanCoordinator() = default;
+}  // namespace opentxs::blockchain::node::wallet
@@ -0,0 +1,127 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/GCS.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node::wallet
+{
+/** Shares cfilter scanning between all the subchains of one chain
+ *
+ *  Every subchain publishes its account targets before it starts a scan. The
+ *  first subchain to reach a block loads the filter and tests it against the
+ *  union of the targets of every subchain which still needs that block. The
+ *  filter and the per-subchain results are retained so the Scan jobs of the
+ *  other subchains reuse them instead of loading and decoding the same filter
+ *  again.
+ */
+class ScanCoordinator
+{
+public:
+    using Filter = std::shared_ptr<const GCS>;
+    using Loader =
+        std::function<std::unique_ptr<const GCS>(const block::Position&)>;
+    using Targets = GCS::Targets;
+    using pTargets = std::shared_ptr<const Targets>;
+
+    /// Default memory budget for retained filters, in bytes
+    static constexpr auto default_capacity_ =
+        std::size_t{64u} * 1024u * 1024u;
+
+    /** Test a filter against the most recent targets for a subchain
+     *
+     *  \returns the filter, or nullptr if it is not available, and whether
+     *  any of the subchain's targets matched
+     */
+    auto Match(const Identifier& subchain, const block::Position& position)
+        const noexcept -> std::pair<Filter, bool>;
+    /** Stop including a subchain in shared matching */
+    auto Remove(const Identifier& subchain) const noexcept -> void;
+    /** Publish the targets for a subchain which is about to scan
+     *
+     *  The targets must remain valid for as long as the pointer is held.
+     */
+    auto Update(
+        const Identifier& subchain,
+        const block::Height from,
+        pTargets targets) const noexcept -> void;
+
+    /** \param capacity approximate upper bound for the memory held by
+     *  retained filters and their results, in bytes
+     */
+    ScanCoordinator(
+        Loader&& loader,
+        std::size_t capacity = default_capacity_) noexcept;
+
+    ~ScanCoordinator();
+
+private:
+    struct Subscriber {
+        pTargets targets_{};
+        block::Height from_{};
+        std::size_t generation_{};
+    };
+    struct Result {
+        std::size_t generation_{};
+        bool match_{};
+    };
+    struct Entry {
+        mutable std::mutex lock_{};
+        Filter filter_{};
+        UnallocatedMap<OTIdentifier, Result> results_{};
+        // NOTE guarded by the coordinator lock
+        std::size_t bytes_{};
+    };
+
+    using Entries = UnallocatedMap<block::pHash, std::shared_ptr<Entry>>;
+    using Subscribers = UnallocatedMap<OTIdentifier, Subscriber>;
+
+    const Loader load_;
+    const std::size_t capacity_;
+    mutable std::mutex lock_;
+    mutable Subscribers subscribers_;
+    mutable Entries entries_;
+    mutable UnallocatedDeque<block::pHash> order_;
+    mutable std::size_t bytes_;
+
+    static auto footprint(const GCS& filter) noexcept -> std::size_t;
+    static auto same(const Targets& lhs, const Targets& rhs) noexcept -> bool;
+
+    auto charge(
+        const block::Position& position,
+        const Entry& entry,
+        std::size_t bytes) const noexcept -> void;
+    auto get(const block::Position& position) const noexcept
+        -> std::shared_ptr<Entry>;
+    auto horizon() const noexcept -> std::size_t;
+    auto match(
+        const Identifier& requester,
+        const block::Position& position,
+        Entry& entry) const noexcept -> void;
+    auto needs(
+        const Identifier& id,
+        const Subscriber& subscriber,
+        const block::Position& position,
+        const Entry& entry) const noexcept -> bool;
+    auto trim() const noexcept -> void;
+
+    ScanCoordinator() = delete;
+    ScanCoordinator(const ScanCoordinator&) = delete;
+    ScanCoordinator(ScanCoordinator&&) = delete;
+    auto operator=(const ScanCoordinator&) -> ScanCoordinator& = delete;
+    auto operator=(ScanCoordinator&&) -> ScanCoordinator& = delete;
+};
+}  // namespace opentxs::blockchain::node::wallet
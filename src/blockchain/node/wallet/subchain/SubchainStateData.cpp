@@ -12,6 +12,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "blockchain/node/wallet/subchain/ScanCoordinator.hpp"
 #include "blockchain/node/wallet/subchain/ScriptForm.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/Index.hpp"
 #include "internal/api/crypto/Blockchain.hpp"
@@ -85,6 +86,7 @@ SubchainStateData::SubchainStateData(
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
     const node::internal::Mempool& mempool,
+    std::shared_ptr<ScanCoordinator> coordinator,
     const crypto::SubaccountType accountType,
     const filter::Type filter,
     const Subchain subchain,
@@ -126,6 +128,7 @@ SubchainStateData::SubchainStateData(
     , node_(node)
     , db_(db)
     , mempool_oracle_(mempool)
+    , scan_coordinator_(std::move(coordinator))
     , task_finished_([&](const Identifier& id, const char* type) {
         auto work = MakeWork(Work::job_finished);
         work.AddFrame(id.data(), id.size());
@@ -252,6 +255,7 @@ auto SubchainStateData::do_shutdown() noexcept -> void
     scan_.Shutdown();
     rescan_.Shutdown();
     process_.Shutdown();
+    scan_coordinator_->Remove(db_key_);
 }
 
 auto SubchainStateData::finish_background_tasks() noexcept -> void
@@ -457,7 +461,7 @@ auto SubchainStateData::process_job_finished(Message&& in) noexcept -> void
     OT_ASSERT(2 < body.size());
 
     const auto id = api_.Factory().Identifier(body.at(1));
-    const auto str = CString{body.at(2).Bytes(), get_allocator()};
+    const auto str = CString{body.at(2).Bytes(), scratch()};
     process_job_finished(id, str.c_str());
 }
 
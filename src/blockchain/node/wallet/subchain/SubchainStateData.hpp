@@ -91,6 +91,7 @@ namespace wallet
 {
 class Index;
 class Job;
+class ScanCoordinator;
 class ScriptForm;
 class Work;
 }  // namespace wallet
@@ -126,6 +127,7 @@ public:
     const node::internal::Network& node_;
     const node::internal::WalletDatabase& db_;
     const node::internal::Mempool& mempool_oracle_;
+    const std::shared_ptr<ScanCoordinator> scan_coordinator_;
     const std::function<void(const Identifier&, const char*)> task_finished_;
     const UnallocatedCString name_;
     const OTNymID owner_;
@@ -205,6 +207,7 @@ protected:
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
         const node::internal::Mempool& mempool,
+        std::shared_ptr<ScanCoordinator> coordinator,
         const crypto::SubaccountType accountType,
         const filter::Type filter,
         const Subchain subchain,
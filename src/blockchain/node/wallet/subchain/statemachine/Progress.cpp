@@ -8,6 +8,7 @@
 #include "blockchain/node/wallet/subchain/statemachine/Progress.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -19,10 +20,14 @@
 #include "internal/blockchain/node/Node.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/crypto/Types.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Pimpl.hpp"
+#include "util/Metrics.hpp"
 
 namespace opentxs::blockchain::node::wallet
 {
@@ -108,6 +113,14 @@ struct Progress::Imp {
             return std::move(pos);
         }())
         , dirty_blocks_()
+        , height_metric_(metrics::Get().AddGauge(
+              "opentxs_blockchain_wallet_scan_height",
+              "Highest block scanned without outstanding matches",
+              labels(parent_)))
+        , dirty_metric_(metrics::Get().AddGauge(
+              "opentxs_blockchain_wallet_dirty_blocks",
+              "Number of scanned blocks waiting to be processed",
+              labels(parent_)))
     {
     }
 
@@ -121,6 +134,17 @@ private:
     std::optional<block::Position> last_reported_;
     std::optional<block::Position> highest_clean_;
     UnallocatedSet<block::Position> dirty_blocks_;
+    const std::shared_ptr<metrics::Gauge> height_metric_;
+    const std::shared_ptr<metrics::Gauge> dirty_metric_;
+
+    static auto labels(const SubchainStateData& parent) noexcept
+        -> metrics::Labels
+    {
+        return {
+            {"chain", opentxs::print(parent.chain_)},
+            {"subaccount", parent.id_->str()},
+            {"subchain", opentxs::print(parent.subchain_)}};
+    }
 
     auto lowest_dirty(const Lock&) const noexcept
         -> std::optional<block::Position>
@@ -133,6 +157,8 @@ private:
     auto report(const Lock& lock, bool reorg) noexcept -> void
     {
         const auto& best = highest_clean_.value_or(parent_.null_position_);
+        height_metric_->Set(best.first);
+        dirty_metric_->Set(static_cast<std::int64_t>(dirty_blocks_.size()));
         const auto report = [&] {
             if (last_reported_.has_value()) {
                 const auto& value = last_reported_.value();
@@ -14,9 +14,11 @@
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "blockchain/node/wallet/subchain/ScanCoordinator.hpp"
 #include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/Batch.hpp"
 #include "blockchain/node/wallet/subchain/statemachine/Process.hpp"
@@ -57,9 +59,7 @@ auto Scan::Do(
     const auto& api = parent_.api_;
     const auto& name = parent_.name_;
     const auto& node = parent_.node_;
-    const auto& type = parent_.filter_type_;
     const auto& headers = node.HeaderOracle();
-    const auto& filters = node.FilterOracleInternal();
     const auto start = Clock::now();
     const auto startHeight = highestTested.first + 1;
     const auto stopHeight =
@@ -113,7 +113,18 @@ auto Scan::Do(
     log(OT_PRETTY_CLASS())(name)(" ")(this->type())("ning filters from ")(
         startHeight)(" to ")(stopHeight)
         .Flush();
-    const auto [elements, utxos, patterns] = parent_.get_account_targets();
+    using AccountTargets = std::tuple<
+        SubchainStateData::Patterns,
+        SubchainStateData::UTXOs,
+        SubchainStateData::Targets>;
+    const auto pTargets =
+        std::make_shared<const AccountTargets>(parent_.get_account_targets());
+    const auto& [elements, utxos, patterns] = *pTargets;
+    auto& coordinator = *parent_.scan_coordinator_;
+    coordinator.Update(
+        parent_.db_key_,
+        startHeight,
+        ScanCoordinator::pTargets{pTargets, &patterns});
     auto blockHash = api.Factory().Data();
 
     for (auto i{startHeight}; i <= stopHeight; ++i) {
@@ -130,7 +141,10 @@ auto Scan::Do(
         }
 
         auto testPosition = block::Position{i, blockHash};
-        const auto pFilter = filters.LoadFilterOrResetTip(type, testPosition);
+        // NOTE the coordinator tests the filter against the targets of every
+        // subchain at once so most of the time this is a cache lookup
+        const auto [pFilter, matched] =
+            coordinator.Match(parent_.db_key_, testPosition);
 
         if (false == bool(pFilter)) {
             log(OT_PRETTY_CLASS())(name)(" filter at height ")(i)(" not found ")
@@ -140,14 +154,12 @@ auto Scan::Do(
         }
 
         atLeastOnce = true;
-        const auto& filter = *pFilter;
-        auto matches = filter.Match(patterns);
         auto isClean{true};
 
-        if (0 < matches.size()) {
+        if (matched) {
             const auto [untested, retest] =
                 parent_.get_block_targets(blockHash, utxos);
-            matches = filter.Match(retest);
+            const auto matches = pFilter->Match(retest);
 
             if (0 < matches.size()) {
                 log(OT_PRETTY_CLASS())(name)(" GCS ")(this->type())(
@@ -0,0 +1,595 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                          // IWYU pragma: associated
+#include "1_Internal.hpp"                        // IWYU pragma: associated
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"  // IWYU pragma: associated
+
+#include <robin_hood.h>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace opentxs::blockchain::p2p::bitcoin
+{
+namespace
+{
+using opentxs::network::blockchain::bitcoin::ByteIterator;
+using opentxs::network::blockchain::bitcoin::DecodeSize;
+
+struct Reader {
+    auto Bytes(const std::size_t count) noexcept(false) -> ReadView
+    {
+        expected_ += count;
+
+        if (expected_ > total_) { throw std::runtime_error{"short payload"}; }
+
+        const auto output =
+            ReadView{reinterpret_cast<const char*>(it_), count};
+        std::advance(it_, count);
+
+        return output;
+    }
+    auto Remaining() const noexcept -> ReadView
+    {
+        return {reinterpret_cast<const char*>(it_), total_ - expected_};
+    }
+    auto Size() noexcept(false) -> std::size_t
+    {
+        expected_ += 1;
+        auto output = std::size_t{};
+
+        if (false == DecodeSize(it_, expected_, total_, output)) {
+            throw std::runtime_error{"invalid CompactSize"};
+        }
+
+        return output;
+    }
+
+    Reader(const ReadView in) noexcept
+        : it_(reinterpret_cast<ByteIterator>(in.data()))
+        , expected_(0)
+        , total_(in.size())
+    {
+    }
+
+private:
+    ByteIterator it_;
+    std::size_t expected_;
+    const std::size_t total_;
+};
+
+auto append(Space& out, const ReadView bytes) noexcept -> void
+{
+    const auto* i = reinterpret_cast<const std::byte*>(bytes.data());
+    out.insert(out.end(), i, std::next(i, bytes.size()));
+}
+
+auto append(Space& out, const std::size_t value) noexcept -> void
+{
+    const auto cs = CompactSize(value).Encode();
+    out.insert(out.end(), cs.begin(), cs.end());
+}
+
+auto copy(const Space& in, AllocateOutput destination) noexcept -> bool
+{
+    if (!destination) { return false; }
+
+    auto output = destination(in.size());
+
+    if (false == output.valid(in.size())) { return false; }
+
+    std::memcpy(output.data(), in.data(), in.size());
+
+    return true;
+}
+
+// NOTE the transaction parser reports how many bytes a serialized transaction
+// occupies which allows transactions to be split out of a longer payload
+auto read_transaction(
+    const api::Session& api,
+    const blockchain::Type chain,
+    Reader& reader) noexcept(false) -> Space
+{
+    const auto remaining = reader.Remaining();
+    const auto tx = blockchain::bitcoin::EncodedTransaction::Deserialize(
+        api, chain, remaining);
+
+    return space(reader.Bytes(tx.size()));
+}
+}  // namespace
+
+CompactBlock::CompactBlock(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const ReadView payload) noexcept(false)
+    : api_(api)
+    , chain_(chain)
+    , version_(Version(chain_))
+    , header_()
+    , nonce_()
+    , key_()
+    , hash_(api_.Factory().Data())
+    , short_ids_()
+    , prefilled_()
+{
+    auto reader = Reader{payload};
+    const auto header = reader.Bytes(header_.size());
+    std::memcpy(header_.data(), header.data(), header.size());
+    auto nonce = NonceField{};
+    const auto bytes = reader.Bytes(sizeof(nonce));
+    std::memcpy(static_cast<void*>(&nonce), bytes.data(), bytes.size());
+    nonce_ = nonce.value();
+    const auto ids = reader.Size();
+
+    if (ids > (reader.Remaining().size() / short_id_bytes_)) {
+        throw std::runtime_error{"short id count exceeds payload size"};
+    }
+
+    short_ids_.reserve(ids);
+
+    for (auto i = std::size_t{0}; i < ids; ++i) {
+        auto id = ShortID{};
+        const auto raw = reader.Bytes(short_id_bytes_);
+        // NOTE short ids are little endian
+        std::memcpy(&id, raw.data(), raw.size());
+        short_ids_.emplace_back(be::little_to_native(id) & short_id_mask_);
+    }
+
+    const auto prefill = reader.Size();
+
+    if (prefill > reader.Remaining().size()) {
+        throw std::runtime_error{"prefilled count exceeds payload size"};
+    }
+
+    auto indices = UnallocatedVector<std::size_t>{};
+    indices.reserve(prefill);
+
+    for (auto i = std::size_t{0}; i < prefill; ++i) {
+        indices.emplace_back(reader.Size());
+        prefilled_.push_back({0, read_transaction(api_, chain_, reader)});
+    }
+
+    indices = DifferentialDecode(indices);
+
+    for (auto i = std::size_t{0}; i < prefill; ++i) {
+        prefilled_.at(i).index_ = indices.at(i);
+    }
+
+    if ((0u < prefill) && (indices.back() >= size())) {
+        throw std::runtime_error{"prefilled transaction index out of range"};
+    }
+
+    init();
+}
+
+CompactBlock::CompactBlock(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const block::bitcoin::Block& block,
+    const std::uint64_t nonce) noexcept(false)
+    : api_(api)
+    , chain_(chain)
+    , version_(Version(chain_))
+    , header_()
+    , nonce_(nonce)
+    , key_()
+    , hash_(api_.Factory().Data())
+    , short_ids_()
+    , prefilled_()
+{
+    const auto serialized = block.Header().Serialize(
+        preallocated(header_.size(), header_.data()), true);
+
+    if (false == serialized) {
+        throw std::runtime_error{"failed to serialize header"};
+    }
+
+    if (0u == block.size()) { throw std::runtime_error{"empty block"}; }
+
+    init();
+    short_ids_.reserve(block.size() - 1u);
+
+    for (auto i = std::size_t{0}; i < block.size(); ++i) {
+        const auto& tx = *block.at(i);
+
+        if (0u == i) {
+            auto& coinbase = prefilled_.emplace_back();
+            coinbase.index_ = i;
+
+            if (false == tx.Internal().Serialize(
+                             writer(coinbase.transaction_))) {
+                throw std::runtime_error{"failed to serialize coinbase"};
+            }
+        } else {
+            short_ids_.emplace_back(ShortTxID(TransactionID(tx)));
+        }
+    }
+}
+
+CompactBlock::CompactBlock(CompactBlock&&) noexcept = default;
+
+auto CompactBlock::DecodeTransactions(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const ReadView payload) noexcept(false)
+    -> std::pair<OTData, UnallocatedVector<Space>>
+{
+    auto output = std::pair<OTData, UnallocatedVector<Space>>{
+        api.Factory().Data(), {}};
+    auto& [hash, transactions] = output;
+    auto reader = Reader{payload};
+    hash->Assign(reader.Bytes(sizeof(BlockHeaderHashField)));
+    const auto count = reader.Size();
+
+    if (count > reader.Remaining().size()) {
+        throw std::runtime_error{"transaction count exceeds payload size"};
+    }
+
+    transactions.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        transactions.emplace_back(read_transaction(api, chain, reader));
+    }
+
+    return output;
+}
+
+auto CompactBlock::DifferentialDecode(
+    const UnallocatedVector<std::size_t>& indices) noexcept(false)
+    -> UnallocatedVector<std::size_t>
+{
+    static constexpr auto limit = std::size_t{0xffff};
+    auto output = UnallocatedVector<std::size_t>{};
+    output.reserve(indices.size());
+
+    for (const auto& index : indices) {
+        const auto value =
+            output.empty() ? index : output.back() + index + 1u;
+
+        // NOTE no block contains enough transactions to exceed this limit
+        if ((index > limit) || (value > limit)) {
+            throw std::runtime_error{"transaction index out of range"};
+        }
+
+        output.emplace_back(value);
+    }
+
+    return output;
+}
+
+auto CompactBlock::DifferentialEncode(
+    const UnallocatedVector<std::size_t>& indices) noexcept(false)
+    -> UnallocatedVector<std::size_t>
+{
+    auto output = UnallocatedVector<std::size_t>{};
+    output.reserve(indices.size());
+
+    for (auto i = std::size_t{0}; i < indices.size(); ++i) {
+        if (0u == i) {
+            output.emplace_back(indices.at(i));
+        } else {
+            const auto& previous = indices.at(i - 1u);
+            const auto& current = indices.at(i);
+
+            if (current <= previous) {
+                throw std::runtime_error{"indices are not sorted"};
+            }
+
+            output.emplace_back(current - previous - 1u);
+        }
+    }
+
+    return output;
+}
+
+auto CompactBlock::EncodeTransactions(
+    const block::Hash& block,
+    const UnallocatedVector<Space>& transactions,
+    AllocateOutput destination) noexcept -> bool
+{
+    auto out = Space{};
+    append(out, block.Bytes());
+    append(out, transactions.size());
+
+    for (const auto& tx : transactions) { append(out, reader(tx)); }
+
+    return copy(out, destination);
+}
+
+auto CompactBlock::Header() const noexcept -> ReadView
+{
+    return {reinterpret_cast<const char*>(header_.data()), header_.size()};
+}
+
+auto CompactBlock::init() noexcept(false) -> void
+{
+    if (false == BlockHash(api_, chain_, Header(), hash_->WriteInto())) {
+        throw std::runtime_error{"failed to calculate block hash"};
+    }
+
+    // NOTE the siphash key is the first 16 bytes of the single sha256 of the
+    // header followed by the nonce
+    auto preimage = space(Header());
+    const auto nonce = NonceField{nonce_};
+    append(preimage, ReadView{reinterpret_cast<const char*>(&nonce), 8u});
+    auto digest = Space{};
+    const auto hashed = api_.Crypto().Hash().Digest(
+        opentxs::crypto::HashType::Sha256, reader(preimage), writer(digest));
+
+    if ((false == hashed) || (16u > digest.size())) {
+        throw std::runtime_error{"failed to calculate short id key"};
+    }
+
+    key_.assign(digest.begin(), std::next(digest.begin(), 16));
+}
+
+auto CompactBlock::Serialize(AllocateOutput destination) const noexcept
+    -> bool
+{
+    auto out = Space{};
+    append(out, Header());
+    const auto nonce = NonceField{nonce_};
+    append(out, ReadView{reinterpret_cast<const char*>(&nonce), 8u});
+    append(out, short_ids_.size());
+
+    for (const auto& id : short_ids_) {
+        const auto le = be::native_to_little(id);
+        append(
+            out,
+            ReadView{reinterpret_cast<const char*>(&le), short_id_bytes_});
+    }
+
+    append(out, prefilled_.size());
+    const auto indices = [&] {
+        auto absolute = UnallocatedVector<std::size_t>{};
+        absolute.reserve(prefilled_.size());
+
+        for (const auto& tx : prefilled_) { absolute.emplace_back(tx.index_); }
+
+        return DifferentialEncode(absolute);
+    }();
+
+    for (auto i = std::size_t{0}; i < prefilled_.size(); ++i) {
+        append(out, indices.at(i));
+        append(out, reader(prefilled_.at(i).transaction_));
+    }
+
+    return copy(out, destination);
+}
+
+auto CompactBlock::ShortTxID(const ReadView id) const noexcept(false)
+    -> ShortID
+{
+    return gcs::Siphash(api_, reader(key_), id) & short_id_mask_;
+}
+
+auto CompactBlock::size() const noexcept -> std::size_t
+{
+    return short_ids_.size() + prefilled_.size();
+}
+
+auto CompactBlock::TransactionID(
+    const block::bitcoin::Transaction& tx) const noexcept -> ReadView
+{
+    if (2u == version_) {
+
+        return tx.WTXID().Bytes();
+    } else {
+
+        return tx.ID().Bytes();
+    }
+}
+
+auto CompactBlock::Version(const blockchain::Type chain) noexcept
+    -> std::uint64_t
+{
+    return HasSegwit(chain) ? 2u : 1u;
+}
+
+CompactBlock::~CompactBlock() = default;
+
+CompactBlockReconstructor::CompactBlockReconstructor(
+    CompactBlock&& compact,
+    const Transactions& mempool) noexcept(false)
+    : compact_(std::move(compact))
+    , slots_(compact_.size())
+{
+    for (const auto& [index, tx] : compact_.Prefill()) {
+        slots_.at(index) = tx;
+    }
+
+    // NOTE short ids fill the slots not occupied by prefilled transactions
+    // in order
+    using Index =
+        robin_hood::unordered_flat_map<CompactBlock::ShortID, std::size_t>;
+    auto index = Index{};
+    {
+        const auto& ids = compact_.ShortTxIDs();
+        index.reserve(ids.size());
+        auto slot = std::size_t{0};
+
+        for (const auto& id : ids) {
+            while (slots_.at(slot).has_value()) { ++slot; }
+
+            if (false == index.try_emplace(id, slot++).second) {
+                throw std::runtime_error{"short id collision in block"};
+            }
+        }
+    }
+
+    auto matched = UnallocatedVector<bool>(slots_.size(), false);
+    auto conflicts = UnallocatedVector<std::size_t>{};
+
+    for (const auto& pTx : mempool) {
+        if (!pTx) { continue; }
+
+        const auto& tx = *pTx;
+        const auto id = compact_.ShortTxID(compact_.TransactionID(tx));
+        const auto i = index.find(id);
+
+        if (index.end() == i) { continue; }
+
+        const auto& slot = i->second;
+
+        if (matched.at(slot)) {
+            // NOTE two mempool transactions share a short id so the one in
+            // the block must be requested
+            conflicts.emplace_back(slot);
+
+            continue;
+        }
+
+        auto& bytes = slots_.at(slot).emplace();
+
+        if (false == tx.Internal().Serialize(writer(bytes))) {
+            slots_.at(slot).reset();
+
+            continue;
+        }
+
+        matched.at(slot) = true;
+    }
+
+    for (const auto& slot : conflicts) { slots_.at(slot).reset(); }
+}
+
+CompactBlockReconstructor::CompactBlockReconstructor(
+    CompactBlockReconstructor&&) noexcept = default;
+
+auto CompactBlockReconstructor::Add(
+    const block::Hash& block,
+    UnallocatedVector<Space>&& transactions) noexcept -> bool
+{
+    if (block != compact_.Hash()) { return false; }
+
+    const auto missing = Missing();
+
+    if (missing.size() != transactions.size()) { return false; }
+
+    for (auto i = std::size_t{0}; i < missing.size(); ++i) {
+        slots_.at(missing.at(i)) = std::move(transactions.at(i));
+    }
+
+    return true;
+}
+
+auto CompactBlockReconstructor::Complete() const noexcept -> bool
+{
+    return std::all_of(slots_.begin(), slots_.end(), [](const auto& slot) {
+        return slot.has_value();
+    });
+}
+
+auto CompactBlockReconstructor::Missing() const noexcept
+    -> UnallocatedVector<std::size_t>
+{
+    auto output = UnallocatedVector<std::size_t>{};
+
+    for (auto i = std::size_t{0}; i < slots_.size(); ++i) {
+        if (false == slots_.at(i).has_value()) { output.emplace_back(i); }
+    }
+
+    return output;
+}
+
+auto CompactBlockReconstructor::Serialize(AllocateOutput destination)
+    const noexcept -> bool
+{
+    if (false == Complete()) { return false; }
+
+    auto out = Space{};
+    append(out, compact_.Header());
+    append(out, slots_.size());
+
+    for (const auto& slot : slots_) { append(out, reader(slot.value())); }
+
+    return copy(out, destination);
+}
+
+CompactBlockReconstructor::~CompactBlockReconstructor() = default;
+
+PendingCompactBlocks::PendingCompactBlocks(
+    const std::size_t limit,
+    const std::chrono::seconds timeout) noexcept
+    : limit_(std::max(limit, std::size_t{1}))
+    , timeout_(timeout)
+    , map_()
+{
+}
+
+auto PendingCompactBlocks::Add(
+    CompactBlockReconstructor&& block,
+    const Time now) noexcept -> UnallocatedVector<block::pHash>
+{
+    auto output = UnallocatedVector<block::pHash>{};
+    map_.erase(block.Hash());
+
+    while (map_.size() >= limit_) {
+        const auto oldest = std::min_element(
+            map_.begin(), map_.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second.second < rhs.second.second;
+            });
+        output.emplace_back(oldest->first);
+        map_.erase(oldest);
+    }
+
+    auto hash = block::pHash{block.Hash()};
+    map_.try_emplace(
+        std::move(hash), std::piecewise_construct,
+        std::forward_as_tuple(std::move(block)), std::forward_as_tuple(now));
+
+    return output;
+}
+
+auto PendingCompactBlocks::Expire(const Time now) noexcept
+    -> UnallocatedVector<block::pHash>
+{
+    auto output = UnallocatedVector<block::pHash>{};
+
+    for (auto i = map_.begin(); i != map_.end();) {
+        if ((now - i->second.second) > timeout_) {
+            output.emplace_back(i->first);
+            i = map_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
+    return output;
+}
+
+auto PendingCompactBlocks::Take(const block::Hash& block) noexcept
+    -> std::optional<CompactBlockReconstructor>
+{
+    auto output = std::optional<CompactBlockReconstructor>{};
+
+    if (auto i = map_.find(block); map_.end() != i) {
+        output.emplace(std::move(i->second.first));
+        map_.erase(i);
+    }
+
+    return output;
+}
+
+PendingCompactBlocks::~PendingCompactBlocks() = default;
+}  // namespace opentxs::blockchain::p2p::bitcoin
@@ -0,0 +1,235 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "internal/blockchain/p2p/bitcoin/Bitcoin.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+class Session;
+}  // namespace api
+
+namespace blockchain
+{
+namespace block
+{
+namespace bitcoin
+{
+class Block;
+class Transaction;
+}  // namespace bitcoin
+}  // namespace block
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::p2p::bitcoin
+{
+/// BIP152 compact block
+///
+/// A compact block consists of a block header, a nonce, a list of 6 byte
+/// short transaction IDs and a list of transactions the sender expects the
+/// recipient not to have (at least the coinbase).
+class CompactBlock
+{
+public:
+    using ShortID = std::uint64_t;
+
+    struct Prefilled {
+        std::size_t index_{};
+        Space transaction_{};
+    };
+
+    /// Returns the compact block version used for the specified chain
+    ///
+    /// Version 2 identifies transactions by wtxid and is used on chains with
+    /// segwit, version 1 identifies transactions by txid.
+    static auto Version(const blockchain::Type chain) noexcept
+        -> std::uint64_t;
+    /// Convert differentially encoded transaction indices into absolute
+    /// indices
+    static auto DifferentialDecode(
+        const UnallocatedVector<std::size_t>& indices) noexcept(false)
+        -> UnallocatedVector<std::size_t>;
+    /// Convert sorted absolute transaction indices into the differential
+    /// encoding used by cmpctblock and getblocktxn messages
+    static auto DifferentialEncode(
+        const UnallocatedVector<std::size_t>& indices) noexcept(false)
+        -> UnallocatedVector<std::size_t>;
+    /// Parse the payload of a blocktxn message
+    static auto DecodeTransactions(
+        const api::Session& api,
+        const blockchain::Type chain,
+        const ReadView payload) noexcept(false)
+        -> std::pair<OTData, UnallocatedVector<Space>>;
+    /// Construct the payload of a blocktxn message
+    static auto EncodeTransactions(
+        const block::Hash& block,
+        const UnallocatedVector<Space>& transactions,
+        AllocateOutput destination) noexcept -> bool;
+
+    auto Hash() const noexcept -> const block::Hash& { return hash_; }
+    auto Header() const noexcept -> ReadView;
+    auto Prefill() const noexcept -> const UnallocatedVector<Prefilled>&
+    {
+        return prefilled_;
+    }
+    auto Serialize(AllocateOutput destination) const noexcept -> bool;
+    /// Calculate the short ID for a txid or wtxid using the key for this block
+    auto ShortTxID(const ReadView id) const noexcept(false) -> ShortID;
+    auto ShortTxIDs() const noexcept -> const UnallocatedVector<ShortID>&
+    {
+        return short_ids_;
+    }
+    auto TransactionID(const block::bitcoin::Transaction& tx) const noexcept
+        -> ReadView;
+    /// Number of transactions in the block
+    auto size() const noexcept -> std::size_t;
+
+    /// Parse the payload of a cmpctblock message
+    CompactBlock(
+        const api::Session& api,
+        const blockchain::Type chain,
+        const ReadView payload) noexcept(false);
+    /// Encode a block with only the coinbase transaction prefilled
+    CompactBlock(
+        const api::Session& api,
+        const blockchain::Type chain,
+        const block::bitcoin::Block& block,
+        const std::uint64_t nonce) noexcept(false);
+    CompactBlock(CompactBlock&&) noexcept;
+
+    ~CompactBlock();
+
+private:
+    static constexpr auto short_id_bytes_ = std::size_t{6};
+    static constexpr auto short_id_mask_ = ShortID{0xffffffffffff};
+
+    const api::Session& api_;
+    const blockchain::Type chain_;
+    const std::uint64_t version_;
+    BlockHeaderField header_;
+    std::uint64_t nonce_;
+    Space key_;
+    OTData hash_;
+    UnallocatedVector<ShortID> short_ids_;
+    UnallocatedVector<Prefilled> prefilled_;
+
+    auto init() noexcept(false) -> void;
+
+    CompactBlock() = delete;
+    CompactBlock(const CompactBlock&) = delete;
+    auto operator=(const CompactBlock&) -> CompactBlock& = delete;
+    auto operator=(CompactBlock&&) -> CompactBlock& = delete;
+};
+
+/// Reassembles a block from a compact block plus transactions found in the
+/// mempool and transactions delivered in a blocktxn message
+class CompactBlockReconstructor
+{
+public:
+    using Transactions = UnallocatedVector<
+        std::shared_ptr<const block::bitcoin::Transaction>>;
+
+    auto Complete() const noexcept -> bool;
+    auto Hash() const noexcept -> const block::Hash&
+    {
+        return compact_.Hash();
+    }
+    /// Absolute indices of the transactions which must be requested
+    auto Missing() const noexcept -> UnallocatedVector<std::size_t>;
+    /// Serialize the reconstructed block
+    auto Serialize(AllocateOutput destination) const noexcept -> bool;
+
+    /// Fill the slots listed by Missing() in order
+    auto Add(
+        const block::Hash& block,
+        UnallocatedVector<Space>&& transactions) noexcept -> bool;
+
+    /// Throws if the compact block contains duplicate short IDs, in which
+    /// case the full block must be requested instead
+    CompactBlockReconstructor(
+        CompactBlock&& compact,
+        const Transactions& mempool) noexcept(false);
+    CompactBlockReconstructor(CompactBlockReconstructor&&) noexcept;
+
+    ~CompactBlockReconstructor();
+
+private:
+    CompactBlock compact_;
+    UnallocatedVector<std::optional<Space>> slots_;
+
+    CompactBlockReconstructor() = delete;
+    CompactBlockReconstructor(const CompactBlockReconstructor&) = delete;
+    auto operator=(const CompactBlockReconstructor&)
+        -> CompactBlockReconstructor& = delete;
+    auto operator=(CompactBlockReconstructor&&)
+        -> CompactBlockReconstructor& = delete;
+};
+
+/// Compact blocks waiting for a blocktxn reply, keyed by block hash
+///
+/// Only a few reconstructions are kept per peer. Adding a block beyond the
+/// limit displaces the oldest one and reconstructions which have waited too
+/// long expire. In both cases the caller must request the full block.
+class PendingCompactBlocks
+{
+public:
+    static constexpr auto default_limit_ = std::size_t{8};
+    static constexpr auto default_timeout_ = std::chrono::seconds{30};
+
+    auto size() const noexcept -> std::size_t { return map_.size(); }
+
+    /// Returns the hashes of any blocks displaced to stay within the limit
+    auto Add(CompactBlockReconstructor&& block, const Time now) noexcept
+        -> UnallocatedVector<block::pHash>;
+    /// Returns the hashes of blocks which have been pending longer than the
+    /// timeout
+    auto Expire(const Time now) noexcept -> UnallocatedVector<block::pHash>;
+    auto Take(const block::Hash& block) noexcept
+        -> std::optional<CompactBlockReconstructor>;
+
+    PendingCompactBlocks(
+        const std::size_t limit = default_limit_,
+        const std::chrono::seconds timeout = default_timeout_) noexcept;
+
+    ~PendingCompactBlocks();
+
+private:
+    using Entry = std::pair<CompactBlockReconstructor, Time>;
+
+    const std::size_t limit_;
+    const std::chrono::seconds timeout_;
+    UnallocatedMap<block::pHash, Entry> map_;
+
+    PendingCompactBlocks(const PendingCompactBlocks&) = delete;
+    PendingCompactBlocks(PendingCompactBlocks&&) = delete;
+    auto operator=(const PendingCompactBlocks&)
+        -> PendingCompactBlocks& = delete;
+    auto operator=(PendingCompactBlocks&&) -> PendingCompactBlocks& = delete;
+};
+}  // namespace opentxs::blockchain::p2p::bitcoin
@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <stdexcept>
 #include <tuple>
@@ -55,6 +57,7 @@
 #include "opentxs/blockchain/node/HeaderOracle.hpp"
 #include "opentxs/blockchain/p2p/Peer.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/FrameSection.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
@@ -201,6 +204,7 @@ Peer::Peer(
           get_local_services(protocol_, chain_, policy, localServices))
     , relay_(relay)
     , get_headers_()
+    , compact_()
 {
     init();
 }
@@ -216,6 +220,17 @@ auto Peer::broadcast_block(zmq::Message&& in) noexcept -> void
     }
 
     const auto id = api_.Factory().Data(body.at(1));
+
+    if (compact_.supported_ && compact_.announce_) {
+        const auto future = network_.BlockOracle().LoadBitcoin(id);
+
+        if (std::future_status::ready == future.wait_for(0ms)) {
+            const auto pBlock = future.get();
+
+            if (pBlock && send_cmpctblock(*pBlock)) { return; }
+        }
+    }
+
     auto payload = [&] {
         using Inventory = blockchain::bitcoin::Inventory;
         auto output = UnallocatedVector<Inventory>{};
@@ -304,6 +319,16 @@ auto Peer::broadcast_transaction(zmq::Message&& in) noexcept -> void
     send(msg.Transmit());
 }
 
+auto Peer::expire_compact_blocks() noexcept -> void
+{
+    for (const auto& hash : compact_.pending_.Expire(Clock::now())) {
+        LogVerbose()(OT_PRETTY_CLASS())("compact block ")(hash->asHex())(
+            " from ")(address_.Display())(" timed out")
+            .Flush();
+        request_full_block(hash);
+    }
+}
+
 auto Peer::get_body_size(const zmq::Frame& header) const noexcept -> std::size_t
 {
     OT_ASSERT(HeaderType::Size() == header.size());
@@ -364,6 +389,59 @@ auto Peer::get_local_services(
     return output;
 }
 
+auto Peer::load_block(const block::Hash& hash, zmq::Frame& payload)
+    const noexcept -> bool
+{
+    if (block_.LoadRaw(hash, payload.WriteInto())) { return true; }
+
+    // NOTE blocks which have not been written to storage may still be held in
+    // the block oracle cache
+    auto future = network_.BlockOracle().LoadBitcoin(hash);
+
+    if (std::future_status::ready != future.wait_for(0ms)) { return false; }
+
+    const auto pBlock = future.get();
+
+    if (false == bool(pBlock)) { return false; }
+
+    return pBlock->Serialize(payload.WriteInto());
+}
+
+auto Peer::load_cfilter(
+    const filter::Type type,
+    const block::Hash& hash,
+    zmq::Frame& payload) const noexcept -> bool
+{
+    using Prefix = message::FilterPrefixBasic;
+    static constexpr auto fixed = sizeof(Prefix);
+
+    try {
+        const auto prefix = Prefix{chain_, type, hash};
+        auto allocate = payload.WriteInto();
+        auto cb = [&](const std::size_t size) -> WritableView {
+            const auto bytes = network::blockchain::bitcoin::CompactSize{size};
+            const auto total = fixed + bytes.Size() + size;
+            auto out = allocate(total);
+
+            if (false == out.valid(total)) { return {}; }
+
+            auto* i = out.as<std::byte>();
+            std::memcpy(i, static_cast<const void*>(&prefix), fixed);
+            std::advance(i, fixed);
+            bytes.Encode(preallocated(bytes.Size(), i));
+            std::advance(i, bytes.Size());
+
+            return {i, size};
+        };
+
+        return filter_.LoadFilterBytes(type, hash, cb);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
 auto Peer::nonce(const api::Session& api) noexcept -> Nonce
 {
     Nonce output{0};
@@ -377,6 +455,7 @@ auto Peer::nonce(const api::Session& api) noexcept -> Nonce
 
 auto Peer::ping() noexcept -> void
 {
+    expire_compact_blocks();
     std::unique_ptr<Message> pPing{
         factory::BitcoinP2PPing(api_, chain_, nonce_)};
 
@@ -456,34 +535,7 @@ auto Peer::process_block(
             throw std::runtime_error("Invalid payload");
         }
 
-        auto submit{true};
-        auto block = api_.Factory().BitcoinBlock(chain_, payload.Bytes());
-
-        if (!block) { throw std::runtime_error("Failed to instantiate block"); }
-
-        if (false == block_.Validate(*block)) {
-            throw std::runtime_error("Invalid block");
-        }
-
-        if (block_job_) {
-            auto header = headers_.LoadHeader(block->Header().Hash());
-
-            if (!header) { throw std::runtime_error("Failed to load header"); }
-
-            submit = !block_job_.Download(header->Position(), std::move(block));
-
-            if (block_job_.isDownloaded()) { reset_block_job(); }
-        }
-
-        if (submit) {
-            using Task = node::internal::Network::Task;
-            network_.Submit([&] {
-                auto work = MakeWork(Task::SubmitBlock);
-                work.AddFrame(payload);
-
-                return work;
-            }());
-        }
+        receive_block(payload.Bytes());
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
     }
@@ -508,7 +560,32 @@ auto Peer::process_blocktxn(
         return;
     }
 
-    // TODO
+    expire_compact_blocks();
+
+    try {
+        const auto data = pMessage->BlockTransactions();
+        auto [hash, transactions] =
+            CompactBlock::DecodeTransactions(api_, chain_, data->Bytes());
+        auto pending = compact_.pending_.Take(hash);
+
+        if (false == pending.has_value()) {
+            LogVerbose()(OT_PRETTY_CLASS())(
+                "ignoring unrequested blocktxn from ")(address_.Display())
+                .Flush();
+
+            return;
+        }
+
+        auto& block = pending.value();
+
+        if (block.Add(hash, std::move(transactions)) && block.Complete()) {
+            receive_compact_block(std::move(block));
+        } else {
+            request_full_block(block.Hash());
+        }
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
 }
 
 auto Peer::process_cfcheckpt(
@@ -725,7 +802,40 @@ auto Peer::process_cmpctblock(
         return;
     }
 
-    // TODO
+    update_compact_mode();
+
+    try {
+        auto compact = CompactBlock{api_, chain_, payload.Bytes()};
+        const auto hash = api_.Factory().Data(compact.Hash().Bytes());
+        const auto have = [&] {
+            const auto pHeader = headers_.LoadHeader(hash);
+
+            if (false == bool(pHeader)) { return false; }
+
+            const auto tip = network_.BlockOracle().Tip();
+
+            return headers_.IsInBestChain(hash) &&
+                   (pHeader->Height() <= tip.first);
+        }();
+
+        if (have) {
+            LogTrace()(OT_PRETTY_CLASS())("block ")(hash->asHex())(
+                " already downloaded")
+                .Flush();
+
+            return;
+        }
+
+        try {
+            receive_compact_block(CompactBlockReconstructor{
+                std::move(compact), mempool_.Snapshot()});
+        } catch (const std::exception& e) {
+            LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+            request_full_block(hash);
+        }
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
 }
 
 auto Peer::process_feefilter(
@@ -869,7 +979,64 @@ auto Peer::process_getblocktxn(
         return;
     }
 
-    // TODO
+    const auto& message = *pMessage;
+    const auto hash = message.getBlockHash();
+    const auto future = network_.BlockOracle().LoadBitcoin(hash);
+
+    if (std::future_status::ready != future.wait_for(0ms)) {
+        LogVerbose()(OT_PRETTY_CLASS())("block ")(hash->asHex())(
+            " requested by ")(address_.Display())(" is not available")
+            .Flush();
+
+        return;
+    }
+
+    try {
+        const auto pBlock = future.get();
+
+        if (false == bool(pBlock)) {
+            throw std::runtime_error{"Failed to load block"};
+        }
+
+        const auto& block = *pBlock;
+        auto transactions = UnallocatedVector<Space>{};
+
+        for (const auto& index :
+             CompactBlock::DifferentialDecode(message.getIndices())) {
+            if (index >= block.size()) {
+                throw std::runtime_error{"Transaction index out of range"};
+            }
+
+            const auto& tx = *block.at(index);
+
+            if (false == tx.Internal().Serialize(
+                             writer(transactions.emplace_back()))) {
+                throw std::runtime_error{"Failed to serialize transaction"};
+            }
+        }
+
+        auto serialized = api_.Factory().Data();
+        const auto encoded = CompactBlock::EncodeTransactions(
+            hash, transactions, serialized->WriteInto());
+
+        if (false == encoded) {
+            throw std::runtime_error{"Failed to encode transactions"};
+        }
+
+        const auto pMsg = std::unique_ptr<Message>{
+            factory::BitcoinP2PBlocktxn(api_, chain_, serialized)};
+
+        if (false == bool(pMsg)) {
+            throw std::runtime_error{"Failed to construct blocktxn"};
+        }
+
+        LogTrace()("sending blocktxn message to ")(display_chain_)(" peer ")(
+            address_.Display())
+            .Flush();
+        send(pMsg->Transmit());
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
 }
 
 auto Peer::process_getcfcheckpt(
@@ -1031,16 +1198,18 @@ auto Peer::process_getcfilters(
         return;
     }
 
-    auto data = UnallocatedVector<std::unique_ptr<const GCS>>{};
+    // NOTE payloads are assembled directly from the stored filters
+    auto data = UnallocatedVector<zmq::Frame>{};
     data.reserve(count);
-    const auto& filters = network_.FilterOracle();
     const auto type = message.Type();
     const auto hashes = headers_.BestHashes(startHeight, stopHash);
 
     for (const auto& hash : hashes) {
-        const auto& pGCS = data.emplace_back(filters.LoadFilter(type, hash));
+        if (false == load_cfilter(type, hash, data.emplace_back())) {
+            data.pop_back();
 
-        if (!pGCS) { break; }
+            break;
+        }
     }
 
     if (data.size() != count) {
@@ -1052,25 +1221,12 @@ auto Peer::process_getcfilters(
         return;
     }
 
-    OT_ASSERT(data.size() == hashes.size());
-
-    auto h{hashes.begin()};
-
-    for (auto g{data.begin()}; g != data.end(); ++g, ++h) {
-        auto pOut = std::unique_ptr<message::internal::Cfilter>{
-            factory::BitcoinP2PCfilter(api_, chain_, type, *h, *(*g))};
-
-        if (false == bool(pOut)) {
-            LogError()(OT_PRETTY_CLASS())("Failed to construct reply").Flush();
-
-            return;
-        }
-
+    for (auto& payload : data) {
         LogTrace()("sending cfilter message to ")(display_chain_)(" peer ")(
             address_.Display())
             .Flush();
-        const auto& message = *pOut;
-        send(message.Transmit());
+        send(message::Transmit(
+            api_, chain_, Command::cfilter, std::move(payload)));
     }
 }
 
@@ -1126,41 +1282,32 @@ auto Peer::process_getdata(
                 }
             } break;
             case Type::MsgBlock: {
-                const auto& oracle = network_.BlockOracle();
-                auto future = oracle.LoadBitcoin(inv.hash_);
-                const auto have =
-                    std::future_status::ready == future.wait_for(0ms);
-
-                if (have) {
-                    const auto pBlock = future.get();
-
-                    OT_ASSERT(pBlock);
-
-                    const auto& block = *pBlock;
-                    const auto serialized = [&] {
-                        auto output = api_.Factory().Data();
-                        block.Serialize(output->WriteInto());
-
-                        return output;
-                    }();
-                    const auto pMsg = std::unique_ptr<Message>{
-                        factory::BitcoinP2PBlock(api_, chain_, serialized)};
-
-                    OT_ASSERT(pMsg);
+                auto payload = zmq::Frame{};
 
+                if (load_block(inv.hash_, payload)) {
                     LogTrace()("sending block message to ")(
                         display_chain_)(" peer ")(address_.Display())
                         .Flush();
-
-                    const auto& msg = *pMsg;
-                    send(msg.Transmit());
+                    send(message::Transmit(
+                        api_, chain_, Command::block, std::move(payload)));
                 } else {
                     notFound.emplace_back(inv);
                 }
             } break;
+            case Type::MsgCmpctBlock: {
+                const auto& oracle = network_.BlockOracle();
+                auto future = oracle.LoadBitcoin(inv.hash_);
+                const auto have =
+                    std::future_status::ready == future.wait_for(0ms);
+                const auto pBlock = have ? future.get() : nullptr;
+
+                if ((false == bool(pBlock)) ||
+                    (false == send_cmpctblock(*pBlock))) {
+                    notFound.emplace_back(inv);
+                }
+            } break;
             case Type::None:
             case Type::MsgFilteredBlock:
-            case Type::MsgCmpctBlock:
             case Type::MsgWitnessTx:
             case Type::MsgWitnessBlock:
             case Type::MsgFilteredWitnessBlock:
@@ -1615,7 +1762,18 @@ auto Peer::process_sendcmpct(
         return;
     }
 
-    // TODO
+    const auto& message = *pMessage;
+
+    if (CompactBlock::Version(chain_) != message.version()) {
+        LogVerbose()(OT_PRETTY_CLASS())("ignoring compact block version ")(
+            message.version())(" from ")(address_.Display())
+            .Flush();
+
+        return;
+    }
+
+    compact_.supported_ = true;
+    compact_.announce_ = message.announce();
 }
 
 auto Peer::process_sendheaders(
@@ -1676,6 +1834,11 @@ auto Peer::process_verack(
     }
 
     state_.handshake_.first_action_ = true;
+
+    if (compact_protocol_version_ <= protocol_.load()) {
+        send_sendcmpct(false);
+    }
+
     check_handshake();
 }
 
@@ -1723,6 +1886,92 @@ auto Peer::process_version(
     check_handshake();
 }
 
+auto Peer::receive_block(const ReadView bytes) noexcept(false) -> void
+{
+    auto submit{true};
+    auto block = api_.Factory().BitcoinBlock(chain_, bytes);
+
+    if (!block) { throw std::runtime_error("Failed to instantiate block"); }
+
+    if (false == block_.Validate(*block)) {
+        throw std::runtime_error("Invalid block");
+    }
+
+    if (block_job_) {
+        auto header = headers_.LoadHeader(block->Header().Hash());
+
+        if (!header) { throw std::runtime_error("Failed to load header"); }
+
+        submit = !block_job_.Download(header->Position(), std::move(block));
+
+        if (block_job_.isDownloaded()) { reset_block_job(); }
+    }
+
+    if (submit) {
+        using Task = node::internal::Network::Task;
+        network_.Submit([&] {
+            auto work = MakeWork(Task::SubmitBlock);
+            work.AddFrame(bytes.data(), bytes.size());
+
+            return work;
+        }());
+    }
+}
+
+auto Peer::receive_compact_block(CompactBlockReconstructor&& block) noexcept
+    -> void
+{
+    if (false == block.Complete()) {
+        const auto missing = block.Missing();
+
+        try {
+            const auto pMsg =
+                std::unique_ptr<Message>{factory::BitcoinP2PGetblocktxn(
+                    api_,
+                    chain_,
+                    block.Hash(),
+                    CompactBlock::DifferentialEncode(missing))};
+
+            if (false == bool(pMsg)) {
+                throw std::runtime_error{"Failed to construct getblocktxn"};
+            }
+
+            LogTrace()("sending getblocktxn message for ")(missing.size())(
+                " transactions to ")(display_chain_)(" peer ")(
+                address_.Display())
+                .Flush();
+            send(pMsg->Transmit());
+            expire_compact_blocks();
+            const auto displaced =
+                compact_.pending_.Add(std::move(block), Clock::now());
+
+            for (const auto& hash : displaced) { request_full_block(hash); }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+            request_full_block(block.Hash());
+        }
+
+        return;
+    }
+
+    try {
+        auto bytes = Space{};
+
+        if (false == block.Serialize(writer(bytes))) {
+            throw std::runtime_error{"Failed to serialize block"};
+        }
+
+        receive_block(reader(bytes));
+        manager_.PromoteHighBandwidthPeer(id());
+        update_compact_mode();
+    } catch (const std::exception& e) {
+        // NOTE a short id shared by a mempool transaction and a different
+        // transaction in the block produces an invalid block
+        LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+        request_full_block(block.Hash());
+    }
+}
+
 auto Peer::reconcile_mempool() noexcept -> void
 {
     const auto local = mempool_.Dump();
@@ -1843,9 +2092,14 @@ auto Peer::request_blocks() noexcept -> void
         using Inventory = blockchain::bitcoin::Inventory;
         using Type = Inventory::Type;
         auto blocks = UnallocatedVector<Inventory>{};
+        // NOTE a batch containing a single block is a new tip whose
+        // transactions are likely to be in the mempool already
+        const auto type = (compact_.supported_ && (1u == data.size()))
+                              ? Type::MsgCmpctBlock
+                              : Type::MsgBlock;
 
         for (const auto& task : data) {
-            blocks.emplace_back(Type::MsgBlock, task->position_.second);
+            blocks.emplace_back(type, task->position_.second);
         }
 
         if (0 == blocks.size()) { return; }
@@ -2027,6 +2281,27 @@ auto Peer::request_checkpoint_filter_header() noexcept -> void
     }
 }
 
+auto Peer::request_full_block(const block::Hash& hash) noexcept -> void
+{
+    using Inventory = blockchain::bitcoin::Inventory;
+    auto blocks = UnallocatedVector<Inventory>{};
+    blocks.emplace_back(Inventory::Type::MsgBlock, hash);
+    auto pMessage = std::unique_ptr<Message>{
+        factory::BitcoinP2PGetdata(api_, chain_, std::move(blocks))};
+
+    if (false == bool(pMessage)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to construct getdata").Flush();
+
+        return;
+    }
+
+    LogTrace()("sending getdata(block) message to ")(display_chain_)(" peer ")(
+        address_.Display())
+        .Flush();
+    const auto& message = *pMessage;
+    send(message.Transmit());
+}
+
 auto Peer::request_headers() noexcept -> void
 {
     request_headers(api_.Factory().Data());
@@ -2090,6 +2365,54 @@ auto Peer::request_transactions(
     send(message.Transmit());
 }
 
+auto Peer::send_cmpctblock(const block::bitcoin::Block& block) noexcept
+    -> bool
+{
+    try {
+        const auto compact = CompactBlock{api_, chain_, block, nonce(api_)};
+        auto serialized = api_.Factory().Data();
+
+        if (false == compact.Serialize(serialized->WriteInto())) {
+            throw std::runtime_error{"Failed to serialize compact block"};
+        }
+
+        const auto pMsg = std::unique_ptr<Message>{
+            factory::BitcoinP2PCmpctblock(api_, chain_, serialized)};
+
+        if (false == bool(pMsg)) {
+            throw std::runtime_error{"Failed to construct cmpctblock"};
+        }
+
+        LogTrace()("sending cmpctblock message to ")(display_chain_)(
+            " peer ")(address_.Display())
+            .Flush();
+        send(pMsg->Transmit());
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto Peer::send_sendcmpct(const bool announce) noexcept -> void
+{
+    const auto pMsg = std::unique_ptr<Message>{factory::BitcoinP2PSendcmpct(
+        api_, chain_, announce, CompactBlock::Version(chain_))};
+
+    if (false == bool(pMsg)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to construct sendcmpct").Flush();
+
+        return;
+    }
+
+    LogTrace()("sending sendcmpct message to ")(display_chain_)(" peer ")(
+        address_.Display())
+        .Flush();
+    send(pMsg->Transmit());
+}
+
 auto Peer::start_handshake() noexcept -> void
 {
     try {
@@ -2146,5 +2469,17 @@ auto Peer::start_handshake() noexcept -> void
     }
 }
 
+auto Peer::update_compact_mode() noexcept -> void
+{
+    if (false == compact_.supported_) { return; }
+
+    const auto highBandwidth = manager_.IsHighBandwidthPeer(id());
+
+    if (highBandwidth == compact_.high_bandwidth_) { return; }
+
+    compact_.high_bandwidth_ = highBandwidth;
+    send_sendcmpct(highBandwidth);
+}
+
 Peer::~Peer() { Shutdown(); }
 }  // namespace opentxs::blockchain::p2p::bitcoin::implementation
@@ -11,8 +11,10 @@
 #include <future>
 #include <iosfwd>
 #include <memory>
+#include <optional>
 #include <type_traits>
 
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"
 #include "blockchain/p2p/bitcoin/Header.hpp"
 #include "blockchain/p2p/bitcoin/Message.hpp"
 #include "blockchain/p2p/peer/Peer.hpp"
@@ -46,6 +48,14 @@ namespace bitcoin
 class Inventory;
 }  // namespace bitcoin
 
+namespace block
+{
+namespace bitcoin
+{
+class Block;
+}  // namespace bitcoin
+}  // namespace block
+
 namespace node
 {
 namespace internal
@@ -146,7 +156,19 @@ private:
         Time start_{};
     };
 
+    struct Compact {
+        // the peer sent a sendcmpct message with a version we support
+        bool supported_{false};
+        // the peer asked us to announce new blocks with cmpctblock
+        bool announce_{false};
+        // we asked the peer to announce new blocks with cmpctblock
+        bool high_bandwidth_{false};
+        // blocks waiting for a blocktxn reply
+        PendingCompactBlocks pending_{};
+    };
+
     static const UnallocatedMap<Command, CommandFunction> command_map_;
+    static const ProtocolVersion compact_protocol_version_{70014};
     static const ProtocolVersion default_protocol_version_{70015};
     static const UnallocatedCString user_agent_;
 
@@ -156,6 +178,7 @@ private:
     const UnallocatedSet<p2p::Service> local_services_;
     std::atomic<bool> relay_;
     Request get_headers_;
+    Compact compact_;
 
     static auto get_local_services(
         const ProtocolVersion version,
@@ -170,13 +193,23 @@ private:
         -> void;
     auto get_body_size(const zmq::Frame& header) const noexcept
         -> std::size_t final;
+    auto load_block(const block::Hash& hash, zmq::Frame& payload)
+        const noexcept -> bool;
+    auto load_cfilter(
+        const filter::Type type,
+        const block::Hash& hash,
+        zmq::Frame& payload) const noexcept -> bool;
 
     auto broadcast_block(zmq::Message&& message) noexcept -> void final;
     auto broadcast_inv_transaction(ReadView txid) noexcept -> void final;
     auto broadcast_transaction(zmq::Message&& message) noexcept -> void final;
+    auto expire_compact_blocks() noexcept -> void;
     auto ping() noexcept -> void final;
     auto pong(Nonce) noexcept -> void final;
     auto process_message(zmq::Message&& message) noexcept -> void final;
+    auto receive_block(const ReadView bytes) noexcept(false) -> void;
+    auto receive_compact_block(CompactBlockReconstructor&& block) noexcept
+        -> void;
     auto reconcile_mempool() noexcept -> void;
     auto request_addresses() noexcept -> void final;
     auto request_block(zmq::Message&& message) noexcept -> void final;
@@ -189,9 +222,13 @@ private:
     auto request_headers() noexcept -> void final;
     auto request_headers(const block::Hash& hash) noexcept -> void;
     auto request_mempool() noexcept -> void final;
+    auto request_full_block(const block::Hash& hash) noexcept -> void;
     auto request_transactions(
         UnallocatedVector<blockchain::bitcoin::Inventory>&&) noexcept -> void;
+    auto send_cmpctblock(const block::bitcoin::Block& block) noexcept -> bool;
+    auto send_sendcmpct(const bool announce) noexcept -> void;
     auto start_handshake() noexcept -> void final;
+    auto update_compact_mode() noexcept -> void;
 
     auto process_addr(
         std::unique_ptr<HeaderType> header,
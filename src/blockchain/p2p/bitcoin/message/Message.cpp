@@ -11,6 +11,7 @@
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include "blockchain/p2p/bitcoin/Header.hpp"
 #include "internal/blockchain/Blockchain.hpp"
@@ -148,6 +149,30 @@ auto FilterRequest::Type(const blockchain::Type chain) const noexcept
     return blockchain::internal::Deserialize(chain, type_.value());
 }
 
+auto Transmit(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const bitcoin::Command command,
+    network::zeromq::Frame&& payload) noexcept
+    -> std::pair<network::zeromq::Frame, network::zeromq::Frame>
+{
+    auto output = std::pair<network::zeromq::Frame, network::zeromq::Frame>{
+        {}, std::move(payload)};
+    auto& [header, body] = output;
+    auto checksum = Data::Factory();
+
+    if (0 == body.size()) {
+        checksum = Data::Factory("0x5df6e0e2", Data::Mode::Hex);
+    } else {
+        P2PMessageHash(api, chain, body.Bytes(), checksum->WriteInto());
+    }
+
+    Header{api, chain, command, body.size(), checksum}.Serialize(
+        header.WriteInto());
+
+    return output;
+}
+
 auto VerifyChecksum(
     const api::Session& api,
     const Header& header,
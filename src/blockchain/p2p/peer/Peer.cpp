@@ -445,7 +445,7 @@ auto Peer::reset_block_job() noexcept -> void
     auto& job = block_job_;
     job = {};
 
-    if (header_probe_) { job = block_.GetBlockJob(); }
+    if (header_probe_) { job = block_.GetBlockJob(id_); }
 
     if (job) { request_blocks(); }
 }
@@ -265,6 +265,7 @@ protected:
     {
         return *connection_;
     }
+    auto id() const noexcept -> int { return id_; }
 
     virtual auto broadcast_block(zmq::Message&& message) noexcept -> void = 0;
     virtual auto broadcast_inv_transaction(ReadView txid) noexcept -> void = 0;
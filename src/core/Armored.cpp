@@ -10,21 +10,20 @@
 #include <zconf.h>
 #include <zlib.h>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
-#include <cstring>
 #include <fstream>
 #include <limits>
 #include <sstream>  // IWYU pragma: keep
 #include <stdexcept>
+#include <utility>
 
 #include "2_Factory.hpp"
 #include "core/String.hpp"
+#include "internal/util/Base64.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/OT.hpp"
-#include "opentxs/api/Context.hpp"
-#include "opentxs/api/crypto/Crypto.hpp"
-#include "opentxs/api/crypto/Encode.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/crypto/Envelope.hpp"
@@ -55,6 +54,14 @@ auto Armored::Factory(const opentxs::String& value) -> OTArmored
     return OTArmored(new implementation::Armored(value));
 }
 
+auto Armored::SetStringCompressed(
+    const opentxs::String& theData,
+    std::int32_t level) -> bool
+{
+    return dynamic_cast<implementation::Armored&>(*this).set_string(
+        theData, level);
+}
+
 auto Armored::LoadFromString(
     Armored& ascArmor,
     const String& strInput,
@@ -178,121 +185,128 @@ auto Armored::operator=(const Armored& strValue) -> Armored&
 
 auto Armored::clone() const -> Armored* { return new Armored(*this); }
 
-// Source for these two functions: http://panthema.net/2007/0328-ZLibString.html
-/** Compress a STL string using zlib with given compression level and return
- * the binary data. */
-auto Armored::compress_string(
-    const UnallocatedCString& str,
-    std::int32_t compressionlevel = Z_BEST_COMPRESSION) const
+auto Armored::compress(const ReadView in, std::int32_t level) noexcept(false)
     -> UnallocatedCString
 {
-    z_stream zs;  // z_stream is zlib's control structure
-    memset(&zs, 0, sizeof(zs));
+    auto zs = z_stream{};
 
-    if (deflateInit(&zs, compressionlevel) != Z_OK)
-        throw(std::runtime_error("deflateInit failed while compressing."));
+    if (deflateInit(&zs, level) != Z_OK) {
+        throw std::runtime_error("deflateInit failed while compressing.");
+    }
 
-    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(str.data()));
-    zs.avail_in = static_cast<uInt>(str.size());  // set the z_stream's input
+    const auto bound = deflateBound(&zs, static_cast<uLong>(in.size()));
+    auto output = UnallocatedCString{};
+    output.resize(bound);
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+    zs.avail_in = static_cast<uInt>(in.size());
+    zs.next_out = reinterpret_cast<Bytef*>(output.data());
+    zs.avail_out = static_cast<uInt>(output.size());
+    // NOTE the output buffer is large enough to compress in a single call
+    const auto ret = deflate(&zs, Z_FINISH);
+    output.resize(zs.total_out);
+    deflateEnd(&zs);
 
-    std::int32_t ret;
-    char outbuffer[32768];
-    UnallocatedCString outstring;
+    if (ret != Z_STREAM_END) {
+        auto error = std::ostringstream{};
+        error << "Exception during zlib compression: (" << ret << ")";
 
-    // retrieve the compressed bytes blockwise
-    do {
-        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-        zs.avail_out = sizeof(outbuffer);
+        if (nullptr != zs.msg) { error << " " << zs.msg; }
 
-        ret = deflate(&zs, Z_FINISH);
-
-        if (outstring.size() < zs.total_out) {
-            // append the block to the output string
-            outstring.append(outbuffer, zs.total_out - outstring.size());
-        }
-    } while (ret == Z_OK);
+        throw std::runtime_error(error.str());
+    }
 
-    deflateEnd(&zs);
+    return output;
+}
 
-    if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
-        std::ostringstream oss;
-        oss << "Exception during zlib compression: (" << ret << ") " << zs.msg;
-        throw(std::runtime_error(oss.str()));
-    }
+auto Armored::decode() const noexcept -> UnallocatedCString
+{
+    const auto in = ReadView{Get(), GetLength()};
+    auto output = UnallocatedCString{};
+    output.resize(base64::DecodedSize(in.size()));
+    output.resize(base64::Decode(in, output.data()));
 
-    return outstring;
+    return output;
 }
 
-/** Decompress an STL string using zlib and return the original data. */
-auto Armored::decompress_string(const UnallocatedCString& str) const
+auto Armored::decompress(const ReadView in) noexcept(false)
     -> UnallocatedCString
 {
-    z_stream zs;  // z_stream is zlib's control structure
-    memset(&zs, 0, sizeof(zs));
+    auto zs = z_stream{};
 
-    if (inflateInit(&zs) != Z_OK)
-        throw(std::runtime_error("inflateInit failed while decompressing."));
-
-    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(str.data()));
-    zs.avail_in = static_cast<uInt>(str.size());
+    if (inflateInit(&zs) != Z_OK) {
+        throw std::runtime_error("inflateInit failed while decompressing.");
+    }
 
-    std::int32_t ret;
-    char outbuffer[32768];
-    UnallocatedCString outstring;
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+    zs.avail_in = static_cast<uInt>(in.size());
+    auto output = UnallocatedCString{};
+    // NOTE armored data is mostly text which typically compresses about 4:1
+    output.resize(std::max<std::size_t>(in.size() * 4u, 1024u));
+    auto ret = Z_OK;
 
-    // get the decompressed bytes blockwise using repeated calls to inflate
+    // inflate directly into the output string, growing it as needed
     do {
-        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-        zs.avail_out = sizeof(outbuffer);
-
-        ret = inflate(&zs, 0);
-
-        if (outstring.size() < zs.total_out) {
-            outstring.append(outbuffer, zs.total_out - outstring.size());
+        if (output.size() == zs.total_out) {
+            output.resize(output.size() * 2u);
         }
 
+        zs.next_out = reinterpret_cast<Bytef*>(output.data() + zs.total_out);
+        zs.avail_out = static_cast<uInt>(std::min<std::size_t>(
+            output.size() - zs.total_out, std::numeric_limits<uInt>::max()));
+        ret = inflate(&zs, Z_NO_FLUSH);
     } while (ret == Z_OK);
 
+    output.resize(zs.total_out);
     inflateEnd(&zs);
 
-    if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
-        std::ostringstream oss;
-        oss << "Exception during zlib decompression: (" << ret << ")";
-        if (zs.msg != nullptr) { oss << " " << zs.msg; }
-        throw(std::runtime_error(oss.str()));
+    if (ret != Z_STREAM_END) {
+        auto error = std::ostringstream{};
+        error << "Exception during zlib decompression: (" << ret << ")";
+
+        if (nullptr != zs.msg) { error << " " << zs.msg; }
+
+        throw std::runtime_error(error.str());
     }
 
-    return outstring;
+    return output;
+}
+
+auto Armored::encode(const ReadView in) noexcept -> void
+{
+    auto buffer = UnallocatedVector<char>{};
+    buffer.resize(base64::EncodedSize(in.size(), base64::line_width_) + 1u);
+    const auto size = base64::Encode(in, buffer.data(), base64::line_width_);
+    buffer.resize(size + 1u);
+    buffer.back() = '\0';
+    Adopt(std::move(buffer));
 }
 
 // Base64-decode
-auto Armored::GetData(opentxs::Data& theData, bool bLineBreaks) const -> bool
+auto Armored::GetData(opentxs::Data& theData, bool) const -> bool
 {
     theData.Release();
 
-    if (GetLength() < 1) return true;
-
-    auto decoded = Context().Crypto().Encode().DataDecode(
-        UnallocatedCString(Get(), GetLength()));
+    if (GetLength() < 1) { return true; }
 
-    theData.Assign(decoded.c_str(), decoded.size());
+    const auto in = ReadView{Get(), GetLength()};
+    theData.resize(base64::DecodedSize(in.size()));
+    const auto decoded = base64::Decode(in, theData.data());
+    theData.resize(decoded);
 
-    return (0 < decoded.size());
+    return (0 < decoded);
 }
 
 // Base64-decode and decompress
-auto Armored::GetString(opentxs::String& strData, bool bLineBreaks) const
-    -> bool
+auto Armored::GetString(opentxs::String& strData, bool) const -> bool
 {
     strData.Release();
 
     if (GetLength() < 1) { return true; }
 
-    UnallocatedCString str_decoded =
-        Context().Crypto().Encode().DataDecode(Get());
+    const auto decoded = decode();
 
-    if (str_decoded.empty()) {
-        LogError()(OT_PRETTY_CLASS())("Base58CheckDecode failed.").Flush();
+    if (decoded.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Base64 decode failed.").Flush();
 
         return false;
     }
@@ -300,9 +314,9 @@ auto Armored::GetString(opentxs::String& strData, bool bLineBreaks) const
     auto str_uncompressed = UnallocatedCString{};
 
     try {
-        str_uncompressed = decompress_string(str_decoded);
-    } catch (const std::runtime_error&) {
-        LogError()(OT_PRETTY_CLASS())("decompress failed.").Flush();
+        str_uncompressed = decompress(decoded);
+    } catch (const std::runtime_error& e) {
+        LogError()(OT_PRETTY_CLASS())("decompress failed: ")(e.what()).Flush();
 
         return false;
     }
@@ -477,19 +491,9 @@ auto Armored::SetData(const opentxs::Data& theData, bool) -> bool
 {
     Release();
 
-    if (theData.size() < 1) return true;
-
-    auto string = Context().Crypto().Encode().DataEncode(theData);
+    if (theData.size() < 1) { return true; }
 
-    if (string.empty()) {
-        LogError()(OT_PRETTY_CLASS())("Base64Encode failed.").Flush();
-
-        return false;
-    }
-
-    OT_ASSERT(std::numeric_limits<std::uint32_t>::max() >= string.size());
-
-    Set(string.data(), static_cast<std::uint32_t>(string.size()));
+    encode(theData.Bytes());
 
     return true;
 }
@@ -531,34 +535,30 @@ auto Armored::SaveToExactPath(const UnallocatedCString& filename) -> bool
 }
 
 // Compress and Base64-encode
-auto Armored::SetString(
-    const opentxs::String& strData,
-    bool bLineBreaks) -> bool  //=true
+auto Armored::SetString(const opentxs::String& strData, bool) -> bool
 {
-    Release();
+    return set_string(strData, DefaultCompression);
+}
 
-    if (strData.GetLength() < 1) return true;
+auto Armored::set_string(const opentxs::String& strData, std::int32_t level)
+    -> bool
+{
+    Release();
 
-    UnallocatedCString str_compressed = compress_string(strData.Get());
+    if (strData.GetLength() < 1) { return true; }
 
-    // "Success"
-    if (str_compressed.size() == 0) {
-        LogError()(OT_PRETTY_CLASS())("compression failed.").Flush();
+    auto compressed = UnallocatedCString{};
 
-        return false;
-    }
-
-    auto pString = Context().Crypto().Encode().DataEncode(str_compressed);
-
-    if (pString.empty()) {
-        LogError()(OT_PRETTY_CLASS())("Base64Encode failed.").Flush();
+    try {
+        compressed = compress({strData.Get(), strData.GetLength()}, level);
+    } catch (const std::runtime_error& e) {
+        LogError()(OT_PRETTY_CLASS())("compression failed: ")(e.what())
+            .Flush();
 
         return false;
     }
 
-    OT_ASSERT(std::numeric_limits<std::uint32_t>::max() >= pString.size());
-
-    Set(pString.data(), static_cast<std::uint32_t>(pString.size()));
+    encode(compressed);
 
     return true;
 }
@@ -11,6 +11,7 @@
 
 #include "String.hpp"
 #include "opentxs/core/Armored.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -73,13 +74,16 @@ private:
 
     static std::unique_ptr<OTDB::OTPacker> s_pPacker;
 
-    auto clone() const -> Armored* override;
-    auto compress_string(
-        const UnallocatedCString& str,
-        std::int32_t compressionlevel) const -> UnallocatedCString;
-    auto decompress_string(const UnallocatedCString& str) const
+    static auto compress(const ReadView in, std::int32_t level) noexcept(false)
+        -> UnallocatedCString;
+    static auto decompress(const ReadView in) noexcept(false)
         -> UnallocatedCString;
 
+    auto clone() const -> Armored* override;
+    auto decode() const noexcept -> UnallocatedCString;
+    auto encode(const ReadView in) noexcept -> void;
+    auto set_string(const opentxs::String& in, std::int32_t level) -> bool;
+
     explicit Armored(const opentxs::Data& theValue);
     explicit Armored(const opentxs::String& strValue);
     explicit Armored(const crypto::Envelope& theEnvelope);
@@ -361,6 +361,26 @@ auto String::operator==(const opentxs::String& s2) const -> bool
     return (false);
 }
 
+void String::Adopt(UnallocatedVector<char>&& buffer)
+{
+    Release();
+
+    if (buffer.empty()) { return; }
+
+    OT_ASSERT('\0' == buffer.back());
+
+    const auto length = buffer.size() - 1u;
+
+    OT_ASSERT_MSG(
+        length < (MAX_STRING_LENGTH - 10),
+        "ASSERT: OTString::Adopt: Exceeded MAX_STRING_LENGTH!");
+
+    if (0u == length) { return; }
+
+    internal_ = std::move(buffer);
+    length_ = static_cast<std::uint32_t>(length);
+}
+
 auto String::At(std::uint32_t lIndex, char& c) const -> bool
 {
     if (lIndex < length_) {
@@ -85,6 +85,10 @@ public:
 protected:
     virtual void Release_String();
 
+    /** Takes ownership of a buffer without copying it. The buffer must end
+     * with a null terminator which is not counted in the length. */
+    void Adopt(UnallocatedVector<char>&& buffer);
+
     explicit String(const opentxs::Armored& value);
     explicit String(const opentxs::Signature& value);
     explicit String(const opentxs::Contract& value);
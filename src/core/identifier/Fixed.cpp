@@ -0,0 +1,92 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                        // IWYU pragma: associated
+#include "1_Internal.hpp"                      // IWYU pragma: associated
+#include "internal/core/identifier/Fixed.hpp"  // IWYU pragma: associated
+
+#include <robin_hood.h>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+#include "core/identifier/Base.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace opentxs::identifier
+{
+auto operator==(const Fixed& lhs, const Fixed& rhs) noexcept -> bool
+{
+    return (lhs.hash_ == rhs.hash_) && (lhs.size_ == rhs.size_) &&
+           (0 == std::memcmp(lhs.bytes_.data(), rhs.bytes_.data(), lhs.size_));
+}
+
+auto operator!=(const Fixed& lhs, const Fixed& rhs) noexcept -> bool
+{
+    return false == (lhs == rhs);
+}
+
+auto operator<(const Fixed& lhs, const Fixed& rhs) noexcept -> bool
+{
+    // NOTE same ordering as opentxs::Data
+    if (lhs.size_ != rhs.size_) { return lhs.size_ < rhs.size_; }
+
+    return 0 > std::memcmp(lhs.bytes_.data(), rhs.bytes_.data(), lhs.size_);
+}
+}  // namespace opentxs::identifier
+
+namespace opentxs::identifier
+{
+Fixed::Fixed() noexcept
+    : bytes_()
+    , hash_(robin_hood::hash_bytes(bytes_.data(), 0u))
+    , size_(0u)
+    , algorithm_(identifier::Algorithm::invalid)
+    , type_(identifier::Type::invalid)
+{
+    static_assert(capacity_ <= std::numeric_limits<decltype(size_)>::max());
+}
+
+Fixed::Fixed(const opentxs::Identifier& id) noexcept
+    : bytes_()
+    , hash_()
+    , size_()
+    , algorithm_(id.Algorithm())
+    , type_(id.Type())
+{
+    const auto size = id.size();
+
+    OT_ASSERT(capacity_ >= size);
+
+    size_ = static_cast<std::uint8_t>(size);
+
+    if (0u < size) { std::memcpy(bytes_.data(), id.data(), size); }
+
+    hash_ = robin_hood::hash_bytes(bytes_.data(), size_);
+}
+
+auto Fixed::Generic() const noexcept -> OTIdentifier
+{
+    return OTIdentifier{instantiate()};
+}
+
+auto Fixed::instantiate() const noexcept
+    -> opentxs::implementation::Identifier*
+{
+    const auto* start = bytes_.data();
+
+    return new opentxs::implementation::Identifier{
+        {start, std::next(start, size_)}, algorithm_, type_};
+}
+
+auto Fixed::Nym() const noexcept -> OTNymID { return OTNymID{instantiate()}; }
+
+auto Fixed::str() const noexcept -> UnallocatedCString
+{
+    return Generic()->str();
+}
+}  // namespace opentxs::identifier
@@ -206,8 +206,13 @@ auto Base::isValid(
 
     credential = serialize(lock, serializationMode, WITH_SIGNATURES);
 
+    return is_valid(*credential);
+}
+
+auto Base::is_valid(const SerializedType& credential) const -> bool
+{
     return proto::Validate<proto::Credential>(
-        *credential,
+        credential,
         VERBOSE,
         translate(mode_),
         translate(role_),
@@ -406,11 +411,27 @@ auto Base::TransportKey(Data&, Secret&, const PasswordPrompt&) const -> bool
 
 auto Base::validate(const Lock& lock) const -> bool
 {
+    const auto serialized =
+        serialize(lock, Private() ? AS_PRIVATE : AS_PUBLIC, WITH_SIGNATURES);
+
+    OT_ASSERT(serialized);
+
+    // NOTE the hash covers the signatures as well as the contents so only a
+    // credential identical to one which already passed can skip validation
+    const auto hash = api_.Factory().InternalSession().Identifier(*serialized);
+    const auto& wallet = api_.Wallet().Internal();
+
+    if (wallet.IsVerifiedCredential(hash)) { return true; }
+
     // Check syntax
-    if (!isValid(lock)) { return false; }
+    if (false == is_valid(*serialized)) { return false; }
 
     // Check cryptographic requirements
-    return verify_internally(lock);
+    if (false == verify_internally(lock)) { return false; }
+
+    wallet.AddVerifiedCredential(hash);
+
+    return true;
 }
 
 auto Base::Validate() const noexcept -> bool
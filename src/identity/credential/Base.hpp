@@ -178,6 +178,7 @@ private:
 
     auto clone() const noexcept -> Base* final { return nullptr; }
     auto GetID(const Lock& lock) const -> OTIdentifier final;
+    auto is_valid(const SerializedType& credential) const -> bool;
     // Syntax (non cryptographic) validation
     auto isValid(const Lock& lock) const -> bool;
     // Returns the serialized form to prevent unnecessary serializations
@@ -8,8 +8,14 @@
 #include <cstdint>
 
 #include "2_Factory.hpp"
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/api/session/Wallet.hpp"
 #include "internal/serialization/protobuf/Check.hpp"
 #include "internal/serialization/protobuf/verify/Credential.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/util/Log.hpp"
 #include "serialization/protobuf/Credential.pb.h"
 #include "serialization/protobuf/Enums.pb.h"
@@ -247,8 +253,17 @@ auto Factory::Credential(
     const proto::KeyMode mode,
     const proto::CredentialRole role) -> C*
 {
+    // Credentials which already passed full validation in this session are
+    // known to be well-formed for the same mode and role
+    const auto verified = (serialized.mode() == mode) &&
+                          (serialized.role() == role) &&
+                          api.Wallet().Internal().IsVerifiedCredential(
+                              api.Factory().InternalSession().Identifier(
+                                  serialized));
+
     // This check allows all constructors to assume inputs are well-formed
-    if (!proto::Validate(serialized, VERBOSE, mode, role)) {
+    if ((false == verified) &&
+        (false == proto::Validate(serialized, VERBOSE, mode, role))) {
         LogError()("opentxs::Factory::")(__func__)(
             ": Invalid serialized credential.")
             .Flush();
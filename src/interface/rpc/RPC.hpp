@@ -142,9 +142,6 @@ private:
     static void add_output_task(
         proto::RPCResponse& output,
         const UnallocatedCString& taskid);
-    static auto get_account_event_type(
-        StorageBox storagebox,
-        Amount amount) noexcept -> rpc::AccountEventType;
     static auto get_args(const Args& serialized) -> Options;
     static auto get_index(std::int32_t instance) -> std::size_t;
     static auto init(const proto::RPCCommand& command) -> proto::RPCResponse;
@@ -9,31 +9,28 @@
 
 #include <utility>
 
+#include "internal/api/session/Activity.hpp"
+#include "internal/api/session/Storage.hpp"
+#include "internal/api/session/Workflow.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/api/session/Activity.hpp"
 #include "opentxs/api/session/Client.hpp"
-#include "opentxs/api/session/Contacts.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Storage.hpp"
-#include "opentxs/api/session/UI.hpp"
 #include "opentxs/api/session/Workflow.hpp"
-#include "opentxs/core/Amount.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
-#include "opentxs/interface/rpc/AccountEventType.hpp"
 #include "opentxs/interface/rpc/ResponseCode.hpp"
 #include "opentxs/interface/rpc/request/Base.hpp"
 #include "opentxs/interface/rpc/request/GetAccountActivity.hpp"
 #include "opentxs/interface/rpc/response/Base.hpp"
 #include "opentxs/interface/rpc/response/GetAccountActivity.hpp"
-#include "opentxs/interface/ui/AccountActivity.hpp"
-#include "opentxs/interface/ui/BalanceItem.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Pimpl.hpp"
-#include "opentxs/util/SharedPimpl.hpp"
-#include "serialization/protobuf/PaymentWorkflow.pb.h"
-#include "serialization/protobuf/PaymentWorkflowEnums.pb.h"
+#include "serialization/protobuf/AccountEvent.pb.h"
 
 namespace opentxs::rpc::implementation
 {
@@ -43,13 +40,15 @@ auto RPC::get_account_activity(const request::Base& base) const
     const auto& in = base.asGetAccountActivity();
     auto codes = response::Base::Responses{};
     auto events = response::GetAccountActivity::Events{};
+    auto cursor = UnallocatedCString{};
     const auto reply = [&] {
         return std::make_unique<response::GetAccountActivity>(
-            in, std::move(codes), std::move(events));
+            in, std::move(codes), std::move(events), cursor);
     };
 
     try {
         const auto& api = client_session(base);
+        const auto& storage = api.Storage().Internal();
 
         for (const auto& id : in.Accounts()) {
             const auto index = codes.size();
@@ -61,76 +60,71 @@ auto RPC::get_account_activity(const request::Base& base) const
             }
 
             const auto accountID = api.Factory().Identifier(id);
-            const auto owner = [&]() -> OTNymID {
+            const auto [chain, owner] = [&] {
                 const auto [chain, owner] =
                     api.Crypto().Blockchain().LookupAccount(accountID);
 
                 if (owner->empty()) {
 
-                    return api.Storage().AccountOwner(accountID);
+                    return std::make_pair(
+                        chain, api.Storage().AccountOwner(accountID));
                 } else {
 
-                    return owner;
+                    return std::make_pair(chain, owner);
                 }
             }();
             // TODO check for empty owner and return appropriate error
-            const auto& widget = api.UI().AccountActivity(owner, accountID);
-            const auto copy = [&](const auto& row) {
-                const auto contact = [&]() -> UnallocatedCString {
-                    const auto& contacts = row.Contacts();
-
-                    if (0u < contacts.size()) {
-                        return contacts.front();
-                    } else if (StorageBox::INTERNALTRANSFER == row.Type()) {
+            auto page = UnallocatedVector<proto::AccountEvent>{};
+            auto next = UnallocatedCString{};
+            auto indexed{false};
+            const auto load = [&] {
+                return storage.AccountEvents(
+                    owner->str(),
+                    id,
+                    in.Cursor(),
+                    in.Limit(),
+                    page,
+                    next,
+                    indexed);
+            };
 
-                        return api.Contacts().ContactID(owner)->str();
-                    }
+            if (false == load()) {
+                codes.emplace_back(index, ResponseCode::invalid);
 
-                    return {};
-                }();
-                const auto state = [&] {
-                    auto out{proto::PAYMENTWORKFLOWSTATE_ERROR};
-                    const auto id = api.Factory().Identifier(row.Workflow());
+                continue;
+            }
 
-                    if (id->empty()) { return out; }
+            if (false == indexed) {
+                // NOTE events which predate the index are added the first
+                // time the account is queried
+                const auto backfilled = [&] {
+                    if (blockchain::Type::Unknown == chain) {
 
-                    auto proto = proto::PaymentWorkflow{};
+                        return api.Workflow().Internal().IndexAccountEvents(
+                            owner, accountID);
+                    } else {
 
-                    if (api.Workflow().LoadWorkflow(owner, id, proto)) {
-                        return proto.state();
+                        return api.Activity().Internal().IndexAccountEvents(
+                            owner, chain);
                     }
-
-                    return out;
                 }();
-                events.emplace_back(
-                    id,
-                    get_account_event_type(row.Type(), row.Amount()),
-                    contact,
-                    row.Workflow(),
-                    row.DisplayAmount(),
-                    row.DisplayAmount(),
-                    row.Amount(),
-                    row.Amount(),
-                    row.Timestamp(),
-                    row.Memo(),
-                    row.UUID(),
-                    state);
-            };
-            auto row = widget.First();
 
-            if (false == row->Valid()) {
-                codes.emplace_back(index, ResponseCode::none);
+                if (false == (backfilled && load())) {
+                    codes.emplace_back(index, ResponseCode::error);
 
-                continue;
+                    continue;
+                }
             }
 
-            copy(row.get());
+            if (page.empty()) {
+                codes.emplace_back(index, ResponseCode::none);
 
-            while (false == row->Last()) {
-                row = widget.Next();
-                copy(row.get());
+                continue;
             }
 
+            for (const auto& event : page) { events.emplace_back(event); }
+
+            cursor = next;
             codes.emplace_back(index, ResponseCode::success);
         }
     } catch (...) {
@@ -139,49 +133,4 @@ auto RPC::get_account_activity(const request::Base& base) const
 
     return reply();
 }
-
-auto RPC::get_account_event_type(StorageBox storagebox, Amount amount) noexcept
-    -> rpc::AccountEventType
-{
-    switch (storagebox) {
-        case StorageBox::INCOMINGCHEQUE: {
-
-            return AccountEventType::incoming_cheque;
-        }
-        case StorageBox::OUTGOINGCHEQUE: {
-
-            return AccountEventType::outgoing_cheque;
-        }
-        case StorageBox::INCOMINGTRANSFER: {
-
-            return AccountEventType::incoming_transfer;
-        }
-        case StorageBox::OUTGOINGTRANSFER: {
-
-            return AccountEventType::outgoing_transfer;
-        }
-        case StorageBox::INTERNALTRANSFER: {
-            if (0 > amount) {
-
-                return AccountEventType::outgoing_transfer;
-            } else {
-
-                return AccountEventType::incoming_transfer;
-            }
-        }
-        case StorageBox::BLOCKCHAIN: {
-            if (0 > amount) {
-
-                return AccountEventType::outgoing_blockchain;
-            } else {
-
-                return AccountEventType::incoming_blockchain;
-            }
-        }
-        default: {
-
-            return AccountEventType::error;
-        }
-    }
-}
 }  // namespace opentxs::rpc::implementation
@@ -8,13 +8,24 @@
 #include "interface/rpc/request/Base.hpp"  // IWYU pragma: associated
 #include "opentxs/interface/rpc/request/GetAccountActivity.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <memory>
+#include <stdexcept>
+#include <string>
 
 #include "opentxs/interface/rpc/CommandType.hpp"
+#include "serialization/protobuf/APIArgument.pb.h"
+#include "serialization/protobuf/RPCCommand.pb.h"
 
 namespace opentxs::rpc::request::implementation
 {
 struct GetAccountActivity final : public Base::Imp {
+    static constexpr auto cursor_key_ = "cursor";
+    static constexpr auto limit_key_ = "limit";
+
+    const UnallocatedCString cursor_;
+    const std::size_t limit_;
+
     auto asGetAccountActivity() const noexcept
         -> const request::GetAccountActivity& final
     {
@@ -25,6 +36,20 @@ struct GetAccountActivity final : public Base::Imp {
         if (Imp::serialize(dest)) {
             serialize_identifiers(dest);
 
+            if (false == cursor_.empty()) {
+                auto& arg = *dest.add_arg();
+                arg.set_version(argument_version_);
+                arg.set_key(cursor_key_);
+                arg.add_value(cursor_);
+            }
+
+            if (0u < limit_) {
+                auto& arg = *dest.add_arg();
+                arg.set_version(argument_version_);
+                arg.set_key(limit_key_);
+                arg.add_value(std::to_string(limit_));
+            }
+
             return true;
         }
 
@@ -36,6 +61,8 @@ struct GetAccountActivity final : public Base::Imp {
         VersionNumber version,
         Base::SessionIndex session,
         const Base::Identifiers& accounts,
+        const UnallocatedCString& cursor,
+        std::size_t limit,
         const Base::AssociateNyms& nyms) noexcept(false)
         : Imp(parent,
               CommandType::get_account_activity,
@@ -43,22 +70,64 @@ struct GetAccountActivity final : public Base::Imp {
               session,
               accounts,
               nyms)
+        , cursor_(cursor)
+        , limit_(limit)
     {
         check_session();
         check_identifiers();
+        check_paging();
     }
     GetAccountActivity(
         const request::GetAccountActivity* parent,
         const proto::RPCCommand& in) noexcept(false)
         : Imp(parent, in)
+        , cursor_(find_argument(in, cursor_key_))
+        , limit_([&]() -> std::size_t {
+            const auto value = find_argument(in, limit_key_);
+
+            if (value.empty()) { return 0u; }
+
+            try {
+
+                return std::stoull(value);
+            } catch (...) {
+                throw std::runtime_error{"invalid limit"};
+            }
+        }())
     {
         check_session();
         check_identifiers();
+        check_paging();
     }
 
     ~GetAccountActivity() final = default;
 
 private:
+    static constexpr auto argument_version_ = VersionNumber{1};
+
+    static auto find_argument(
+        const proto::RPCCommand& in,
+        const char* key) noexcept -> UnallocatedCString
+    {
+        for (const auto& arg : in.arg()) {
+            if ((arg.key() == key) && (0 < arg.value_size())) {
+
+                return arg.value(0);
+            }
+        }
+
+        return {};
+    }
+
+    auto check_paging() const noexcept(false) -> void
+    {
+        const auto paged = (0u < limit_) || (false == cursor_.empty());
+
+        if (paged && (1u != identifiers_.size())) {
+            throw std::runtime_error{"paging requires exactly one account"};
+        }
+    }
+
     GetAccountActivity() = delete;
     GetAccountActivity(const GetAccountActivity&) = delete;
     GetAccountActivity(GetAccountActivity&&) = delete;
@@ -78,6 +147,25 @@ GetAccountActivity::GetAccountActivity(
           DefaultVersion(),
           session,
           accounts,
+          "",
+          0u,
+          nyms))
+{
+}
+
+GetAccountActivity::GetAccountActivity(
+    SessionIndex session,
+    const UnallocatedCString& account,
+    std::size_t limit,
+    const UnallocatedCString& cursor,
+    const AssociateNyms& nyms)
+    : Base(std::make_unique<implementation::GetAccountActivity>(
+          this,
+          DefaultVersion(),
+          session,
+          Identifiers{account},
+          cursor,
+          limit,
           nyms))
 {
 }
@@ -98,9 +186,21 @@ auto GetAccountActivity::Accounts() const noexcept -> const Identifiers&
     return imp_->identifiers_;
 }
 
+auto GetAccountActivity::Cursor() const noexcept -> const UnallocatedCString&
+{
+    return static_cast<const implementation::GetAccountActivity&>(*imp_)
+        .cursor_;
+}
+
 auto GetAccountActivity::DefaultVersion() noexcept -> VersionNumber
 {
-    return 3u;
+    return 4u;
+}
+
+auto GetAccountActivity::Limit() const noexcept -> std::size_t
+{
+    return static_cast<const implementation::GetAccountActivity&>(*imp_)
+        .limit_;
 }
 
 GetAccountActivity::~GetAccountActivity() = default;
@@ -33,6 +33,8 @@ struct GetAccountActivity final : public Base::Imp {
     auto serialize(proto::RPCResponse& dest) const noexcept -> bool final
     {
         if (Imp::serialize(dest)) {
+            serialize_identifiers(dest);
+
             for (const auto& event : events_) {
                 if (false == event.Serialize(*dest.add_accountevent())) {
 
@@ -50,8 +52,15 @@ struct GetAccountActivity final : public Base::Imp {
         const response::GetAccountActivity* parent,
         const request::GetAccountActivity& request,
         Base::Responses&& response,
-        Events&& events) noexcept(false)
-        : Imp(parent, request, std::move(response))
+        Events&& events,
+        const UnallocatedCString& cursor) noexcept(false)
+        : Imp(parent, request, std::move(response), [&] {
+            auto out = Base::Identifiers{};
+
+            if (false == cursor.empty()) { out.emplace_back(cursor); }
+
+            return out;
+        }())
         , events_(std::move(events))
     {
     }
@@ -84,12 +93,14 @@ namespace opentxs::rpc::response
 GetAccountActivity::GetAccountActivity(
     const request::GetAccountActivity& request,
     Responses&& response,
-    Events&& events)
+    Events&& events,
+    const UnallocatedCString& cursor)
     : Base(std::make_unique<implementation::GetAccountActivity>(
           this,
           request,
           std::move(response),
-          std::move(events)))
+          std::move(events),
+          cursor))
 {
 }
 
@@ -112,5 +123,14 @@ auto GetAccountActivity::Activity() const noexcept -> const Events&
         .events_;
 }
 
+auto GetAccountActivity::Cursor() const noexcept -> UnallocatedCString
+{
+    const auto& cursors = imp_->identifiers_;
+
+    if (cursors.empty()) { return {}; }
+
+    return cursors.front();
+}
+
 GetAccountActivity::~GetAccountActivity() = default;
 }  // namespace opentxs::rpc::response
@@ -17,9 +17,7 @@
 #include "opentxs/api/session/Client.hpp"
 #include "opentxs/api/session/Contacts.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
-#if OT_BLOCKCHAIN
-#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
-#endif  // OT_BLOCKCHAIN
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/contract/Unit.hpp"
 #include "opentxs/core/display/Definition.hpp"
@@ -51,15 +49,6 @@ auto BalanceItem(
 {
 #if OT_BLOCKCHAIN
     if (2 < custom.size()) {
-        using Transaction = opentxs::blockchain::block::bitcoin::Transaction;
-
-        auto pTx =
-            ui::implementation::extract_custom_ptr<Transaction>(custom, 2);
-
-        OT_ASSERT(pTx);
-
-        const auto& tx = *pTx;
-
         return std::make_shared<ui::implementation::BlockchainBalanceItem>(
             parent,
             api,
@@ -70,8 +59,8 @@ auto BalanceItem(
             accountID,
             ui::implementation::extract_custom<blockchain::Type>(custom, 3),
             ui::implementation::extract_custom<OTData>(custom, 5),
-            tx.NetBalanceChange(nymID),
-            tx.Memo(),
+            ui::implementation::extract_custom<opentxs::Amount>(custom, 2),
+            ui::implementation::extract_custom<UnallocatedCString>(custom, 7),
             ui::implementation::extract_custom<UnallocatedCString>(custom, 4));
     }
 #endif  // OT_BLOCKCHAIN
@@ -95,6 +95,7 @@ BlockchainAccountActivity::BlockchainAccountActivity(
           zmq::socket::Direction::Connect))
     , progress_()
     , height_(0)
+    , transactions_()
 {
     const auto connected = balance_socket_->Start(
         Widget::api_.Endpoints().BlockchainBalance().data());
@@ -159,16 +160,67 @@ auto BlockchainAccountActivity::load_thread() noexcept -> void
         }
     }();
     auto active = UnallocatedSet<AccountActivityRowID>{};
+    auto current = Transactions{};
 
     for (const auto& txid : transactions) {
         if (const auto id = process_txid(txid); id.has_value()) {
             active.emplace(id.value());
         }
+
+        if (auto i = transactions_.find(txid); transactions_.end() != i) {
+            current.insert(transactions_.extract(i));
+        }
     }
 
+    transactions_.swap(current);
     delete_inactive(active);
 }
 
+auto BlockchainAccountActivity::load_transaction(
+    const Data& txid,
+    bool reload) noexcept -> const Cached*
+{
+    const auto key = OTData{txid};
+
+    if (false == reload) {
+        if (auto i = transactions_.find(key); transactions_.end() != i) {
+            const auto& cached = i->second;
+
+            // NOTE the confirmation height of a mined transaction only
+            // changes during a reorg, which discards every cached entry
+            if (0 <= cached.mined_) { return &cached; }
+        }
+    }
+
+    auto pTX = Widget::api_.Crypto().Blockchain().LoadTransactionBitcoin(txid);
+
+    if (false == bool(pTX)) {
+        transactions_.erase(key);
+
+        return nullptr;
+    }
+
+    const auto& tx = pTX->Internal();
+
+    if (false == contains(tx.Chains(), chain_)) {
+        transactions_.erase(key);
+
+        return nullptr;
+    }
+
+    const auto i = transactions_.insert_or_assign(
+        key,
+        Cached{
+            tx.Timestamp(),
+            tx.ConfirmationHeight(),
+            tx.NetBalanceChange(primary_id_),
+            tx.Memo(),
+            Widget::api_.Crypto().Blockchain().ActivityDescription(
+                primary_id_, chain_, tx)});
+
+    return &(i.first->second);
+}
+
 auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
 {
     if (false == running_.load()) { return; }
@@ -330,7 +382,7 @@ auto BlockchainAccountActivity::process_contact(const Message& in) noexcept
         return out;
     }();
 
-    for (const auto& txid : txids) { process_txid(txid); }
+    for (const auto& txid : txids) { process_txid(txid, true); }
 }
 
 auto BlockchainAccountActivity::process_height(
@@ -353,6 +405,7 @@ auto BlockchainAccountActivity::process_reorg(const Message& in) noexcept
 
     if (chain != chain_) { return; }
 
+    transactions_.clear();
     process_height(body.at(5).as<blockchain::block::Height>());
 }
 
@@ -424,26 +477,24 @@ auto BlockchainAccountActivity::process_txid(const Message& in) noexcept -> void
 
     if (chain != chain_) { return; }
 
-    process_txid(txid);
+    process_txid(txid, true);
 }
 
-auto BlockchainAccountActivity::process_txid(const Data& txid) noexcept
-    -> std::optional<AccountActivityRowID>
+auto BlockchainAccountActivity::process_txid(
+    const Data& txid,
+    bool reload) noexcept -> std::optional<AccountActivityRowID>
 {
     const auto rowID = AccountActivityRowID{
         blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
         proto::PAYMENTEVENTTYPE_COMPLETE};
-    auto pTX = Widget::api_.Crypto().Blockchain().LoadTransactionBitcoin(txid);
-
-    if (false == bool(pTX)) { return std::nullopt; }
+    const auto* pTX = load_transaction(txid, reload);
 
-    const auto& tx = pTX->Internal();
-
-    if (false == contains(tx.Chains(), chain_)) { return std::nullopt; }
+    if (nullptr == pTX) { return std::nullopt; }
 
-    const auto sortKey{tx.Timestamp()};
+    const auto& tx = *pTX;
+    const auto sortKey{tx.time_};
     const auto conf = [&]() -> int {
-        const auto height = tx.ConfirmationHeight();
+        const auto height = tx.mined_;
 
         if ((0 > height) || (height > height_)) { return 0; }
 
@@ -452,13 +503,12 @@ auto BlockchainAccountActivity::process_txid(const Data& txid) noexcept
     auto custom = CustomData{
         new proto::PaymentWorkflow(),
         new proto::PaymentEvent(),
-        const_cast<void*>(static_cast<const void*>(pTX.release())),
+        new opentxs::Amount{tx.amount_},
         new blockchain::Type{chain_},
-        new UnallocatedCString{
-            Widget::api_.Crypto().Blockchain().ActivityDescription(
-                primary_id_, chain_, tx)},
-        new OTData{tx.ID()},
+        new UnallocatedCString{tx.description_},
+        new OTData{txid},
         new int{conf},
+        new UnallocatedCString{tx.memo_},
     };
     add_item(rowID, sortKey, custom);
 
@@ -29,6 +29,7 @@
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/core/Amount.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Types.hpp"
 #include "opentxs/core/contract/Unit.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
@@ -41,6 +42,7 @@
 #include "opentxs/network/zeromq/socket/Dealer.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/SharedPimpl.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "serialization/protobuf/PaymentWorkflowEnums.pb.h"
 #include "util/Work.hpp"
@@ -201,6 +203,19 @@ private:
         std::pair<int, int> ratio_{};
     };
 
+    // NOTE the parts of a transaction which are needed to construct a row,
+    // retained so that a new block does not require reloading and parsing
+    // every transaction in the account
+    struct Cached {
+        Time time_{};
+        blockchain::block::Height mined_{};
+        opentxs::Amount amount_{};
+        UnallocatedCString memo_{};
+        UnallocatedCString description_{};
+    };
+
+    using Transactions = UnallocatedMap<OTData, Cached>;
+
     enum class Work : OTZMQWorkType {
         shutdown = value(WorkType::Shutdown),
         contact = value(WorkType::ContactUpdated),
@@ -220,6 +235,7 @@ private:
     OTZMQDealerSocket balance_socket_;
     Progress progress_;
     blockchain::block::Height height_;
+    Transactions transactions_;
 
     static auto print(Work type) noexcept -> const char*;
 
@@ -227,6 +243,8 @@ private:
         -> UnallocatedCString final;
 
     auto load_thread() noexcept -> void;
+    auto load_transaction(const Data& txid, bool reload) noexcept
+        -> const Cached*;
     auto pipeline(const Message& in) noexcept -> void final;
     auto process_balance(const Message& in) noexcept -> void;
     auto process_block(const Message& in) noexcept -> void;
@@ -237,7 +255,7 @@ private:
     auto process_state(const Message& in) noexcept -> void;
     auto process_sync(const Message& in) noexcept -> void;
     auto process_txid(const Message& in) noexcept -> void;
-    auto process_txid(const Data& txid) noexcept
+    auto process_txid(const Data& txid, bool reload = false) noexcept
         -> std::optional<AccountActivityRowID>;
     auto startup() noexcept -> void final;
 
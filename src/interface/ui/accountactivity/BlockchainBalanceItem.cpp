@@ -17,7 +17,7 @@
 #include "opentxs/api/session/Client.hpp"
 #include "opentxs/api/session/Storage.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
-#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/util/Container.hpp"
@@ -82,22 +82,15 @@ auto BlockchainBalanceItem::reindex(
     const implementation::AccountActivitySortKey& key,
     implementation::CustomData& custom) noexcept -> bool
 {
-    using Transaction = opentxs::blockchain::block::bitcoin::Transaction;
-
+    auto output = BalanceItem::reindex(key, custom);
     extract_custom<proto::PaymentWorkflow>(custom, 0);
     extract_custom<proto::PaymentEvent>(custom, 1);
-    const auto pTx = extract_custom_ptr<Transaction>(custom, 2);
-
-    OT_ASSERT(pTx);
-
-    const auto& tx = *pTx;
-    auto output = BalanceItem::reindex(key, custom);
+    const auto amount = extract_custom<opentxs::Amount>(custom, 2);
     const auto chain = extract_custom<blockchain::Type>(custom, 3);
-    const auto txid = extract_custom<OTData>(custom, 5);
-    const auto amount = tx.NetBalanceChange(nym_id_);
-    const auto memo = tx.Memo();
     const auto text = extract_custom<UnallocatedCString>(custom, 4);
+    const auto txid = extract_custom<OTData>(custom, 5);
     const auto conf = extract_custom<int>(custom, 6);
+    const auto memo = extract_custom<UnallocatedCString>(custom, 7);
 
     OT_ASSERT(chain_ == chain);
     OT_ASSERT(txid_ == txid);
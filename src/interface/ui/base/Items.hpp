@@ -6,9 +6,14 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <optional>
+#include <stdexcept>
+#include <utility>
 
+#include "interface/ui/base/RowTree.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 
@@ -30,6 +35,10 @@ struct Row;
 
 namespace opentxs::ui::implementation
 {
+/// Rows of a list model in sort order
+///
+/// Rows are stored in an order statistic tree so that locating a row by key,
+/// by position, or finding the position of a row are O(log n).
 template <typename RowID, typename SortKey, typename RowPointer>
 class ListItems
 {
@@ -39,8 +48,8 @@ public:
         RowID id_;
         RowPointer item_;
     };
-    using Data = UnallocatedList<Row>;
-    using Iterator = typename Data::iterator;
+    using Data = RowTree<Row>;
+    using Iterator = typename Data::Iterator;
     using Index = UnallocatedMap<RowID, Iterator>;
     using Insert = std::pair<Iterator, internal::Row*>;
     using Position = std::pair<Iterator, std::size_t>;
@@ -74,16 +83,7 @@ public:
             throw std::out_of_range("Invalid position (offset)");
         }
 
-        const auto eff = pos - offset_;
-
-        if ((0 == data_.size()) || ((data_.size() - 1) < eff)) {
-            throw std::out_of_range("Invalid position");
-        }
-
-        auto output = data_.begin();
-        std::advance(output, eff);
-
-        return *output;
+        return data_.at(pos - offset_);
     }
     auto get(const RowID& id) -> Row& { return *index_.at(id); }
     auto begin() noexcept -> Iterator { return data_.begin(); }
@@ -96,106 +96,54 @@ public:
     auto find_delete_position(const RowID& id) noexcept
         -> std::optional<Position>
     {
-        try {
-            const auto it = index_.at(id);
+        if (auto i = index_.find(id); index_.end() != i) {
+            const auto& it = i->second;
 
-            return Position{
-                it,
-                static_cast<std::size_t>(std::distance(data_.begin(), it)) +
-                    offset_};
-
-        } catch (...) {
-
-            return std::nullopt;
+            return Position{it, data_.rank(it) + offset_};
         }
+
+        return std::nullopt;
     }
     auto find_insert_position(const SortKey& key, const RowID& id) noexcept
         -> Insert
     {
-        auto output = Insert{data_.end(), nullptr};
-        auto& [it, before] = output;
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
+        const auto it = data_.partition_point(precedes(key, id));
 
-            if (sort(key, id, rKey, rId)) {
-
-                continue;
-            } else {
-                it = i;
-
-                break;
-            }
-        }
-
-        if (data_.begin() != it) {
-            const auto& [rKey, rId, item] = *std::prev(it);
-            before = item.get();
-        }
-
-        return output;
+        return Insert{it, previous(it)};
     }
     auto find_move_position(
         const RowID& oldId,
         const SortKey& newKey,
         const RowID& newID) noexcept -> std::optional<Move>
     {
-        auto output = Move{{data_.end(), nullptr}, {data_.end(), nullptr}};
-        auto& [from, to] = output;
-        auto& [it, before] = to;
-
-        try {
-            const auto it = index_.at(oldId);
-            from = Insert{it, [&]() -> internal::Row* {
-                              if (data_.begin() == it) {
+        const auto i = index_.find(oldId);
 
-                                  return nullptr;
-                              } else {
+        if (index_.end() == i) { return std::nullopt; }
 
-                                  return std::prev(it)->item_.get();
-                              }
-                          }()};
-        } catch (...) {
+        const auto& from = i->second;
+        const auto to = data_.partition_point(precedes(newKey, newID));
 
-            return std::nullopt;
-        }
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(newKey, newID, rKey, rId)) {
-                before = item.get();
-
-                continue;
-            }
-
-            it = i;
-
-            break;
-        }
-
-        return std::move(output);
+        return Move{{from, previous(from)}, {to, previous(to)}};
     }
     auto get_index(const RowID& id) noexcept -> std::optional<std::size_t>
     {
-        try {
+        if (auto i = index_.find(id); index_.end() != i) {
 
-            return static_cast<std::size_t>(
-                       std::distance(data_.begin(), index_.at(id))) +
-                   offset_;
-        } catch (...) {
-
-            return std::nullopt;
+            return data_.rank(i->second) + offset_;
         }
+
+        return std::nullopt;
     }
+    /// The row is placed according to its sort key. The position argument is
+    /// the value returned by find_insert_position.
     auto insert_before(
-        const Iterator& position,
+        const Iterator&,
         const SortKey& key,
         const RowID& id,
         const RowPointer& item) noexcept -> RowPointer
     {
         auto& index = index_[id];
-        index = data_.emplace(position, Row{key, id, item});
+        index = data_.insert(Row{key, id, item}, precedes(key, id));
 
         return index->item_;
     }
@@ -204,13 +152,14 @@ public:
         Iterator oldPosition,
         const SortKey& newKey,
         const RowID& newID,
-        Iterator newPosition) noexcept -> void
+        Iterator) noexcept -> void
     {
+        auto item = oldPosition->item_;
         index_.erase(oldId);
-        auto& oldData = *oldPosition;
-        auto& index = index_[newID];
-        index = data_.emplace(newPosition, Row{newKey, newID, oldData.item_});
         data_.erase(oldPosition);
+        auto& index = index_[newID];
+        index = data_.insert(
+            Row{newKey, newID, std::move(item)}, precedes(newKey, newID));
     }
 
     ListItems(std::size_t offset, bool reverse) noexcept
@@ -230,7 +179,18 @@ private:
     auto compare_id(const RowID& lhs, const RowID& rhs) const noexcept -> bool;
     auto compare_key(const SortKey& lhs, const SortKey& rhs) const noexcept
         -> bool;
+    auto precedes(const SortKey& key, const RowID& id) const noexcept
+    {
+        return [this, &key, &id](const Row& existing) {
+            return sort(key, id, existing.key_, existing.id_);
+        };
+    }
+    auto previous(Iterator it) noexcept -> internal::Row*
+    {
+        if (data_.begin() == it) { return nullptr; }
 
+        return std::prev(it)->item_.get();
+    }
     auto sort(
         const SortKey& incomingKey,
         const RowID& incomingID,
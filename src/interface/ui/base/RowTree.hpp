@@ -0,0 +1,381 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace opentxs::ui::implementation
+{
+/// Order statistic AVL tree
+///
+/// Elements are kept in the order defined by the predicate supplied to
+/// insert() and can be located by position in O(log n). Iterators remain
+/// valid until the element they refer to is erased.
+template <typename Value>
+class RowTree
+{
+    struct Node;
+
+    struct Entry {
+        Value value_;
+        Node* node_;
+    };
+
+    struct Node {
+        std::unique_ptr<Entry> entry_;
+        Node* parent_;
+        std::unique_ptr<Node> left_;
+        std::unique_ptr<Node> right_;
+        std::size_t size_;
+        int height_;
+    };
+
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        auto operator*() const noexcept -> Value& { return entry_->value_; }
+        auto operator->() const noexcept -> Value* { return &entry_->value_; }
+        auto operator==(const Iterator& rhs) const noexcept -> bool
+        {
+            return entry_ == rhs.entry_;
+        }
+        auto operator!=(const Iterator& rhs) const noexcept -> bool
+        {
+            return entry_ != rhs.entry_;
+        }
+
+        auto operator++() noexcept -> Iterator&
+        {
+            entry_ = entry(next(entry_->node_));
+
+            return *this;
+        }
+        auto operator++(int) noexcept -> Iterator
+        {
+            auto output{*this};
+            ++(*this);
+
+            return output;
+        }
+        auto operator--() noexcept -> Iterator&
+        {
+            if (nullptr == entry_) {
+                entry_ = entry(last(tree_->root_.get()));
+            } else {
+                entry_ = entry(previous(entry_->node_));
+            }
+
+            return *this;
+        }
+        auto operator--(int) noexcept -> Iterator
+        {
+            auto output{*this};
+            --(*this);
+
+            return output;
+        }
+
+        Iterator() noexcept
+            : Iterator(nullptr, nullptr)
+        {
+        }
+
+    private:
+        friend RowTree;
+
+        const RowTree* tree_;
+        Entry* entry_;
+
+        Iterator(const RowTree* tree, Entry* entry) noexcept
+            : tree_(tree)
+            , entry_(entry)
+        {
+        }
+    };
+
+    auto at(const std::size_t pos) noexcept(false) -> Value&
+    {
+        if (pos >= size()) { throw std::out_of_range("Invalid position"); }
+
+        auto* node = root_.get();
+        auto remaining = pos;
+
+        while (true) {
+            const auto left = size(node->left_.get());
+
+            if (remaining < left) {
+                node = node->left_.get();
+            } else if (remaining == left) {
+
+                return node->entry_->value_;
+            } else {
+                remaining -= (left + 1u);
+                node = node->right_.get();
+            }
+        }
+    }
+    auto back() const noexcept(false) -> const Value&
+    {
+        if (false == bool(root_)) { throw std::out_of_range("Empty tree"); }
+
+        return last(root_.get())->entry_->value_;
+    }
+    auto begin() noexcept -> Iterator
+    {
+        return {this, entry(first(root_.get()))};
+    }
+    auto end() noexcept -> Iterator { return {this, nullptr}; }
+    /// Position of the element referenced by a valid, non-end iterator
+    auto rank(const Iterator& it) const noexcept -> std::size_t
+    {
+        const auto* node = it.entry_->node_;
+        auto output = size(node->left_.get());
+
+        for (const auto* parent = node->parent_; nullptr != parent;
+             node = parent, parent = parent->parent_) {
+            if (parent->right_.get() == node) {
+                output += size(parent->left_.get()) + 1u;
+            }
+        }
+
+        return output;
+    }
+    auto size() const noexcept -> std::size_t { return size(root_.get()); }
+
+    auto erase(const Iterator& it) noexcept -> void
+    {
+        auto* node = it.entry_->node_;
+
+        if (node->left_ && node->right_) {
+            // NOTE entries are swapped rather than values so that iterators
+            // to the successor remain valid
+            auto* successor = first(node->right_.get());
+            std::swap(node->entry_, successor->entry_);
+            node->entry_->node_ = node;
+            successor->entry_->node_ = successor;
+            node = successor;
+        }
+
+        auto* parent = node->parent_;
+        auto child = node->left_ ? std::move(node->left_)
+                                 : std::move(node->right_);
+
+        if (child) { child->parent_ = parent; }
+
+        slot(node) = std::move(child);
+        rebalance(parent);
+    }
+    /// Insert an element after every existing element for which the
+    /// predicate returns true
+    ///
+    /// The predicate must be true for a prefix of the existing elements and
+    /// false for the remainder.
+    template <typename Before>
+    auto insert(Value&& value, const Before& before) noexcept -> Iterator
+    {
+        auto node = std::make_unique<Node>(
+            Node{std::make_unique<Entry>(Entry{std::move(value), nullptr}),
+                 nullptr,
+                 nullptr,
+                 nullptr,
+                 1u,
+                 1});
+        auto* entry = node->entry_.get();
+        entry->node_ = node.get();
+        auto* target = &root_;
+
+        while (*target) {
+            node->parent_ = target->get();
+
+            if (before((*target)->entry_->value_)) {
+                target = &(*target)->right_;
+            } else {
+                target = &(*target)->left_;
+            }
+        }
+
+        auto* parent = node->parent_;
+        *target = std::move(node);
+        rebalance(parent);
+
+        return {this, entry};
+    }
+    /// Returns the first element for which the predicate returns false
+    template <typename Before>
+    auto partition_point(const Before& before) noexcept -> Iterator
+    {
+        Node* output{nullptr};
+
+        for (auto* node = root_.get(); nullptr != node;) {
+            if (before(node->entry_->value_)) {
+                node = node->right_.get();
+            } else {
+                output = node;
+                node = node->left_.get();
+            }
+        }
+
+        return {this, entry(output)};
+    }
+
+    RowTree() noexcept
+        : root_()
+    {
+    }
+    RowTree(const RowTree&) = delete;
+    RowTree(RowTree&&) = delete;
+    auto operator=(const RowTree&) -> RowTree& = delete;
+    auto operator=(RowTree&&) -> RowTree& = delete;
+
+    ~RowTree() = default;
+
+private:
+    std::unique_ptr<Node> root_;
+
+    static auto entry(Node* node) noexcept -> Entry*
+    {
+        return (nullptr == node) ? nullptr : node->entry_.get();
+    }
+    static auto first(Node* node) noexcept -> Node*
+    {
+        if (nullptr == node) { return nullptr; }
+
+        while (node->left_) { node = node->left_.get(); }
+
+        return node;
+    }
+    static auto height(const Node* node) noexcept -> int
+    {
+        return (nullptr == node) ? 0 : node->height_;
+    }
+    static auto last(Node* node) noexcept -> Node*
+    {
+        if (nullptr == node) { return nullptr; }
+
+        while (node->right_) { node = node->right_.get(); }
+
+        return node;
+    }
+    static auto next(Node* node) noexcept -> Node*
+    {
+        if (node->right_) { return first(node->right_.get()); }
+
+        auto* parent = node->parent_;
+
+        while ((nullptr != parent) && (parent->right_.get() == node)) {
+            node = parent;
+            parent = parent->parent_;
+        }
+
+        return parent;
+    }
+    static auto previous(Node* node) noexcept -> Node*
+    {
+        if (node->left_) { return last(node->left_.get()); }
+
+        auto* parent = node->parent_;
+
+        while ((nullptr != parent) && (parent->left_.get() == node)) {
+            node = parent;
+            parent = parent->parent_;
+        }
+
+        return parent;
+    }
+    static auto size(const Node* node) noexcept -> std::size_t
+    {
+        return (nullptr == node) ? 0u : node->size_;
+    }
+    static auto update(Node& node) noexcept -> void
+    {
+        const auto* left = node.left_.get();
+        const auto* right = node.right_.get();
+        node.size_ = size(left) + size(right) + 1u;
+        node.height_ = std::max(height(left), height(right)) + 1;
+    }
+
+    static auto rotate_left(std::unique_ptr<Node>& slot) noexcept -> void
+    {
+        auto node = std::move(slot);
+        auto pivot = std::move(node->right_);
+        node->right_ = std::move(pivot->left_);
+
+        if (node->right_) { node->right_->parent_ = node.get(); }
+
+        pivot->parent_ = node->parent_;
+        node->parent_ = pivot.get();
+        update(*node);
+        pivot->left_ = std::move(node);
+        update(*pivot);
+        slot = std::move(pivot);
+    }
+    static auto rotate_right(std::unique_ptr<Node>& slot) noexcept -> void
+    {
+        auto node = std::move(slot);
+        auto pivot = std::move(node->left_);
+        node->left_ = std::move(pivot->right_);
+
+        if (node->left_) { node->left_->parent_ = node.get(); }
+
+        pivot->parent_ = node->parent_;
+        node->parent_ = pivot.get();
+        update(*node);
+        pivot->right_ = std::move(node);
+        update(*pivot);
+        slot = std::move(pivot);
+    }
+
+    auto rebalance(Node* node) noexcept -> void
+    {
+        while (nullptr != node) {
+            update(*node);
+            auto& owner = slot(node);
+            const auto balance =
+                height(node->left_.get()) - height(node->right_.get());
+
+            if (1 < balance) {
+                const auto& left = *node->left_;
+
+                if (height(left.left_.get()) < height(left.right_.get())) {
+                    rotate_left(node->left_);
+                }
+
+                rotate_right(owner);
+            } else if (-1 > balance) {
+                const auto& right = *node->right_;
+
+                if (height(right.right_.get()) < height(right.left_.get())) {
+                    rotate_right(node->right_);
+                }
+
+                rotate_left(owner);
+            }
+
+            node = owner->parent_;
+        }
+    }
+    auto slot(const Node* node) noexcept -> std::unique_ptr<Node>&
+    {
+        auto* parent = node->parent_;
+
+        if (nullptr == parent) { return root_; }
+
+        return (parent->left_.get() == node) ? parent->left_ : parent->right_;
+    }
+};
+}  // namespace opentxs::ui::implementation
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "opentxs/api/session/Activity.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -43,6 +44,11 @@ public:
         const identifier::Nym& nym,
         const UnallocatedCString& id,
         const UnallocatedCString& workflow) const noexcept -> ChequeData = 0;
+    /// Adds account events for blockchain transactions which were recorded
+    /// before the account event index existed
+    virtual auto IndexAccountEvents(
+        const identifier::Nym& nym,
+        const opentxs::blockchain::Type chain) const noexcept -> bool = 0;
     auto Internal() const noexcept -> const Activity& final { return *this; }
     using session::Activity::Mail;
     /**   Load a mail object
@@ -5,7 +5,10 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "opentxs/api/session/Storage.hpp"
+#include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -19,6 +22,11 @@ namespace key
 class Symmetric;
 }  // namespace key
 }  // namespace crypto
+
+namespace proto
+{
+class AccountEvent;
+}  // namespace proto
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
@@ -28,6 +36,30 @@ namespace opentxs::api::session::internal
 class Storage : virtual public session::Storage
 {
 public:
+    /** Returns false if the cursor is not valid
+     *
+     *  indexed is false until SetAccountEventsIndexed has been called for the
+     *  account.
+     */
+    virtual auto AccountEvents(
+        const UnallocatedCString& nymID,
+        const UnallocatedCString& accountID,
+        const UnallocatedCString& cursor,
+        const std::size_t limit,
+        UnallocatedVector<proto::AccountEvent>& events,
+        UnallocatedCString& next,
+        bool& indexed) const noexcept -> bool = 0;
+    virtual auto SetAccountEventsIndexed(
+        const UnallocatedCString& nymID,
+        const UnallocatedCString& accountID) const noexcept -> bool = 0;
+    /** Replaces the events for the account which were produced by source */
+    virtual auto StoreAccountEvents(
+        const UnallocatedCString& nymID,
+        const UnallocatedCString& accountID,
+        const UnallocatedCString& source,
+        const UnallocatedVector<proto::AccountEvent>& events) const noexcept
+        -> bool = 0;
+
     virtual auto InitBackup() -> void = 0;
     virtual auto InitEncryptedBackup(opentxs::crypto::key::Symmetric& key)
         -> void = 0;
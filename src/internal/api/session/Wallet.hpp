@@ -51,6 +51,13 @@ class Wallet : virtual public api::session::Wallet
 public:
     virtual auto Account(const Identifier& accountID) const
         -> SharedAccount = 0;
+    /**   Record that a credential has passed syntax and signature validation
+     *
+     *    \param[in] hash the identifier of the complete serialized credential,
+     *                    including its signatures
+     */
+    virtual auto AddVerifiedCredential(const Identifier& hash) const noexcept
+        -> void = 0;
     virtual auto CreateAccount(
         const identifier::Nym& ownerNymID,
         const identifier::Notary& notaryID,
@@ -60,6 +67,14 @@ public:
         TransactionNumber stash,
         const PasswordPrompt& reason) const -> ExclusiveAccount = 0;
     auto Internal() const noexcept -> const Wallet& final { return *this; }
+    /**   Returns true if a credential with the specified hash has previously
+     *    passed validation during this session
+     *
+     *    Any change to the contents or signatures of a credential changes its
+     *    hash, so a modified credential is always fully validated.
+     */
+    virtual auto IsVerifiedCredential(const Identifier& hash) const noexcept
+        -> bool = 0;
     virtual auto IssuerAccount(const identifier::UnitDefinition& unitID) const
         -> SharedAccount = 0;
     virtual auto LoadCredential(
@@ -7,11 +7,31 @@
 
 #include "opentxs/api/session/Workflow.hpp"
 
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace identifier
+{
+class Nym;
+}  // namespace identifier
+
+class Identifier;
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
 namespace opentxs::api::session::internal
 {
 class Workflow : virtual public session::Workflow
 {
 public:
+    /// Adds account events for workflows which were saved before the
+    /// account event index existed
+    virtual auto IndexAccountEvents(
+        const identifier::Nym& nymID,
+        const Identifier& accountID) const noexcept -> bool = 0;
     auto Internal() const noexcept -> const internal::Workflow& final
     {
         return *this;
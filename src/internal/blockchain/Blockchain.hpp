@@ -91,6 +91,18 @@ auto HashedSetConstruct(
     const std::uint32_t M,
     const UnallocatedVector<ReadView> items) noexcept(false)
     -> UnallocatedVector<std::uint64_t>;
+/// Map previously calculated siphash values into the hashed set range
+auto HashedSetConstruct(
+    const std::uint32_t N,
+    const std::uint32_t M,
+    UnallocatedVector<std::uint64_t>&& siphashes) noexcept
+    -> UnallocatedVector<std::uint64_t>;
+auto MapToRange(const std::uint64_t siphash, const std::uint64_t range) noexcept
+    -> std::uint64_t;
+auto Siphash(
+    const api::Session& api,
+    const ReadView key,
+    const ReadView item) noexcept(false) -> std::uint64_t;
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain
@@ -230,6 +242,14 @@ auto GCS(
     const blockchain::filter::Type type,
     const blockchain::block::Block& block) noexcept
     -> std::unique_ptr<blockchain::GCS>;
+/// siphashes must be calculated from a deduplicated set of non-empty elements
+auto GCS(
+    const api::Session& api,
+    const std::uint8_t bits,
+    const std::uint32_t fpRate,
+    const ReadView key,
+    UnallocatedVector<std::uint64_t>&& siphashes) noexcept
+    -> std::unique_ptr<blockchain::GCS>;
 auto GCS(const api::Session& api, const proto::GCS& serialized) noexcept
     -> std::unique_ptr<blockchain::GCS>;
 auto GCS(const api::Session& api, const ReadView serialized) noexcept
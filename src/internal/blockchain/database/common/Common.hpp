@@ -78,6 +78,8 @@ enum Table {
     FilterIndexBCH = 20,
     FilterIndexES = 21,
     TransactionIndex = 22,
+    BulkFreeSpace = 23,
+    SyncFreeSpace = 24,
 };
 
 auto ChainToSyncTable(const opentxs::blockchain::Type chain) noexcept(false)
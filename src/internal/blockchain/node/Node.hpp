@@ -25,6 +25,7 @@
 #if OT_BLOCKCHAIN
 #include "blockchain/DownloadTask.hpp"
 #include "internal/blockchain/database/Database.hpp"
+#include "internal/blockchain/node/wallet/CoinSelection.hpp"
 #endif  // OT_BLOCKCHAIN
 #include "internal/core/Core.hpp"
 #include "opentxs/Types.hpp"
@@ -219,6 +220,9 @@ struct BlockDatabase {
         -> bool = 0;
     virtual auto BlockLoadBitcoin(const block::Hash& block) const noexcept
         -> std::shared_ptr<const block::bitcoin::Block> = 0;
+    virtual auto BlockLoadRaw(
+        const block::Hash& block,
+        const AllocateOutput destination) const noexcept -> bool = 0;
     virtual auto BlockPolicy() const noexcept -> database::BlockStorage = 0;
     virtual auto BlockStore(const block::Block& block) const noexcept
         -> bool = 0;
@@ -236,8 +240,12 @@ struct BlockOracle : virtual public node::BlockOracle {
         Shutdown = value(WorkType::Shutdown),
     };
 
-    virtual auto GetBlockJob() const noexcept -> BlockJob = 0;
+    virtual auto GetBlockJob(const int peer) const noexcept -> BlockJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
+    /// Copy a stored block in wire format without parsing it
+    virtual auto LoadRaw(
+        const block::Hash& block,
+        const AllocateOutput destination) const noexcept -> bool = 0;
     virtual auto SubmitBlock(const ReadView in) const noexcept -> void = 0;
 
     virtual auto Init() noexcept -> void = 0;
@@ -285,6 +293,10 @@ struct FilterDatabase {
         const block::Hash& block) const noexcept -> bool = 0;
     virtual auto LoadFilter(const filter::Type type, const ReadView block)
         const noexcept -> std::unique_ptr<const GCS> = 0;
+    virtual auto LoadFilterBytes(
+        const filter::Type type,
+        const ReadView block,
+        const AllocateOutput destination) const noexcept -> bool = 0;
     virtual auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash = 0;
     virtual auto LoadFilterHeader(const filter::Type type, const ReadView block)
@@ -317,6 +329,12 @@ struct FilterOracle : virtual public node::FilterOracle {
     virtual auto GetFilterJob() const noexcept -> CfilterJob = 0;
     virtual auto GetHeaderJob() const noexcept -> CfheaderJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
+    /// Write the BIP157 encoding of a stored filter without constructing a
+    /// GCS object
+    virtual auto LoadFilterBytes(
+        const filter::Type type,
+        const block::Hash& block,
+        const AllocateOutput destination) const noexcept -> bool = 0;
     virtual auto LoadFilterOrResetTip(
         const filter::Type type,
         const block::Position& position) const noexcept
@@ -372,6 +390,9 @@ struct Mempool {
         -> UnallocatedSet<UnallocatedCString> = 0;
     virtual auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const block::bitcoin::Transaction> = 0;
+    /// Returns every transaction currently held in the mempool
+    virtual auto Snapshot() const noexcept -> UnallocatedVector<
+        std::shared_ptr<const block::bitcoin::Transaction>> = 0;
     virtual auto Submit(ReadView txid) const noexcept -> bool = 0;
     virtual auto Submit(const UnallocatedVector<ReadView>& txids) const noexcept
         -> UnallocatedVector<bool> = 0;
@@ -443,10 +464,19 @@ struct PeerManager {
     virtual auto GetPeerCount() const noexcept -> std::size_t = 0;
     virtual auto GetVerifiedPeerCount() const noexcept -> std::size_t = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
+    /// Returns true if the peer should announce new blocks with cmpctblock
+    virtual auto IsHighBandwidthPeer(const int id) const noexcept
+        -> bool = 0;
     virtual auto JobReady(const Task type) const noexcept -> void = 0;
     virtual auto Listen(const p2p::Address& address) const noexcept -> bool = 0;
     virtual auto LookupIncomingSocket(const int id) const noexcept(false)
         -> opentxs::network::asio::Socket = 0;
+    /// Record that a peer delivered a new block via cmpctblock
+    ///
+    /// The most recent peers to do so are selected for high bandwidth compact
+    /// block relay.
+    virtual auto PromoteHighBandwidthPeer(const int id) const noexcept
+        -> void = 0;
     virtual auto RequestBlock(const block::Hash& block) const noexcept
         -> bool = 0;
     virtual auto RequestBlocks(
@@ -555,6 +585,7 @@ struct Wallet : virtual public node::Wallet {
 struct SpendPolicy {
     bool unconfirmed_incoming_{false};
     bool unconfirmed_change_{true};
+    wallet::SelectionStrategy selection_{wallet::SelectionStrategy::Automatic};
 };
 
 struct WalletDatabase {
@@ -666,6 +697,13 @@ struct WalletDatabase {
         const identifier::Nym& spender,
         const Identifier& proposal,
         SpendPolicy& policy) const noexcept -> std::optional<UTXO> = 0;
+    /// Selects and reserves every input required to reach the target
+    virtual auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const wallet::SelectionTarget& target,
+        SpendPolicy& policy) const noexcept
+        -> std::optional<UnallocatedVector<UTXO>> = 0;
     virtual auto StartReorg() const noexcept
         -> storage::lmdb::LMDB::Transaction = 0;
     virtual auto SubchainAddElements(
@@ -43,6 +43,11 @@ struct Mempool;
 struct Network;
 struct WalletDatabase;
 }  // namespace internal
+
+namespace wallet
+{
+class ScanCoordinator;
+}  // namespace wallet
 }  // namespace node
 }  // namespace blockchain
 // }  // namespace v1
@@ -66,6 +71,7 @@ public:
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
         const node::internal::Mempool& mempool,
+        std::shared_ptr<ScanCoordinator> coordinator,
         const Type chain,
         const filter::Type filter,
         const std::string_view shutdown,
@@ -0,0 +1,93 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace blockchain
+{
+namespace block
+{
+namespace bitcoin
+{
+class Output;
+}  // namespace bitcoin
+}  // namespace block
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::node::wallet
+{
+enum class SelectionStrategy : std::uint8_t {
+    /// Branch and bound, falling back to knapsack if no changeless
+    /// solution exists
+    Automatic = 0,
+    /// Searches for a set of inputs which does not require change
+    BranchAndBound = 1,
+    /// Randomized approximation of the smallest sufficient set of inputs
+    Knapsack = 2,
+    /// Adds the largest inputs until the target is reached
+    LargestFirst = 3,
+};
+
+/// Requirements for the inputs of a transaction
+///
+/// Values are denominated in the smallest unit of the chain.
+struct SelectionTarget {
+    /// Minimum sum of effective input values
+    std::int64_t value_{};
+    /// Fee per 1000 bytes
+    std::int64_t fee_rate_{};
+    /// Largest excess value which is not worth a change output
+    std::int64_t change_cost_{};
+};
+
+/// A spendable output
+struct Coin {
+    std::int64_t value_{};
+    /// Estimated size of an input which spends this output
+    std::size_t bytes_{};
+};
+
+struct Selection {
+    /// Positions of the chosen outputs in the candidate list
+    UnallocatedVector<std::size_t> coins_{};
+    /// Fee required to spend the chosen outputs
+    std::int64_t fee_{};
+    /// Effective value of the chosen outputs in excess of the target. The
+    /// transaction needs a change output if this exceeds the change cost.
+    std::int64_t excess_{};
+    SelectionStrategy strategy_{};
+};
+
+/// Estimated size of an input spending the specified output
+///
+/// Returns nothing if the transaction builder can not spend the script type.
+auto InputBytes(const block::bitcoin::Output& output) noexcept
+    -> std::optional<std::size_t>;
+auto print(SelectionStrategy strategy) noexcept -> std::string_view;
+/// The effective value of a coin is its value less the fee required to spend
+/// it. Coins with a non-positive effective value are never chosen.
+///
+/// Returns nothing if the effective value of every coin together does not
+/// reach the target.
+auto SelectCoins(
+    const SelectionStrategy strategy,
+    const SelectionTarget& target,
+    const UnallocatedVector<Coin>& coins) noexcept -> std::optional<Selection>;
+}  // namespace opentxs::blockchain::node::wallet
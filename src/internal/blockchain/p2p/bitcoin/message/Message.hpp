@@ -160,6 +160,16 @@ struct FilterRequest {
     FilterRequest() noexcept;
 };
 
+/// Frame a payload which is already in wire format
+///
+/// The payload is neither parsed nor copied. Used to serve blocks and filters
+/// directly from storage.
+auto Transmit(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const bitcoin::Command command,
+    network::zeromq::Frame&& payload) noexcept
+    -> std::pair<network::zeromq::Frame, network::zeromq::Frame>;
 auto VerifyChecksum(
     const api::Session& api,
     const Header& header,
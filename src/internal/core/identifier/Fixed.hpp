@@ -0,0 +1,114 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <robin_hood.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include "opentxs/core/identifier/Algorithm.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/core/identifier/Type.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace implementation
+{
+class Identifier;
+}  // namespace implementation
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::identifier
+{
+/// Identifier value type for use as a container key
+///
+/// The identifier bytes are stored inline and the hash is calculated once
+/// at construction, so copying, hashing, and comparing a Fixed never touches
+/// the heap or makes a virtual call. capacity_ is the digest size of the
+/// largest supported identifier algorithm.
+class Fixed
+{
+public:
+    static constexpr auto capacity_ = std::size_t{32};
+
+    auto Algorithm() const noexcept -> identifier::Algorithm
+    {
+        return algorithm_;
+    }
+    auto Bytes() const noexcept -> ReadView
+    {
+        return {reinterpret_cast<const char*>(bytes_.data()), size_};
+    }
+    auto empty() const noexcept -> bool { return 0u == size_; }
+    auto Generic() const noexcept -> OTIdentifier;
+    auto Hash() const noexcept -> std::size_t { return hash_; }
+    auto Nym() const noexcept -> OTNymID;
+    auto size() const noexcept -> std::size_t { return size_; }
+    auto str() const noexcept -> UnallocatedCString;
+    auto Type() const noexcept -> identifier::Type { return type_; }
+
+    Fixed() noexcept;
+    explicit Fixed(const opentxs::Identifier& id) noexcept;
+    Fixed(const Fixed&) noexcept = default;
+    Fixed(Fixed&&) noexcept = default;
+    auto operator=(const Fixed&) noexcept -> Fixed& = default;
+    auto operator=(Fixed&&) noexcept -> Fixed& = default;
+
+    ~Fixed() = default;
+
+private:
+    std::array<std::uint8_t, capacity_> bytes_;
+    std::size_t hash_;
+    std::uint8_t size_;
+    identifier::Algorithm algorithm_;
+    identifier::Type type_;
+
+    auto instantiate() const noexcept -> opentxs::implementation::Identifier*;
+
+    friend auto operator==(const Fixed& lhs, const Fixed& rhs) noexcept
+        -> bool;
+    friend auto operator<(const Fixed& lhs, const Fixed& rhs) noexcept
+        -> bool;
+};
+
+// NOTE like opentxs::Identifier, only the identifier bytes participate in
+// comparisons. The algorithm and type are informational.
+auto operator==(const Fixed& lhs, const Fixed& rhs) noexcept -> bool;
+auto operator!=(const Fixed& lhs, const Fixed& rhs) noexcept -> bool;
+auto operator<(const Fixed& lhs, const Fixed& rhs) noexcept -> bool;
+
+static_assert(std::is_trivially_copyable_v<Fixed>);
+
+template <typename Value>
+using FixedMap = robin_hood::unordered_flat_map<Fixed, Value>;
+/// Use when values are not movable or references must remain stable
+template <typename Value>
+using FixedNodeMap = robin_hood::unordered_node_map<Fixed, Value>;
+using FixedSet = robin_hood::unordered_flat_set<Fixed>;
+}  // namespace opentxs::identifier
+
+namespace std
+{
+template <>
+struct hash<opentxs::identifier::Fixed> {
+    auto operator()(const opentxs::identifier::Fixed& id) const noexcept
+        -> std::size_t
+    {
+        return id.Hash();
+    }
+};
+}  // namespace std
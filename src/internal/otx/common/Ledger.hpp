@@ -14,6 +14,7 @@
 #include "internal/otx/common/Contract.hpp"
 #include "internal/otx/common/OTTransaction.hpp"
 #include "internal/otx/common/OTTransactionType.hpp"
+#include "internal/otx/common/transaction/Helpers.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Amount.hpp"
@@ -63,6 +64,7 @@ class Account;
 class Identifier;
 class Item;
 class PasswordPrompt;
+class Tag;
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
@@ -275,22 +277,44 @@ private:  // Private prevents erroneous use by other classes.
 
     using ot_super = OTTransactionType;
 
+    // Files which begin with this prefix contain a serialized
+    // OTDB::Ledger_InternalPB instead of an armored XML contract
+    static constexpr auto binary_prefix_ = "OTLEDGER-PB\n";
+    static constexpr auto binary_version_ = std::uint32_t{1};
+
     mapOfTransactions m_mapTransactions;  // a ledger contains a map of
                                           // transactions.
 
+    static auto is_binary(const UnallocatedCString& contents) noexcept -> bool;
+
     auto make_filename(const ledgerType theType) -> std::
         tuple<bool, UnallocatedCString, UnallocatedCString, UnallocatedCString>;
 
+    auto generate_contents(Tag& tag, const PasswordPrompt& reason) const
+        -> bool;
     auto generate_ledger(
         const identifier::Nym& theNymID,
         const Identifier& theAcctID,
         const identifier::Notary& theNotaryID,
         ledgerType theType,
         bool bCreateFile) -> bool;
+    auto load_binary(const UnallocatedCString& contents) -> bool;
+    // return -1 if error, 1 if the ledger was loaded
+    auto load_contents(const Tag& contents) -> std::int32_t;
+    // return -1 if error, 1 if the ledger element was processed
+    auto load_header(
+        const AttributeReader& attribute,
+        std::int32_t& records,
+        String& expected) -> std::int32_t;
+    // return -1 if error, 1 if the record was added
+    auto load_record(const AttributeReader& attribute) -> std::int32_t;
     auto save_box(
         const ledgerType type,
         Identifier& hash,
         bool (Ledger::*calc)(Identifier&) const) -> bool;
+    // Returns false if the in-memory contents no longer match the signed
+    // contents, in which case the ledger must be saved as armored XML
+    auto serialize_binary(UnallocatedCString& output) const -> bool;
 
     Ledger(const api::Session& api);
     Ledger(
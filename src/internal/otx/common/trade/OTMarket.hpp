@@ -6,11 +6,13 @@
 #pragma once
 
 #include <irrxml/irrXML.hpp>
+#include <cstddef>
 #include <cstdint>
 
 #include "internal/otx/common/Contract.hpp"
 #include "internal/otx/common/cron/OTCron.hpp"
 #include "internal/otx/common/trade/OTOffer.hpp"
+#include "internal/otx/common/trade/OTOrderBook.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/api/session/Factory.hpp"
@@ -60,16 +62,12 @@ class PasswordPrompt;
 #define MAX_MARKET_QUERY_DEPTH                                                 \
     50  // todo add this to the ini file. (Now that we actually have one.)
 
-// Multiple offers, mapped by price limit.
-// Using multi-map since there will be more than one offer for each single
-// price.
-// (Map would only allow a single item on the map for each price.)
-using mapOfOffers = UnallocatedMultimap<Amount, OTOffer*>;
-// The same offers are also mapped (uniquely) to transaction number.
-using mapOfOffersTrnsNum = UnallocatedMap<Amount, OTOffer*>;
+// Number of changes which may be appended to the market journal before the
+// full market is rewritten and the journal is truncated.
+#define MAX_MARKET_JOURNAL_ENTRIES 1000
 
-// A market has a list of OTOffers for all the bids, and another list of
-// OTOffers for all the asks.
+// A market has an order book containing OTOffers for all the bids and all the
+// asks, aggregated by price level.
 // Presumably the server will have different markets for different instrument
 // definitions.
 
@@ -123,8 +121,21 @@ public:
     auto GetHighestBidPrice() -> Amount;
     auto GetLowestAskPrice() -> Amount;
 
-    auto GetBidCount() -> mapOfOffers::size_type { return m_mapBids.size(); }
-    auto GetAskCount() -> mapOfOffers::size_type { return m_mapAsks.size(); }
+    auto GetBidCount() -> std::size_t { return m_Book.BidCount(); }
+    auto GetAskCount() -> std::size_t { return m_Book.AskCount(); }
+    // Market data feed. Consumers take a depth snapshot and then request the
+    // price level changes which occurred after the snapshot's sequence number.
+    // If GetDepthUpdates returns false the consumer must take a new snapshot.
+    auto GetDepth(std::size_t depth = 0) const -> OTOrderBook::Depth
+    {
+        return m_Book.Snapshot(depth);
+    }
+    auto GetDepthUpdates(
+        std::uint64_t since,
+        UnallocatedVector<OTOrderBook::Delta>& output) const -> bool
+    {
+        return m_Book.Deltas(since, output);
+    }
     void SetInstrumentDefinitionID(
         const identifier::UnitDefinition& INSTRUMENT_DEFINITION_ID)
     {
@@ -182,7 +193,12 @@ public:
     inline void SetCronPointer(OTCron& theCron) { m_pCron = &theCron; }
     inline auto GetCron() -> OTCron* { return m_pCron; }
     auto LoadMarket() -> bool;
+    // Rewrites the entire market and truncates the journal
     auto SaveMarket(const PasswordPrompt& reason) -> bool;
+    // Appends the current state of an offer to the market journal. AddOffer
+    // does not journal new offers; the caller passes them here once they are
+    // signed by the server nym.
+    auto SaveOffer(OTOffer& theOffer, const PasswordPrompt& reason) -> bool;
 
     void InitMarket();
 
@@ -208,11 +224,12 @@ private:
 
     OTDB::TradeListMarket* m_pTradeList{nullptr};
 
-    mapOfOffers m_mapBids;  // The buyers, ordered by price limit
-    mapOfOffers m_mapAsks;  // The sellers, ordered by price limit
+    OTOrderBook m_Book;  // The buyers and sellers, aggregated by price
+                         // limit and indexed by transaction number.
 
-    mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
-                                     // ordered by transaction number.
+    // Number of records appended to the journal since the market was last
+    // saved in full.
+    std::size_t m_nJournalEntries{0};
 
     OTNotaryID m_NOTARY_ID;  // Always store this in any object that's
                              // associated with a specific server.
@@ -255,6 +272,16 @@ private:
         const identifier::UnitDefinition& CURRENCY_TYPE_ID,
         const Amount& lScale);
 
+    auto append_journal(
+        const char* type,
+        const UnallocatedCString& argument,
+        const UnallocatedCString& payload,
+        const PasswordPrompt& reason) -> bool;
+    auto load_journal(const UnallocatedCString& marketID) -> bool;
+    auto replay_offer(const Time dateAdded, const String& contract) -> bool;
+    auto save_trade_list(const UnallocatedCString& marketID) -> void;
+    void update_book(OTOffer& theOffer);
+
     void rollback_four_accounts(
         Account& p1,
         bool b1,
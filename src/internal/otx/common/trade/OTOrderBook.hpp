@@ -0,0 +1,158 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "opentxs/Version.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Numbers.hpp"
+
+namespace opentxs
+{
+class OTOffer;
+
+// Price-level aggregated view of the offers on a single market.
+//
+// Limit orders are grouped into one level per price. Each level holds its
+// offers in an intrusive FIFO queue (so time priority within a price is
+// preserved) and maintains the total quantity available at that price. Market
+// orders (price 0) never rest at a level and are kept in a separate FIFO per
+// side.
+//
+// Every change to a level is recorded as a Delta with a monotonically
+// increasing sequence number. A consumer takes a Snapshot once and then
+// applies Deltas to stay current. If the consumer falls further behind than
+// the retained history then Deltas returns false and a new Snapshot is needed.
+//
+// The book does not own the offers it indexes. OTMarket remains responsible
+// for their lifetime.
+class OTOrderBook
+{
+public:
+    enum class Side : std::uint8_t { Bid = 0, Ask = 1 };
+
+    struct Level {
+        Amount price_{};
+        Amount quantity_{};
+        std::size_t count_{};
+    };
+
+    struct Depth {
+        std::uint64_t sequence_{};
+        UnallocatedVector<Level> bids_{};  // highest price first
+        UnallocatedVector<Level> asks_{};  // lowest price first
+    };
+
+    struct Delta {
+        std::uint64_t sequence_{};
+        Side side_{};
+        Level level_{};  // a zero count means the level was removed
+    };
+
+    // Return false from the visitor to stop iterating
+    using Visitor = std::function<bool(OTOffer&)>;
+
+    static constexpr std::size_t default_history_{1024};
+
+    auto AskCount() const noexcept -> std::size_t;
+    // Returns 0 if there are no limit asks
+    auto BestAsk() const noexcept -> Amount;
+    // Returns 0 if there are no limit bids
+    auto BestBid() const noexcept -> Amount;
+    auto BidCount() const noexcept -> std::size_t;
+    // Appends every delta newer than the specified sequence to the output.
+    // Returns false if the requested range is no longer retained.
+    auto Deltas(std::uint64_t since, UnallocatedVector<Delta>& out)
+        const noexcept -> bool;
+    auto Find(const TransactionNumber number) const noexcept -> OTOffer*;
+    auto Sequence() const noexcept -> std::uint64_t { return sequence_; }
+    auto size() const noexcept -> std::size_t { return index_.size(); }
+    // A depth of zero returns every level
+    auto Snapshot(std::size_t depth = 0) const noexcept -> Depth;
+    // Total quantity available on all limit and market asks
+    auto TotalAsks() const noexcept -> Amount;
+    // Visits limit asks from lowest to highest price, oldest first within
+    // each level
+    auto VisitAsks(const Visitor& cb) const noexcept -> void;
+    // Visits limit bids from highest to lowest price, oldest first within
+    // each level
+    auto VisitBids(const Visitor& cb) const noexcept -> void;
+    // Visits every offer on the book including market orders
+    auto VisitAll(const Visitor& cb) const noexcept -> void;
+
+    auto Add(
+        const TransactionNumber number,
+        const Side side,
+        const Amount& price,
+        const Amount& quantity,
+        OTOffer* offer) noexcept -> bool;
+    // Removes every offer from the book and returns them to the caller
+    auto Clear() noexcept -> UnallocatedVector<OTOffer*>;
+    // Returns nullptr if the offer was not found
+    auto Remove(const TransactionNumber number) noexcept -> OTOffer*;
+    // Call after an offer's available quantity changes
+    auto Update(const TransactionNumber number, const Amount& quantity) noexcept
+        -> bool;
+
+    OTOrderBook(std::size_t history = default_history_) noexcept;
+
+    ~OTOrderBook();
+
+private:
+    struct Node {
+        TransactionNumber number_{};
+        Side side_{};
+        Amount price_{};
+        Amount quantity_{};
+        OTOffer* offer_{};
+        Node* prev_{};
+        Node* next_{};
+    };
+
+    struct Queue {
+        Node* head_{};
+        Node* tail_{};
+        Amount quantity_{};
+        std::size_t count_{};
+
+        auto empty() const noexcept -> bool { return nullptr == head_; }
+        auto erase(Node& node) noexcept -> void;
+        auto push_back(Node& node) noexcept -> void;
+    };
+
+    using Levels = UnallocatedMap<Amount, Queue>;
+    using Index = UnallocatedMap<TransactionNumber, Node>;
+
+    const std::size_t history_limit_;
+    Levels bids_;
+    Levels asks_;
+    Queue market_bids_;
+    Queue market_asks_;
+    Index index_;
+    std::size_t bid_count_;
+    std::size_t ask_count_;
+    Amount total_asks_;
+    std::uint64_t sequence_;
+    UnallocatedDeque<Delta> history_;
+
+    static auto is_market(const Amount& price) noexcept -> bool;
+    static auto visit(const Queue& queue, const Visitor& cb) noexcept -> bool;
+
+    auto levels(Side side) noexcept -> Levels&;
+    auto market(Side side) noexcept -> Queue&;
+    auto publish(Side side, const Amount& price, const Queue* queue) noexcept
+        -> void;
+
+    OTOrderBook(const OTOrderBook&) = delete;
+    OTOrderBook(OTOrderBook&&) = delete;
+    auto operator=(const OTOrderBook&) -> OTOrderBook& = delete;
+    auto operator=(OTOrderBook&&) -> OTOrderBook& = delete;
+};
+}  // namespace opentxs
@@ -7,6 +7,7 @@
 
 #include <irrxml/irrXML.hpp>
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 #include "internal/otx/Types.hpp"
@@ -42,6 +43,10 @@ auto GetTransactionTypeString(int transactionTypeIndex) -> const
 auto GetOriginTypeToString(int originTypeIndex) -> const char*;  // enum
                                                                  // originType
 
+// Returns the value of the named attribute of the current element, or nullptr
+// if the attribute does not exist
+using AttributeReader = std::function<const char*(const char*)>;
+
 auto LoadAbbreviatedRecord(
     irr::io::IrrXMLReader*& xml,
     std::int64_t& lNumberOfOrigin,
@@ -58,6 +63,22 @@ auto LoadAbbreviatedRecord(
     std::int64_t& lRequestNum,
     bool& bReplyTransSuccess,
     NumList* pNumList = nullptr) -> std::int32_t;
+auto LoadAbbreviatedRecord(
+    const AttributeReader& attribute,
+    std::int64_t& lNumberOfOrigin,
+    originType& theOriginType,
+    std::int64_t& lTransactionNum,
+    std::int64_t& lInRefTo,
+    std::int64_t& lInRefDisplay,
+    Time& the_DATE_SIGNED,
+    transactionType& theType,
+    String& strHash,
+    Amount& lAdjustment,
+    Amount& lDisplayValue,
+    std::int64_t& lClosingNum,
+    std::int64_t& lRequestNum,
+    bool& bReplyTransSuccess,
+    NumList* pNumList = nullptr) -> std::int32_t;
 
 auto VerifyBoxReceiptExists(
     const api::Session& api,
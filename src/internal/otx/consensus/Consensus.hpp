@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <future>
+
 #include "internal/otx/Types.hpp"
 #include "internal/util/Editor.hpp"
 #include "opentxs/otx/consensus/Base.hpp"
@@ -112,6 +114,8 @@ public:
         const bool withAcknowledgments = true,
         const bool withNymboxHash = false)
         -> std::pair<RequestNumber, std::unique_ptr<Message>> = 0;
+    // Ready the next time no request is in progress
+    virtual auto Idle() const noexcept -> std::shared_future<void> = 0;
     auto InternalServer() const noexcept -> const internal::Server& final
     {
         return *this;
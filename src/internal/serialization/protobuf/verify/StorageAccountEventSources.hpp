@@ -0,0 +1,47 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "opentxs/Version.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace proto
+{
+class StorageAccountEventSources;
+}  // namespace proto
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::proto
+{
+auto CheckProto_1(
+    const StorageAccountEventSources& input,
+    const bool silent) -> bool;
+auto CheckProto_2(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_3(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_4(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_5(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_6(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_7(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_8(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_9(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_10(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_11(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_12(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_13(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_14(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_15(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_16(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_17(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_18(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_19(const StorageAccountEventSources&, const bool) -> bool;
+auto CheckProto_20(const StorageAccountEventSources&, const bool) -> bool;
+}  // namespace opentxs::proto
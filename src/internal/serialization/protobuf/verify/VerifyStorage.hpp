@@ -11,6 +11,13 @@
 namespace opentxs::proto
 {
 auto BlindedSeriesListAllowedStorageItemHash() noexcept -> const VersionMap&;
+auto StorageAccountEventAllowedAccountEvent() noexcept -> const VersionMap&;
+auto StorageAccountEventListAllowedStorageAccountEvent() noexcept
+    -> const VersionMap&;
+auto StorageAccountEventSourcesAllowedStorageAccountEventSource() noexcept
+    -> const VersionMap&;
+auto StorageAccountEventsAllowedStorageAccountEventBucket() noexcept
+    -> const VersionMap&;
 auto StorageAccountsAllowedStorageAccountIndex() noexcept -> const VersionMap&;
 auto StorageAccountsAllowedStorageItemHash() noexcept -> const VersionMap&;
 auto StorageAccountsAllowedStorageIDList() noexcept -> const VersionMap&;
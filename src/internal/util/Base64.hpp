@@ -0,0 +1,39 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+
+#include "opentxs/util/Bytes.hpp"
+
+// Table driven base64 codec which writes into caller-provided buffers.
+//
+// Encoding emits two output characters per table lookup. Decoding handles a
+// full four character group with four lookups and a single validity check, and
+// only falls back to per-character processing when it encounters whitespace,
+// padding, or other characters outside the base64 alphabet.
+namespace opentxs::base64
+{
+// Line width of armored output
+constexpr auto line_width_ = std::size_t{72};
+
+// Upper bound on the number of bytes written by Decode
+auto DecodedSize(std::size_t chars) noexcept -> std::size_t;
+// Exact number of characters written by Encode. If width is not zero a
+// newline follows every width characters and the final line.
+auto EncodedSize(std::size_t bytes, std::size_t width = 0) noexcept
+    -> std::size_t;
+
+// Characters outside the base64 alphabet are ignored and decoding stops at the
+// first padding character. The output buffer must have room for
+// DecodedSize(in.size()) bytes. Returns the number of bytes written.
+auto Decode(const ReadView in, void* out) noexcept -> std::size_t;
+// The output buffer must have room for EncodedSize(in.size(), width)
+// characters and width must be a multiple of 4. Returns the number of
+// characters written.
+auto Encode(const ReadView in, char* out, std::size_t width = 0) noexcept
+    -> std::size_t;
+}  // namespace opentxs::base64
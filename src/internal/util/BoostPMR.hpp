@@ -66,6 +66,8 @@ public:
     {
         return &other == this;
     }
+    /// Only available for resources which support release()
+    auto release() noexcept -> void { boost_.release(); }
 
     template <typename... Args>
     Boost(Args&&... args)
@@ -0,0 +1,88 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "opentxs/util/Allocator.hpp"
+#include "util/Metrics.hpp"
+
+namespace opentxs::alloc
+{
+/// Forwards to an upstream resource and records every allocation
+///
+/// The counters are supplied by the caller so that several resources may
+/// share them and so that their totals survive the resource which updated
+/// them.
+///
+/// Memory allocated by a Counting resource may be released by its upstream
+/// and vice versa.
+class Counting final : public Resource
+{
+public:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* final
+    {
+        allocations_->Increment();
+        bytes_->Add(bytes);
+
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void* p, std::size_t size, std::size_t alignment)
+        -> void final
+    {
+        return upstream_->deallocate(p, size, alignment);
+    }
+    auto do_is_equal(const Resource& other) const noexcept -> bool final
+    {
+        return (&other == this) || upstream_->is_equal(other);
+    }
+
+    Counting(
+        Resource* upstream,
+        std::shared_ptr<metrics::Counter> allocations,
+        std::shared_ptr<metrics::Counter> bytes) noexcept
+        : upstream_((nullptr == upstream) ? System() : upstream)
+        , allocations_(std::move(allocations))
+        , bytes_(std::move(bytes))
+    {
+    }
+    Counting(const Counting&) = delete;
+    Counting(Counting&&) = delete;
+    auto operator=(const Counting&) -> Counting& = delete;
+    auto operator=(Counting&&) -> Counting& = delete;
+
+    ~Counting() final = default;
+
+private:
+    Resource* const upstream_;
+    const std::shared_ptr<metrics::Counter> allocations_;
+    const std::shared_ptr<metrics::Counter> bytes_;
+};
+
+/// Returns a Counting resource for the specified owner
+///
+/// Objects allocated from the returned resource may safely outlive the
+/// owner which requested it. One resource exists for every combination of
+/// owner and upstream, and it remains valid until ReleaseCounted is called
+/// for that upstream.
+///
+/// Every resource for an owner updates the same pair of counters, which are
+/// exported with an owner label and retained after the resources are
+/// released so that the totals never decrease.
+auto Counted(std::string_view owner, Resource* upstream) noexcept
+    -> Resource*;
+/// Number of Counting resources which forward to upstream
+auto CountedSize(Resource* upstream) noexcept -> std::size_t;
+/// Destroys every Counting resource which forwards to upstream
+///
+/// Must be called by the owner of a resource before the resource itself is
+/// destroyed if that resource has ever been passed to Counted.
+auto ReleaseCounted(Resource* upstream) noexcept -> void;
+}  // namespace opentxs::alloc
@@ -12,6 +12,14 @@ namespace opentxs  // NOLINT
 {
 // inline namespace v1
 // {
+namespace network
+{
+namespace zeromq
+{
+class Context;
+}  // namespace zeromq
+}  // namespace network
+
 class Log;
 // }  // namespace v1
 }  // namespace opentxs
@@ -25,7 +33,9 @@ public:
     static auto Endpoint() noexcept -> const char*;
     static auto SetVerbosity(const int level) noexcept -> void;
     static auto Shutdown() noexcept -> void;
-    static auto Start() noexcept -> void;
+    /// Start the thread which formats buffered messages and sends them to
+    /// Endpoint()
+    static auto Start(const network::zeromq::Context& zmq) noexcept -> void;
 
     Log() = default;
 
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                // IWYU pragma: associated
 #include "opentxs/network/p2p/Data.hpp"  // IWYU pragma: associated
 
+#include <google/protobuf/arena.h>
 #include <memory>
 #include <stdexcept>
 #include <utility>
@@ -138,7 +139,9 @@ Data::Data(Imp* imp) noexcept
 
 auto Data::Add(ReadView data) noexcept -> bool
 {
-    const auto proto = proto::Factory<proto::BlockchainP2PSync>(data);
+    auto arena = google::protobuf::Arena{};
+    const auto& proto =
+        proto::ArenaFactory<proto::BlockchainP2PSync>(arena, data);
 
     if (false == proto::Validate(proto, VERBOSE)) { return false; }
 
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                // IWYU pragma: associated
 #include "opentxs/network/p2p/Base.hpp"  // IWYU pragma: associated
 
+#include <google/protobuf/arena.h>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -239,8 +240,10 @@ auto BlockchainSyncMessage(
                 auto height = Height{-1};
 
                 for (auto i{std::next(b.begin(), 3)}; i != b.end(); ++i) {
-                    const auto sync =
-                        proto::Factory<proto::BlockchainP2PSync>(*i);
+                    auto arena = google::protobuf::Arena{};
+                    const auto& sync =
+                        proto::ArenaFactory<proto::BlockchainP2PSync>(
+                            arena, *i);
 
                     if (false == proto::Validate(sync, VERBOSE)) {
                         throw std::runtime_error{"invalid sync data"};
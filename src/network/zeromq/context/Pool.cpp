@@ -35,7 +35,9 @@ Pool::Pool(const Context& parent) noexcept
     , batch_index_()
     , socket_index_()
 {
-    for (unsigned int n{0}; n < count_; ++n) { threads_.try_emplace(n, *this); }
+    for (unsigned int n{0}; n < count_; ++n) {
+        threads_.try_emplace(n, n, *this);
+    }
 }
 
 auto Pool::Alloc(BatchID id) noexcept -> alloc::Resource*
@@ -15,16 +15,19 @@
 #include <cerrno>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <thread>
 #include <utility>
 
 #include "internal/network/zeromq/Pool.hpp"
 #include "internal/network/zeromq/socket/Factory.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/util/CountingResource.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Signals.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
@@ -33,13 +36,25 @@
 
 namespace opentxs::network::zeromq::context
 {
-Thread::Thread(zeromq::internal::Pool& parent) noexcept
+Thread::Thread(unsigned int index, zeromq::internal::Pool& parent) noexcept
     : parent_(parent)
     , null_(factory::ZMQSocketNull())
     , alloc_()
     , gate_()
     , thread_()
     , data_()
+    , messages_metric_(metrics::Get().AddCounter(
+          "opentxs_zmq_thread_messages_total",
+          "Number of messages delivered by a zeromq pool thread",
+          {{"thread", std::to_string(index)}}))
+    , busy_metric_(metrics::Get().AddCounter(
+          "opentxs_zmq_thread_busy_microseconds_total",
+          "Time a zeromq pool thread spent executing callbacks",
+          {{"thread", std::to_string(index)}}))
+    , latency_metric_(metrics::Get().AddHistogram(
+          "opentxs_zmq_callback_seconds",
+          "Time spent executing a single zeromq callback",
+          {0.0001, 0.001, 0.01, 0.1, 1.0, 10.0}))
 {
 }
 
@@ -150,11 +165,20 @@ auto Thread::poll(Items& data) noexcept -> void
 
         if (receive_message(socket, message)) {
             const auto& callback = *c;
+            const auto start = std::chrono::steady_clock::now();
 
             try {
                 callback(std::move(message));
             } catch (...) {
             }
+
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            messages_metric_->Increment();
+            busy_metric_->Add(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                    .count()));
+            latency_metric_->Observe(
+                std::chrono::duration<double>(elapsed).count());
         }
     }
 }
@@ -276,5 +300,9 @@ auto Thread::wait() noexcept -> void
 
 Thread::Items::~Items() = default;
 
-Thread::~Thread() { wait(); }
+Thread::~Thread()
+{
+    wait();
+    alloc::ReleaseCounted(&alloc_);
+}
 }  // namespace opentxs::network::zeromq::context
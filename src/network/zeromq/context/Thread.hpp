@@ -9,6 +9,7 @@
 #include <zmq.h>
 #include <atomic>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <shared_mutex>
@@ -25,6 +26,7 @@
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/Gatekeeper.hpp"
+#include "util/Metrics.hpp"
 
 struct zmq_pollitem_t;
 
@@ -72,7 +74,7 @@ public:
         -> std::future<bool>;
     auto Shutdown() noexcept -> void;
 
-    Thread(zeromq::internal::Pool& parent) noexcept;
+    Thread(unsigned int index, zeromq::internal::Pool& parent) noexcept;
 
     ~Thread() final;
 
@@ -99,6 +101,9 @@ private:
     Gatekeeper gate_;
     Background thread_;
     Data data_;
+    const std::shared_ptr<metrics::Counter> messages_metric_;
+    const std::shared_ptr<metrics::Counter> busy_metric_;
+    const std::shared_ptr<metrics::Histogram> latency_metric_;
 
     auto join() noexcept -> void;
     auto poll(Items& data) noexcept -> void;
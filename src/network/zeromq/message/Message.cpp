@@ -14,6 +14,7 @@
 
 #include "internal/network/zeromq/message/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "network/zeromq/message/Frame.hpp"
 #include "network/zeromq/message/FrameIterator.hpp"
 #include "network/zeromq/message/FrameSection.hpp"
 #include "opentxs/core/Amount.hpp"
@@ -123,9 +124,19 @@ Message::Imp::Imp(const Imp& rhs) noexcept
 {
 }
 
+template <typename... Args>
+auto Message::Imp::emplace_frame(Args&&... args) noexcept -> Frame&
+{
+    // NOTE growing the vector moves every frame and each move allocates a
+    // replacement Frame::Imp for the moved-from frame
+    if (0u == frames_.capacity()) { frames_.reserve(reserve_frames_); }
+
+    return frames_.emplace_back(std::forward<Args>(args)...);
+}
+
 auto Message::Imp::AddFrame() noexcept -> Frame&
 {
-    return frames_.emplace_back();
+    return emplace_frame();
 }
 
 auto Message::Imp::AddFrame(const Amount& amount) noexcept -> Frame&
@@ -137,7 +148,7 @@ auto Message::Imp::AddFrame(const Amount& amount) noexcept -> Frame&
 
 auto Message::Imp::AddFrame(Frame&& frame) noexcept -> Frame&
 {
-    return frames_.emplace_back(std::move(frame));
+    return emplace_frame(std::move(frame));
 }
 
 auto Message::Imp::AddFrame(const char* in) noexcept -> Frame&
@@ -155,18 +166,19 @@ auto Message::Imp::AddFrame(const ReadView bytes) noexcept -> Frame&
 auto Message::Imp::AddFrame(const void* input, const std::size_t size) noexcept
     -> Frame&
 {
-    return frames_.emplace_back(factory::ZMQFrame(input, size));
+    return emplace_frame(std::make_unique<Frame::Imp>(input, size).release());
 }
 
 auto Message::Imp::AddFrame(const ProtobufType& input) noexcept -> Frame&
 {
-    return frames_.emplace_back(factory::ZMQFrame(input));
+    return emplace_frame(std::make_unique<Frame::Imp>(input).release());
 }
 
 auto Message::Imp::AppendBytes() noexcept -> AllocateOutput
 {
     return [this](const std::size_t size) -> WritableView {
-        auto& frame = frames_.emplace_back(factory::ZMQFrame(size));
+        auto& frame =
+            emplace_frame(std::make_unique<Frame::Imp>(size).release());
 
         return {const_cast<void*>(frame.data()), frame.size()};
     };
@@ -259,7 +271,7 @@ auto Message::Imp::EnsureDelimiter() noexcept -> void
     else if (0 < frames_.size() && !hasDivider()) {
         frames_.emplace(frames_.begin(), Frame{});
     } else if (!hasDivider()) {
-        frames_.emplace_back();
+        emplace_frame();
     }
 }
 
@@ -394,9 +406,9 @@ auto Message::Imp::set_field(
 auto Message::Imp::StartBody() noexcept -> void
 {
     if (0 == frames_.size()) {
-        frames_.emplace_back();
+        emplace_frame();
     } else if (0 < (*frames_.crbegin()).size()) {
-        frames_.emplace_back();
+        emplace_frame();
     }
 }
 
@@ -76,9 +76,16 @@ protected:
         const zeromq::Frame& input) noexcept -> bool;
 
 private:
+    // NOTE enough for the routing, delimiter, and body frames of most
+    // messages so that the vector rarely needs to grow
+    static constexpr auto reserve_frames_ = std::size_t{8};
+
     auto hasDivider() const noexcept -> bool;
     auto findDivider() const noexcept -> std::size_t;
 
+    template <typename... Args>
+    auto emplace_frame(Args&&... args) noexcept -> Frame&;
+
     Imp(Imp&&) = delete;
     auto operator=(const Imp&) -> Imp& = delete;
     auto operator=(Imp&&) -> Imp& = delete;
@@ -106,7 +106,6 @@
     reset();
 
 #define OPERATION_POLL_MILLISECONDS 100
-#define OPERATION_JOIN_MILLISECONDS OPERATION_POLL_MILLISECONDS
 #define MAX_ERROR_COUNT 3
 
 #define PREPARE_CONTEXT()                                                      \
@@ -1630,7 +1629,9 @@ auto Operation::download_box_receipt(
 
     while (false == bool(result)) {
         LogTrace()(OT_PRETTY_CLASS())("Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+
+        if (false == wait_for_context(context)) { return false; }
+
         result = context.Queue(api_, command, reason_, {});
     }
 
@@ -1803,7 +1804,7 @@ void Operation::execute()
 
     if (false == bool(result)) {
         LogTrace()(OT_PRETTY_CLASS())("Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+        wait_for_context(context);
 
         return;
     }
@@ -1877,7 +1878,7 @@ auto Operation::get_account_data(
 
     if (false == bool(result)) {
         LogTrace()(OT_PRETTY_CLASS())("Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+        wait_for_context(context);
 
         return false;
     }
@@ -2005,12 +2006,7 @@ auto Operation::IssueUnitDefinition(
     return IssueUnitDefinition(unitdefinition, args);
 }
 
-void Operation::join()
-{
-    while (State::Idle != state_.load()) {
-        Sleep(std::chrono::milliseconds(OPERATION_JOIN_MILLISECONDS));
-    }
-}
+void Operation::join() { Wait().get(); }
 
 void Operation::nymbox_post()
 {
@@ -2258,7 +2254,9 @@ auto Operation::process_inbox(
 
     while (false == bool(result)) {
         LogTrace()(OT_PRETTY_CLASS())("Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+
+        if (false == wait_for_context(context)) { return false; }
+
         result = context.Queue(api_, message, reason_, {});
     }
 
@@ -2696,7 +2694,7 @@ void Operation::transaction_numbers()
 
     if (false == bool(result)) {
         LogTrace()(OT_PRETTY_CLASS())("Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+        wait_for_context(context);
 
         return;
     }
@@ -2711,7 +2709,7 @@ void Operation::transaction_numbers()
         while (false == bool(nymbox)) {
             if (shutdown().load()) { return; }
             LogTrace()(OT_PRETTY_CLASS())("Context is busy").Flush();
-            Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+            wait_for_context(context);
             nymbox = context.RefreshNymbox(api_, reason_);
         }
 
@@ -2802,6 +2800,29 @@ auto Operation::UpdateAccount(const Identifier& accountID) -> bool
     return start(lock, otx::OperationType::RefreshAccount, {});
 }
 
+auto Operation::wait_for_context(const otx::context::Server& context) const
+    -> bool
+{
+    const auto poll = std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS);
+    const auto idle = context.InternalServer().Idle();
+    const auto busy = std::future_status::ready !=
+                      idle.wait_for(std::chrono::milliseconds{0});
+
+    // NOTE if the context was not busy then the request was rejected for some
+    // other reason and retrying immediately would spin
+    if (false == busy) {
+        Sleep(poll);
+
+        return false == shutdown().load();
+    }
+
+    while (std::future_status::ready != idle.wait_for(poll)) {
+        if (shutdown().load()) { return false; }
+    }
+
+    return true;
+}
+
 auto Operation::WithdrawCash(const Identifier& accountID, const Amount& amount)
     -> bool
 {
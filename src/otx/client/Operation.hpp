@@ -340,6 +340,7 @@ private:
         const otx::context::Server::ExtraArgs& args) -> bool;
     auto state_machine() -> bool;
     void transaction_numbers();
+    auto wait_for_context(const otx::context::Server& context) const -> bool;
 
     Operation(
         const api::session::Client& api,
@@ -64,7 +64,6 @@
 
 #define CONTRACT_DOWNLOAD_MILLISECONDS 10000
 #define NYM_REGISTRATION_MILLISECONDS 10000
-#define STATE_MACHINE_READY_MILLISECONDS 100
 
 #define DO_OPERATION(a, ...)                                                   \
     if (shutdown().load()) {                                                   \
@@ -84,7 +83,7 @@
             return false;                                                      \
         }                                                                      \
                                                                                \
-        Sleep(std::chrono::milliseconds(STATE_MACHINE_READY_MILLISECONDS));    \
+        op_.join();                                                            \
                                                                                \
         if (shutdown().load()) {                                               \
             op_.Shutdown();                                                    \
@@ -115,7 +114,7 @@
                                                                                \
             return task_done(false);                                           \
         }                                                                      \
-        Sleep(std::chrono::milliseconds(STATE_MACHINE_READY_MILLISECONDS));    \
+        op_.join();                                                            \
                                                                                \
         if (shutdown().load()) {                                               \
             op_.Shutdown();                                                    \
@@ -138,7 +137,7 @@
 
 #define SM_SHUTDOWN()                                                          \
     {                                                                          \
-        SM_YIELD(50);                                                          \
+        if (shutdown().load()) { return false; }                               \
     }
 
 #define SM_YIELD(a)                                                            \
@@ -8,12 +8,17 @@
 #include "internal/otx/common/Ledger.hpp"  // IWYU pragma: associated
 
 #include <irrxml/irrXML.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 #include <utility>
 
+#include "Generics.pb.h"
+#include "Ledger.pb.h"
+
 #include "internal/api/Legacy.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/api/session/Session.hpp"
@@ -27,6 +32,8 @@
 #include "internal/otx/common/OTTransactionType.hpp"
 #include "internal/otx/common/StringXML.hpp"
 #include "internal/otx/common/XML.hpp"
+#include "internal/otx/common/crypto/OTSignatureMetadata.hpp"
+#include "internal/otx/common/crypto/Signature.hpp"
 #include "internal/otx/common/transaction/Helpers.hpp"
 #include "internal/otx/common/util/Tag.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -40,11 +47,14 @@
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/crypto/library/HashingProvider.hpp"
 #include "opentxs/identity/Nym.hpp"
 #include "opentxs/otx/consensus/Server.hpp"
 #include "opentxs/otx/consensus/TransactionStatement.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/Time.hpp"
 #include "otx/common/OTStorage.hpp"
 
@@ -71,6 +81,57 @@ char const* const __TypeStringsLedger[] = {
                    // paymentInbox.
     "error_state"};
 
+namespace
+{
+auto attribute_reader(const Tag& tag) noexcept -> AttributeReader
+{
+    return [&tag](const char* name) -> const char* {
+        const auto& attributes = tag.attributes();
+
+        if (auto i = attributes.find(name); attributes.end() != i) {
+
+            return i->second.c_str();
+        }
+
+        return nullptr;
+    };
+}
+
+auto deserialize_tag(const OTDB::LedgerTag_InternalPB& in) noexcept -> TagPtr
+{
+    auto output = std::make_shared<Tag>(in.name(), in.text());
+
+    for (const auto& attribute : in.attribute()) {
+        output->add_attribute(attribute.key(), attribute.value());
+    }
+
+    for (const auto& child : in.tag()) {
+        auto tag = deserialize_tag(child);
+        output->add_tag(tag);
+    }
+
+    return output;
+}
+
+auto serialize_tag(const Tag& in, OTDB::LedgerTag_InternalPB& out) noexcept
+    -> void
+{
+    out.set_name(in.name());
+
+    if (false == in.text().empty()) { out.set_text(in.text()); }
+
+    for (const auto& [key, value] : in.attributes()) {
+        auto& attribute = *out.add_attribute();
+        attribute.set_key(key);
+        attribute.set_value(value);
+    }
+
+    for (const auto& child : in.tags()) {
+        serialize_tag(*child, *out.add_tag());
+    }
+}
+}  // namespace
+
 // ID refers to account ID.
 // Since a ledger is normally used as an inbox for a specific account, in a
 // specific file, then I've decided to restrict ledgers to a single account.
@@ -485,6 +546,7 @@ auto Ledger::LoadGeneric(ledgerType theType, const String& pString) -> bool
     }
 
     auto strRawFile = String::Factory();
+    bool bMigrate = false;
 
     if (pString.Exists()) {  // Loading FROM A STRING.
         strRawFile->Set(pString.Get());
@@ -513,7 +575,26 @@ auto Ledger::LoadGeneric(ledgerType theType, const String& pString) -> bool
             return false;
         }
 
+        if (is_binary(strFileContents)) {
+            const bool bLoaded = load_binary(strFileContents);
+
+            if (bLoaded) {
+                LogVerbose()(OT_PRETTY_CLASS())("Successfully loaded ")(
+                    pszType)(" from binary file: ")(
+                    path1)(api::Legacy::PathSeparator())(m_strFilename)
+                    .Flush();
+            } else {
+                LogError()(OT_PRETTY_CLASS())("Failed loading ")(
+                    pszType)(" from binary file: ")(
+                    path1)(api::Legacy::PathSeparator())(m_strFilename)
+                    .Flush();
+            }
+
+            return bLoaded;
+        }
+
         strRawFile->Set(strFileContents.c_str());
+        bMigrate = true;
     }
 
     // NOTE: No need to deal with OT ARMORED INBOX file format here, since
@@ -543,6 +624,22 @@ auto Ledger::LoadGeneric(ledgerType theType, const String& pString) -> bool
             .Flush();
     }
 
+    // Boxes still stored as armored XML are converted to the binary format the
+    // first time they are loaded. Legacy boxes which contain full receipts are
+    // left alone since their contents are rewritten once they are re-signed.
+    if (bMigrate && (false == m_bLoadedLegacyData)) {
+        auto binary = UnallocatedCString{};
+
+        if (serialize_binary(binary) &&
+            OTDB::StorePlainString(
+                api_, binary, api_.DataFolder(), path1, path2, path3, "")) {
+            LogVerbose()(OT_PRETTY_CLASS())("Converted ")(
+                pszType)(" to binary format: ")(
+                path1)(api::Legacy::PathSeparator())(m_strFilename)
+                .Flush();
+        }
+    }
+
     return bSuccess;
 }
 
@@ -560,29 +657,38 @@ auto Ledger::SaveGeneric(ledgerType theType) -> bool
         return false;
     }
 
-    auto strRawFile = String::Factory();
+    auto strFinal = UnallocatedCString{};
 
-    if (!SaveContractRaw(strRawFile)) {
-        LogError()(OT_PRETTY_CLASS())("Error saving ")(pszType)(m_strFilename)
-            .Flush();
-        return false;
-    }
+    // Ledgers whose contents were modified since they were signed can not be
+    // stored in the binary format
+    if (false == serialize_binary(strFinal)) {
+        auto strRawFile = String::Factory();
 
-    auto strFinal = String::Factory();
-    auto ascTemp = Armored::Factory(strRawFile);
+        if (!SaveContractRaw(strRawFile)) {
+            LogError()(OT_PRETTY_CLASS())("Error saving ")(pszType)(
+                m_strFilename)
+                .Flush();
+            return false;
+        }
 
-    if (false ==
-        ascTemp->WriteArmoredString(strFinal, m_strContractType->Get())) {
-        LogError()(OT_PRETTY_CLASS())("Error saving ")(
-            pszType)(" (failed writing armored string): ")(
-            path1)(api::Legacy::PathSeparator())(m_strFilename)
-            .Flush();
-        return false;
+        auto strArmored = String::Factory();
+        auto ascTemp = Armored::Factory(strRawFile);
+
+        if (false ==
+            ascTemp->WriteArmoredString(strArmored, m_strContractType->Get())) {
+            LogError()(OT_PRETTY_CLASS())("Error saving ")(
+                pszType)(" (failed writing armored string): ")(
+                path1)(api::Legacy::PathSeparator())(m_strFilename)
+                .Flush();
+            return false;
+        }
+
+        strFinal = strArmored->Get();
     }
 
     bool bSaved = OTDB::StorePlainString(
         api_,
-        strFinal->Get(),
+        strFinal,
         api_.DataFolder(),
         path1,
         path2,
@@ -656,6 +762,456 @@ auto Ledger::CalculateNymboxHash(Identifier& theOutput) const -> bool
     return CalculateHash(theOutput);
 }
 
+auto Ledger::is_binary(const UnallocatedCString& contents) noexcept -> bool
+{
+    const auto size = std::strlen(binary_prefix_);
+
+    return (contents.size() > size) &&
+           (0 == contents.compare(0, size, binary_prefix_));
+}
+
+auto Ledger::load_binary(const UnallocatedCString& contents) -> bool
+{
+    const auto prefix = std::strlen(binary_prefix_);
+    auto proto = OTDB::Ledger_InternalPB{};
+
+    OT_ASSERT(contents.size() > prefix);
+
+    if (false == proto.ParseFromArray(
+                     contents.data() + prefix,
+                     static_cast<int>(contents.size() - prefix))) {
+        LogError()(OT_PRETTY_CLASS())("Failed to deserialize ledger").Flush();
+
+        return false;
+    }
+
+    if (binary_version_ < proto.version()) {
+        LogError()(OT_PRETTY_CLASS())("Unsupported ledger version ")(
+            proto.version())
+            .Flush();
+
+        return false;
+    }
+
+    Release();
+    m_strContractType->Set(proto.contract_type().c_str());
+    m_strSigHashType = crypto::HashingProvider::StringToHashType(
+        String::Factory(proto.hash_type()));
+
+    if (crypto::HashType::Error == m_strSigHashType) {
+        LogError()(OT_PRETTY_CLASS())("Invalid hash type").Flush();
+
+        return false;
+    }
+
+    for (const auto& serialized : proto.signature()) {
+        auto& sig =
+            m_listSignatures.emplace_back(Signature::Factory(api_)).get();
+        const auto& meta = serialized.metadata();
+
+        if (false == meta.empty()) {
+            if ((4u != meta.size()) ||
+                (false == sig.getMetaData().SetMetadata(
+                              meta[0], meta[1], meta[2], meta[3]))) {
+                LogError()(OT_PRETTY_CLASS())("Invalid signature metadata")
+                    .Flush();
+
+                return false;
+            }
+        }
+
+        sig.Concatenate(String::Factory(serialized.value()));
+    }
+
+    // The signed contents are regenerated from the element tree exactly as
+    // UpdateContents would have produced them, so the signatures can only
+    // verify if the tree was not modified.
+    const auto root = deserialize_tag(proto.contents());
+    auto xml = UnallocatedCString{};
+    root->output(xml);
+    m_xmlUnsigned->Set(xml.c_str());
+
+    if (1 != load_contents(*root)) { return false; }
+
+    return SaveContract();
+}
+
+auto Ledger::load_contents(const Tag& contents) -> std::int32_t
+{
+    if ("accountLedger" != contents.name()) {
+        LogError()(OT_PRETTY_CLASS())("Unexpected element: ")(contents.name())
+            .Flush();
+
+        return (-1);
+    }
+
+    std::int32_t nPartialRecordCount{0};
+    auto strExpected = String::Factory();
+
+    if ((-1) == load_header(
+                    attribute_reader(contents),
+                    nPartialRecordCount,
+                    strExpected)) {
+
+        return (-1);
+    }
+
+    const auto& records = contents.tags();
+
+    if ((0 > nPartialRecordCount) ||
+        (records.size() != static_cast<std::size_t>(nPartialRecordCount))) {
+        LogError()(OT_PRETTY_CLASS())("Expected ")(nPartialRecordCount)(
+            " records but found ")(records.size())
+            .Flush();
+
+        return (-1);
+    }
+
+    // NOTE every abbreviated record is materialized here. Deferring this until
+    // a transaction is first accessed would change the ownership semantics of
+    // GetTransactionMap, which callers iterate and modify directly. Full
+    // receipts are still only decoded when their box receipt is loaded.
+    for (const auto& record : records) {
+        if (false == strExpected->Compare(record->name().c_str())) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Expected abbreviated record element.")
+                .Flush();
+
+            return (-1);
+        }
+
+        if ((-1) == load_record(attribute_reader(*record))) { return (-1); }
+    }
+
+    if (VerifyContractID()) {
+        return 1;
+    } else {
+        return (-1);
+    }
+}
+
+// return -1 if error, 1 if the ledger element was processed.
+auto Ledger::load_header(
+    const AttributeReader& attribute,
+    std::int32_t& nPartialRecordCount,
+    String& strExpected) -> std::int32_t
+{
+    auto strType = String::Factory(),               // ledger type
+        strLedgerAcctID = String::Factory(),        // purported
+        strLedgerAcctNotaryID = String::Factory(),  // purported
+        strNymID = String::Factory(),
+         strNumPartialRecords =
+             String::Factory();  // Ledger contains either full
+                                 // receipts, or abbreviated
+                                 // receipts with hashes and partial
+                                 // data.
+
+    strType = String::Factory(attribute("type"));
+    m_strVersion = String::Factory(attribute("version"));
+
+    if (strType->Compare("message"))  // These are used for sending
+        // transactions in messages. (Withdrawal
+        // request, etc.)
+        m_Type = ledgerType::message;
+    else if (strType->Compare("nymbox"))  // Used for receiving new
+                                          // transaction numbers, and for
+                                          // receiving notices.
+        m_Type = ledgerType::nymbox;
+    else if (strType->Compare("inbox"))  // These are used for storing the
+                                         // receipts in your inbox. (That
+                                         // server must store until
+                                         // signed-off.)
+        m_Type = ledgerType::inbox;
+    else if (strType->Compare("outbox"))  // Outgoing, pending transfers.
+        m_Type = ledgerType::outbox;
+    else if (strType->Compare("paymentInbox"))  // Receiving invoices, etc.
+        m_Type = ledgerType::paymentInbox;
+    else if (strType->Compare("recordBox"))  // Where receipts go to die
+                                             // (awaiting user deletion,
+                                             // completed from other boxes
+                                             // already.)
+        m_Type = ledgerType::recordBox;
+    else if (strType->Compare("expiredBox"))  // Where expired payments go
+                                              // to die (awaiting user
+                                              // deletion, completed from
+                                              // other boxes already.)
+        m_Type = ledgerType::expiredBox;
+    else
+        m_Type = ledgerType::error_state;  // Danger, Will Robinson.
+
+    strLedgerAcctID = String::Factory(attribute("accountID"));
+    strLedgerAcctNotaryID = String::Factory(attribute("notaryID"));
+    strNymID = String::Factory(attribute("nymID"));
+
+    if (!strLedgerAcctID->Exists() || !strLedgerAcctNotaryID->Exists() ||
+        !strNymID->Exists()) {
+        LogConsole()(OT_PRETTY_CLASS())("Failure: missing strLedgerAcctID (")(
+            strLedgerAcctID)(") or strLedgerAcctNotaryID (")(
+            strLedgerAcctNotaryID)(") or strNymID (")(
+            strNymID)(") while loading transaction from ")(strType)(" ledger.")
+            .Flush();
+        return (-1);
+    }
+
+    const auto ACCOUNT_ID = api_.Factory().Identifier(strLedgerAcctID);
+    const auto NOTARY_ID = api_.Factory().ServerID(strLedgerAcctNotaryID);
+    const auto NYM_ID = api_.Factory().NymID(strNymID);
+
+    SetPurportedAccountID(ACCOUNT_ID);
+    SetPurportedNotaryID(NOTARY_ID);
+    SetNymID(NYM_ID);
+
+    if (!m_bLoadSecurely) {
+        SetRealAccountID(ACCOUNT_ID);
+        SetRealNotaryID(NOTARY_ID);
+    }
+
+    // Load up the partial records, based on the expected count...
+    //
+    strNumPartialRecords = String::Factory(attribute("numPartialRecords"));
+    nPartialRecordCount =
+        (strNumPartialRecords->Exists() ? atoi(strNumPartialRecords->Get())
+                                        : 0);
+
+    // The record type has a different name for each box.
+    switch (m_Type) {
+        case ledgerType::nymbox:
+            strExpected.Set("nymboxRecord");
+            break;
+        case ledgerType::inbox:
+            strExpected.Set("inboxRecord");
+            break;
+        case ledgerType::outbox:
+            strExpected.Set("outboxRecord");
+            break;
+        case ledgerType::paymentInbox:
+            strExpected.Set("paymentInboxRecord");
+            break;
+        case ledgerType::recordBox:
+            strExpected.Set("recordBoxRecord");
+            break;
+        case ledgerType::expiredBox:
+            strExpected.Set("expiredBoxRecord");
+            break;
+        /* --- BREAK --- */
+        case ledgerType::message:
+            if (nPartialRecordCount > 0) {
+                LogError()(OT_PRETTY_CLASS())("Error: There are ")(
+                    nPartialRecordCount)(" unexpected abbreviated records "
+                                         "in an "
+                                         "OTLedger::message type ledger. "
+                                         "(Failed loading "
+                                         "ledger with accountID: ")(
+                    strLedgerAcctID)(").")
+                    .Flush();
+                return (-1);
+            }
+
+            break;
+        default:
+            LogError()(OT_PRETTY_CLASS())("Unexpected ledger type (")(
+                strType)("). (Failed loading "
+                         "ledger for account: ")(strLedgerAcctID)(").")
+                .Flush();
+            return (-1);
+    }  // switch (to set strExpected to the abbreviated record type.)
+
+    LogTrace()(OT_PRETTY_CLASS())("Loading account ledger of type \"")(
+        strType)("\", version: ")(m_strVersion)
+        .Flush();
+
+    return 1;
+}
+
+// return -1 if error, 1 if the record was added.
+auto Ledger::load_record(const AttributeReader& attribute) -> std::int32_t
+{
+    std::int64_t lNumberOfOrigin = 0;
+    originType theOriginType = originType::not_applicable;  // default
+    TransactionNumber number{0};
+    std::int64_t lInRefTo = 0;
+    std::int64_t lInRefDisplay = 0;
+
+    auto the_DATE_SIGNED = Time{};
+    transactionType theType = transactionType::error_state;  // default
+    auto strHash = String::Factory();
+
+    Amount lAdjustment = 0;
+    Amount lDisplayValue = 0;
+    std::int64_t lClosingNum = 0;
+    std::int64_t lRequestNum = 0;
+    bool bReplyTransSuccess = false;
+
+    // This is for "transactionType::blank" and
+    // "transactionType::successNotice" in the nymbox, otherwise nullptr.
+    NumList theNumList;
+    NumList* pNumList =
+        (ledgerType::nymbox == m_Type) ? &theNumList : nullptr;
+
+    std::int32_t nAbbrevRetVal = LoadAbbreviatedRecord(
+        attribute,
+        lNumberOfOrigin,
+        theOriginType,
+        number,
+        lInRefTo,
+        lInRefDisplay,
+        the_DATE_SIGNED,
+        theType,
+        strHash,
+        lAdjustment,
+        lDisplayValue,
+        lClosingNum,
+        lRequestNum,
+        bReplyTransSuccess,
+        pNumList);
+    if ((-1) == nAbbrevRetVal)
+        return (-1);  // The function already logs appropriately.
+
+    //
+    // See if the same-ID transaction already exists in the ledger.
+    // (There can only be one.)
+    //
+    auto pExistingTrans = GetTransaction(number);
+    if (false != bool(pExistingTrans))  // Uh-oh, it's already there!
+    {
+        const auto strPurportedAcctID =
+            String::Factory(GetPurportedAccountID());
+        LogConsole()(OT_PRETTY_CLASS())("Error loading transaction ")(
+            number)(" (")(GetTypeString())(" record), since one was already "
+                                           "there, in box for account: ")(
+            strPurportedAcctID)(".")
+            .Flush();
+        return (-1);
+    }
+
+    // CONSTRUCT THE ABBREVIATED RECEIPT HERE...
+
+    // Set all the values we just loaded here during actual construction of
+    // transaction (as abbreviated transaction) i.e. make a special
+    // constructor for abbreviated transactions which is ONLY used here.
+    //
+    auto pTransaction{api_.Factory().InternalSession().Transaction(
+        GetNymID(),
+        GetPurportedAccountID(),
+        GetPurportedNotaryID(),
+        lNumberOfOrigin,
+        static_cast<originType>(theOriginType),
+        number,
+        lInRefTo,  // lInRefTo
+        lInRefDisplay,
+        the_DATE_SIGNED,
+        static_cast<transactionType>(theType),
+        strHash,
+        lAdjustment,
+        lDisplayValue,
+        lClosingNum,
+        lRequestNum,
+        bReplyTransSuccess,
+        pNumList)};
+    OT_ASSERT(pTransaction);
+    // NOTE: For THIS CONSTRUCTOR ONLY, we DO set the purported
+    // AcctID and purported NotaryID.
+    // WHY? Normally you set the "real" IDs at construction, and
+    // then set the "purported" IDs
+    // when loading from string. But this constructor (only this
+    // one) is actually used when
+    // loading abbreviated receipts as you load their
+    // inbox/outbox/nymbox.
+    // Abbreviated receipts are not like real transactions,
+    // which have notaryID, AcctID, nymID,
+    // and signature attached, and the whole thing is
+    // base64-encoded and then added to the ledger
+    // as part of a list of contained objects. Rather, with
+    // abbreviated receipts, there are a series
+    // of XML records loaded up as PART OF the ledger itself.
+    // None of these individual XML records
+    // has its own signature, or its own record of the main IDs
+    // -- those are assumed to be on the parent
+    // ledger.
+    // That's the whole point: abbreviated records don't store
+    // redundant info, and don't each have their
+    // own signature, because we want them to be as small as
+    // possible inside their parent ledger.
+    // Therefore I will pass in the parent ledger's "real" IDs
+    // at construction, and immediately thereafter
+    // set the parent ledger's "purported" IDs onto the
+    // abbreviated transaction. That way, VerifyContractID()
+    // will still work and do its job properly with these
+    // abbreviated records.
+    //
+    // NOTE: Moved to OTTransaction constructor (for
+    // abbreviateds) for now.
+    //
+    //                    pTransaction->SetPurportedAccountID(
+    // GetPurportedAccountID());
+    //                    pTransaction->SetPurportedNotaryID(
+    // GetPurportedNotaryID());
+
+    // Add it to the ledger's list of transactions...
+    //
+
+    if (pTransaction->VerifyContractID()) {
+        // Add it to the ledger...
+        //
+        std::shared_ptr<OTTransaction> transaction{pTransaction.release()};
+        m_mapTransactions[transaction->GetTransactionNum()] = transaction;
+        transaction->SetParent(*this);
+    } else {
+        LogError()(OT_PRETTY_CLASS())(
+            "ERROR: verifying contract ID on abbreviated transaction ")(
+            pTransaction->GetTransactionNum())(".")
+            .Flush();
+        return (-1);
+    }
+
+    return 1;
+}
+
+auto Ledger::serialize_binary(UnallocatedCString& output) const -> bool
+{
+    const auto reason = api_.Factory().PasswordPrompt(__func__);
+    Tag contents("accountLedger");
+
+    if (false == generate_contents(contents, reason)) { return false; }
+
+    auto xml = UnallocatedCString{};
+    contents.output(xml);
+
+    if (0 != xml.compare(m_xmlUnsigned->Get())) {
+        LogVerbose()(OT_PRETTY_CLASS())(GetTypeString())(
+            " contents do not match the signed version")
+            .Flush();
+
+        return false;
+    }
+
+    auto proto = OTDB::Ledger_InternalPB{};
+    proto.set_version(binary_version_);
+    proto.set_contract_type(m_strContractType->Get());
+    proto.set_hash_type(
+        crypto::HashingProvider::HashTypeToString(m_strSigHashType)->Get());
+    serialize_tag(contents, *proto.mutable_contents());
+
+    for (const auto& sig : m_listSignatures) {
+        auto& serialized = *proto.add_signature();
+        const auto& meta = sig->getMetaData();
+
+        if (meta.HasMetadata()) {
+            serialized.set_metadata(UnallocatedCString{
+                meta.GetKeyType(),
+                meta.FirstCharNymID(),
+                meta.FirstCharMasterCredID(),
+                meta.FirstCharChildCredID()});
+        }
+
+        serialized.set_value(sig->Get());
+    }
+
+    output = binary_prefix_;
+
+    return proto.AppendToString(&output);
+}
+
 auto Ledger::make_filename(const ledgerType theType) -> std::
     tuple<bool, UnallocatedCString, UnallocatedCString, UnallocatedCString>
 {
@@ -1670,13 +2226,8 @@ auto Ledger::LoadLedgerFromString(const String& theStr) -> bool
     return bLoaded;
 }
 
-// SignContract will call this function at the right time.
-void Ledger::UpdateContents(const PasswordPrompt& reason)  // Before
-                                                           // transmission or
-                                                           // serialization,
-                                                           // this is where the
-                                                           // ledger saves its
-                                                           // contents
+auto Ledger::generate_contents(Tag& tag, const PasswordPrompt& reason) const
+    -> bool
 {
     switch (GetType()) {
         case ledgerType::message:
@@ -1691,7 +2242,7 @@ void Ledger::UpdateContents(const PasswordPrompt& reason)  // Before
             LogError()(OT_PRETTY_CLASS())("Error: unexpected box type (1st "
                                           "block). (This should never happen).")
                 .Flush();
-            return;
+            return false;
     }
 
     // Abbreviated for all types but OTLedger::message.
@@ -1724,11 +2275,6 @@ void Ledger::UpdateContents(const PasswordPrompt& reason)  // Before
          strLedgerAcctNotaryID = String::Factory(GetPurportedNotaryID()),
          strNymID = String::Factory(GetNymID());
 
-    // I release this because I'm about to repopulate it.
-    m_xmlUnsigned->Release();
-
-    Tag tag("accountLedger");
-
     tag.add_attribute("version", m_strVersion->Get());
     tag.add_attribute("type", strType->Get());
     tag.add_attribute("numPartialRecords", std::to_string(nPartialRecordCount));
@@ -1794,6 +2340,24 @@ void Ledger::UpdateContents(const PasswordPrompt& reason)  // Before
         }
     }
 
+    return true;
+}
+
+// SignContract will call this function at the right time.
+void Ledger::UpdateContents(const PasswordPrompt& reason)  // Before
+                                                           // transmission or
+                                                           // serialization,
+                                                           // this is where the
+                                                           // ledger saves its
+                                                           // contents
+{
+    Tag tag("accountLedger");
+
+    if (false == generate_contents(tag, reason)) { return; }
+
+    // I release this because I'm about to repopulate it.
+    m_xmlUnsigned->Release();
+
     UnallocatedCString str_result;
     tag.output(str_result);
 
@@ -1808,332 +2372,58 @@ auto Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
     const auto strNodeName = String::Factory(xml->getNodeName());
 
     if (strNodeName->Compare("accountLedger")) {
-        auto strType = String::Factory(),               // ledger type
-            strLedgerAcctID = String::Factory(),        // purported
-            strLedgerAcctNotaryID = String::Factory(),  // purported
-            strNymID = String::Factory(),
-             strNumPartialRecords =
-                 String::Factory();  // Ledger contains either full
-                                     // receipts, or abbreviated
-                                     // receipts with hashes and partial
-                                     // data.
-
-        strType = String::Factory(xml->getAttributeValue("type"));
-        m_strVersion = String::Factory(xml->getAttributeValue("version"));
-
-        if (strType->Compare("message"))  // These are used for sending
-            // transactions in messages. (Withdrawal
-            // request, etc.)
-            m_Type = ledgerType::message;
-        else if (strType->Compare("nymbox"))  // Used for receiving new
-                                              // transaction numbers, and for
-                                              // receiving notices.
-            m_Type = ledgerType::nymbox;
-        else if (strType->Compare("inbox"))  // These are used for storing the
-                                             // receipts in your inbox. (That
-                                             // server must store until
-                                             // signed-off.)
-            m_Type = ledgerType::inbox;
-        else if (strType->Compare("outbox"))  // Outgoing, pending transfers.
-            m_Type = ledgerType::outbox;
-        else if (strType->Compare("paymentInbox"))  // Receiving invoices, etc.
-            m_Type = ledgerType::paymentInbox;
-        else if (strType->Compare("recordBox"))  // Where receipts go to die
-                                                 // (awaiting user deletion,
-                                                 // completed from other boxes
-                                                 // already.)
-            m_Type = ledgerType::recordBox;
-        else if (strType->Compare("expiredBox"))  // Where expired payments go
-                                                  // to die (awaiting user
-                                                  // deletion, completed from
-                                                  // other boxes already.)
-            m_Type = ledgerType::expiredBox;
-        else
-            m_Type = ledgerType::error_state;  // Danger, Will Robinson.
-
-        strLedgerAcctID = String::Factory(xml->getAttributeValue("accountID"));
-        strLedgerAcctNotaryID =
-            String::Factory(xml->getAttributeValue("notaryID"));
-        strNymID = String::Factory(xml->getAttributeValue("nymID"));
-
-        if (!strLedgerAcctID->Exists() || !strLedgerAcctNotaryID->Exists() ||
-            !strNymID->Exists()) {
-            LogConsole()(OT_PRETTY_CLASS())(
-                "Failure: missing strLedgerAcctID (")(
-                strLedgerAcctID)(") or strLedgerAcctNotaryID (")(
-                strLedgerAcctNotaryID)(") or strNymID (")(
-                strNymID)(") while loading transaction from ")(
-                strType)(" ledger.")
-                .Flush();
-            return (-1);
-        }
-
-        const auto ACCOUNT_ID = api_.Factory().Identifier(strLedgerAcctID);
-        const auto NOTARY_ID = api_.Factory().ServerID(strLedgerAcctNotaryID);
-        const auto NYM_ID = api_.Factory().NymID(strNymID);
+        const AttributeReader attribute = [&](const char* name) {
+            return xml->getAttributeValue(name);
+        };
+        std::int32_t nPartialRecordCount{0};
+        auto strExpected = String::Factory();  // The record type has a
+                                               // different name for each box.
 
-        SetPurportedAccountID(ACCOUNT_ID);
-        SetPurportedNotaryID(NOTARY_ID);
-        SetNymID(NYM_ID);
+        if ((-1) == load_header(attribute, nPartialRecordCount, strExpected)) {
 
-        if (!m_bLoadSecurely) {
-            SetRealAccountID(ACCOUNT_ID);
-            SetRealNotaryID(NOTARY_ID);
+            return (-1);
         }
 
-        // Load up the partial records, based on the expected count...
+        // message ledger will never enter this loop due to load_header
+        // (above.)
         //
-        strNumPartialRecords =
-            String::Factory(xml->getAttributeValue("numPartialRecords"));
-        std::int32_t nPartialRecordCount =
-            (strNumPartialRecords->Exists() ? atoi(strNumPartialRecords->Get())
-                                            : 0);
-
-        auto strExpected = String::Factory();  // The record type has a
-                                               // different name for each box.
-        NumList theNumList;
-        NumList* pNumList = nullptr;
-        switch (m_Type) {
-            case ledgerType::nymbox:
-                strExpected->Set("nymboxRecord");
-                pNumList = &theNumList;
-                break;
-            case ledgerType::inbox:
-                strExpected->Set("inboxRecord");
-                break;
-            case ledgerType::outbox:
-                strExpected->Set("outboxRecord");
-                break;
-            case ledgerType::paymentInbox:
-                strExpected->Set("paymentInboxRecord");
-                break;
-            case ledgerType::recordBox:
-                strExpected->Set("recordBoxRecord");
-                break;
-            case ledgerType::expiredBox:
-                strExpected->Set("expiredBoxRecord");
-                break;
-            /* --- BREAK --- */
-            case ledgerType::message:
-                if (nPartialRecordCount > 0) {
-                    LogError()(OT_PRETTY_CLASS())("Error: There are ")(
-                        nPartialRecordCount)(" unexpected abbreviated records "
-                                             "in an "
-                                             "OTLedger::message type ledger. "
-                                             "(Failed loading "
-                                             "ledger with accountID: ")(
-                        strLedgerAcctID)(").")
-                        .Flush();
-                    return (-1);
-                }
-
-                break;
-            default:
-                LogError()(OT_PRETTY_CLASS())("Unexpected ledger type (")(
-                    strType)("). (Failed loading "
-                             "ledger for account: ")(strLedgerAcctID)(").")
+        // We iterate to read the expected number of partial records from
+        // the xml.
+        // (They had better be there...)
+        //
+        while (nPartialRecordCount-- > 0) {
+            if (!SkipToElement(xml)) {
+                LogConsole()(OT_PRETTY_CLASS())(
+                    "Failure: Unable to find element when "
+                    "one was expected (")(
+                    strExpected)(") for abbreviated record of receipt in ")(
+                    GetTypeString())(" box: ")(m_strRawFile)(".")
                     .Flush();
                 return (-1);
-        }  // switch (to set strExpected to the abbreviated record type.)
-
-        if (nPartialRecordCount > 0)  // message ledger will never enter this
-                                      // block due to switch block (above.)
-        {
+            }
 
-            // We iterate to read the expected number of partial records from
-            // the xml.
-            // (They had better be there...)
+            // strExpected can be one of:
             //
-            while (nPartialRecordCount-- > 0) {
-                //                xml->read(); // <==================
-                if (!SkipToElement(xml)) {
-                    LogConsole()(OT_PRETTY_CLASS())(
-                        "Failure: Unable to find element when "
-                        "one was expected (")(
-                        strExpected)(") for abbreviated record of receipt in ")(
-                        GetTypeString())(" box: ")(m_strRawFile)(".")
-                        .Flush();
-                    return (-1);
-                }
-
-                // strExpected can be one of:
-                //
-                //                strExpected.Set("nymboxRecord");
-                //                strExpected.Set("inboxRecord");
-                //                strExpected.Set("outboxRecord");
-                //
-                // We're loading here either a nymboxRecord, inboxRecord, or
-                // outboxRecord...
-                //
-                const auto strLoopNodeName =
-                    String::Factory(xml->getNodeName());
-
-                if (strLoopNodeName->Exists() &&
-                    (xml->getNodeType() == irr::io::EXN_ELEMENT) &&
-                    (strExpected->Compare(strLoopNodeName))) {
-                    std::int64_t lNumberOfOrigin = 0;
-                    originType theOriginType =
-                        originType::not_applicable;  // default
-                    TransactionNumber number{0};
-                    std::int64_t lInRefTo = 0;
-                    std::int64_t lInRefDisplay = 0;
-
-                    auto the_DATE_SIGNED = Time{};
-                    transactionType theType =
-                        transactionType::error_state;  // default
-                    auto strHash = String::Factory();
-
-                    Amount lAdjustment = 0;
-                    Amount lDisplayValue = 0;
-                    std::int64_t lClosingNum = 0;
-                    std::int64_t lRequestNum = 0;
-                    bool bReplyTransSuccess = false;
-
-                    std::int32_t nAbbrevRetVal = LoadAbbreviatedRecord(
-                        xml,
-                        lNumberOfOrigin,
-                        theOriginType,
-                        number,
-                        lInRefTo,
-                        lInRefDisplay,
-                        the_DATE_SIGNED,
-                        theType,
-                        strHash,
-                        lAdjustment,
-                        lDisplayValue,
-                        lClosingNum,
-                        lRequestNum,
-                        bReplyTransSuccess,
-                        pNumList);  // This is for "transactionType::blank" and
-                                    // "transactionType::successNotice",
-                                    // otherwise nullptr.
-                    if ((-1) == nAbbrevRetVal)
-                        return (-1);  // The function already logs
-                                      // appropriately.
-
-                    //
-                    // See if the same-ID transaction already exists in the
-                    // ledger.
-                    // (There can only be one.)
-                    //
-                    auto pExistingTrans = GetTransaction(number);
-                    if (false != bool(pExistingTrans))  // Uh-oh, it's already
-                                                        // there!
-                    {
-                        LogConsole()(OT_PRETTY_CLASS())(
-                            "Error loading transaction ")(number)(" (")(
-                            strExpected)("), since one was already there, in "
-                                         "box for "
-                                         "account: ")(strLedgerAcctID)(".")
-                            .Flush();
-                        return (-1);
-                    }
-
-                    // CONSTRUCT THE ABBREVIATED RECEIPT HERE...
-
-                    // Set all the values we just loaded here during actual
-                    // construction of transaction
-                    // (as abbreviated transaction) i.e. make a special
-                    // constructor for abbreviated transactions
-                    // which is ONLY used here.
-                    //
-                    auto pTransaction{
-                        api_.Factory().InternalSession().Transaction(
-                            NYM_ID,
-                            ACCOUNT_ID,
-                            NOTARY_ID,
-                            lNumberOfOrigin,
-                            static_cast<originType>(theOriginType),
-                            number,
-                            lInRefTo,  // lInRefTo
-                            lInRefDisplay,
-                            the_DATE_SIGNED,
-                            static_cast<transactionType>(theType),
-                            strHash,
-                            lAdjustment,
-                            lDisplayValue,
-                            lClosingNum,
-                            lRequestNum,
-                            bReplyTransSuccess,
-                            pNumList)};  // This is for "transactionType::blank"
-                                         // and
-                                         // "transactionType::successNotice",
-                                         // otherwise nullptr.
-                    OT_ASSERT(pTransaction);
-                    //
-                    // NOTE: For THIS CONSTRUCTOR ONLY, we DO set the purported
-                    // AcctID and purported NotaryID.
-                    // WHY? Normally you set the "real" IDs at construction, and
-                    // then set the "purported" IDs
-                    // when loading from string. But this constructor (only this
-                    // one) is actually used when
-                    // loading abbreviated receipts as you load their
-                    // inbox/outbox/nymbox.
-                    // Abbreviated receipts are not like real transactions,
-                    // which have notaryID, AcctID, nymID,
-                    // and signature attached, and the whole thing is
-                    // base64-encoded and then added to the ledger
-                    // as part of a list of contained objects. Rather, with
-                    // abbreviated receipts, there are a series
-                    // of XML records loaded up as PART OF the ledger itself.
-                    // None of these individual XML records
-                    // has its own signature, or its own record of the main IDs
-                    // -- those are assumed to be on the parent
-                    // ledger.
-                    // That's the whole point: abbreviated records don't store
-                    // redundant info, and don't each have their
-                    // own signature, because we want them to be as small as
-                    // possible inside their parent ledger.
-                    // Therefore I will pass in the parent ledger's "real" IDs
-                    // at construction, and immediately thereafter
-                    // set the parent ledger's "purported" IDs onto the
-                    // abbreviated transaction. That way, VerifyContractID()
-                    // will still work and do its job properly with these
-                    // abbreviated records.
-                    //
-                    // NOTE: Moved to OTTransaction constructor (for
-                    // abbreviateds) for now.
-                    //
-                    //                    pTransaction->SetPurportedAccountID(
-                    // GetPurportedAccountID());
-                    //                    pTransaction->SetPurportedNotaryID(
-                    // GetPurportedNotaryID());
-
-                    // Add it to the ledger's list of transactions...
-                    //
-
-                    if (pTransaction->VerifyContractID()) {
-                        // Add it to the ledger...
-                        //
-                        std::shared_ptr<OTTransaction> transaction{
-                            pTransaction.release()};
-                        m_mapTransactions[transaction->GetTransactionNum()] =
-                            transaction;
-                        transaction->SetParent(*this);
-                    } else {
-                        LogError()(OT_PRETTY_CLASS())(
-                            "ERROR: verifying contract ID on "
-                            "abbreviated transaction ")(
-                            pTransaction->GetTransactionNum())(".")
-                            .Flush();
-                        return (-1);
-                    }
-                    //                    xml->read(); // <==================
-                    // MIGHT need to add "skip after element" here.
-                    //
-                    // Update: Nope.
-                } else {
-                    LogError()(OT_PRETTY_CLASS())(
-                        "Expected abbreviated record element.")
-                        .Flush();
-                    return (-1);  // error condition
-                }
-            }  // while
-        }      // if (number of partial records > 0)
+            //                strExpected.Set("nymboxRecord");
+            //                strExpected.Set("inboxRecord");
+            //                strExpected.Set("outboxRecord");
+            //
+            // We're loading here either a nymboxRecord, inboxRecord, or
+            // outboxRecord...
+            //
+            const auto strLoopNodeName = String::Factory(xml->getNodeName());
 
-        LogTrace()(OT_PRETTY_CLASS())("Loading account ledger of type \"")(
-            strType)("\", version: ")(m_strVersion)
-            .Flush();
+            if (strLoopNodeName->Exists() &&
+                (xml->getNodeType() == irr::io::EXN_ELEMENT) &&
+                (strExpected->Compare(strLoopNodeName))) {
+                if ((-1) == load_record(attribute)) { return (-1); }
+            } else {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Expected abbreviated record element.")
+                    .Flush();
+                return (-1);  // error condition
+            }
+        }  // while
 
         // Since we just loaded this stuff, let's verify it. We may have to
         // remove this verification here and do it outside this call. But for
@@ -716,6 +716,46 @@ auto QueryPlainString(
         threeStr);
 }
 
+auto AppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& strContents,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    auto ot_strFolder = String::Factory(strFolder),
+         ot_oneStr = String::Factory(oneStr),
+         ot_twoStr = String::Factory(twoStr),
+         ot_threeStr = String::Factory(threeStr);
+    OT_ASSERT_MSG(
+        ot_strFolder->Exists(), "OTDB::AppendPlainString: strFolder is null");
+
+    if (!ot_oneStr->Exists()) {
+        OT_ASSERT_MSG(
+            (!ot_twoStr->Exists() && !ot_threeStr->Exists()),
+            "OTDB::AppendPlainString: bad options");
+        ot_oneStr = String::Factory(strFolder.c_str());
+        ot_strFolder = String::Factory(".");
+    }
+    Storage* pStorage = details::s_pStorage;
+
+    OT_ASSERT((strFolder.length() > 3) || (0 == strFolder.compare(0, 1, ".")));
+    OT_ASSERT((oneStr.length() < 1) || (oneStr.length() > 3));
+
+    if (nullptr == pStorage) { return false; }
+
+    return pStorage->AppendPlainString(
+        api,
+        strContents,
+        dataFolder,
+        ot_strFolder->Get(),
+        ot_oneStr->Get(),
+        twoStr,
+        threeStr);
+}
+
 // Store/Retrieve an object. (Storable.)
 
 auto StoreObject(
@@ -2335,6 +2375,19 @@ auto Storage::QueryPlainString(
     return theString;
 }
 
+auto Storage::AppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& strContents,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    return onAppendPlainString(
+        api, strContents, dataFolder, strFolder, oneStr, twoStr, threeStr);
+}
+
 auto Storage::StoreObject(
     const api::Session& api,
     Storable& theContents,
@@ -2920,6 +2973,43 @@ auto StorageFS::onQueryPlainString(
     return bSuccess;
 }
 
+auto StorageFS::onAppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& theBuffer,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    UnallocatedCString strOutput;
+
+    if (0 >
+        ConstructAndCreatePath(
+            api, strOutput, dataFolder, strFolder, oneStr, twoStr, threeStr)) {
+        LogError()(OT_PRETTY_CLASS())("Error writing to ")(strOutput)(".")
+            .Flush();
+        return false;
+    }
+
+    std::ofstream ofs(
+        strOutput.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+
+    if (ofs.fail()) {
+        LogError()(OT_PRETTY_CLASS())("Error opening file: ")(strOutput)(".")
+            .Flush();
+        return false;
+    }
+
+    ofs.clear();
+    ofs << theBuffer;
+    ofs.flush();
+    bool bSuccess = ofs.good();
+    ofs.close();
+
+    return bSuccess;
+}
+
 // Erase a value by location.
 //
 auto StorageFS::onEraseValueByKey(
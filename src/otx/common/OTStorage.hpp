@@ -442,6 +442,15 @@ protected:
         const UnallocatedCString& twoStr,
         const UnallocatedCString& threeStr) = 0;
 
+    virtual bool onAppendPlainString(
+        const api::Session& api,
+        const UnallocatedCString& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) = 0;
+
     virtual bool onEraseValueByKey(
         const api::Session& api,
         const UnallocatedCString& dataFolder,
@@ -524,6 +533,16 @@ public:
         const UnallocatedCString& twoStr,
         const UnallocatedCString& threeStr);
 
+    // Appends to the end of the location instead of replacing it
+    bool AppendPlainString(
+        const api::Session& api,
+        const UnallocatedCString& strContents,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr);
+
     // Store/Retrieve an object. (Storable.)
 
     bool StoreObject(
@@ -667,6 +686,16 @@ UnallocatedCString QueryPlainString(
     const UnallocatedCString& twoStr,
     const UnallocatedCString& threeStr);
 
+// Appends to the end of the location instead of replacing it
+bool AppendPlainString(
+    const api::Session& api,
+    const UnallocatedCString& strContents,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr);
+
 // Store/Retrieve an object. (Storable.)
 //
 bool StoreObject(
@@ -1747,6 +1776,15 @@ protected:
         const UnallocatedCString& twoStr,
         const UnallocatedCString& threeStr) override;
 
+    bool onAppendPlainString(
+        const api::Session& api,
+        const UnallocatedCString& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+
     bool onEraseValueByKey(
         const api::Session& api,
         const UnallocatedCString& dataFolder,
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "internal/otx/common/cron/OTCron.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -264,8 +265,8 @@ auto OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
 
         pMarketData->last_sale_date = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const std::size_t theBidCount = pMarket->GetBidCount();
+        const std::size_t theAskCount = pMarket->GetAskCount();
 
         pMarketData->number_bids = std::to_string(theBidCount);
         pMarketData->number_asks = std::to_string(theAskCount);
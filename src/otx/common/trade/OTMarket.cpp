@@ -12,6 +12,8 @@
 #include <cstring>
 #include <iterator>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <utility>
 
 #include "internal/api/Legacy.hpp"
@@ -28,6 +30,7 @@
 #include "internal/otx/common/XML.hpp"
 #include "internal/otx/common/cron/OTCron.hpp"
 #include "internal/otx/common/cron/OTCronItem.hpp"
+#include "internal/otx/common/crypto/OTSignedFile.hpp"
 #include "internal/otx/common/trade/OTOffer.hpp"
 #include "internal/otx/common/trade/OTTrade.hpp"
 #include "internal/otx/common/util/Common.hpp"
@@ -57,9 +60,8 @@ OTMarket::OTMarket(const api::Session& api, const char* szFilename)
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , m_Book()
+    , m_nJournalEntries(0)
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
     , m_CURRENCY_TYPE_ID(identifier::UnitDefinition::Factory())
@@ -78,9 +80,8 @@ OTMarket::OTMarket(const api::Session& api)
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , m_Book()
+    , m_nJournalEntries(0)
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
     , m_CURRENCY_TYPE_ID(identifier::UnitDefinition::Factory())
@@ -100,9 +101,8 @@ OTMarket::OTMarket(
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , m_Book()
+    , m_nJournalEntries(0)
     , m_NOTARY_ID(NOTARY_ID)
     , m_INSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID)
     , m_CURRENCY_TYPE_ID(CURRENCY_TYPE_ID)
@@ -236,37 +236,20 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
         return buf;
     }());
 
-    // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
+    // Save the offers for sale, then the bids.
+    m_Book.VisitAll([&](OTOffer& offer) {
+        auto strOffer = String::Factory(offer);  // Extract the offer contract
+                                                 // into string form.
         auto ascOffer =
             Armored::Factory(strOffer);  // Base64-encode that for storage.
 
         TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
         tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
+            "dateAdded", formatTimestamp(offer.GetDateAddedToMarket()));
         tag.add_tag(tagOffer);
-    }
-
-    // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
 
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer =
-            Armored::Factory(strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
-    }
+        return true;
+    });
 
     UnallocatedCString str_result;
     tag.output(str_result);
@@ -276,16 +259,7 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
 
 auto OTMarket::GetTotalAvailableAssets() -> Amount
 {
-    Amount lTotal = 0;
-
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        lTotal += pOffer->GetAmountAvailable();
-    }
-
-    return lTotal;
+    return m_Book.TotalAsks();
 }
 
 // Get list of offers for a particular Nym, to send that Nym
@@ -301,9 +275,8 @@ auto OTMarket::GetNym_OfferList(
     // Loop through the offers, up to some maximum depth, and then add each
     // as a data member to an offer list, then pack it into ascOutput.
     //
-    for (auto& it : m_mapOffers) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    m_Book.VisitAll([&](OTOffer& offer) {
+        OTOffer* pOffer = &offer;
 
         OTTrade* pTrade = pOffer->GetTrade();
 
@@ -311,7 +284,7 @@ auto OTMarket::GetNym_OfferList(
         // info only for that Nym.
         //
         if ((nullptr == pTrade) || (pTrade->GetSenderNymID() != NYM_ID)) {
-            continue;
+            return true;
         }
 
         // Below this point, I KNOW pTrade and pOffer are both good pointers.
@@ -410,7 +383,9 @@ auto OTMarket::GetNym_OfferList(
         //
         theOutputList.AddOfferDataNym(*pOfferData);
         nNymOfferCount++;
-    }
+
+        return true;
+    });
 
     return true;
 }
@@ -501,24 +476,16 @@ auto OTMarket::GetOfferList(
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
-
+    // The order book only visits limit orders, so market orders are skipped.
+    // Both sides are visited starting from the best price.
     std::int32_t nTempDepth = 0;
 
-    for (auto& it : m_mapBids) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    m_Book.VisitBids([&](OTOffer& offer) {
+        if (nTempDepth++ > lDepth) return false;
 
+        OTOffer* pOffer = &offer;
         const Amount& lPriceLimit = pOffer->GetPriceLimit();
 
-        if (0 == lPriceLimit)  // Skipping any market orders.
-            continue;
-
         // OfferDataMarket
         std::unique_ptr<OTDB::BidData> pOfferData(dynamic_cast<OTDB::BidData*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
@@ -552,15 +519,16 @@ auto OTMarket::GetOfferList(
         //
         pOfferList->AddBidData(*pOfferData);
         nOfferCount++;
-    }
+
+        return true;
+    });
 
     nTempDepth = 0;
 
-    for (auto& it : m_mapAsks) {
-        if (nTempDepth++ > lDepth) break;
+    m_Book.VisitAsks([&](OTOffer& offer) {
+        if (nTempDepth++ > lDepth) return false;
 
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+        OTOffer* pOffer = &offer;
 
         // OfferDataMarket"
         std::unique_ptr<OTDB::AskData> pOfferData(dynamic_cast<OTDB::AskData*>(
@@ -596,7 +564,9 @@ auto OTMarket::GetOfferList(
         //
         pOfferList->AddAskData(*pOfferData);
         nOfferCount++;
-    }
+
+        return true;
+    });
 
     // Now pack the list into strOutput...
 
@@ -642,44 +612,21 @@ auto OTMarket::GetOfferList(
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef UnallocatedMultimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
-
 auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
 {
-    // See if there's something there with that transaction number.
-    auto it = m_mapOffers.find(lTransactionNum);
-
-    if (it == m_mapOffers.end()) {
-        // nothing found.
-        return nullptr;
-    }
-    // Found it!
-    else {
-        OTOffer* pOffer = it->second;
+    OTOffer* pOffer = m_Book.Find(lTransactionNum);
 
-        OT_ASSERT((nullptr != pOffer));
+    if ((nullptr != pOffer) && (pOffer->GetTransactionNum() != lTransactionNum)) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Expected Offer with transaction number ")(
+            lTransactionNum)(", but found ")(pOffer->GetTransactionNum())(
+            " inside. Bad data?")
+            .Flush();
 
-        if (pOffer->GetTransactionNum() == lTransactionNum)
-            return pOffer;
-        else
-            LogError()(OT_PRETTY_CLASS())(
-                "Expected Offer with transaction number ")(
-                lTransactionNum)(", but found ")(pOffer->GetTransactionNum())(
-                " inside. Bad data?")
-                .Flush();
+        return nullptr;
     }
 
-    return nullptr;
+    return pOffer;
 }
 
 // if false, offer wasn't found.
@@ -687,88 +634,24 @@ auto OTMarket::RemoveOffer(
     const std::int64_t& lTransactionNum,
     const PasswordPrompt& reason) -> bool
 {
-    bool bReturnValue = false;
-
-    // See if there's something there with that transaction number.
-    auto it = m_mapOffers.find(lTransactionNum);
+    // The order book locates the offer by transaction number and unlinks it
+    // from its price level without searching.
+    OTOffer* pOffer = m_Book.Remove(lTransactionNum);
 
     // If it's not already on the list, then there's nothing to remove.
-    if (it == m_mapOffers.end()) {
+    if (nullptr == pOffer) {
         LogError()(OT_PRETTY_CLASS())(
             "Attempt to remove non-existent Offer from Market. "
             "Transaction #: ")(lTransactionNum)(".")
             .Flush();
         return false;
     }
-    // Otherwise, if it WAS already there, remove it properly.
-    else {
-        OTOffer* pOffer = it->second;
 
-        OT_ASSERT(nullptr != pOffer);
-
-        // This removes it from one list (the one indexed by transaction
-        // number.)
-        // But it's still on one of the other lists...
-        m_mapOffers.erase(it);
-
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
-
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
-
-        for (auto iii = pMap->begin(); iii != pMap->end(); ++iii) {
-            pSameOffer = iii->second;
-
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
-
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
+    delete pOffer;
+    pOffer = nullptr;
 
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
-
-        if (nullptr == pSameOffer) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Removed offer from offers list, but not found on bid/ask "
-                "list.")
-                .Flush();
-        } else  // This means it was found and removed from the second list as
-                // well.
-        {
-            bReturnValue = true;  // Success.
-        }
-
-        // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
-        // They SHOULD be pointers to the SAME object.
-        // Therefore I CANNOT delete them both.
-        //
-        OT_ASSERT(pOffer == pSameOffer);
-
-        delete pOffer;
-        pOffer = nullptr;
-        pSameOffer = nullptr;
-    }
-
-    if (bReturnValue)
-        return SaveMarket(reason);  // <====== SAVE since an offer was removed.
-    else
-        return false;
+    // <====== SAVE since an offer was removed.
+    return append_journal("remove", std::to_string(lTransactionNum), {}, reason);
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -796,24 +679,18 @@ auto OTMarket::AddOffer(
 
         if (nullptr != pTrade) pTrade->FlagForRemoval();
     } else {
-        // I store duplicate lists of offer pointers. Two multimaps ordered by
-        // price,
-        // (for buyers and sellers) and one map ordered by transaction number.
-
-        // See if there's something else already there with the same transaction
-        // number.
-        //
-        auto it = m_mapOffers.find(lTransactionNum);
-
-        // If it's not already on the list, then add it...
-        if (it == m_mapOffers.end()) {
-            m_mapOffers[lTransactionNum] = &theOffer;
-            LogTrace()(OT_PRETTY_CLASS())(
-                "Offer added as an offer to the market.")
-                .Flush();
-        }
-        // Otherwise, if it was already there, log an error.
-        else {
+        // The order book indexes the offer by transaction number and appends
+        // it to the end of the queue for its price level, so offers at the
+        // same price are always processed in the order they were received.
+        const auto side = theOffer.IsBid() ? OTOrderBook::Side::Bid
+                                           : OTOrderBook::Side::Ask;
+
+        if (!m_Book.Add(
+                lTransactionNum,
+                side,
+                lPriceLimit,
+                theOffer.GetAmountAvailable(),
+                &theOffer)) {
             LogError()(OT_PRETTY_CLASS())(
                 "Attempt to add Offer to Market with pre-existing "
                 "transaction number: ")(lTransactionNum)(".")
@@ -821,44 +698,20 @@ auto OTMarket::AddOffer(
             return false;
         }
 
-        // Okay so we successfully added it to one list (indexed by Transaction
-        // Num) and we
-        // know it validated as an offer, AND we know it wasn't already on the
-        // market.
-        //
-        // So next, let's add it to the lists that are indexed by price:
-
-        // Determine if it's a buy or sell, and add it to the right list.
-        if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
-            LogTrace()(OT_PRETTY_CLASS())("Offer added as a bid to the market.")
-                .Flush();
-        } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
-            LogTrace()(OT_PRETTY_CLASS())(
-                "Offer added as an ask to the market.")
-                .Flush();
-        }
+        LogTrace()(OT_PRETTY_CLASS())("Offer added as ")(
+            theOffer.IsBid() ? "a bid" : "an ask")(" to the market.")
+            .Flush();
 
         if (bSaveFile) {
             // Set this to the current date/time, since the offer is
             // being added for the first time.
             //
+            // The offer is not journaled here. The caller signs it with the
+            // server nym and then calls SaveOffer, so that every offer is
+            // journaled exactly once and only in its server-signed form.
             theOffer.SetDateAddedToMarket(Clock::now());
 
-            return SaveMarket(reason);  // <====== SAVE since an offer
-                                        // was added to the Market.
+            return true;
         } else {
             // Set this to the date passed in, since this offer was
             // added to the market in the past, and we are preserving that date.
@@ -871,6 +724,245 @@ auto OTMarket::AddOffer(
     return false;
 }
 
+// The market is persisted as a signed snapshot plus an append-only journal.
+// Every change to the order book appends one record to the journal instead of
+// rewriting the entire market. Once the journal grows past
+// MAX_MARKET_JOURNAL_ENTRIES the snapshot is rewritten and the journal is
+// truncated.
+//
+// Each record is a signed file, signed by the server nym and bound to the
+// journal of this market, framed as:
+//
+//     <signed file size>\n<signed file>\n
+//
+// The payload of the signed file is:
+//
+//     <type> <argument> <payload size>\n<payload>
+//
+// offer:  argument is the date added to market, payload is the offer contract
+// remove: argument is the transaction number, payload is empty
+// sale:   argument is the last sale price, payload is the last sale date
+//
+// Replaying a record more than once has no additional effect, so a crash
+// between rewriting the snapshot and truncating the journal is harmless.
+auto OTMarket::append_journal(
+    const char* type,
+    const UnallocatedCString& argument,
+    const UnallocatedCString& payload,
+    const PasswordPrompt& reason) -> bool
+{
+    OT_ASSERT(nullptr != GetCron());
+    OT_ASSERT(nullptr != GetCron()->GetServerNym());
+
+    if (MAX_MARKET_JOURNAL_ENTRIES <= m_nJournalEntries) {
+
+        return SaveMarket(reason);
+    }
+
+    const auto MARKET_ID = Identifier::Factory(*this);
+    const auto str_MARKET_ID = String::Factory(MARKET_ID);
+    const char* szFoldername = api_.Internal().Legacy().Market();
+    const char* szSubFolder = "journal";  // todo stop hardcoding.
+
+    auto body = UnallocatedCString{type};
+    body.reserve(body.size() + argument.size() + payload.size() + 32u);
+    body.append(" ");
+    body.append(argument);
+    body.append(" ");
+    body.append(std::to_string(payload.size()));
+    body.append("\n");
+    body.append(payload);
+
+    auto signedRecord =
+        api_.Factory().InternalSession().SignedFile(szSubFolder, str_MARKET_ID);
+    signedRecord->SetFilePayload(String::Factory(body));
+    signedRecord->SetSignerNymID(
+        String::Factory(GetCron()->GetServerNym()->ID()));
+
+    if (!signedRecord->SignContract(*(GetCron()->GetServerNym()), reason) ||
+        !signedRecord->SaveContract()) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Error signing journal record for Market: ")(
+            str_MARKET_ID)(". Saving full market instead.")
+            .Flush();
+
+        return SaveMarket(reason);
+    }
+
+    const auto contract = String::Factory(*signedRecord);
+    auto record = std::to_string(contract->GetLength());
+    record.reserve(record.size() + contract->GetLength() + 2u);
+    record.append("\n");
+    record.append(contract->Get());
+    record.append("\n");
+
+    if (!OTDB::AppendPlainString(
+            api_,
+            record,
+            api_.DataFolder(),
+            szFoldername,  // markets
+            szSubFolder,   // markets/journal
+            str_MARKET_ID->Get(),
+            "")) {  // markets/journal/<Market_ID>
+        LogError()(OT_PRETTY_CLASS())("Error appending to journal for Market: ")(
+            str_MARKET_ID)(". Saving full market instead.")
+            .Flush();
+
+        return SaveMarket(reason);
+    }
+
+    ++m_nJournalEntries;
+
+    return true;
+}
+
+auto OTMarket::load_journal(const UnallocatedCString& marketID) -> bool
+{
+    OT_ASSERT(nullptr != GetCron());
+    OT_ASSERT(nullptr != GetCron()->GetServerNym());
+
+    const char* szFoldername = api_.Internal().Legacy().Market();
+    const char* szSubFolder = "journal";  // todo stop hardcoding.
+    m_nJournalEntries = 0;
+
+    if (!OTDB::Exists(
+            api_,
+            api_.DataFolder(),
+            szFoldername,
+            szSubFolder,
+            marketID,
+            "")) {
+
+        return true;
+    }
+
+    const auto journal = OTDB::QueryPlainString(
+        api_, api_.DataFolder(), szFoldername, szSubFolder, marketID, "");
+    const auto& serverNym = *(GetCron()->GetServerNym());
+    auto position = std::size_t{0};
+
+    while (position < journal.size()) {
+        const auto eol = journal.find('\n', position);
+
+        if (UnallocatedCString::npos == eol) { break; }
+
+        auto header = std::istringstream{journal.substr(position, eol - position)};
+        auto size = std::size_t{0};
+        header >> size;
+
+        if (header.fail() || ((eol + 1u + size) >= journal.size())) {
+            // A partially written record can only exist at the end of the
+            // journal and is discarded
+            LogError()(OT_PRETTY_CLASS())("Discarding incomplete record at ")(
+                position)(" in journal for Market: ")(marketID)
+                .Flush();
+
+            break;
+        }
+
+        auto signedRecord = api_.Factory().InternalSession().SignedFile(
+            szSubFolder, marketID.c_str());
+
+        if (!signedRecord->LoadContractFromString(
+                String::Factory(journal.substr(eol + 1u, size))) ||
+            !signedRecord->VerifyFile() ||
+            !signedRecord->VerifySignature(serverNym)) {
+            LogError()(OT_PRETTY_CLASS())("Invalid signature on record at ")(
+                position)(" in journal for Market: ")(marketID)
+                .Flush();
+
+            return false;
+        }
+
+        position = eol + size + 2u;
+        ++m_nJournalEntries;
+        const auto body = UnallocatedCString{
+            signedRecord->GetFilePayload().Get(),
+            signedRecord->GetFilePayload().GetLength()};
+        const auto bodyEol = body.find('\n');
+        auto fields = std::istringstream{body.substr(0u, bodyEol)};
+        auto type = UnallocatedCString{};
+        auto argument = UnallocatedCString{};
+        auto payloadSize = std::size_t{0};
+        fields >> type >> argument >> payloadSize;
+
+        if ((UnallocatedCString::npos == bodyEol) || fields.fail() ||
+            ((bodyEol + 1u + payloadSize) != body.size())) {
+            LogError()(OT_PRETTY_CLASS())("Malformed record in journal for "
+                                          "Market: ")(marketID)
+                .Flush();
+
+            return false;
+        }
+
+        const auto payload = body.substr(bodyEol + 1u);
+
+        if (0 == type.compare("offer")) {
+            if (!replay_offer(parseTimestamp(argument), String::Factory(payload))) {
+
+                return false;
+            }
+        } else if (0 == type.compare("remove")) {
+            const auto number = String::StringToLong(argument);
+
+            if (OTOffer* pOffer = m_Book.Remove(number); nullptr != pOffer) {
+                delete pOffer;
+            }
+        } else if (0 == type.compare("sale")) {
+            m_lLastSalePrice = String::StringToLong(argument);
+            m_strLastSaleDate = payload;
+        } else {
+            LogError()(OT_PRETTY_CLASS())("Unknown record type ")(
+                type)(" in journal for Market: ")(marketID)
+                .Flush();
+
+            return false;
+        }
+    }
+
+    LogDetail()(OT_PRETTY_CLASS())("Replayed ")(
+        m_nJournalEntries)(" journal records for Market: ")(marketID)
+        .Flush();
+
+    return true;
+}
+
+auto OTMarket::replay_offer(const Time dateAdded, const String& contract)
+    -> bool
+{
+    auto pOffer{api_.Factory().InternalSession().Offer(
+        m_NOTARY_ID, m_INSTRUMENT_DEFINITION_ID, m_CURRENCY_TYPE_ID, m_lScale)};
+
+    OT_ASSERT(false != bool(pOffer));
+
+    if (!pOffer->LoadContractFromString(contract)) {
+        LogError()(OT_PRETTY_CLASS())("Invalid offer in journal.").Flush();
+
+        return false;
+    }
+
+    // A journaled offer supersedes any earlier version of the same offer
+    if (OTOffer* pOld = m_Book.Remove(pOffer->GetTransactionNum());
+        nullptr != pOld) {
+        delete pOld;
+    }
+
+    // TODO this isn't actually used since the offer will not be saved
+    auto reason = api_.Factory().PasswordPrompt(__func__);
+    OTOffer* offer = pOffer.release();
+
+    if (!AddOffer(nullptr, *offer, reason, false, dateAdded)) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Error adding journaled offer to market while loading market.")
+            .Flush();
+        delete offer;
+
+        return false;
+    }
+
+    return true;
+}
+
 auto OTMarket::LoadMarket() -> bool
 {
     OT_ASSERT(nullptr != GetCron());
@@ -889,6 +981,9 @@ auto OTMarket::LoadMarket() -> bool
 
     if (bSuccess) bSuccess = VerifySignature(*(GetCron()->GetServerNym()));
 
+    // Apply the changes which were made since the snapshot was written.
+    if (bSuccess) bSuccess = load_journal(str_MARKET_ID->Get());
+
     // Load the list of recent market trades (informational only.)
     //
     if (bSuccess) {
@@ -939,33 +1034,74 @@ auto OTMarket::SaveMarket(const PasswordPrompt& reason) -> bool
         return false;
     }
 
-    // Save a copy of recent trades.
-
-    if (nullptr != m_pTradeList) {
-
-        auto filename = api::Legacy::GetFilenameBin(str_MARKET_ID->Get());
+    // The snapshot now contains every journaled change
+    if (0 < m_nJournalEntries) {
+        const char* szSubFolder = "journal";  // todo stop hardcoding.
 
-        const char* szSubFolder = "recent";  // todo stop hardcoding.
-
-        // If this fails, oh well. It's informational, anyway.
-        if (!OTDB::StoreObject(
+        if (OTDB::StorePlainString(
                 api_,
-                *m_pTradeList,
+                "",
                 api_.DataFolder(),
                 szFoldername,  // markets
-                szSubFolder,   // markets/recent
-                filename,
-                ""))  // markets/recent/<Market_ID>.bin
-            LogError()(OT_PRETTY_CLASS())(
-                "Error saving recent trades for Market: ")(
-                szFoldername)(api::Legacy::PathSeparator())(
-                szSubFolder)(api::Legacy::PathSeparator())(szFilename)(".")
+                szSubFolder,   // markets/journal
+                szFilename,
+                "")) {  // markets/journal/<Market_ID>
+            m_nJournalEntries = 0;
+        } else {
+            LogError()(OT_PRETTY_CLASS())("Error truncating journal for Market: ")(
+                szFilename)(".")
                 .Flush();
+        }
     }
 
+    save_trade_list(szFilename);
+
     return true;
 }
 
+auto OTMarket::SaveOffer(OTOffer& theOffer, const PasswordPrompt& reason)
+    -> bool
+{
+    auto strOffer = String::Factory(theOffer);
+
+    return append_journal(
+        "offer",
+        formatTimestamp(theOffer.GetDateAddedToMarket()),
+        strOffer->Get(),
+        reason);
+}
+
+// Save a copy of recent trades.
+auto OTMarket::save_trade_list(const UnallocatedCString& marketID) -> void
+{
+    if (nullptr == m_pTradeList) { return; }
+
+    const char* szFoldername = api_.Internal().Legacy().Market();
+    auto filename = api::Legacy::GetFilenameBin(marketID.c_str());
+
+    const char* szSubFolder = "recent";  // todo stop hardcoding.
+
+    // If this fails, oh well. It's informational, anyway.
+    if (!OTDB::StoreObject(
+            api_,
+            *m_pTradeList,
+            api_.DataFolder(),
+            szFoldername,  // markets
+            szSubFolder,   // markets/recent
+            filename,
+            ""))  // markets/recent/<Market_ID>.bin
+        LogError()(OT_PRETTY_CLASS())(
+            "Error saving recent trades for Market: ")(
+            szFoldername)(api::Legacy::PathSeparator())(
+            szSubFolder)(api::Legacy::PathSeparator())(marketID)(".")
+            .Flush();
+}
+
+void OTMarket::update_book(OTOffer& theOffer)
+{
+    m_Book.Update(theOffer.GetTransactionNum(), theOffer.GetAmountAvailable());
+}
+
 // A Market's ID is based on the instrument definition, the currency type, and
 // the scale.
 //
@@ -998,47 +1134,14 @@ void OTMarket::GetIdentifier(Identifier& theIdentifier) const
 
 // returns 0 if there are no bids. Otherwise returns the value of the highest
 // bid on the market.
-auto OTMarket::GetHighestBidPrice() -> Amount
-{
-    Amount lPrice = 0;
-
-    auto rr = m_mapBids.rbegin();
-
-    if (rr != m_mapBids.rend()) { lPrice = rr->first; }
-
-    return lPrice;
-}
+auto OTMarket::GetHighestBidPrice() -> Amount { return m_Book.BestBid(); }
 
 // returns 0 if there are no asks. Otherwise returns the value of the lowest ask
 // on the market.
-auto OTMarket::GetLowestAskPrice() -> Amount
-{
-    Amount lPrice = 0;
-
-    auto it = m_mapAsks.begin();
-
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
-
-            if (it == m_mapAsks.end()) break;
-
-            lPrice = it->first;
-        }
-    }
-
-    return lPrice;
-}
+//
+// Market orders have a 0 price, but the order book keeps them apart from the
+// priced levels so they can never undercut the actual prices.
+auto OTMarket::GetLowestAskPrice() -> Amount { return m_Book.BestAsk(); }
 
 // This utility function is used directly below (only).
 // It is ASSUMED that the first two accounts are DEBITS, and the second two
@@ -1999,10 +2102,21 @@ void OTMarket::ProcessTrade(
                 }
 
                 // Account balances have changed based on these trades
-                // that we just processed. Make sure to save the Market
-                // since it contains those offers that have just
-                // updated.
-                SaveMarket(reason);
+                // that we just processed. Make sure to journal the
+                // offers that have just updated, along with the sale.
+                SaveOffer(theOffer, reason);
+                SaveOffer(theOtherOffer, reason);
+                append_journal(
+                    "sale",
+                    [&] {
+                        auto buf = UnallocatedCString{};
+                        m_lLastSalePrice.Serialize(writer(buf));
+                        return buf;
+                    }(),
+                    m_strLastSaleDate,
+                    reason);
+                save_trade_list(String::Factory(Identifier::Factory(*this))
+                                    ->Get());
 
                 // The Trade has changed, and it is stored as a
                 // CronItem. So I save Cron as well, for the same reason
@@ -2485,200 +2599,92 @@ auto OTMarket::ProcessTrade(
     // THIS TRADE'S PRICE LIMITS. So we're going to go up the list of
     // what's available, and trade.
 
-    if (theOffer.IsAsk())  // If I'm selling,
-    {
-        // rbegin puts us on the upper bound of the highest bidder (any
-        // new bidders at the same price would be added at the lower
-        // bound, where they are last in line.) The upper bound, on the
-        // other hand, is first in line.  So we start there, and loop
-        // backwards until there are no other bids within my price
-        // range.
-        for (auto rr = m_mapBids.rbegin(); rr != m_mapBids.rend(); ++rr) {
-            // then I want to start at the highest bidder and loop DOWN
-            // until hitting my price limit.
-            OTOffer* pBid = rr->second;
-            OT_ASSERT(nullptr != pBid);
-
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this bid.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pBid! Imagine if pBid is a market order
-            // and theOffer isn't -- that would mean pBid hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pBid->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pBid->IsMarketOrder())
-                //              continue;
-                break;
-            // NOTE: Why break, instead of continue? Because since we
-            // are looping through the bids, from the HIGHEST down to
-            // the LOWEST, and since market orders have a ZERO price, we
-            // know for a fact that there are not any other non-zero
-            // bids. (So we might as well break.)
-
-            // I'm selling.
-            //
-            // If the bid is larger than, or equal to, my
-            // low-side-limit, and the amount available is at least my
-            // minimum increment, (and vice versa),
-            // ...then let's trade!
+    // The order book visits the other side starting at the best price level
+    // (highest bid or lowest ask) and, within a level, in the order the offers
+    // were added. Market orders only process once, and they are processed in
+    // the order they were added to the market, so they are never visited here
+    // as the other offer. We ONLY process a market order as theOffer. If the
+    // other offer is a market order that means it hasn't been processed yet,
+    // so it needs to wait its turn.
+    std::optional<bool> output{};
+    const auto match = [&](OTOffer& theOtherOffer) -> bool {
+        // If I'm selling then the bid must be larger than, or equal to, my
+        // low-side limit. If I'm buying then the ask price must be less than,
+        // or equal to, my price limit.
+        const bool bWithinLimit =
+            theOffer.IsAsk()
+                ? (theOtherOffer.GetPriceLimit() >= theOffer.GetPriceLimit())
+                : (theOtherOffer.GetPriceLimit() <= theOffer.GetPriceLimit());
+
+        if (theOffer.IsMarketOrder() ||  // If I don't care about price...
+            bWithinLimit)  // Or if this offer is within my price range...
+        {
+            // Notice the above "if" is ONLY based on price... because the
+            // "else" returns! (Once I am out of my price range, no point to
+            // continue looping.)
             //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pBid->GetPriceLimit() >=
-                 theOffer.GetPriceLimit()))  // Or if this bid is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.)
-                //
-                // ...So all the other "if"s have to go INSIDE the block
-                // here:
-                //
-                if ((pBid->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pBid->GetMinimumIncrement()) &&
-                    (nullptr != pBid->GetTrade()) &&
-                    !pBid->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet,
-                        theTrade,
-                        theOffer,
-                        *pBid,
-                        reason);  // <========
-            }
-
-            // Else, the bid is lower than I am willing to sell. (And
-            // all the remaining bids are even lower.)
+            // ...So all the other "if"s have to go INSIDE the block here:
             //
-            else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
-                return true;  // stay on cron for more processing (for
-                              // now.)
-            }
-
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                const auto unittype = wallet.CurrencyTypeBasedOnUnitType(
-                    GetInstrumentDefinitionID());
-                LogVerbose()(OT_PRETTY_CLASS())("Removing market order: ")(
-                    theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
-                    theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
-                    theOffer.GetMinimumIncrement(),
-                    unittype)(" is larger than Amount available: ")(
-                    theOffer.GetAmountAvailable(), unittype)
-                    .Flush();
-
-                return false;  // remove this trade from cron
+            if ((theOtherOffer.GetAmountAvailable() >=
+                 theOffer.GetMinimumIncrement()) &&
+                (theOffer.GetAmountAvailable() >=
+                 theOtherOffer.GetMinimumIncrement()) &&
+                (nullptr != theOtherOffer.GetTrade()) &&
+                !theOtherOffer.GetTrade()->IsFlaggedForRemoval()) {
+                ProcessTrade(
+                    wallet,
+                    theTrade,
+                    theOffer,
+                    theOtherOffer,
+                    reason);  // <========
+                update_book(theOffer);
+                update_book(theOtherOffer);
             }
-
-            pBid = nullptr;
         }
-    }
-    // I'm buying
-    else {
-        // Begin puts us on the lower bound of the lowest seller (any
-        // new sellers at the same price would be added at the upper
-        // bound for that price, where they are last in line.) The lower
-        // bound, on the other hand, is first in line.  So we start
-        // there, and loop forwards until there are no other asks within
-        // my price range.
+
+        // Else, the other offer is outside my price limit. (And all the
+        // remaining offers are even further away.)
         //
-        for (auto& it : m_mapAsks) {
-            // then I want to start at the lowest seller and loop UP
-            // until hitting my price limit.
-            OTOffer* pAsk = it.second;
-            OT_ASSERT(nullptr != pAsk);
-
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this ask.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pAsk! Imagine if pAsk is a market order
-            // and theOffer isn't -- that would mean pAsk hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pAsk->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pAsk->IsMarketOrder())
-                continue;
-
-            // I'm buying.
-            // If the ask price is less than, or equal to, my price
-            // limit, and the amount available for purchase is at least
-            // my minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pAsk->GetPriceLimit() <=
-                 theOffer.GetPriceLimit()))  // Or if this ask is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.) So all
-                // the other "if"s have to go INSIDE the block here:
-                //
-                if ((pAsk->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pAsk->GetMinimumIncrement()) &&
-                    (nullptr != pAsk->GetTrade()) &&
-                    !pAsk->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet, theTrade, theOffer, *pAsk, reason);  // <======
-            }
-            // Else, the ask price is higher than I am willing to pay.
-            // (And all the remaining sellers are even HIGHER.)
-            else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
-                return true;  // stay on the market for now.
-            }
+        else if (theOffer.IsLimitOrder()) {
+            output = true;  // stay on cron for more processing (for now.)
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                const auto unittype = wallet.CurrencyTypeBasedOnUnitType(
-                    GetInstrumentDefinitionID());
-                LogVerbose()(OT_PRETTY_CLASS())("Removing market order: ")(
-                    theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
-                    theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
-                    theOffer.GetMinimumIncrement(),
-                    unittype)(" is larger than Amount available: ")(
-                    theOffer.GetAmountAvailable(), unittype)
-                    .Flush();
+            return false;
+        }
 
-                return false;  // remove this trade from the market.
-            }
+        // The offer has no more trading to do--it's done.
+        if (theTrade.IsFlaggedForRemoval() ||  // during processing, the trade
+                                               // may have gotten flagged.
+            (theOffer.GetMinimumIncrement() > theOffer.GetAmountAvailable())) {
+
+            const auto unittype =
+                wallet.CurrencyTypeBasedOnUnitType(GetInstrumentDefinitionID());
+            LogVerbose()(OT_PRETTY_CLASS())("Removing market order: ")(
+                theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
+                theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
+                theOffer.GetMinimumIncrement(),
+                unittype)(" is larger than Amount available: ")(
+                theOffer.GetAmountAvailable(), unittype)
+                .Flush();
+            output = false;  // remove this trade from cron
 
-            pAsk = nullptr;
+            return false;
         }
+
+        return true;
+    };
+
+    if (theOffer.IsAsk()) {  // If I'm selling,
+        // then I want to start at the highest bidder and loop DOWN until
+        // hitting my price limit.
+        m_Book.VisitBids(match);
+    } else {  // If I'm buying,
+        // then I want to start at the lowest seller and loop UP until hitting
+        // my price limit.
+        m_Book.VisitAsks(match);
     }
 
+    if (output.has_value()) { return output.value(); }
+
     // Market orders only process once.
     // (So tell the caller to remove it.)
     //
@@ -2849,18 +2855,9 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
+    for (OTOffer* pOffer : m_Book.Clear()) { delete pOffer; }
+
+    m_nJournalEntries = 0;
 }
 
 void OTMarket::Release()
@@ -0,0 +1,375 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                               // IWYU pragma: associated
+#include "1_Internal.hpp"                             // IWYU pragma: associated
+#include "internal/otx/common/trade/OTOrderBook.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <iterator>
+
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs
+{
+auto OTOrderBook::Queue::erase(Node& node) noexcept -> void
+{
+    if (nullptr == node.prev_) {
+        head_ = node.next_;
+    } else {
+        node.prev_->next_ = node.next_;
+    }
+
+    if (nullptr == node.next_) {
+        tail_ = node.prev_;
+    } else {
+        node.next_->prev_ = node.prev_;
+    }
+
+    node.prev_ = nullptr;
+    node.next_ = nullptr;
+    quantity_ -= node.quantity_;
+    --count_;
+}
+
+auto OTOrderBook::Queue::push_back(Node& node) noexcept -> void
+{
+    node.prev_ = tail_;
+    node.next_ = nullptr;
+
+    if (nullptr == tail_) {
+        head_ = &node;
+    } else {
+        tail_->next_ = &node;
+    }
+
+    tail_ = &node;
+    quantity_ += node.quantity_;
+    ++count_;
+}
+
+OTOrderBook::OTOrderBook(std::size_t history) noexcept
+    : history_limit_(history)
+    , bids_()
+    , asks_()
+    , market_bids_()
+    , market_asks_()
+    , index_()
+    , bid_count_(0)
+    , ask_count_(0)
+    , total_asks_(0)
+    , sequence_(0)
+    , history_()
+{
+}
+
+auto OTOrderBook::Add(
+    const TransactionNumber number,
+    const Side side,
+    const Amount& price,
+    const Amount& quantity,
+    OTOffer* offer) noexcept -> bool
+{
+    auto [it, added] = index_.try_emplace(number);
+
+    if (false == added) {
+        LogError()(OT_PRETTY_CLASS())("offer ")(number)(" already exists")
+            .Flush();
+
+        return false;
+    }
+
+    auto& node = it->second;
+    node.number_ = number;
+    node.side_ = side;
+    node.price_ = price;
+    node.quantity_ = quantity;
+    node.offer_ = offer;
+
+    if (Side::Ask == side) {
+        ++ask_count_;
+        total_asks_ += quantity;
+    } else {
+        ++bid_count_;
+    }
+
+    if (is_market(price)) {
+        market(side).push_back(node);
+    } else {
+        auto& queue = levels(side)[price];
+        queue.push_back(node);
+        publish(side, price, &queue);
+    }
+
+    return true;
+}
+
+auto OTOrderBook::AskCount() const noexcept -> std::size_t
+{
+    return ask_count_;
+}
+
+auto OTOrderBook::BestAsk() const noexcept -> Amount
+{
+    if (asks_.empty()) { return 0; }
+
+    return asks_.cbegin()->first;
+}
+
+auto OTOrderBook::BestBid() const noexcept -> Amount
+{
+    if (bids_.empty()) { return 0; }
+
+    return bids_.crbegin()->first;
+}
+
+auto OTOrderBook::BidCount() const noexcept -> std::size_t
+{
+    return bid_count_;
+}
+
+auto OTOrderBook::Clear() noexcept -> UnallocatedVector<OTOffer*>
+{
+    auto output = UnallocatedVector<OTOffer*>{};
+    output.reserve(index_.size());
+
+    for (auto& [number, node] : index_) {
+        if (nullptr != node.offer_) { output.emplace_back(node.offer_); }
+    }
+
+    for (const auto& [price, queue] : bids_) {
+        publish(Side::Bid, price, nullptr);
+    }
+
+    for (const auto& [price, queue] : asks_) {
+        publish(Side::Ask, price, nullptr);
+    }
+
+    bids_.clear();
+    asks_.clear();
+    market_bids_ = {};
+    market_asks_ = {};
+    index_.clear();
+    bid_count_ = 0;
+    ask_count_ = 0;
+    total_asks_ = 0;
+
+    return output;
+}
+
+auto OTOrderBook::Deltas(std::uint64_t since, UnallocatedVector<Delta>& out)
+    const noexcept -> bool
+{
+    if (since >= sequence_) { return true; }
+
+    if (history_.empty() || (history_.front().sequence_ > (since + 1u))) {
+
+        return false;
+    }
+
+    const auto start = std::next(
+        history_.cbegin(),
+        static_cast<std::ptrdiff_t>(since + 1u - history_.front().sequence_));
+    std::copy(start, history_.cend(), std::back_inserter(out));
+
+    return true;
+}
+
+auto OTOrderBook::Find(const TransactionNumber number) const noexcept
+    -> OTOffer*
+{
+    if (auto it = index_.find(number); index_.end() != it) {
+
+        return it->second.offer_;
+    }
+
+    return nullptr;
+}
+
+auto OTOrderBook::is_market(const Amount& price) noexcept -> bool
+{
+    return 0 == price;
+}
+
+auto OTOrderBook::levels(Side side) noexcept -> Levels&
+{
+    return (Side::Bid == side) ? bids_ : asks_;
+}
+
+auto OTOrderBook::market(Side side) noexcept -> Queue&
+{
+    return (Side::Bid == side) ? market_bids_ : market_asks_;
+}
+
+auto OTOrderBook::publish(
+    Side side,
+    const Amount& price,
+    const Queue* queue) noexcept -> void
+{
+    auto& delta = history_.emplace_back();
+    delta.sequence_ = ++sequence_;
+    delta.side_ = side;
+    delta.level_.price_ = price;
+
+    if (nullptr != queue) {
+        delta.level_.quantity_ = queue->quantity_;
+        delta.level_.count_ = queue->count_;
+    }
+
+    while (history_.size() > history_limit_) { history_.pop_front(); }
+}
+
+auto OTOrderBook::Remove(const TransactionNumber number) noexcept -> OTOffer*
+{
+    auto it = index_.find(number);
+
+    if (index_.end() == it) { return nullptr; }
+
+    auto& node = it->second;
+    auto* output = node.offer_;
+    const auto side = node.side_;
+    const auto price = node.price_;
+
+    if (Side::Ask == side) {
+        --ask_count_;
+        total_asks_ -= node.quantity_;
+    } else {
+        --bid_count_;
+    }
+
+    if (is_market(price)) {
+        market(side).erase(node);
+    } else {
+        auto& map = levels(side);
+        auto level = map.find(price);
+
+        OT_ASSERT(map.end() != level);
+
+        auto& queue = level->second;
+        queue.erase(node);
+
+        if (queue.empty()) {
+            map.erase(level);
+            publish(side, price, nullptr);
+        } else {
+            publish(side, price, &queue);
+        }
+    }
+
+    index_.erase(it);
+
+    return output;
+}
+
+auto OTOrderBook::Snapshot(std::size_t depth) const noexcept -> Depth
+{
+    auto output = Depth{};
+    output.sequence_ = sequence_;
+    const auto limit = [&](const auto& map) {
+        return (0u == depth) ? map.size() : std::min(depth, map.size());
+    };
+    const auto copy = [](const auto& level) {
+        const auto& [price, queue] = level;
+
+        return Level{price, queue.quantity_, queue.count_};
+    };
+    const auto bids = limit(bids_);
+    const auto asks = limit(asks_);
+    output.bids_.reserve(bids);
+    output.asks_.reserve(asks);
+
+    for (auto i = bids_.crbegin(); output.bids_.size() < bids; ++i) {
+        output.bids_.emplace_back(copy(*i));
+    }
+
+    for (auto i = asks_.cbegin(); output.asks_.size() < asks; ++i) {
+        output.asks_.emplace_back(copy(*i));
+    }
+
+    return output;
+}
+
+auto OTOrderBook::TotalAsks() const noexcept -> Amount { return total_asks_; }
+
+auto OTOrderBook::Update(
+    const TransactionNumber number,
+    const Amount& quantity) noexcept -> bool
+{
+    auto it = index_.find(number);
+
+    if (index_.end() == it) { return false; }
+
+    auto& node = it->second;
+
+    if (node.quantity_ == quantity) { return true; }
+
+    const auto side = node.side_;
+    const auto& price = node.price_;
+    auto& queue =
+        is_market(price) ? market(side) : levels(side).find(price)->second;
+    queue.quantity_ -= node.quantity_;
+    queue.quantity_ += quantity;
+
+    if (Side::Ask == side) {
+        total_asks_ -= node.quantity_;
+        total_asks_ += quantity;
+    }
+
+    node.quantity_ = quantity;
+
+    if (false == is_market(price)) { publish(side, price, &queue); }
+
+    return true;
+}
+
+auto OTOrderBook::visit(const Queue& queue, const Visitor& cb) noexcept -> bool
+{
+    for (auto* node = queue.head_; nullptr != node;) {
+        // NOTE the visitor is allowed to update the node
+        auto* next = node->next_;
+
+        if ((nullptr != node->offer_) && (false == cb(*node->offer_))) {
+
+            return false;
+        }
+
+        node = next;
+    }
+
+    return true;
+}
+
+auto OTOrderBook::VisitAll(const Visitor& cb) const noexcept -> void
+{
+    if (false == visit(market_asks_, cb)) { return; }
+
+    for (const auto& [price, queue] : asks_) {
+        if (false == visit(queue, cb)) { return; }
+    }
+
+    if (false == visit(market_bids_, cb)) { return; }
+
+    for (const auto& [price, queue] : bids_) {
+        if (false == visit(queue, cb)) { return; }
+    }
+}
+
+auto OTOrderBook::VisitAsks(const Visitor& cb) const noexcept -> void
+{
+    for (const auto& [price, queue] : asks_) {
+        if (false == visit(queue, cb)) { return; }
+    }
+}
+
+auto OTOrderBook::VisitBids(const Visitor& cb) const noexcept -> void
+{
+    for (auto i = bids_.crbegin(); i != bids_.crend(); ++i) {
+        if (false == visit(i->second, cb)) { return; }
+    }
+}
+
+OTOrderBook::~OTOrderBook() = default;
+}  // namespace opentxs
@@ -142,19 +142,49 @@ auto LoadAbbreviatedRecord(
     bool& bReplyTransSuccess,
     NumList* pNumList) -> std::int32_t
 {
+    return LoadAbbreviatedRecord(
+        [&](const char* name) { return xml->getAttributeValue(name); },
+        lNumberOfOrigin,
+        theOriginType,
+        lTransactionNum,
+        lInRefTo,
+        lInRefDisplay,
+        the_DATE_SIGNED,
+        theType,
+        strHash,
+        lAdjustment,
+        lDisplayValue,
+        lClosingNum,
+        lRequestNum,
+        bReplyTransSuccess,
+        pNumList);
+}
+
+// Returns 1 if success, -1 if error.
+auto LoadAbbreviatedRecord(
+    const AttributeReader& attribute,
+    std::int64_t& lNumberOfOrigin,
+    originType& theOriginType,
+    std::int64_t& lTransactionNum,
+    std::int64_t& lInRefTo,
+    std::int64_t& lInRefDisplay,
+    Time& the_DATE_SIGNED,
+    transactionType& theType,
+    String& strHash,
+    Amount& lAdjustment,
+    Amount& lDisplayValue,
+    std::int64_t& lClosingNum,
+    std::int64_t& lRequestNum,
+    bool& bReplyTransSuccess,
+    NumList* pNumList) -> std::int32_t
+{
 
-    const auto strOriginNum =
-        String::Factory(xml->getAttributeValue("numberOfOrigin"));
-    const auto strOriginType =
-        String::Factory(xml->getAttributeValue("originType"));
-    const auto strTransNum =
-        String::Factory(xml->getAttributeValue("transactionNum"));
-    const auto strInRefTo =
-        String::Factory(xml->getAttributeValue("inReferenceTo"));
-    const auto strInRefDisplay =
-        String::Factory(xml->getAttributeValue("inRefDisplay"));
-    const auto strDateSigned =
-        String::Factory(xml->getAttributeValue("dateSigned"));
+    const auto strOriginNum = String::Factory(attribute("numberOfOrigin"));
+    const auto strOriginType = String::Factory(attribute("originType"));
+    const auto strTransNum = String::Factory(attribute("transactionNum"));
+    const auto strInRefTo = String::Factory(attribute("inReferenceTo"));
+    const auto strInRefDisplay = String::Factory(attribute("inRefDisplay"));
+    const auto strDateSigned = String::Factory(attribute("dateSigned"));
 
     if (!strTransNum->Exists() || !strInRefTo->Exists() ||
         !strInRefDisplay->Exists() || !strDateSigned->Exists()) {
@@ -180,10 +210,9 @@ auto LoadAbbreviatedRecord(
 
     // Transaction TYPE for the abbreviated record...
     theType = transactionType::error_state;  // default
-    const auto strAbbrevType = String::Factory(
-        xml->getAttributeValue("type"));  // the type of inbox receipt, or
-                                          // outbox receipt, or nymbox receipt.
-                                          // (Transaction type.)
+    // the type of inbox receipt, or outbox receipt, or nymbox receipt.
+    // (Transaction type.)
+    const auto strAbbrevType = String::Factory(attribute("type"));
     if (strAbbrevType->Exists()) {
         theType = OTTransaction::GetTypeFromString(strAbbrevType);
 
@@ -208,7 +237,7 @@ auto LoadAbbreviatedRecord(
 
     // RECEIPT HASH
     //
-    strHash.Set(xml->getAttributeValue("receiptHash"));
+    strHash.Set(attribute("receiptHash"));
     if (!strHash.Exists()) {
         LogConsole()(__func__)("Failure: Expected "
                                "receiptHash while loading "
@@ -222,19 +251,17 @@ auto LoadAbbreviatedRecord(
     lDisplayValue = 0;
     lClosingNum = 0;
 
-    const auto strAbbrevAdjustment =
-        String::Factory(xml->getAttributeValue("adjustment"));
+    const auto strAbbrevAdjustment = String::Factory(attribute("adjustment"));
     if (strAbbrevAdjustment->Exists())
         lAdjustment = factory::Amount(strAbbrevAdjustment->Get());
     // -------------------------------------
     const auto strAbbrevDisplayValue =
-        String::Factory(xml->getAttributeValue("displayValue"));
+        String::Factory(attribute("displayValue"));
     if (strAbbrevDisplayValue->Exists())
         lDisplayValue = factory::Amount(strAbbrevDisplayValue->Get());
 
     if (transactionType::replyNotice == theType) {
-        const auto strRequestNum =
-            String::Factory(xml->getAttributeValue("requestNumber"));
+        const auto strRequestNum = String::Factory(attribute("requestNumber"));
 
         if (!strRequestNum->Exists()) {
             LogConsole()(__func__)(
@@ -247,8 +274,7 @@ auto LoadAbbreviatedRecord(
         }
         lRequestNum = strRequestNum->ToLong();
 
-        const auto strTransSuccess =
-            String::Factory(xml->getAttributeValue("transSuccess"));
+        const auto strTransSuccess = String::Factory(attribute("transSuccess"));
 
         bReplyTransSuccess = strTransSuccess->Compare("true");
     }  // if replyNotice (expecting request Number)
@@ -260,7 +286,7 @@ auto LoadAbbreviatedRecord(
     if ((transactionType::finalReceipt == theType) ||
         (transactionType::basketReceipt == theType)) {
         const auto strAbbrevClosingNum =
-            String::Factory(xml->getAttributeValue("closingNum"));
+            String::Factory(attribute("closingNum"));
 
         if (!strAbbrevClosingNum->Exists()) {
             LogConsole()(__func__)("Failed loading "
@@ -279,7 +305,7 @@ auto LoadAbbreviatedRecord(
         ((transactionType::blank == theType) ||
          (transactionType::successNotice == theType))) {
         const auto strNumbers =
-            String::Factory(xml->getAttributeValue("totalListOfNumbers"));
+            String::Factory(attribute("totalListOfNumbers"));
         pNumList->Release();
 
         if (strNumbers->Exists()) pNumList->Add(strNumbers);
@@ -131,6 +131,10 @@ public:
     auto HaveAdminPassword() const -> bool final;
     auto HaveSufficientNumbers(const MessageType reason) const -> bool final;
     auto Highest() const -> TransactionNumber final;
+    auto Idle() const noexcept -> std::shared_future<void> final
+    {
+        return Wait();
+    }
     auto isAdmin() const -> bool final;
     auto Purse(const identifier::UnitDefinition& id) const
         -> const otx::blind::Purse& final;
@@ -43,6 +43,7 @@ auto RPCCommandAllowedAPIArgument() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -54,6 +55,7 @@ auto RPCCommandAllowedAcceptPendingPayment() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -65,6 +67,7 @@ auto RPCCommandAllowedAddClaim() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -76,6 +79,7 @@ auto RPCCommandAllowedAddContact() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -87,6 +91,7 @@ auto RPCCommandAllowedCreateInstrumentDefinition() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -98,6 +103,7 @@ auto RPCCommandAllowedCreateNym() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -109,6 +115,7 @@ auto RPCCommandAllowedGetWorkflow() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -120,6 +127,7 @@ auto RPCCommandAllowedHDSeed() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -130,6 +138,7 @@ auto RPCCommandAllowedModifyAccount() noexcept -> const VersionMap&
     static const auto output = VersionMap{
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -141,6 +150,7 @@ auto RPCCommandAllowedSendMessage() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -152,6 +162,7 @@ auto RPCCommandAllowedSendPayment() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -163,6 +174,7 @@ auto RPCCommandAllowedServerContract() noexcept -> const VersionMap&
         {1, {1, 2}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -174,6 +186,7 @@ auto RPCCommandAllowedVerification() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -185,6 +198,7 @@ auto RPCCommandAllowedVerifyClaim() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -229,6 +243,7 @@ auto RPCResponseAllowedAccountData() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -240,6 +255,7 @@ auto RPCResponseAllowedAccountEvent() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -251,6 +267,7 @@ auto RPCResponseAllowedContact() noexcept -> const VersionMap&
         {1, {1, 2}},
         {2, {1, 3}},
         {3, {1, 3}},
+        {4, {1, 3}},
     };
 
     return output;
@@ -262,6 +279,7 @@ auto RPCResponseAllowedContactEvent() noexcept -> const VersionMap&
         {1, {1, 2}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -273,6 +291,7 @@ auto RPCResponseAllowedHDSeed() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -284,6 +303,7 @@ auto RPCResponseAllowedNym() noexcept -> const VersionMap&
         {1, {1, 5}},
         {2, {1, 6}},
         {3, {1, 6}},
+        {4, {1, 6}},
     };
 
     return output;
@@ -295,6 +315,7 @@ auto RPCResponseAllowedRPCStatus() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -306,6 +327,7 @@ auto RPCResponseAllowedRPCTask() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -317,6 +339,7 @@ auto RPCResponseAllowedServerContract() noexcept -> const VersionMap&
         {1, {1, 2}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -328,6 +351,7 @@ auto RPCResponseAllowedSessionData() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -338,6 +362,7 @@ auto RPCResponseAllowedTransactionData() noexcept -> const VersionMap&
     static const auto output = VersionMap{
         {2, {1, 1}},
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -348,6 +373,7 @@ auto RPCResponseAllowedUnitDefinition() noexcept -> const VersionMap&
     static const auto output = VersionMap{
         {2, {1, 1}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
@@ -359,6 +385,7 @@ auto RPCResponseAllowedWorkflow() noexcept -> const VersionMap&
         {1, {1, 2}},
         {2, {1, 2}},
         {3, {1, 2}},
+        {4, {1, 2}},
     };
 
     return output;
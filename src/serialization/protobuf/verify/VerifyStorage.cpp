@@ -15,6 +15,41 @@ auto BlindedSeriesListAllowedStorageItemHash() noexcept -> const VersionMap&
 
     return output;
 }
+auto StorageAccountEventAllowedAccountEvent() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {2, 2}},
+    };
+
+    return output;
+}
+auto StorageAccountEventListAllowedStorageAccountEvent() noexcept
+    -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageAccountEventSourcesAllowedStorageAccountEventSource() noexcept
+    -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageAccountEventsAllowedStorageAccountEventBucket() noexcept
+    -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {1, 1}},
+    };
+
+    return output;
+}
 auto StorageAccountsAllowedStorageAccountIndex() noexcept -> const VersionMap&
 {
     static const auto output = VersionMap{
@@ -130,6 +165,7 @@ auto StorageNymAllowedBlockchainAccountList() noexcept -> const VersionMap&
         {7, {1, 1}},
         {8, {1, 1}},
         {9, {1, 1}},
+        {10, {1, 1}},
     };
 
     return output;
@@ -143,6 +179,7 @@ auto StorageNymAllowedHDAccount() noexcept -> const VersionMap&
         {7, {1, 1}},
         {8, {1, 1}},
         {9, {1, 1}},
+        {10, {1, 1}},
     };
 
     return output;
@@ -153,6 +190,7 @@ auto StorageNymAllowedStorageBip47AddressIndex() noexcept -> const VersionMap&
         {7, {1, 1}},
         {8, {1, 1}},
         {9, {1, 1}},
+        {10, {1, 1}},
     };
 
     return output;
@@ -169,6 +207,7 @@ auto StorageNymAllowedStorageItemHash() noexcept -> const VersionMap&
         {7, {2, 7}},
         {8, {2, 8}},
         {9, {2, 9}},
+        {10, {2, 10}},
     };
 
     return output;
@@ -178,6 +217,7 @@ auto StorageNymAllowedStoragePurse() noexcept -> const VersionMap&
     static const auto output = VersionMap{
         {8, {1, 1}},
         {9, {1, 1}},
+        {10, {1, 1}},
     };
 
     return output;
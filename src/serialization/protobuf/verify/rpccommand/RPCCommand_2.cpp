@@ -1223,7 +1223,46 @@ auto CheckProto_3(const RPCCommand& input, const bool silent) -> bool
 
 auto CheckProto_4(const RPCCommand& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(4)
+    CHECK_IDENTIFIER(cookie)
+    CHECK_EXISTS(type)
+
+    switch (input.type()) {
+        case RPCCOMMAND_GETACCOUNTACTIVITY: {
+            if (0 > input.session()) { FAIL_1("invalid session"); }
+
+            OPTIONAL_IDENTIFIERS(associatenym);
+            CHECK_EXCLUDED(owner);
+            CHECK_EXCLUDED(notary);
+            CHECK_EXCLUDED(unit);
+            CHECK_HAVE(identifier);
+            CHECK_IDENTIFIERS(identifier);
+            OPTIONAL_SUBOBJECTS(arg, RPCCommandAllowedAPIArgument());
+            CHECK_EXCLUDED(hdseed);
+            CHECK_EXCLUDED(createnym);
+            CHECK_NONE(claim);
+            CHECK_NONE(server);
+            CHECK_EXCLUDED(createunit);
+            CHECK_EXCLUDED(sendpayment);
+            CHECK_EXCLUDED(movefunds);
+            CHECK_NONE(addcontact);
+            CHECK_NONE(verifyclaim);
+            CHECK_NONE(sendmessage);
+            CHECK_NONE(acceptverification);
+            CHECK_NONE(acceptpendingpayment);
+            CHECK_NONE(getworkflow);
+            CHECK_EXCLUDED(param);
+            CHECK_NONE(modifyaccount);
+
+            if ((0 < input.arg_size()) && (1 != input.identifier_size())) {
+                FAIL_1("paging requires exactly one account");
+            }
+        } break;
+        default: {
+            return CheckProto_3(input, silent);
+        }
+    }
+
+    return true;
 }
 
 auto CheckProto_5(const RPCCommand& input, const bool silent) -> bool
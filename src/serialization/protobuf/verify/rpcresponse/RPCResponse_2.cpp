@@ -954,7 +954,34 @@ auto CheckProto_3(const RPCResponse& input, const bool silent) -> bool
 
 auto CheckProto_4(const RPCResponse& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(4)
+    CHECK_IDENTIFIER(cookie)
+
+    switch (input.type()) {
+        case RPCCOMMAND_GETACCOUNTACTIVITY: {
+            CHECK_HAVE(status);
+            CHECK_SUBOBJECTS(status, RPCResponseAllowedRPCStatus());
+            CHECK_NONE(sessions);
+            OPTIONAL_NAMES(identifier);
+            CHECK_NONE(seed);
+            CHECK_NONE(nym);
+            CHECK_NONE(balance);
+            CHECK_NONE(contact);
+            OPTIONAL_SUBOBJECTS(accountevent, RPCResponseAllowedAccountEvent());
+            CHECK_NONE(contactevent);
+            CHECK_NONE(task);
+            CHECK_NONE(notary);
+            CHECK_NONE(workflow);
+            CHECK_NONE(unit);
+            CHECK_NONE(transactiondata);
+
+            if (1 < input.identifier_size()) { FAIL_1("too many cursors"); }
+        } break;
+        default: {
+            return CheckProto_3(input, silent);
+        }
+    }
+
+    return true;
 }
 
 auto CheckProto_5(const RPCResponse& input, const bool silent) -> bool
@@ -78,7 +78,7 @@ auto CheckProto_9(const StorageItemHash& input, const bool silent) -> bool
 
 auto CheckProto_10(const StorageItemHash& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(10)
+    return CheckProto_2(input, silent);
 }
 
 auto CheckProto_11(const StorageItemHash& input, const bool silent) -> bool
@@ -44,59 +44,4 @@ auto CheckProto_9(const StorageNym& input, const bool silent) -> bool
 
     return true;
 }
-
-auto CheckProto_10(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(10)
-}
-
-auto CheckProto_11(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(11)
-}
-
-auto CheckProto_12(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(12)
-}
-
-auto CheckProto_13(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(13)
-}
-
-auto CheckProto_14(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(14)
-}
-
-auto CheckProto_15(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(15)
-}
-
-auto CheckProto_16(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(16)
-}
-
-auto CheckProto_17(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(17)
-}
-
-auto CheckProto_18(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(18)
-}
-
-auto CheckProto_19(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(19)
-}
-
-auto CheckProto_20(const StorageNym& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(20)
-}
 }  // namespace opentxs::proto
@@ -7,15 +7,21 @@
 
 #pragma once
 
+#include <boost/core/demangle.hpp>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <memory>
+#include <typeinfo>
 
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/network/zeromq/socket/Pipeline.hpp"
+#include "internal/util/BoostPMR.hpp"
+#include "internal/util/CountingResource.hpp"
 #include "internal/util/Future.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/network/Network.hpp"
@@ -34,6 +40,7 @@
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "util/Gatekeeper.hpp"
+#include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -110,6 +117,11 @@ protected:
         repeat(downcast().work());
     }
     auto init_complete() noexcept -> void { init_promise_.set_value(); }
+    /// Memory which is released after every message
+    ///
+    /// Use this for temporaries which are not needed after pipeline() or
+    /// work() returns.
+    auto scratch() noexcept -> allocator_type { return &scratch_; }
 
     Actor(
         const api::Session& api,
@@ -138,11 +150,15 @@ protected:
               dealer,
               extra,
               batch,
-              alloc.resource()))
+              alloc::Counted(
+                  boost::core::demangle(typeid(CRTP).name()),
+                  alloc.resource())))
         , disable_automatic_processing_(false)
         , rate_limit_(rateLimit)
         , last_executed_(Clock::now())
         , state_machine_queued_(false)
+        , scratch_buffer_()
+        , scratch_(scratch_buffer_.data(), scratch_buffer_.size())
     {
         LogTrace()(OT_PRETTY_CLASS())("using ZMQ batch ")(pipeline_.BatchID())
             .Flush();
@@ -151,9 +167,13 @@ protected:
     ~Actor() override = default;
 
 private:
+    static constexpr auto scratch_bytes_ = std::size_t{4096};
+
     const std::chrono::milliseconds rate_limit_;
     Time last_executed_;
     mutable std::atomic<bool> state_machine_queued_;
+    std::array<std::byte, scratch_bytes_> scratch_buffer_;
+    alloc::BoostMonotonic scratch_;
 
     auto rate_limit_state_machine() const noexcept
     {
@@ -189,6 +209,7 @@ private:
     }
     auto worker(network::zeromq::Message&& in) noexcept -> void
     {
+        const auto post = ScopeGuard{[this] { scratch_.release(); }};
         const auto& log = LogTrace();
         log(OT_PRETTY_CLASS())("Message received").Flush();
         const auto body = in.Body();
@@ -208,7 +229,7 @@ private:
                 OT_FAIL;
             }
         }();
-        const auto type = CString{print(work)};
+        const auto type = CString{print(work), scratch()};
         log(OT_PRETTY_CLASS())("message type is: ")(type).Flush();
 
         if (OT_ZMQ_INIT_SIGNAL == static_cast<OTZMQWorkType>(work)) {
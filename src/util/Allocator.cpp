@@ -8,11 +8,116 @@
 #include "opentxs/util/Allocator.hpp"  // IWYU pragma: associated
 
 #include <boost/container/pmr/global_resource.hpp>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
 
 #include "internal/util/BoostPMR.hpp"
+#include "internal/util/CountingResource.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/util/Container.hpp"
+#include "util/Metrics.hpp"
 
 namespace opentxs::alloc
 {
+namespace
+{
+// NOTE resources are grouped by upstream so that all of them can be
+// destroyed together with the upstream they forward to
+using CountedByOwner =
+    std::map<UnallocatedCString, std::unique_ptr<Counting>, std::less<>>;
+using CountedByUpstream = std::map<Resource*, CountedByOwner>;
+// NOTE the registry only exports live counters, so the counters for an owner
+// are kept for the lifetime of the process instead of being destroyed along
+// with the resources which update them
+using Counters = std::pair<
+    std::shared_ptr<metrics::Counter>,
+    std::shared_ptr<metrics::Counter>>;
+using CountersByOwner = std::map<UnallocatedCString, Counters, std::less<>>;
+
+struct CountedData {
+    CountedByUpstream resources_{};
+    CountersByOwner counters_{};
+};
+
+auto counted(std::function<void(CountedData&)> cb) noexcept -> void
+{
+    static auto lock = std::mutex{};
+    // NOTE intentionally leaked since memory allocated from these resources
+    // may be released during static destruction
+    static auto* data = new CountedData{};
+    auto guard = Lock{lock};
+    cb(*data);
+}
+
+auto counters(CountersByOwner& map, std::string_view owner) noexcept
+    -> const Counters&
+{
+    if (auto it = map.find(owner); map.end() != it) { return it->second; }
+
+    const auto labels = metrics::Labels{{"owner", UnallocatedCString{owner}}};
+    auto& output = map[UnallocatedCString{owner}];
+    output.first = metrics::Get().AddCounter(
+        "opentxs_allocations_total",
+        "Number of allocations requested from a memory resource",
+        labels);
+    output.second = metrics::Get().AddCounter(
+        "opentxs_allocated_bytes_total",
+        "Number of bytes requested from a memory resource",
+        labels);
+
+    return output;
+}
+}  // namespace
+
+auto Counted(std::string_view owner, Resource* upstream) noexcept -> Resource*
+{
+    if (nullptr == upstream) { upstream = System(); }
+
+    auto* output = static_cast<Resource*>(nullptr);
+    counted([&](auto& data) {
+        auto& resources = data.resources_[upstream];
+
+        if (auto it = resources.find(owner); resources.end() != it) {
+            output = it->second.get();
+
+            return;
+        }
+
+        const auto& [allocations, bytes] = counters(data.counters_, owner);
+        auto& resource = resources[UnallocatedCString{owner}];
+        resource = std::make_unique<Counting>(upstream, allocations, bytes);
+        output = resource.get();
+    });
+
+    return output;
+}
+
+auto CountedSize(Resource* upstream) noexcept -> std::size_t
+{
+    if (nullptr == upstream) { upstream = System(); }
+
+    auto output = std::size_t{0};
+    counted([&](auto& data) {
+        const auto& resources = data.resources_;
+
+        if (auto it = resources.find(upstream); resources.end() != it) {
+            output = it->second.size();
+        }
+    });
+
+    return output;
+}
+
+auto ReleaseCounted(Resource* upstream) noexcept -> void
+{
+    counted([&](auto& data) { data.resources_.erase(upstream); });
+}
+
 auto System() noexcept -> Resource*
 {
     // TODO replace with std::pmr::new_delete_resource once Android and Apple
@@ -0,0 +1,198 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"              // IWYU pragma: associated
+#include "1_Internal.hpp"            // IWYU pragma: associated
+#include "internal/util/Base64.hpp"  // IWYU pragma: associated
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+
+#include "internal/util/LogMacros.hpp"
+
+namespace opentxs::base64
+{
+using namespace std::literals;
+
+constexpr auto alphabet_ =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"sv;
+constexpr auto invalid_ = std::uint8_t{0xff};
+// Any group containing an invalid character sets a bit above the low 24
+constexpr auto invalid_group_ = std::uint32_t{0x01000000};
+
+using Pair = std::array<char, 2>;
+using Pairs = std::array<Pair, 4096>;
+using Shifted = std::array<std::uint32_t, 256>;
+using Values = std::array<std::uint8_t, 256>;
+
+constexpr auto make_pairs() noexcept -> Pairs
+{
+    auto out = Pairs{};
+
+    for (auto i = std::size_t{0}; i < out.size(); ++i) {
+        out[i][0] = alphabet_[i >> 6u];
+        out[i][1] = alphabet_[i & 0x3fu];
+    }
+
+    return out;
+}
+
+constexpr auto make_values() noexcept -> Values
+{
+    auto out = Values{};
+
+    for (auto& value : out) { value = invalid_; }
+
+    for (auto i = std::size_t{0}; i < alphabet_.size(); ++i) {
+        out[static_cast<unsigned char>(alphabet_[i])] =
+            static_cast<std::uint8_t>(i);
+    }
+
+    return out;
+}
+
+constexpr auto values_ = make_values();
+
+constexpr auto make_shifted(unsigned int shift) noexcept -> Shifted
+{
+    auto out = Shifted{};
+
+    for (auto i = std::size_t{0}; i < out.size(); ++i) {
+        const auto value = values_[i];
+        out[i] = (invalid_ == value)
+                     ? invalid_group_
+                     : (static_cast<std::uint32_t>(value) << shift);
+    }
+
+    return out;
+}
+
+constexpr auto pairs_ = make_pairs();
+constexpr auto d0_ = make_shifted(18u);
+constexpr auto d1_ = make_shifted(12u);
+constexpr auto d2_ = make_shifted(6u);
+constexpr auto d3_ = make_shifted(0u);
+
+auto Decode(const ReadView in, void* out) noexcept -> std::size_t
+{
+    const auto* i = reinterpret_cast<const std::uint8_t*>(in.data());
+    const auto* const end = std::next(i, in.size());
+    auto* o = static_cast<std::uint8_t*>(out);
+    auto group = std::uint32_t{0};
+    auto count = 0u;
+    const auto write = [&](std::uint32_t value) {
+        *o++ = static_cast<std::uint8_t>(value >> 16u);
+        *o++ = static_cast<std::uint8_t>(value >> 8u);
+        *o++ = static_cast<std::uint8_t>(value);
+    };
+
+    while (i < end) {
+        if ((0u == count) && (4 <= std::distance(i, end))) {
+            const auto value = d0_[i[0]] | d1_[i[1]] | d2_[i[2]] | d3_[i[3]];
+
+            if (value < invalid_group_) {
+                write(value);
+                i += 4;
+
+                continue;
+            }
+        }
+
+        const auto c = *i++;
+        const auto value = values_[c];
+
+        if (invalid_ != value) {
+            group = (group << 6u) | value;
+
+            if (4u == ++count) {
+                write(group);
+                group = 0;
+                count = 0;
+            }
+        } else if ('=' == c) {
+
+            break;
+        }
+    }
+
+    // NOTE a single leftover character does not encode a full byte
+    if (3u == count) {
+        group <<= 6u;
+        *o++ = static_cast<std::uint8_t>(group >> 16u);
+        *o++ = static_cast<std::uint8_t>(group >> 8u);
+    } else if (2u == count) {
+        group <<= 12u;
+        *o++ = static_cast<std::uint8_t>(group >> 16u);
+    }
+
+    return static_cast<std::size_t>(o - static_cast<std::uint8_t*>(out));
+}
+
+auto DecodedSize(std::size_t chars) noexcept -> std::size_t
+{
+    return ((chars / 4u) + 1u) * 3u;
+}
+
+auto Encode(const ReadView in, char* out, std::size_t width) noexcept
+    -> std::size_t
+{
+    OT_ASSERT(0u == (width % 4u));
+
+    const auto* i = reinterpret_cast<const std::uint8_t*>(in.data());
+    auto remaining = in.size();
+    auto* o = out;
+    auto column = std::size_t{0};
+    const auto wrap = [&] {
+        column += 4u;
+
+        if ((0u < width) && (width == column)) {
+            *o++ = '\n';
+            column = 0;
+        }
+    };
+
+    while (3u <= remaining) {
+        const auto value = (static_cast<std::uint32_t>(i[0]) << 16u) |
+                           (static_cast<std::uint32_t>(i[1]) << 8u) |
+                           static_cast<std::uint32_t>(i[2]);
+        std::memcpy(o, pairs_[value >> 12u].data(), sizeof(Pair));
+        std::memcpy(o + 2, pairs_[value & 0xfffu].data(), sizeof(Pair));
+        o += 4;
+        i += 3;
+        remaining -= 3u;
+        wrap();
+    }
+
+    if (0u < remaining) {
+        auto value = static_cast<std::uint32_t>(i[0]) << 16u;
+
+        if (2u == remaining) {
+            value |= static_cast<std::uint32_t>(i[1]) << 8u;
+        }
+
+        std::memcpy(o, pairs_[value >> 12u].data(), sizeof(Pair));
+        o[2] = (2u == remaining) ? alphabet_[(value >> 6u) & 0x3fu] : '=';
+        o[3] = '=';
+        o += 4;
+        wrap();
+    }
+
+    if ((0u < width) && (0u < column)) { *o++ = '\n'; }
+
+    return static_cast<std::size_t>(o - out);
+}
+
+auto EncodedSize(std::size_t bytes, std::size_t width) noexcept -> std::size_t
+{
+    const auto chars = ((bytes + 2u) / 3u) * 4u;
+
+    if (0u == width) { return chars; }
+
+    return chars + ((chars + width - 1u) / width);
+}
+}  // namespace opentxs::base64
@@ -0,0 +1,429 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"       // IWYU pragma: associated
+#include "1_Internal.hpp"     // IWYU pragma: associated
+#include "util/Executor.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/Signals.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
+#include "util/Metrics.hpp"
+#include "util/Thread.hpp"
+
+namespace opentxs
+{
+namespace
+{
+// NOTE identifies the executor, if any, which owns the calling thread
+thread_local const void* current_executor_{nullptr};
+thread_local std::size_t current_worker_{0};
+}  // namespace
+
+struct Executor::Imp {
+    auto QueueDepth(Priority priority) const noexcept -> std::size_t
+    {
+        const auto value =
+            pending_[static_cast<std::size_t>(priority)].load();
+
+        return (0 > value) ? 0u : static_cast<std::size_t>(value);
+    }
+    auto Threads() const noexcept -> std::size_t { return threads_.size(); }
+
+    auto Post(Priority priority, Job&& job) noexcept -> bool
+    {
+        if (false == bool(job)) { return false; }
+
+        const auto p = static_cast<std::size_t>(priority);
+
+        if (priorities_ <= p) { return false; }
+
+        {
+            auto gate = sLock{gate_};
+
+            if (stopped_) { return false; }
+
+            if (stopping_ && (false == worker())) { return false; }
+
+            const auto index = [&] {
+                if (worker()) {
+
+                    return current_worker_;
+                } else {
+
+                    return next_.fetch_add(1) % workers_.size();
+                }
+            }();
+            auto& queue = workers_[index][p];
+
+            {
+                auto lock = Lock{queue.lock_};
+                queue.jobs_.emplace_back(std::move(job));
+            }
+
+            ++pending_[p];
+        }
+
+        depth_[p]->Add(1);
+        wake(priority);
+
+        return true;
+    }
+    auto Stop() noexcept -> void
+    {
+        if (worker()) {
+            LogError()(OT_PRETTY_CLASS())(
+                "an executor can not be stopped by one of its own jobs")
+                .Flush();
+
+            return;
+        }
+
+        auto stop = Lock{stop_lock_};
+
+        if (stopped_) { return; }
+
+        {
+            auto gate = eLock{gate_};
+            auto lock = Lock{sleep_lock_};
+            stopping_ = true;
+        }
+
+        general_.notify_all();
+        reserved_.notify_all();
+
+        for (auto& thread : threads_) {
+            if (thread.joinable()) { thread.join(); }
+        }
+
+        // NOTE reserved workers may have posted normal or low priority jobs
+        // after every general worker exited
+        current_executor_ = this;
+        current_worker_ = 0u;
+
+        while (true) {
+            auto job = take(0u, priorities_);
+
+            if (job.has_value()) {
+                execute(*job);
+            } else {
+                break;
+            }
+        }
+
+        current_executor_ = nullptr;
+
+        {
+            auto gate = eLock{gate_};
+            stopped_ = true;
+        }
+    }
+
+    Imp(std::string_view name,
+        unsigned int threads,
+        unsigned int reserved,
+        bool pinThreads) noexcept
+        : name_(name)
+        , reserved_count_(std::min(reserved, std::max(threads, 1u) - 1u))
+        , pin_(pinThreads)
+        , gate_()
+        , stopping_(false)
+        , stopped_(false)
+        , next_(0)
+        , pending_()
+        , workers_(std::max(threads, 1u))
+        , taken_(workers_.size(), 0u)
+        , stop_lock_()
+        , sleep_lock_()
+        , general_()
+        , reserved_()
+        , general_sleepers_(0)
+        , reserved_sleepers_(0)
+        , depth_([&] {
+            auto out = Gauges{};
+
+            for (auto p = std::size_t{0}; p < priorities_; ++p) {
+                out[p] = metrics::Get().AddGauge(
+                    "opentxs_executor_queue_depth",
+                    "Number of jobs waiting for an executor thread",
+                    {{"executor", name_},
+                     {"priority",
+                      UnallocatedCString{
+                          print(static_cast<Priority>(p))}}});
+            }
+
+            return out;
+        }())
+        , executed_(metrics::Get().AddCounter(
+              "opentxs_executor_jobs_total",
+              "Number of jobs executed",
+              {{"executor", name_}}))
+        , stolen_(metrics::Get().AddCounter(
+              "opentxs_executor_steals_total",
+              "Number of jobs executed by a thread other than the one to "
+              "which they were queued",
+              {{"executor", name_}}))
+        , threads_()
+    {
+        for (auto& pending : pending_) { pending.store(0); }
+
+        threads_.reserve(workers_.size());
+
+        for (auto i = std::size_t{0}; i < workers_.size(); ++i) {
+            threads_.emplace_back(&Imp::run, this, i);
+        }
+    }
+
+    ~Imp() { Stop(); }
+
+private:
+    struct Queue {
+        std::mutex lock_{};
+        std::deque<Job> jobs_{};
+    };
+
+    using Gauges = std::array<std::shared_ptr<metrics::Gauge>, priorities_>;
+    using Worker = std::array<Queue, priorities_>;
+
+    const UnallocatedCString name_;
+    const std::size_t reserved_count_;
+    const bool pin_;
+    mutable std::shared_mutex gate_;
+    std::atomic<bool> stopping_;
+    bool stopped_;
+    std::atomic<std::size_t> next_;
+    std::array<std::atomic<std::int64_t>, priorities_> pending_;
+    UnallocatedVector<Worker> workers_;
+    // NOTE each element is only accessed by the thread which runs the
+    // corresponding worker
+    UnallocatedVector<std::size_t> taken_;
+    std::mutex stop_lock_;
+    std::mutex sleep_lock_;
+    std::condition_variable general_;
+    std::condition_variable reserved_;
+    std::atomic<std::size_t> general_sleepers_;
+    std::atomic<std::size_t> reserved_sleepers_;
+    const Gauges depth_;
+    const std::shared_ptr<metrics::Counter> executed_;
+    const std::shared_ptr<metrics::Counter> stolen_;
+    UnallocatedVector<std::thread> threads_;
+
+    // NOTE reserved workers only run high priority jobs
+    auto allowed(std::size_t index) const noexcept -> std::size_t
+    {
+        return (index < reserved_count_) ? 1u : priorities_;
+    }
+    auto available(std::size_t limit) const noexcept -> bool
+    {
+        for (auto p = std::size_t{0}; p < limit; ++p) {
+            if (0 < pending_[p].load()) { return true; }
+        }
+
+        return false;
+    }
+    auto execute(Job& job) noexcept -> void
+    {
+        try {
+            job();
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(name_)(": job failed: ")(e.what())
+                .Flush();
+        } catch (...) {
+            LogError()(OT_PRETTY_CLASS())(name_)(": job failed").Flush();
+        }
+
+        executed_->Increment();
+    }
+    auto pop(Queue& queue) noexcept -> std::optional<Job>
+    {
+        auto lock = Lock{queue.lock_};
+
+        if (queue.jobs_.empty()) { return std::nullopt; }
+
+        auto output = std::make_optional(std::move(queue.jobs_.front()));
+        queue.jobs_.pop_front();
+
+        return output;
+    }
+    auto run(std::size_t index) noexcept -> void
+    {
+        current_executor_ = this;
+        current_worker_ = index;
+        Signals::Block();
+
+        if (pin_) {
+            const auto cores =
+                std::max<unsigned int>(std::thread::hardware_concurrency(), 1u);
+
+            if (false == SetThisThreadsAffinity(index % cores)) {
+                LogDebug()(OT_PRETTY_CLASS())(name_)(
+                    ": failed to set affinity for thread ")(index)
+                    .Flush();
+            }
+        }
+
+        const auto limit = allowed(index);
+        const auto reserved = (priorities_ != limit);
+        auto& cv = reserved ? reserved_ : general_;
+        auto& sleepers = reserved ? reserved_sleepers_ : general_sleepers_;
+
+        while (true) {
+            if (auto job = take(index, limit); job.has_value()) {
+                execute(*job);
+
+                continue;
+            }
+
+            auto lock = Lock{sleep_lock_};
+            ++sleepers;
+
+            if (false == available(limit)) {
+                if (stopping_) {
+                    --sleepers;
+
+                    break;
+                }
+
+                cv.wait(lock);
+            }
+
+            --sleepers;
+        }
+
+        current_executor_ = nullptr;
+    }
+    auto take(std::size_t index, std::size_t limit) noexcept
+        -> std::optional<Job>
+    {
+        const auto count = workers_.size();
+        auto& taken = taken_[index];
+        const auto lowestFirst = (low_share_ - 1u) == (taken % low_share_);
+
+        for (auto n = std::size_t{0}; n < limit; ++n) {
+            const auto p = lowestFirst ? (limit - 1u - n) : n;
+
+            if (0 >= pending_[p].load()) { continue; }
+
+            for (auto i = std::size_t{0}; i < count; ++i) {
+                auto& queue = workers_[(index + i) % count][p];
+                auto job = pop(queue);
+
+                if (job.has_value()) {
+                    --pending_[p];
+                    depth_[p]->Add(-1);
+                    ++taken;
+
+                    if (0u != i) { stolen_->Increment(); }
+
+                    return job;
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+    auto wake(Priority priority) noexcept -> void
+    {
+        // NOTE the sleeper counts are incremented under sleep_lock_ before
+        // the pending counts are checked, so if a sleeper is not visible
+        // here it will observe the new job before it waits
+        const auto high = (Priority::High == priority);
+        const auto reserved = high && (0u < reserved_sleepers_.load());
+        const auto general = (0u < general_sleepers_.load());
+
+        if ((false == reserved) && (false == general)) { return; }
+
+        {
+            auto lock = Lock{sleep_lock_};
+        }
+
+        if (reserved) {
+            reserved_.notify_one();
+        } else {
+            general_.notify_one();
+        }
+    }
+    auto worker() const noexcept -> bool { return this == current_executor_; }
+
+    Imp() = delete;
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+};
+
+Executor::Executor(
+    std::string_view name,
+    unsigned int threads,
+    unsigned int reserved,
+    bool pinThreads) noexcept
+    : imp_(std::make_unique<Imp>(name, threads, reserved, pinThreads)
+               .release())
+{
+}
+
+auto Executor::Post(Priority priority, Job job) noexcept -> bool
+{
+    return imp_->Post(priority, std::move(job));
+}
+
+auto Executor::QueueDepth(Priority priority) const noexcept -> std::size_t
+{
+    return imp_->QueueDepth(priority);
+}
+
+auto Executor::Stop() noexcept -> void { imp_->Stop(); }
+
+auto Executor::Threads() const noexcept -> std::size_t
+{
+    return imp_->Threads();
+}
+
+Executor::~Executor()
+{
+    if (nullptr != imp_) {
+        delete imp_;
+        imp_ = nullptr;
+    }
+}
+
+auto print(Executor::Priority priority) noexcept -> std::string_view
+{
+    using namespace std::literals;
+
+    switch (priority) {
+        case Executor::Priority::High: {
+
+            return "high"sv;
+        }
+        case Executor::Priority::Normal: {
+
+            return "normal"sv;
+        }
+        case Executor::Priority::Low: {
+
+            return "low"sv;
+        }
+        default: {
+
+            return "error"sv;
+        }
+    }
+}
+}  // namespace opentxs
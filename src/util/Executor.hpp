@@ -0,0 +1,94 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace opentxs
+{
+/** Work stealing thread pool
+ *
+ *  Every worker owns one deque per priority. Jobs posted from a worker are
+ *  queued on that worker's deques and jobs posted from any other thread are
+ *  distributed round robin. An idle worker takes the oldest job of the
+ *  highest available priority, first from its own deques and then from the
+ *  deques of the other workers.
+ *
+ *  To keep a sustained stream of higher priority jobs from starving the
+ *  others, every general worker takes its next job from the lowest available
+ *  priority instead once per low_share_ jobs.
+ *
+ *  Reserved workers only execute high priority jobs. Reserve at least one
+ *  worker if normal or low priority jobs block while waiting for high
+ *  priority jobs to finish, otherwise the pool can deadlock once every
+ *  worker is waiting.
+ */
+class Executor
+{
+public:
+    enum class Priority : std::uint8_t {
+        High = 0,
+        Normal = 1,
+        Low = 2,
+    };
+
+    using Job = std::function<void()>;
+
+    static constexpr auto priorities_ = std::size_t{3};
+    static constexpr auto low_share_ = std::size_t{8};
+
+    auto QueueDepth(Priority priority) const noexcept -> std::size_t;
+    auto Threads() const noexcept -> std::size_t;
+
+    /// Returns false if the executor has been stopped
+    auto Post(Priority priority, Job job) noexcept -> bool;
+    /// The future holds std::future_error if the executor has been stopped
+    template <typename Callable>
+    auto Submit(Priority priority, Callable&& job) noexcept
+        -> std::future<std::invoke_result_t<Callable>>
+    {
+        using Result = std::invoke_result_t<Callable>;
+        using Task = std::packaged_task<Result()>;
+        auto task = std::make_shared<Task>(std::forward<Callable>(job));
+        auto output = task->get_future();
+        Post(priority, [task] { (*task)(); });
+
+        return output;
+    }
+    /// Executes every queued job, including any posted by those jobs, then
+    /// joins the worker threads
+    auto Stop() noexcept -> void;
+
+    /// Workers are pinned to consecutive cores if pinThreads is true
+    Executor(
+        std::string_view name,
+        unsigned int threads,
+        unsigned int reserved = 0u,
+        bool pinThreads = false) noexcept;
+
+    ~Executor();
+
+private:
+    struct Imp;
+
+    Imp* imp_;
+
+    Executor() = delete;
+    Executor(const Executor&) = delete;
+    Executor(Executor&&) = delete;
+    auto operator=(const Executor&) -> Executor& = delete;
+    auto operator=(Executor&&) -> Executor& = delete;
+};
+
+auto print(Executor::Priority priority) noexcept -> std::string_view;
+}  // namespace opentxs
@@ -13,18 +13,19 @@
 #include <boost/system/error_code.hpp>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <cstdlib>
-#include <future>
+#include <iostream>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <thread>
 
 #include "internal/core/Amount.hpp"
 #include "internal/otx/common/StringXML.hpp"
 #include "internal/otx/common/util/Common.hpp"
 #include "internal/util/Log.hpp"
-#include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
-#include "opentxs/api/Context.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/String.hpp"
@@ -43,6 +44,7 @@
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "util/Log.hpp"
+#include "util/LogBuffer.hpp"
 
 namespace zmq = opentxs::network::zeromq;
 
@@ -65,17 +67,47 @@ auto Log::Shutdown() noexcept -> void
 {
     static auto& logger = opentxs::Log::Imp::logger_;
     logger.running_.shutdown();
+    logger.stop_ = true;
+    logger.wake_.notify_one();
+
+    if (logger.consumer_.joinable()) { logger.consumer_.join(); }
+
     auto lock = Lock{logger.lock_};
     logger.map_.clear();
 }
 
-auto Log::Start() noexcept -> void {}
+auto Log::Start(const zmq::Context& zmq) noexcept -> void
+{
+    static auto& logger = opentxs::Log::Imp::logger_;
+
+    if (logger.consumer_.joinable()) { return; }
+
+    logger.stop_ = false;
+    logger.consumer_ =
+        std::thread{[&zmq] { opentxs::Log::Imp::Consume(zmq); }};
+}
 }  // namespace opentxs::internal
 
 namespace opentxs
 {
 Log::Imp::Logger Log::Imp::logger_{};
 
+// NOTE only reached if the process exits without shutting down the context
+Log::Imp::Logger::~Logger()
+{
+    stop_ = true;
+    wake_.notify_one();
+
+    if (consumer_.joinable()) { consumer_.join(); }
+}
+
+Log::Imp::Logger::Source::Source(UnallocatedCString&& thread) noexcept
+    : thread_(std::move(thread))
+    , ring_()
+    , closed_(false)
+{
+}
+
 Log::Imp::Imp(const int logLevel, opentxs::Log& parent) noexcept
     : level_(logLevel)
     , parent_(parent)
@@ -87,136 +119,238 @@ auto Log::Imp::active() const noexcept -> bool
     return logger_.verbosity_.load() >= level_;
 }
 
+template <typename Value>
+auto Log::Imp::add(const Value& value) const noexcept -> const opentxs::Log&
+{
+    if (false == active()) { return parent_; }
+
+    if (auto done = logger_.running_.get(); false == done) {
+        get_buffer().record_.Add(value);
+    }
+
+    return parent_;
+}
+
 auto Log::Imp::Assert(
     const char* file,
     const std::size_t line,
     const char* message) const noexcept -> void
 {
-    if (auto done = logger_.running_.get(); false == done) {
-        auto id = UnallocatedCString{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "OT ASSERT";
+    const auto print = [](auto, const auto& thread, const auto& text) {
+        if (text.empty()) { return; }
 
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
+        std::cerr << "(" << thread << ") " << text << std::endl;
+    };
+
+    if (auto done = logger_.running_.get(); false == done) {
+        auto& [source, record] = get_buffer();
+        record.Clear();
+        record.Add("OT ASSERT");
+
+        if (nullptr != file) {
+            record.Add(" in ");
+            record.Add(file);
+            record.Add(" line ");
+            record.Add(static_cast<std::uint64_t>(line));
+        }
 
-        if (nullptr != message) { buffer << ": " << message; }
+        if (nullptr != message) {
+            record.Add(": ");
+            record.Add(message);
+        }
 
-        buffer << "\n" << boost::stacktrace::stacktrace();
+        record.Add("\n");
+        record.Add(PrintStackTrace());
+        // NOTE the consumer thread may never run again so everything which
+        // has been buffered so far is written directly, followed by the
+        // assertion itself
+        Drain(print);
+        print(level_, source->thread_, util::LogRecord::Format(record.Bytes()));
     }
 
-    send(true);
     abort();
 }
 
-auto Log::Imp::Flush() const noexcept -> void { send(false); }
+auto Log::Imp::commit(Logger::Producer& producer) const noexcept -> void
+{
+    auto& [source, record] = producer;
+
+    if (record.empty()) { return; }
+
+    auto& ring = source->ring_;
 
-auto Log::Imp::get_buffer(UnallocatedCString& out) noexcept -> Logger::Source&
+    // NOTE a record which could never fit in the ring is shortened rather
+    // than discarded
+    if (const auto max = ring.MaxRecord(); record.Bytes().size() > max) {
+        record.Truncate(max);
+    }
+
+    // NOTE the producer never waits for the consumer. If the ring is full the
+    // record is discarded and the number of discarded records is reported by
+    // the consumer once it catches up.
+    const auto pushed = ring.Push(level_, record.Bytes());
+
+    if (false == pushed) { ++logger_.dropped_; }
+
+    record.Clear();
+    wake();
+}
+
+auto Log::Imp::Consume(const zmq::Context& zmq) noexcept -> void
+{
+    auto socket = zmq.PushSocket(zmq::socket::Direction::Connect);
+    const auto started = socket->Start(internal::Log::Endpoint());
+
+    assert(started);
+
+    const auto send = [&](auto level, const auto& thread, const auto& text) {
+        auto message = zmq::Message{};
+        message.StartBody();
+        message.AddFrame(level);
+        message.AddFrame(text);
+        message.AddFrame(thread);
+        socket->Send(std::move(message));
+    };
+    auto running = true;
+
+    while (running) {
+        {
+            auto lock = Lock{logger_.wake_lock_};
+            // NOTE producers notify without taking the mutex so a wakeup may
+            // occasionally be missed, which only delays output until the
+            // timeout expires
+            logger_.wake_.wait_for(lock, 100ms, [] {
+                return logger_.pending_.load() || logger_.stop_.load();
+            });
+        }
+
+        running = (false == logger_.stop_.load());
+        logger_.pending_ = false;
+        Drain(send);
+    }
+}
+
+auto Log::Imp::Drain(const Sink& sink) noexcept -> void
+{
+    auto lock =
+        std::unique_lock<std::timed_mutex>{logger_.drain_, std::defer_lock};
+
+    if (false == lock.try_lock_for(10s)) { return; }
+
+    const auto sources = [] {
+        auto out = UnallocatedVector<std::shared_ptr<Logger::Source>>{};
+        auto lock = Lock{logger_.lock_};
+        auto& map = logger_.map_;
+
+        for (auto i = map.begin(); i != map.end();) {
+            out.emplace_back(i->second);
+
+            // NOTE a closed source will never receive another record so it
+            // can be forgotten once it has been drained one final time
+            if (i->second->closed_) {
+                i = map.erase(i);
+            } else {
+                ++i;
+            }
+        }
+
+        return out;
+    }();
+
+    for (const auto& source : sources) {
+        source->ring_.Pop([&](auto level, auto record) {
+            sink(level, source->thread_, util::LogRecord::Format(record));
+        });
+    }
+
+    if (const auto dropped = logger_.dropped_.exchange(0); 0u < dropped) {
+        sink(
+            -1,
+            {},
+            std::to_string(dropped) +
+                " log messages were discarded because the buffer was full");
+    }
+}
+
+auto Log::Imp::Flush() const noexcept -> void
+{
+    if (false == active()) { return; }
+
+    if (auto done = logger_.running_.get(); false == done) {
+        commit(get_buffer());
+    }
+}
+
+auto Log::Imp::get_buffer() noexcept -> Logger::Producer&
 {
     struct Buffer {
-        const std::thread::id id_;
-        const UnallocatedCString text_;
         const int index_;
-        Logger::SourceMap::iterator source_;
+        Logger::Producer producer_;
 
         Buffer() noexcept
-            : id_(std::this_thread::get_id())
-            , text_([&] {
-                auto buf = std::stringstream{};
-                buf << std::hex << id_;
+            : index_(++logger_.index_)
+            , producer_([] {
+                auto out = Logger::Producer{};
+                out.source_ = std::make_shared<Logger::Source>([] {
+                    auto buf = std::stringstream{};
+                    buf << std::hex << std::this_thread::get_id();
 
-                return buf.str();
-            }())
-            , index_(++logger_.index_)
-            , source_([&] {
-                auto lock = Lock{logger_.lock_};
-                auto [it, added] = logger_.map_.try_emplace(
-                    index_,
-                    [] {
-                        using Direction = zmq::socket::Direction;
-                        auto out =
-                            Context().ZMQ().PushSocket(Direction::Connect);
-                        const auto started =
-                            out->Start(internal::Log::Endpoint());
-
-                        assert(started);
-
-                        return out;
-                    }(),
-                    std::stringstream{});
-                assert(added);
-
-                return it;
+                    return buf.str();
+                }());
+
+                return out;
             }())
         {
+            auto lock = Lock{logger_.lock_};
+            const auto [it, added] =
+                logger_.map_.try_emplace(index_, producer_.source_);
+
+            assert(added);
         }
 
         ~Buffer()
         {
-            auto lock = Lock{logger_.lock_};
-            logger_.map_.erase(index_);
+            producer_.source_->closed_ = true;
+            wake();
         }
     };
 
     static thread_local auto buffer = Buffer{};
-    out = buffer.text_;
 
-    return buffer.source_->second;
+    return buffer.producer_;
 }
 
 auto Log::Imp::operator()(const char* in) const noexcept -> const opentxs::Log&
 {
-    if (false == active()) { return parent_; }
+    if (nullptr == in) { return parent_; }
 
-    auto id = UnallocatedCString{};
-
-    if (auto done = logger_.running_.get(); false == done) {
-        std::get<1>(get_buffer(id)) << in;
-    }
-
-    return parent_;
+    return add(ReadView{in});
 }
 
-auto Log::Imp::operator()(const boost::system::error_code& error) const noexcept
+auto Log::Imp::operator()(const std::int64_t in) const noexcept
     -> const opentxs::Log&
 {
-    if (false == active()) { return parent_; }
-
-    auto id = UnallocatedCString{};
-
-    if (auto done = logger_.running_.get(); false == done) {
-        std::get<1>(get_buffer(id)) << error.message();
-    }
+    return add(in);
+}
 
-    return parent_;
+auto Log::Imp::operator()(const std::uint64_t in) const noexcept
+    -> const opentxs::Log&
+{
+    return add(in);
 }
 
-auto Log::Imp::send(const bool terminate) const noexcept -> void
+auto Log::Imp::operator()(const double in) const noexcept
+    -> const opentxs::Log&
 {
-    if (auto done = logger_.running_.get(); false == done) {
-        auto id = UnallocatedCString{};
-        auto& [socket, buffer] = get_buffer(id);
-        auto message = zmq::Message{};
-        message.StartBody();
-        message.AddFrame(level_);
-        message.AddFrame(buffer.str());
-        message.AddFrame(id);
-        auto promise = std::promise<void>{};
-        auto future = promise.get_future();
-        const auto* pPromise = &promise;
-
-        if (terminate) {
-            message.AddFrame(&pPromise, sizeof(pPromise));
-        } else {
-            promise.set_value();
-        }
+    return add(in);
+}
 
-        socket->Send(std::move(message));
-        buffer = std::stringstream{};
-        future.wait_for(10s);
-    }
+auto Log::Imp::operator()(const boost::system::error_code& error) const noexcept
+    -> const opentxs::Log&
+{
+    if (false == active()) { return parent_; }
 
-    if (terminate) { abort(); }
+    return add(ReadView{error.message()});
 }
 
 auto Log::Imp::Trace(
@@ -225,19 +359,34 @@ auto Log::Imp::Trace(
     const char* message) const noexcept -> void
 {
     if (auto done = logger_.running_.get(); false == done) {
-        UnallocatedCString id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "Stack trace requested";
-
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
+        auto& producer = get_buffer();
+        auto& record = producer.record_;
+        record.Clear();
+        record.Add("Stack trace requested");
+
+        if (nullptr != file) {
+            record.Add(" in ");
+            record.Add(file);
+            record.Add(" line ");
+            record.Add(static_cast<std::uint64_t>(line));
+        }
 
-        if (nullptr != message) { buffer << ": " << message; }
+        if (nullptr != message) {
+            record.Add(": ");
+            record.Add(message);
+        }
 
-        buffer << "\n" << PrintStackTrace();
+        record.Add("\n");
+        record.Add(PrintStackTrace());
+        commit(producer);
     }
+}
 
-    send(false);
+auto Log::Imp::wake() noexcept -> void
+{
+    if (false == logger_.pending_.exchange(true)) {
+        logger_.wake_.notify_one();
+    }
 }
 }  // namespace opentxs
 
@@ -444,8 +593,18 @@ auto Log::Assert(const char* file, const std::size_t line, const char* message)
     imp_->Assert(file, line, message);
 }
 
+auto Log::floating_point(const double in) const noexcept -> const Log&
+{
+    return (*imp_)(in);
+}
+
 auto Log::Flush() const noexcept -> void { imp_->Flush(); }
 
+auto Log::signed_integer(const std::int64_t in) const noexcept -> const Log&
+{
+    return (*imp_)(in);
+}
+
 auto Log::Trace(const char* file, const std::size_t line) const noexcept -> void
 {
     Trace(file, line, nullptr);
@@ -457,6 +616,12 @@ auto Log::Trace(const char* file, const std::size_t line, const char* message)
     imp_->Trace(file, line, message);
 }
 
+auto Log::unsigned_integer(const std::uint64_t in) const noexcept
+    -> const Log&
+{
+    return (*imp_)(in);
+}
+
 Log::~Log()
 {
     if (nullptr != imp_) {
@@ -6,11 +6,13 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <sstream>
 #include <thread>
-#include <tuple>
 #include <utility>
 
 #include "internal/otx/common/StringXML.hpp"
@@ -22,11 +24,11 @@
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Time.hpp"
 #include "util/Gatekeeper.hpp"
+#include "util/LogBuffer.hpp"
 
 namespace boost
 {
@@ -36,24 +38,74 @@ class error_code;
 }  // namespace system
 }  // namespace boost
 
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace network
+{
+namespace zeromq
+{
+class Context;
+}  // namespace zeromq
+}  // namespace network
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
 namespace opentxs
 {
 struct Log::Imp final : public internal::Log {
+    /** Messages are encoded by the thread which produces them into a ring
+     *  buffer owned by that thread. A single consumer thread converts them to
+     *  text and forwards them to api::Log.
+     */
     struct Logger {
-        using Source = std::pair<OTZMQPushSocket, std::stringstream>;
-        using SourceMap = UnallocatedMap<int, Source>;
+        struct Source {
+            const UnallocatedCString thread_;
+            util::LogRing ring_;
+            std::atomic_bool closed_;
+
+            Source(UnallocatedCString&& thread) noexcept;
+        };
+        struct Producer {
+            std::shared_ptr<Source> source_{};
+            util::LogRecord record_{};
+        };
+
+        using SourceMap = UnallocatedMap<int, std::shared_ptr<Source>>;
 
         std::atomic_int verbosity_{-1};
         std::atomic_int index_{-1};
+        std::atomic<std::size_t> dropped_{0};
+        std::atomic_bool pending_{false};
+        std::atomic_bool stop_{false};
         Gatekeeper running_{};
         std::mutex lock_{};
         SourceMap map_{};
+        std::timed_mutex drain_{};
+        std::mutex wake_lock_{};
+        std::condition_variable wake_{};
+        std::thread consumer_{};
+
+        ~Logger();
     };
+    using Sink = std::function<
+        void(int, const UnallocatedCString&, const UnallocatedCString&)>;
 
     static Logger logger_;
 
+    static auto Consume(const network::zeromq::Context& zmq) noexcept -> void;
+    static auto Drain(const Sink& sink) noexcept -> void;
+
     auto active() const noexcept -> bool;
     auto operator()(const char* in) const noexcept -> const opentxs::Log&;
+    auto operator()(const std::int64_t in) const noexcept
+        -> const opentxs::Log&;
+    auto operator()(const std::uint64_t in) const noexcept
+        -> const opentxs::Log&;
+    auto operator()(const double in) const noexcept -> const opentxs::Log&;
     auto operator()(const boost::system::error_code& error) const noexcept
         -> const opentxs::Log&;
 
@@ -73,9 +125,12 @@ private:
     const int level_;
     opentxs::Log& parent_;
 
-    static auto get_buffer(UnallocatedCString& id) noexcept -> Logger::Source&;
+    static auto get_buffer() noexcept -> Logger::Producer&;
+    static auto wake() noexcept -> void;
 
-    auto send(const bool terminate) const noexcept -> void;
+    template <typename Value>
+    auto add(const Value& value) const noexcept -> const opentxs::Log&;
+    auto commit(Logger::Producer& producer) const noexcept -> void;
 
     Imp() = delete;
     Imp(const Imp&) = delete;
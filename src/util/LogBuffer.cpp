@@ -0,0 +1,239 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"        // IWYU pragma: associated
+#include "1_Internal.hpp"      // IWYU pragma: associated
+#include "util/LogBuffer.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace opentxs::util
+{
+LogRecord::LogRecord() noexcept
+    : buffer_()
+{
+}
+
+auto LogRecord::Add(const ReadView text) noexcept -> void
+{
+    append(Argument::text, text.data(), text.size());
+}
+
+auto LogRecord::Add(const std::int64_t value) noexcept -> void
+{
+    append(Argument::signed_integer, &value, sizeof(value));
+}
+
+auto LogRecord::Add(const std::uint64_t value) noexcept -> void
+{
+    append(Argument::unsigned_integer, &value, sizeof(value));
+}
+
+auto LogRecord::Add(const double value) noexcept -> void
+{
+    append(Argument::floating_point, &value, sizeof(value));
+}
+
+auto LogRecord::append(
+    const Argument type,
+    const void* data,
+    std::size_t size) noexcept -> void
+{
+    const auto position = buffer_.size();
+
+    if (Argument::text == type) {
+        const auto length = static_cast<std::uint32_t>(std::min<std::size_t>(
+            size, std::numeric_limits<std::uint32_t>::max()));
+        size = length;
+        buffer_.resize(position + 1u + sizeof(length) + size);
+        auto* out = buffer_.data() + position;
+        *out = static_cast<char>(type);
+        std::memcpy(out + 1, &length, sizeof(length));
+        std::memcpy(out + 1 + sizeof(length), data, size);
+    } else {
+        buffer_.resize(position + 1u + size);
+        auto* out = buffer_.data() + position;
+        *out = static_cast<char>(type);
+        std::memcpy(out + 1, data, size);
+    }
+}
+
+auto LogRecord::Bytes() const noexcept -> ReadView
+{
+    return {buffer_.data(), buffer_.size()};
+}
+
+// NOTE the allocated capacity is retained since every thread reuses the same
+// record for all of its messages
+auto LogRecord::Clear() noexcept -> void { buffer_.clear(); }
+
+auto LogRecord::Format(const ReadView record) noexcept -> UnallocatedCString
+{
+    auto output = UnallocatedCString{};
+    const auto* it = record.data();
+    const auto* const end = it + record.size();
+    const auto copy = [&](auto& value) {
+        if (sizeof(value) > static_cast<std::size_t>(end - it)) {
+            it = end;
+
+            return false;
+        }
+
+        std::memcpy(&value, it, sizeof(value));
+        it += sizeof(value);
+
+        return true;
+    };
+
+    while (it < end) {
+        const auto type = static_cast<Argument>(*it++);
+
+        switch (type) {
+            case Argument::text: {
+                auto length = std::uint32_t{};
+
+                if (false == copy(length)) { break; }
+
+                const auto size = std::min<std::size_t>(
+                    length, static_cast<std::size_t>(end - it));
+                output.append(it, size);
+                it += size;
+            } break;
+            case Argument::signed_integer: {
+                auto value = std::int64_t{};
+
+                if (copy(value)) { output.append(std::to_string(value)); }
+            } break;
+            case Argument::unsigned_integer: {
+                auto value = std::uint64_t{};
+
+                if (copy(value)) { output.append(std::to_string(value)); }
+            } break;
+            case Argument::floating_point: {
+                auto value = double{};
+
+                if (copy(value)) { output.append(std::to_string(value)); }
+            } break;
+            default: {
+
+                return output;
+            }
+        }
+    }
+
+    return output;
+}
+
+auto LogRecord::Truncate(const std::size_t size) noexcept -> void
+{
+    static constexpr auto marker = std::string_view{" [truncated]"};
+    static constexpr auto overhead =
+        1u + sizeof(std::uint32_t) + marker.size();
+
+    if (size >= buffer_.size()) { return; }
+
+    auto text = Format(Bytes());
+    Clear();
+
+    if (size < overhead) { return; }
+
+    text.resize(std::min(text.size(), size - overhead));
+    text.append(marker);
+    Add(text);
+}
+
+LogRecord::~LogRecord() = default;
+}  // namespace opentxs::util
+
+namespace opentxs::util
+{
+LogRing::LogRing(std::size_t capacity) noexcept
+    : capacity_(std::max(capacity, sizeof(Header) + 1u))
+    // NOTE the storage is deliberately left uninitialized so that pages are
+    // only committed once a thread actually logs enough to touch them
+    , data_(new char[capacity_])
+    , scratch_()
+    , read_(0)
+    , write_(0)
+{
+}
+
+auto LogRing::Empty() const noexcept -> bool
+{
+    return read_.load(std::memory_order_acquire) ==
+           write_.load(std::memory_order_acquire);
+}
+
+auto LogRing::MaxRecord() const noexcept -> std::size_t
+{
+    return capacity_ - sizeof(Header);
+}
+
+auto LogRing::Pop(const Callback& cb) noexcept -> std::size_t
+{
+    auto count = std::size_t{0};
+    auto position = read_.load(std::memory_order_relaxed);
+    const auto end = write_.load(std::memory_order_acquire);
+
+    while (position < end) {
+        auto header = Header{};
+        read(position, &header, sizeof(header));
+        position += sizeof(header);
+        scratch_.resize(header.size_);
+        read(position, scratch_.data(), header.size_);
+        position += header.size_;
+        read_.store(position, std::memory_order_release);
+        cb(header.level_, {scratch_.data(), scratch_.size()});
+        ++count;
+    }
+
+    return count;
+}
+
+auto LogRing::Push(const int level, const ReadView record) noexcept -> bool
+{
+    const auto required = sizeof(Header) + record.size();
+    const auto position = write_.load(std::memory_order_relaxed);
+    const auto used = position - read_.load(std::memory_order_acquire);
+
+    if ((capacity_ - used) < required) { return false; }
+
+    const auto header =
+        Header{static_cast<std::uint32_t>(record.size()), level};
+    write(position, &header, sizeof(header));
+    write(position + sizeof(header), record.data(), record.size());
+    write_.store(position + required, std::memory_order_release);
+
+    return true;
+}
+
+auto LogRing::read(std::size_t position, void* out, std::size_t size)
+    const noexcept -> void
+{
+    const auto offset = position % capacity_;
+    const auto first = std::min(size, capacity_ - offset);
+    auto* dest = static_cast<char*>(out);
+    std::memcpy(dest, data_.get() + offset, first);
+    std::memcpy(dest + first, data_.get(), size - first);
+}
+
+auto LogRing::write(
+    std::size_t position,
+    const void* in,
+    std::size_t size) noexcept -> void
+{
+    const auto offset = position % capacity_;
+    const auto first = std::min(size, capacity_ - offset);
+    const auto* src = static_cast<const char*>(in);
+    std::memcpy(data_.get() + offset, src, first);
+    std::memcpy(data_.get(), src + first, size - first);
+}
+
+LogRing::~LogRing() = default;
+}  // namespace opentxs::util
@@ -0,0 +1,115 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::util
+{
+/** Binary encoding of the arguments of a log message
+ *
+ *  Text is copied verbatim and numeric arguments are stored in their native
+ *  representation. Conversion to text happens in Format, which is called by
+ *  the log consumer rather than by the thread which produced the message.
+ */
+class LogRecord
+{
+public:
+    static auto Format(const ReadView record) noexcept -> UnallocatedCString;
+
+    auto Add(const ReadView text) noexcept -> void;
+    auto Add(const std::int64_t value) noexcept -> void;
+    auto Add(const std::uint64_t value) noexcept -> void;
+    auto Add(const double value) noexcept -> void;
+    auto Bytes() const noexcept -> ReadView;
+    auto Clear() noexcept -> void;
+    /** Replaces the record with a single text argument containing as much of
+     *  its formatted text as fits in size bytes, followed by a marker
+     */
+    auto Truncate(const std::size_t size) noexcept -> void;
+    auto empty() const noexcept -> bool { return buffer_.empty(); }
+
+    LogRecord() noexcept;
+
+    ~LogRecord();
+
+private:
+    enum class Argument : std::uint8_t {
+        text = 0,
+        signed_integer = 1,
+        unsigned_integer = 2,
+        floating_point = 3,
+    };
+
+    UnallocatedVector<char> buffer_;
+
+    auto append(
+        const Argument type,
+        const void* data,
+        std::size_t size) noexcept -> void;
+};
+
+/** Single producer, single consumer ring buffer of log records
+ *
+ *  The producer and the consumer never share a lock. Each side only writes
+ *  its own position and publishes it with release semantics after the
+ *  corresponding bytes have been written or read.
+ */
+class LogRing
+{
+public:
+    using Callback = std::function<void(int level, const ReadView record)>;
+
+    static constexpr auto default_capacity_ = std::size_t{256u * 1024u};
+
+    auto Empty() const noexcept -> bool;
+    /// The size of the largest record which fits in an empty ring
+    auto MaxRecord() const noexcept -> std::size_t;
+    /// Called only by the consumer
+    auto Pop(const Callback& cb) noexcept -> std::size_t;
+    /// Called only by the producer
+    ///
+    /// \returns false if the ring does not have enough free space
+    auto Push(const int level, const ReadView record) noexcept -> bool;
+
+    LogRing(std::size_t capacity = default_capacity_) noexcept;
+
+    ~LogRing();
+
+private:
+    struct Header {
+        std::uint32_t size_;
+        std::int32_t level_;
+    };
+
+    // NOTE keeps the positions written by different threads in separate
+    // cache lines
+    static constexpr auto cache_line_ = std::size_t{64};
+
+    const std::size_t capacity_;
+    const std::unique_ptr<char[]> data_;
+    UnallocatedVector<char> scratch_;
+    alignas(cache_line_) std::atomic<std::size_t> read_;
+    alignas(cache_line_) std::atomic<std::size_t> write_;
+
+    auto read(std::size_t position, void* out, std::size_t size) const noexcept
+        -> void;
+    auto write(std::size_t position, const void* in, std::size_t size) noexcept
+        -> void;
+
+    LogRing(const LogRing&) = delete;
+    LogRing(LogRing&&) = delete;
+    auto operator=(const LogRing&) -> LogRing& = delete;
+    auto operator=(LogRing&&) -> LogRing& = delete;
+};
+}  // namespace opentxs::util
@@ -7,11 +7,19 @@
 #include "1_Internal.hpp"              // IWYU pragma: associated
 #include "util/MappedFileStorage.hpp"  // IWYU pragma: associated
 
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif  // defined(__linux__)
 #include <boost/filesystem.hpp>
 #include <boost/iostreams/device/mapped_file.hpp>
+#include <lmdb.h>
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -20,6 +28,7 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "util/FileSize.hpp"
+#include "util/ScopeGuard.hpp"
 
 namespace fs = boost::filesystem;
 
@@ -46,16 +55,238 @@ constexpr auto get_start_position(const std::size_t file) noexcept
     return file * mapped_file_size();
 }
 
+// Free extents are grouped by the smallest power of two which can contain them
+constexpr auto get_size_class(const std::size_t bytes) noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+
+    while ((std::size_t{1} << output) < bytes) { ++output; }
+
+    return output;
+}
+
+// Remainders smaller than this are not worth tracking
+constexpr auto min_extent_ = std::size_t{64};
+
+auto fragmentation(const std::size_t free, const std::size_t largest) noexcept
+    -> double
+{
+    if (0u == free) { return 0.0; }
+
+    return 1.0 - (static_cast<double>(largest) / static_cast<double>(free));
+}
+
+auto CompactionReport::FragmentationAfter() const noexcept -> double
+{
+    return fragmentation(free_bytes_after_, largest_free_after_);
+}
+
+auto CompactionReport::FragmentationBefore() const noexcept -> double
+{
+    return fragmentation(free_bytes_before_, largest_free_before_);
+}
+
 struct MappedFileStorage::Imp {
     using FileCounter = std::size_t;
+    // NOTE size first so lower_bound finds the smallest extent which fits
+    using Extent = std::pair<IndexData::ItemSize, IndexData::MemoryPosition>;
+    using FreeList = UnallocatedMap<std::size_t, UnallocatedSet<Extent>>;
+    // NOTE position to size, never spanning more than one file
+    using Ranges =
+        UnallocatedMap<IndexData::MemoryPosition, IndexData::ItemSize>;
+    using Live = UnallocatedVector<std::pair<IndexData, std::size_t>>;
+    // NOTE LMDB reuses the same MDB_txn object for consecutive write
+    // transactions so they are told apart by id
+    using TransactionID = std::size_t;
+
+    static auto id(LMDB::Transaction& tx) noexcept -> TransactionID
+    {
+        return static_cast<TransactionID>(::mdb_txn_id(tx));
+    }
 
     LMDB& lmdb_;
     const UnallocatedCString path_prefix_;
     const UnallocatedCString filename_prefix_;
     const int table_;
     const std::size_t key_;
+    const int free_table_;
     mutable IndexData::MemoryPosition next_position_;
     mutable UnallocatedVector<boost::iostreams::mapped_file> files_;
+    // NOTE free_ only contains extents whose release has been committed.
+    // Extents released by a transaction which has not been committed yet might
+    // still be referenced if that transaction is aborted, so they wait in
+    // pending_, along with the id of the releasing transaction, until that
+    // transaction has finished.
+    FreeList free_;
+    UnallocatedDeque<std::pair<TransactionID, IndexData>> pending_;
+    TransactionID promoted_;
+
+    static auto add_range(
+        Ranges& ranges,
+        IndexData::MemoryPosition position,
+        IndexData::ItemSize size) noexcept -> void
+    {
+        while (0u < size) {
+            const auto offset = get_offset(position).second;
+            const auto bytes = std::min(size, mapped_file_size() - offset);
+            ranges.emplace(position, bytes);
+            position += bytes;
+            size -= bytes;
+        }
+    }
+    static auto find_gaps(
+        const Live& live,
+        const IndexData::MemoryPosition end,
+        Ranges& output) noexcept -> bool
+    {
+        auto position = IndexData::MemoryPosition{0};
+
+        for (const auto& [index, item] : live) {
+            const auto stop = index.position_ + index.size_;
+
+            if ((index.position_ < position) || (stop > end)) { return false; }
+
+            add_range(output, position, index.position_ - position);
+            position = stop;
+        }
+
+        add_range(output, position, end - position);
+
+        return true;
+    }
+    static auto first_fit(Ranges& ranges, const IndexData& index) noexcept
+        -> Ranges::iterator
+    {
+        for (auto i = ranges.begin(); ranges.end() != i; ++i) {
+            if (i->first >= index.position_) { break; }
+
+            if (i->second >= index.size_) { return i; }
+        }
+
+        return ranges.end();
+    }
+    static auto insert(FreeList& list, const IndexData& extent) noexcept
+        -> void
+    {
+        list[get_size_class(extent.size_)].emplace(
+            extent.size_, extent.position_);
+    }
+    static auto merge(Ranges& ranges, IndexData extent) noexcept -> void
+    {
+        const auto file = get_offset(extent.position_).first;
+        auto next = ranges.lower_bound(extent.position_);
+
+        if ((ranges.end() != next) &&
+            (next->first == (extent.position_ + extent.size_)) &&
+            (get_offset(next->first).first == file)) {
+            extent.size_ += next->second;
+            next = ranges.erase(next);
+        }
+
+        if (ranges.begin() != next) {
+            auto prior = std::prev(next);
+
+            if (((prior->first + prior->second) == extent.position_) &&
+                (get_offset(prior->first).first == file)) {
+                prior->second += extent.size_;
+
+                return;
+            }
+        }
+
+        ranges.emplace_hint(next, extent.position_, extent.size_);
+    }
+    static auto subtract(Ranges& ranges, const IndexData& extent) noexcept
+        -> void
+    {
+        const auto start = extent.position_;
+        const auto end = start + extent.size_;
+        auto i = ranges.upper_bound(start);
+
+        if (ranges.begin() != i) { --i; }
+
+        while ((ranges.end() != i) && (i->first < end)) {
+            const auto position = i->first;
+            const auto stop = position + i->second;
+
+            if (stop <= start) {
+                ++i;
+
+                continue;
+            }
+
+            i = ranges.erase(i);
+
+            if (position < start) {
+                ranges.emplace(position, start - position);
+            }
+
+            if (stop > end) {
+                ranges.emplace(end, stop - end);
+
+                break;
+            }
+        }
+    }
+    static auto summarize(
+        const Ranges& ranges,
+        std::size_t& count,
+        std::size_t& bytes,
+        std::size_t& largest) noexcept -> void
+    {
+        count = ranges.size();
+        bytes = 0u;
+        largest = 0u;
+
+        for (const auto& [position, size] : ranges) {
+            bytes += size;
+            largest = std::max(largest, size);
+        }
+    }
+
+    auto allocate(
+        LMDB::Transaction& tx,
+        std::size_t bytes,
+        IndexData& index) noexcept -> bool
+    {
+        promote(tx);
+
+        for (auto i = free_.lower_bound(get_size_class(bytes));
+             free_.end() != i;
+             ++i) {
+            auto& extents = i->second;
+            const auto j = extents.lower_bound(Extent{bytes, 0u});
+
+            if (extents.end() == j) { continue; }
+
+            const auto extent = IndexData{j->second, j->first};
+            extents.erase(j);
+
+            if (extents.empty()) { free_.erase(i); }
+
+            const auto deleted = lmdb_.Delete(
+                free_table_, get_size_class(extent.size_), tsv(extent), tx);
+
+            if (false == deleted) {
+                LogError()(OT_PRETTY_CLASS())("Failed to remove free extent")
+                    .Flush();
+
+                return false;
+            }
+
+            index.position_ = extent.position_;
+            index.size_ = bytes;
+
+            if (const auto remaining = extent.size_ - bytes;
+                min_extent_ <= remaining) {
+                release(tx, IndexData{extent.position_ + bytes, remaining});
+            }
+
+            return true;
+        }
+
+        return false;
+    }
 
     auto calculate_file_name(
         const UnallocatedCString& prefix,
@@ -71,12 +302,157 @@ struct MappedFileStorage::Imp {
 
         return path.string();
     }
+    auto compact(
+        LMDB::Transaction& tx,
+        const UnallocatedVector<Item>& items,
+        RelocateCallback& cb,
+        std::size_t budget) noexcept -> std::optional<CompactionReport>
+    {
+        auto report = CompactionReport{};
+        auto live = Live{};
+        live.reserve(items.size());
+
+        for (auto i = std::size_t{0}; i < items.size(); ++i) {
+            const auto& index = items[i].index_;
+
+            if (0u == index.size_) { continue; }
+
+            live.emplace_back(index, i);
+            ++report.live_items_;
+            report.live_bytes_ += index.size_;
+        }
+
+        std::sort(live.begin(), live.end(), [](const auto& l, const auto& r) {
+            return l.first.position_ < r.first.position_;
+        });
+        auto free = Ranges{};
+
+        if (false == find_gaps(live, next_position_, free)) {
+            LogError()(OT_PRETTY_CLASS())("Live items overlap").Flush();
+
+            return std::nullopt;
+        }
+
+        summarize(
+            free,
+            report.free_extents_before_,
+            report.free_bytes_before_,
+            report.largest_free_before_);
+        // NOTE extents vacated during this pass might still be viewed by
+        // readers so only space which was already free can be punched
+        auto punch = free;
+
+        for (auto i = live.rbegin(); i != live.rend(); ++i) {
+            if (report.relocated_bytes_ >= budget) { break; }
+
+            auto& [index, item] = *i;
+
+            if (false == items[item].movable_) { continue; }
+
+            const auto target = first_fit(free, index);
+
+            if (free.end() == target) { continue; }
+
+            const auto destination = IndexData{target->first, index.size_};
+            const auto remaining = target->second - index.size_;
+            free.erase(target);
+
+            if (0u < remaining) {
+                free.emplace(destination.position_ + index.size_, remaining);
+            }
+
+            subtract(punch, destination);
+            copy(index, destination);
+
+            if (false == cb(tx, item, destination)) {
+                LogError()(OT_PRETTY_CLASS())("Failed to relocate item")
+                    .Flush();
+
+                return std::nullopt;
+            }
+
+            merge(free, index);
+            ++report.relocated_items_;
+            report.relocated_bytes_ += index.size_;
+            index = destination;
+        }
+
+        const auto end = [&] {
+            auto output = IndexData::MemoryPosition{0};
+
+            for (const auto& [index, item] : live) {
+                output = std::max(output, index.position_ + index.size_);
+            }
+
+            return output;
+        }();
+        free.erase(free.lower_bound(end), free.end());
+        report.trimmed_bytes_ = next_position_ - end;
+        summarize(
+            free,
+            report.free_extents_after_,
+            report.free_bytes_after_,
+            report.largest_free_after_);
+
+        if (false == lmdb_.Delete(free_table_, tx)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to clear free list").Flush();
+
+            return std::nullopt;
+        }
+
+        auto list = FreeList{};
+
+        for (const auto& [position, size] : free) {
+            if (min_extent_ > size) { continue; }
+
+            const auto extent = IndexData{position, size};
+            const auto stored = lmdb_.Store(
+                free_table_, get_size_class(size), tsv(extent), tx);
+
+            if (false == stored.first) {
+                LogError()(OT_PRETTY_CLASS())("Failed to store free list")
+                    .Flush();
+
+                return std::nullopt;
+            }
+
+            insert(list, extent);
+        }
+
+        if (false == lmdb_.Store(table_, tsv(key_), tsv(end), tx).first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to update write position")
+                .Flush();
+
+            return std::nullopt;
+        }
+
+        if (false == tx.Finalize(true)) {
+            LogError()(OT_PRETTY_CLASS())("Database error").Flush();
+
+            return std::nullopt;
+        }
+
+        next_position_ = end;
+        free_.swap(list);
+        pending_.clear();
+        promoted_ = 0;
+        report.reclaimed_bytes_ = punch_holes(punch);
+
+        return report;
+    }
     auto check_file(const FileCounter position) noexcept -> void
     {
         while (files_.size() < (position + 1)) {
             create_or_load(path_prefix_, files_.size(), files_);
         }
     }
+    auto copy(const IndexData& from, const IndexData& to) noexcept -> void
+    {
+        const auto [file, offset] = get_offset(to.position_);
+        check_file(file);
+        const auto bytes = get_read_view(from);
+        std::memcpy(files_.at(file).data() + offset, bytes.data(), to.size_);
+    }
     auto create_or_load(
         const UnallocatedCString& prefix,
         const FileCounter file,
@@ -148,20 +524,44 @@ struct MappedFileStorage::Imp {
             return output();
         }
 
-        increment_index(index, bytes);
-        LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
-            index.position_)
-            .Flush();
-        const auto nextPosition = index.position_ + bytes;
+        const auto previous = index;
+        const auto start = next_position_;
+        const auto reused = allocate(tx, bytes, index);
+
+        if (reused) {
+            LogDebug()(OT_PRETTY_CLASS())(
+                "Storing new item in free extent at position ")(
+                index.position_)
+                .Flush();
+        } else {
+            increment_index(index, bytes);
+            LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
+                index.position_)
+                .Flush();
+        }
 
         if (cb && (false == cb(tx))) { return {}; }
 
-        if (false == update_next_position(nextPosition, tx)) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Failed to update next write position")
-                .Flush();
+        if (false == release(tx, previous)) { return {}; }
 
-            return {};
+        if (false == reused) {
+            // NOTE increment_index skips the end of a file which is too small
+            // to hold the new item
+            const auto skipped = IndexData{start, index.position_ - start};
+
+            if ((min_extent_ <= skipped.size_) &&
+                (false == release(tx, skipped))) {
+
+                return {};
+            }
+
+            if (false == update_next_position(index.position_ + bytes, tx)) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Failed to update next write position")
+                    .Flush();
+
+                return {};
+            }
         }
 
         return output();
@@ -199,6 +599,28 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto load_free() noexcept -> FreeList
+    {
+        auto output = FreeList{};
+        lmdb_.Read(
+            free_table_,
+            [&](const auto, const auto value) {
+                auto extent = IndexData{};
+
+                if (sizeof(extent) == value.size()) {
+                    std::memcpy(
+                        static_cast<void*>(&extent),
+                        value.data(),
+                        value.size());
+                    insert(output, extent);
+                }
+
+                return true;
+            },
+            LMDB::Dir::Forward);
+
+        return output;
+    }
     auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
         -> IndexData::MemoryPosition
     {
@@ -220,6 +642,107 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto promote(LMDB::Transaction& tx) noexcept -> void
+    {
+        // NOTE only one write transaction exists at a time so every
+        // transaction which released a pending extent, other than tx itself,
+        // has either been committed or aborted by now
+        const auto current = id(tx);
+
+        if (current == promoted_) { return; }
+
+        promoted_ = current;
+        auto remaining = decltype(pending_){};
+
+        for (const auto& [released, extent] : pending_) {
+            if (released == current) {
+                remaining.emplace_back(released, extent);
+
+                continue;
+            }
+
+            const auto key = get_size_class(extent.size_);
+
+            // NOTE an extent which is missing from free_table_ was released by
+            // an aborted transaction and is still occupied
+            if (lmdb_.Exists(free_table_, tsv(key), tsv(extent))) {
+                insert(free_, extent);
+            }
+        }
+
+        pending_.swap(remaining);
+    }
+    auto punch_holes([[maybe_unused]] const Ranges& ranges) noexcept
+        -> std::size_t
+    {
+        auto output = std::size_t{0};
+#if defined(__linux__)
+        const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        auto current = std::optional<FileCounter>{};
+        auto fd = -1;
+        auto post = ScopeGuard{[&] {
+            if (0 <= fd) { ::close(fd); }
+        }};
+
+        for (const auto& [position, size] : ranges) {
+            const auto [file, offset] = get_offset(position);
+            const auto start = ((offset + page - 1u) / page) * page;
+            const auto stop = ((offset + size) / page) * page;
+
+            if (stop <= start) { continue; }
+
+            if (current != file) {
+                if (0 <= fd) { ::close(fd); }
+
+                current = file;
+                const auto path = calculate_file_name(path_prefix_, file);
+                fd = ::open(path.c_str(), O_RDWR);
+
+                if (0 > fd) {
+                    LogError()(OT_PRETTY_CLASS())("Failed to open ")(path)
+                        .Flush();
+                }
+            }
+
+            if (0 > fd) { continue; }
+
+            const auto rc = ::fallocate(
+                fd,
+                FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                static_cast<off_t>(start),
+                static_cast<off_t>(stop - start));
+
+            if (0 == rc) {
+                output += stop - start;
+            } else {
+                LogVerbose()(OT_PRETTY_CLASS())("Failed to punch hole: ")(
+                    std::strerror(errno))
+                    .Flush();
+            }
+        }
+#endif  // defined(__linux__)
+
+        return output;
+    }
+    auto release(LMDB::Transaction& tx, const IndexData& extent) noexcept
+        -> bool
+    {
+        if (0u == extent.size_) { return true; }
+
+        const auto result = lmdb_.Store(
+            free_table_, get_size_class(extent.size_), tsv(extent), tx);
+
+        if (false == result.first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to record free extent")
+                .Flush();
+
+            return false;
+        }
+
+        pending_.emplace_back(id(tx), extent);
+
+        return true;
+    }
     auto update_next_position(
         IndexData::MemoryPosition position,
         LMDB::Transaction& tx) noexcept -> bool
@@ -242,14 +765,19 @@ struct MappedFileStorage::Imp {
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false)
+        std::size_t key,
+        int freeTable) noexcept(false)
         : lmdb_(lmdb)
         , path_prefix_(basePath)
         , filename_prefix_(filenamePrefix)
         , table_(table)
         , key_(key)
+        , free_table_(freeTable)
         , next_position_(load_position(lmdb_))
         , files_(init_files(path_prefix_, next_position_))
+        , free_(load_free())
+        , pending_()
+        , promoted_(0)
     {
         static_assert(1 == get_file_count(0));
         static_assert(1 == get_file_count(1));
@@ -265,6 +793,11 @@ struct MappedFileStorage::Imp {
         static_assert(Offset{1, 1} == get_offset(mapped_file_size() + 1u));
         static_assert(0 == get_start_position(0));
         static_assert(mapped_file_size() == get_start_position(1));
+        static_assert(0 == get_size_class(1));
+        static_assert(1 == get_size_class(2));
+        static_assert(2 == get_size_class(3));
+        static_assert(6 == get_size_class(64));
+        static_assert(7 == get_size_class(65));
 
         {
             const auto offset = get_offset(next_position_);
@@ -283,14 +816,30 @@ MappedFileStorage::MappedFileStorage(
     const UnallocatedCString& basePath,
     const UnallocatedCString filenamePrefix,
     int table,
-    std::size_t key) noexcept(false)
+    std::size_t key,
+    int freeTable) noexcept(false)
     : lmdb_(lmdb)
-    , imp_p_(std::make_unique<Imp>(lmdb, basePath, filenamePrefix, table, key))
+    , imp_p_(std::make_unique<Imp>(
+          lmdb,
+          basePath,
+          filenamePrefix,
+          table,
+          key,
+          freeTable))
     , imp_(*imp_p_)
 {
     OT_ASSERT(imp_p_);
 }
 
+auto MappedFileStorage::compact(
+    LMDB::Transaction& tx,
+    const UnallocatedVector<Item>& items,
+    RelocateCallback&& cb,
+    std::size_t budget) const noexcept -> std::optional<CompactionReport>
+{
+    return imp_.compact(tx, items, cb, budget);
+}
+
 auto MappedFileStorage::get_read_view(const IndexData& index) const noexcept
     -> ReadView
 {
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "opentxs/Version.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -25,23 +26,63 @@ struct IndexData {
     ItemSize size_{};
 };
 
+// Describes the backing files before and after a compaction pass. Free space
+// counts every byte below the write position which is not occupied by a live
+// item.
+struct CompactionReport {
+    std::size_t live_items_{};
+    std::size_t live_bytes_{};
+    std::size_t free_extents_before_{};
+    std::size_t free_bytes_before_{};
+    std::size_t largest_free_before_{};
+    std::size_t free_extents_after_{};
+    std::size_t free_bytes_after_{};
+    std::size_t largest_free_after_{};
+    std::size_t relocated_items_{};
+    std::size_t relocated_bytes_{};
+    // Reduction of the write position
+    std::size_t trimmed_bytes_{};
+    // Bytes returned to the filesystem by punching holes
+    std::size_t reclaimed_bytes_{};
+
+    // Fraction of the free space which lies outside the largest free extent
+    auto FragmentationAfter() const noexcept -> double;
+    auto FragmentationBefore() const noexcept -> double;
+};
+
 class MappedFileStorage
 {
 protected:
     using LMDB = opentxs::storage::lmdb::LMDB;
     using UpdateCallback = std::function<bool(LMDB::Transaction&)>;
+    // Called once for every item moved by compact. The inheritor must persist
+    // the new index of the item in the supplied transaction.
+    using RelocateCallback = std::function<
+        bool(LMDB::Transaction&, std::size_t item, const IndexData& index)>;
+
+    struct Item {
+        IndexData index_{};
+        // Items which may be written to outside of the lock held by the
+        // inheritor must not be relocated
+        bool movable_{};
+    };
 
     LMDB& lmdb_;
 
     // NOTE: this class performs no locking. Inheritors must ensure these
-    // functions are not called simultaneously from multiple threads.
+    // functions are not called simultaneously from multiple threads. A view
+    // returned by get_read_view is only valid while the inheritor's lock is
+    // held unless the item is never relocated or replaced.
     auto get_read_view(const IndexData& index) const noexcept -> ReadView;
     // Default construct an IndexData if you just want to append a new item, or
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
     // old items matches the size of the new item; to do otherwise would be
-    // madness. If the size doesn't match then space will be allocated at the
-    // end of the file and we just forget about the old data.
+    // madness. If the size doesn't match then the new item is placed in a
+    // previously released extent if one is large enough, otherwise space will
+    // be allocated at the end of the file. The extent occupied by the old item
+    // is recorded in the free list and becomes eligible for reuse once tx has
+    // been committed, so views of the old item must not be retained.
     //
     // Regardless after this function is called the supplied index will be
     // updated to the location at which the return value points so you should
@@ -57,13 +98,28 @@ protected:
         LMDB::Transaction& tx,
         IndexData& index,
         std::size_t size) const noexcept -> WritableView;
+    // Moves up to budget bytes of movable items into free space closer to the
+    // start of the file, rebuilds the free list from the gaps between live
+    // items, lowers the write position to the end of the last live item, and
+    // punches holes in the backing files for space which was already free
+    // before this pass. Extents vacated by relocation are punched by the
+    // following pass.
+    //
+    // items must contain every live item in the storage. tx is committed by
+    // this function.
+    auto compact(
+        LMDB::Transaction& tx,
+        const UnallocatedVector<Item>& items,
+        RelocateCallback&& cb,
+        std::size_t budget) const noexcept -> std::optional<CompactionReport>;
 
     MappedFileStorage(
         opentxs::storage::lmdb::LMDB& lmdb,
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false);
+        std::size_t key,
+        int freeTable) noexcept(false);
 
     virtual ~MappedFileStorage();
 
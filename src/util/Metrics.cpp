@@ -0,0 +1,510 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"      // IWYU pragma: associated
+#include "1_Internal.hpp"    // IWYU pragma: associated
+#include "util/Metrics.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::metrics
+{
+namespace
+{
+auto escape(std::string_view in, bool quote) noexcept -> UnallocatedCString
+{
+    auto output = UnallocatedCString{};
+    output.reserve(in.size());
+
+    for (const auto c : in) {
+        switch (c) {
+            case '\\': {
+                output.append("\\\\");
+            } break;
+            case '\n': {
+                output.append("\\n");
+            } break;
+            case '"': {
+                if (quote) {
+                    output.append("\\\"");
+                } else {
+                    output.push_back(c);
+                }
+            } break;
+            default: {
+                output.push_back(c);
+            }
+        }
+    }
+
+    return output;
+}
+
+auto format(double value) noexcept -> UnallocatedCString
+{
+    if (std::isnan(value)) { return "NaN"; }
+
+    if (std::isinf(value)) { return (0 < value) ? "+Inf" : "-Inf"; }
+
+    auto out = std::ostringstream{};
+    out.precision(15);
+    out << value;
+
+    return out.str();
+}
+
+auto format(
+    const Labels& labels,
+    std::string_view extraKey = {},
+    std::string_view extraValue = {}) noexcept -> UnallocatedCString
+{
+    if (labels.empty() && extraKey.empty()) { return {}; }
+
+    auto output = UnallocatedCString{"{"};
+    auto first{true};
+    const auto add = [&](std::string_view key, std::string_view value) {
+        if (false == first) { output.push_back(','); }
+
+        first = false;
+        output.append(key);
+        output.append("=\"");
+        output.append(escape(value, true));
+        output.push_back('"');
+    };
+
+    for (const auto& [key, value] : labels) { add(key, value); }
+
+    if (false == extraKey.empty()) { add(extraKey, extraValue); }
+
+    output.push_back('}');
+
+    return output;
+}
+
+// NOTE a thread keeps the same shard for its entire lifetime
+auto shard() noexcept -> std::size_t
+{
+    static auto next = std::atomic<std::size_t>{0};
+    static thread_local const auto index =
+        next.fetch_add(1, std::memory_order_relaxed) % shards_;
+
+    return index;
+}
+}  // namespace
+}  // namespace opentxs::metrics
+
+namespace opentxs::metrics
+{
+Counter::Counter() noexcept
+    : data_()
+{
+}
+
+auto Counter::Add(std::uint64_t value) noexcept -> void
+{
+    data_[shard()].value_.fetch_add(value, std::memory_order_relaxed);
+}
+
+auto Counter::Value() const noexcept -> std::uint64_t
+{
+    auto output = std::uint64_t{0};
+
+    for (const auto& shard : data_) {
+        output += shard.value_.load(std::memory_order_relaxed);
+    }
+
+    return output;
+}
+
+Counter::~Counter() = default;
+}  // namespace opentxs::metrics
+
+namespace opentxs::metrics
+{
+Gauge::Gauge() noexcept
+    : value_(0)
+{
+}
+
+auto Gauge::Add(std::int64_t value) noexcept -> void
+{
+    value_.fetch_add(value, std::memory_order_relaxed);
+}
+
+auto Gauge::Set(std::int64_t value) noexcept -> void
+{
+    value_.store(value, std::memory_order_relaxed);
+}
+
+auto Gauge::Value() const noexcept -> std::int64_t
+{
+    return value_.load(std::memory_order_relaxed);
+}
+
+Gauge::~Gauge() = default;
+}  // namespace opentxs::metrics
+
+namespace opentxs::metrics
+{
+Histogram::Histogram(Bounds bounds) noexcept
+    : bounds_([&] {
+        auto& out = bounds;
+        out.erase(
+            std::remove_if(
+                out.begin(),
+                out.end(),
+                [](const auto& v) { return false == std::isfinite(v); }),
+            out.end());
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+
+        return std::move(out);
+    }())
+    , data_()
+{
+    const auto count = bounds_.size() + 1u;
+
+    for (auto& shard : data_) {
+        shard.buckets_ =
+            std::make_unique<std::atomic<std::uint64_t>[]>(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            shard.buckets_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+auto Histogram::Observe(double value) noexcept -> void
+{
+    const auto bucket = static_cast<std::size_t>(std::distance(
+        bounds_.begin(),
+        std::lower_bound(bounds_.begin(), bounds_.end(), value)));
+    auto& data = data_[shard()];
+    data.buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    auto sum = data.sum_.load(std::memory_order_relaxed);
+
+    while (false == data.sum_.compare_exchange_weak(
+                        sum, sum + value, std::memory_order_relaxed)) {}
+}
+
+auto Histogram::Values() const noexcept -> Snapshot
+{
+    const auto count = bounds_.size() + 1u;
+    auto output = Snapshot{bounds_, {}, 0};
+    auto& buckets = output.buckets_;
+    buckets.assign(count, 0u);
+
+    for (const auto& shard : data_) {
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            buckets[i] += shard.buckets_[i].load(std::memory_order_relaxed);
+        }
+
+        output.sum_ += shard.sum_.load(std::memory_order_relaxed);
+    }
+
+    for (auto i = std::size_t{1}; i < count; ++i) {
+        buckets[i] += buckets[i - 1u];
+    }
+
+    return output;
+}
+
+Histogram::~Histogram() = default;
+}  // namespace opentxs::metrics
+
+namespace opentxs::metrics
+{
+Registry::Registry() noexcept
+    : lock_()
+    , map_()
+{
+}
+
+auto Registry::add(
+    const Lock&,
+    std::string_view name,
+    std::string_view help,
+    Type type,
+    Labels&& labels,
+    Metric&& metric,
+    const Bounds& bounds) const noexcept -> bool
+{
+    if (false == valid_name(name)) {
+        LogError()(OT_PRETTY_CLASS())("invalid metric name ")(
+            UnallocatedCString{name})
+            .Flush();
+
+        return false;
+    }
+
+    std::sort(labels.begin(), labels.end(), [](const auto& l, const auto& r) {
+        return l.first < r.first;
+    });
+
+    for (auto i = labels.begin(); i != labels.end(); ++i) {
+        const auto& key = i->first;
+        const auto duplicate =
+            (labels.begin() != i) && (std::prev(i)->first == key);
+
+        if (duplicate || (false == valid_label(key))) {
+            LogError()(OT_PRETTY_CLASS())("invalid label ")(key)(" for ")(
+                UnallocatedCString{name})
+                .Flush();
+
+            return false;
+        }
+    }
+
+    auto i = map_.find(name);
+
+    if (map_.end() == i) {
+        i = map_.emplace(
+                    UnallocatedCString{name},
+                    Family{type, UnallocatedCString{help}, bounds, {}})
+                .first;
+    } else if (type != i->second.type_) {
+        LogError()(OT_PRETTY_CLASS())("metric ")(UnallocatedCString{name})(
+            " is already registered with a different type")
+            .Flush();
+
+        return false;
+    }
+
+    i->second.series_.emplace_back(std::move(labels), std::move(metric));
+
+    return true;
+}
+
+auto Registry::AddCounter(
+    std::string_view name,
+    std::string_view help,
+    Labels labels) const noexcept -> std::shared_ptr<Counter>
+{
+    auto output = std::make_shared<Counter>();
+    auto lock = Lock{lock_};
+    add(lock,
+        name,
+        help,
+        Type::counter,
+        std::move(labels),
+        std::weak_ptr<const Counter>{output});
+
+    return output;
+}
+
+auto Registry::AddGauge(
+    std::string_view name,
+    std::string_view help,
+    Labels labels) const noexcept -> std::shared_ptr<Gauge>
+{
+    auto output = std::make_shared<Gauge>();
+    auto lock = Lock{lock_};
+    add(lock,
+        name,
+        help,
+        Type::gauge,
+        std::move(labels),
+        std::weak_ptr<const Gauge>{output});
+
+    return output;
+}
+
+auto Registry::AddHistogram(
+    std::string_view name,
+    std::string_view help,
+    Bounds bounds,
+    Labels labels) const noexcept -> std::shared_ptr<Histogram>
+{
+    auto lock = Lock{lock_};
+
+    if (auto i = map_.find(name);
+        (map_.end() != i) && (Type::histogram == i->second.type_)) {
+        bounds = i->second.bounds_;
+    }
+
+    auto output = std::make_shared<Histogram>(std::move(bounds));
+    add(lock,
+        name,
+        help,
+        Type::histogram,
+        std::move(labels),
+        std::weak_ptr<const Histogram>{output},
+        output->Limits());
+
+    return output;
+}
+
+auto Registry::Prometheus() const noexcept -> UnallocatedCString
+{
+    auto output = std::ostringstream{};
+    output.precision(15);
+    auto lock = Lock{lock_};
+
+    for (auto f = map_.begin(); f != map_.end();) {
+        const auto& name = f->first;
+        auto& [type, help, bounds, series] = f->second;
+        // NOTE series with identical labels are merged
+        auto counters = std::map<UnallocatedCString, std::uint64_t>{};
+        auto gauges = std::map<UnallocatedCString, std::int64_t>{};
+        auto histograms = std::map<UnallocatedCString, Histogram::Snapshot>{};
+        const auto collect = [&](const auto& item) {
+            const auto& [key, metric] = item;
+
+            return std::visit(
+                [&](const auto& weak) {
+                    using Value =
+                        typename std::decay_t<decltype(weak)>::element_type;
+                    const auto p = weak.lock();
+
+                    if (false == static_cast<bool>(p)) { return true; }
+
+                    const auto id = format(key);
+
+                    if constexpr (std::is_same_v<Value, const Counter>) {
+                        counters[id] += p->Value();
+                    } else if constexpr (std::is_same_v<Value, const Gauge>) {
+                        gauges[id] += p->Value();
+                    } else {
+                        const auto values = p->Values();
+                        auto& [b, buckets, sum] = histograms[id];
+
+                        if (buckets.empty()) {
+                            buckets = values.buckets_;
+                        } else {
+                            for (auto i = std::size_t{0}; i < buckets.size();
+                                 ++i) {
+                                buckets[i] += values.buckets_[i];
+                            }
+                        }
+
+                        sum += values.sum_;
+                    }
+
+                    return false;
+                },
+                metric);
+        };
+        // NOTE expired series are pruned while collecting
+        series.erase(
+            std::remove_if(series.begin(), series.end(), collect),
+            series.end());
+
+        if (series.empty()) {
+            f = map_.erase(f);
+
+            continue;
+        }
+
+        output << "# HELP " << name << ' ' << escape(help, false) << '\n';
+        output << "# TYPE " << name << ' ';
+
+        switch (type) {
+            case Type::counter: {
+                output << "counter\n";
+
+                for (const auto& [id, value] : counters) {
+                    output << name << id << ' ' << value << '\n';
+                }
+            } break;
+            case Type::gauge: {
+                output << "gauge\n";
+
+                for (const auto& [id, value] : gauges) {
+                    output << name << id << ' ' << value << '\n';
+                }
+            } break;
+            case Type::histogram:
+            default: {
+                output << "histogram\n";
+
+                for (const auto& item : series) {
+                    const auto& key = item.first;
+                    const auto id = format(key);
+                    const auto h = histograms.find(id);
+
+                    if (histograms.end() == h) { continue; }
+
+                    const auto& [b, buckets, sum] = h->second;
+
+                    for (auto i = std::size_t{0}; i < buckets.size(); ++i) {
+                        const auto le = (i < bounds.size())
+                                            ? format(bounds[i])
+                                            : UnallocatedCString{"+Inf"};
+                        output << name << "_bucket" << format(key, "le", le)
+                               << ' ' << buckets[i] << '\n';
+                    }
+
+                    output << name << "_sum" << id << ' ' << format(sum)
+                           << '\n';
+                    output << name << "_count" << id << ' '
+                           << (buckets.empty() ? 0u : buckets.back()) << '\n';
+                    histograms.erase(h);
+                }
+            }
+        }
+
+        ++f;
+    }
+
+    return output.str();
+}
+
+auto Registry::valid_label(std::string_view name) noexcept -> bool
+{
+    // NOTE names beginning with __ are reserved by Prometheus and le is used
+    // by histogram buckets
+    if (name.empty() || (0 == name.compare(0, 2, "__")) || (name == "le")) {
+        return false;
+    }
+
+    for (auto i = std::size_t{0}; i < name.size(); ++i) {
+        const auto c = static_cast<unsigned char>(name[i]);
+        const auto valid =
+            (0 != std::isalpha(c)) || ('_' == c) ||
+            ((0u < i) && (0 != std::isdigit(c)));
+
+        if (false == valid) { return false; }
+    }
+
+    return true;
+}
+
+auto Registry::valid_name(std::string_view name) noexcept -> bool
+{
+    if (name.empty()) { return false; }
+
+    for (auto i = std::size_t{0}; i < name.size(); ++i) {
+        const auto c = static_cast<unsigned char>(name[i]);
+        const auto valid = (0 != std::isalpha(c)) || ('_' == c) ||
+                           (':' == c) || ((0u < i) && (0 != std::isdigit(c)));
+
+        if (false == valid) { return false; }
+    }
+
+    return true;
+}
+
+Registry::~Registry() = default;
+}  // namespace opentxs::metrics
+
+namespace opentxs::metrics
+{
+auto Get() noexcept -> const Registry&
+{
+    static const auto registry = Registry{};
+
+    return registry;
+}
+}  // namespace opentxs::metrics
@@ -0,0 +1,199 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::metrics
+{
+using Label = std::pair<UnallocatedCString, UnallocatedCString>;
+using Labels = UnallocatedVector<Label>;
+using Bounds = UnallocatedVector<double>;
+
+// NOTE every metric spreads its updates over a fixed number of cache lines.
+// Each thread is assigned one of them the first time it updates any metric so
+// that concurrent writers rarely contend for the same line. Readers sum all
+// shards.
+static constexpr auto shards_ = std::size_t{16};
+static constexpr auto cache_line_ = std::size_t{64};
+
+/** Monotonically increasing count of events */
+class Counter
+{
+public:
+    auto Add(std::uint64_t value) noexcept -> void;
+    auto Increment() noexcept -> void { Add(1u); }
+    auto Value() const noexcept -> std::uint64_t;
+
+    Counter() noexcept;
+
+    ~Counter();
+
+private:
+    struct alignas(cache_line_) Shard {
+        std::atomic<std::uint64_t> value_{0};
+    };
+
+    std::array<Shard, shards_> data_;
+
+    Counter(const Counter&) = delete;
+    Counter(Counter&&) = delete;
+    auto operator=(const Counter&) -> Counter& = delete;
+    auto operator=(Counter&&) -> Counter& = delete;
+};
+
+/** Instantaneous value which may increase or decrease
+ *
+ *  Gauges are usually written by a single owner so they are not sharded.
+ */
+class Gauge
+{
+public:
+    auto Add(std::int64_t value) noexcept -> void;
+    auto Set(std::int64_t value) noexcept -> void;
+    auto Value() const noexcept -> std::int64_t;
+
+    Gauge() noexcept;
+
+    ~Gauge();
+
+private:
+    std::atomic<std::int64_t> value_;
+
+    Gauge(const Gauge&) = delete;
+    Gauge(Gauge&&) = delete;
+    auto operator=(const Gauge&) -> Gauge& = delete;
+    auto operator=(Gauge&&) -> Gauge& = delete;
+};
+
+/** Distribution of observed values over a fixed set of buckets */
+class Histogram
+{
+public:
+    struct Snapshot {
+        Bounds bounds_{};
+        /// cumulative counts for every bound, followed by the total count
+        UnallocatedVector<std::uint64_t> buckets_{};
+        double sum_{};
+    };
+
+    auto Limits() const noexcept -> const Bounds& { return bounds_; }
+    auto Observe(double value) noexcept -> void;
+    auto Values() const noexcept -> Snapshot;
+
+    /// bounds are sorted and deduplicated. An implicit +Inf bucket is added.
+    Histogram(Bounds bounds) noexcept;
+
+    ~Histogram();
+
+private:
+    struct alignas(cache_line_) Shard {
+        std::unique_ptr<std::atomic<std::uint64_t>[]> buckets_{};
+        std::atomic<double> sum_{0};
+    };
+
+    const Bounds bounds_;
+    std::array<Shard, shards_> data_;
+
+    Histogram(const Histogram&) = delete;
+    Histogram(Histogram&&) = delete;
+    auto operator=(const Histogram&) -> Histogram& = delete;
+    auto operator=(Histogram&&) -> Histogram& = delete;
+};
+
+/** Process-wide collection of named metrics
+ *
+ *  Components register the metrics they own and keep the returned pointers
+ *  for as long as they exist. The registry only holds weak references, so a
+ *  metric disappears from the exported text once its owner is destroyed.
+ *
+ *  Metrics with the same name form a family which shares a type and a help
+ *  string. Series within a family are distinguished by their labels. If
+ *  several live metrics are registered with identical labels, for example by
+ *  two instances of the same component, their values are summed on export.
+ *
+ *  Invalid names, or names which are already registered with a different
+ *  type, produce a metric which works normally but is never exported.
+ */
+class Registry
+{
+public:
+    auto AddCounter(
+        std::string_view name,
+        std::string_view help,
+        Labels labels = {}) const noexcept -> std::shared_ptr<Counter>;
+    auto AddGauge(
+        std::string_view name,
+        std::string_view help,
+        Labels labels = {}) const noexcept -> std::shared_ptr<Gauge>;
+    /// Every histogram in a family uses the bounds of the first one registered
+    auto AddHistogram(
+        std::string_view name,
+        std::string_view help,
+        Bounds bounds,
+        Labels labels = {}) const noexcept -> std::shared_ptr<Histogram>;
+    /// Text exposition format version 0.0.4
+    auto Prometheus() const noexcept -> UnallocatedCString;
+
+    Registry() noexcept;
+
+    ~Registry();
+
+private:
+    enum class Type : std::uint8_t { counter, gauge, histogram };
+
+    using Metric = std::variant<
+        std::weak_ptr<const Counter>,
+        std::weak_ptr<const Gauge>,
+        std::weak_ptr<const Histogram>>;
+    using Series = UnallocatedVector<std::pair<Labels, Metric>>;
+
+    struct Family {
+        Type type_{};
+        UnallocatedCString help_{};
+        Bounds bounds_{};
+        Series series_{};
+    };
+
+    using Map = std::map<UnallocatedCString, Family, std::less<>>;
+
+    mutable std::mutex lock_;
+    mutable Map map_;
+
+    static auto valid_label(std::string_view name) noexcept -> bool;
+    static auto valid_name(std::string_view name) noexcept -> bool;
+
+    auto add(
+        const Lock& lock,
+        std::string_view name,
+        std::string_view help,
+        Type type,
+        Labels&& labels,
+        Metric&& metric,
+        const Bounds& bounds = {}) const noexcept -> bool;
+
+    Registry(const Registry&) = delete;
+    Registry(Registry&&) = delete;
+    auto operator=(const Registry&) -> Registry& = delete;
+    auto operator=(Registry&&) -> Registry& = delete;
+};
+
+/** The registry shared by every component in the process */
+auto Get() noexcept -> const Registry&;
+}  // namespace opentxs::metrics
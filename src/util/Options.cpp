@@ -48,6 +48,7 @@ struct Options::Imp::Parser {
     static constexpr auto ipv6_connection_mode_{"ipv6_connection_mode"};
     static constexpr auto log_endpoint_{"log_endpoint"};
     static constexpr auto log_level_{"log_level"};
+    static constexpr auto metrics_endpoint_{"metrics_endpoint"};
     static constexpr auto notary_inproc_{"notary_inproc"};
     static constexpr auto notary_bind_ip_{"notary_bind_ip"};
     static constexpr auto notary_bind_port_{"notary_bind_port"};
@@ -59,6 +60,7 @@ struct Options::Imp::Parser {
     static constexpr auto notary_public_port_{"notary_command_port"};
     static constexpr auto notary_terms_{"notary_terms"};
     static constexpr auto storage_plugin_{"ot_storage_plugin"};
+    static constexpr auto ui_update_interval_{"ui_update_interval"};
 
     po::variables_map variables_;
 
@@ -127,6 +129,10 @@ struct Options::Imp::Parser {
                 po::value<int>(),
                 "Log verbosity. Valid values are -1 through 5. Higher numbers "
                 "are more verbose. Default value is 0");
+            out.add_options()(
+                metrics_endpoint_,
+                po::value<UnallocatedCString>(),
+                "ZeroMQ endpoint on which to publish metrics snapshots");
             out.add_options()(
                 notary_bind_ip_,
                 po::value<UnallocatedCString>(),
@@ -175,6 +181,12 @@ struct Options::Imp::Parser {
                 storage_plugin_,
                 po::value<UnallocatedCString>(),
                 "primary opentxs storage plugin");
+            out.add_options()(
+                ui_update_interval_,
+                po::value<int>(),
+                "Minimum number of milliseconds between update notifications "
+                "for a single widget. 0 = notify on every change. Default "
+                "value is 16");
 
             return out;
         }();
@@ -209,6 +221,7 @@ Options::Imp::Imp() noexcept
     , ipv4_connection_mode_(std::nullopt)
     , ipv6_connection_mode_(std::nullopt)
     , log_level_(std::nullopt)
+    , metrics_endpoint_(std::nullopt)
     , notary_bind_inproc_(std::nullopt)
     , notary_bind_ip_(std::nullopt)
     , notary_bind_port_(std::nullopt)
@@ -222,6 +235,7 @@ Options::Imp::Imp() noexcept
     , qt_root_object_(std::nullopt)
     , storage_primary_plugin_(std::nullopt)
     , test_mode_(std::nullopt)
+    , ui_update_interval_(std::nullopt)
 {
 }
 
@@ -239,6 +253,7 @@ Options::Imp::Imp(const Imp& rhs) noexcept
     , ipv4_connection_mode_(rhs.ipv4_connection_mode_)
     , ipv6_connection_mode_(rhs.ipv6_connection_mode_)
     , log_level_(rhs.log_level_)
+    , metrics_endpoint_(rhs.metrics_endpoint_)
     , notary_bind_inproc_(rhs.notary_bind_inproc_)
     , notary_bind_ip_(rhs.notary_bind_ip_)
     , notary_bind_port_(rhs.notary_bind_port_)
@@ -252,6 +267,7 @@ Options::Imp::Imp(const Imp& rhs) noexcept
     , qt_root_object_(rhs.qt_root_object_)
     , storage_primary_plugin_(rhs.storage_primary_plugin_)
     , test_mode_(rhs.test_mode_)
+    , ui_update_interval_(rhs.ui_update_interval_)
 {
 }
 
@@ -346,6 +362,8 @@ auto Options::Imp::import_value(const char* key, const char* value) noexcept
             log_endpoint_ = value;
         } else if (0 == std::strcmp(key, Parser::log_level_)) {
             log_level_ = std::stoi(value);
+        } else if (0 == std::strcmp(key, Parser::metrics_endpoint_)) {
+            metrics_endpoint_ = value;
         } else if (0 == std::strcmp(key, Parser::notary_inproc_)) {
             notary_bind_inproc_ = to_bool(value);
         } else if (0 == std::strcmp(key, Parser::notary_bind_ip_)) {
@@ -368,6 +386,8 @@ auto Options::Imp::import_value(const char* key, const char* value) noexcept
             notary_terms_ = value;
         } else if (0 == std::strcmp(key, Parser::storage_plugin_)) {
             storage_primary_plugin_ = value;
+        } else if (0 == std::strcmp(key, Parser::ui_update_interval_)) {
+            ui_update_interval_ = std::stoi(value);
         }
     } catch (...) {
     }
@@ -494,6 +514,11 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                 log_level_ = value.as<int>();
             } catch (...) {
             }
+        } else if (name == Parser::metrics_endpoint_) {
+            try {
+                metrics_endpoint_ = value.as<UnallocatedCString>();
+            } catch (...) {
+            }
         } else if (name == Parser::notary_bind_ip_) {
             try {
                 notary_bind_ip_ = value.as<UnallocatedCString>();
@@ -564,6 +589,11 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                 storage_primary_plugin_ = value.as<UnallocatedCString>();
             } catch (...) {
             }
+        } else if (name == Parser::ui_update_interval_) {
+            try {
+                ui_update_interval_ = value.as<int>();
+            } catch (...) {
+            }
         }
     }
 }
@@ -658,6 +688,10 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         l.log_level_ = v.value();
     }
 
+    if (const auto& v = r.metrics_endpoint_; v.has_value()) {
+        l.metrics_endpoint_ = v.value();
+    }
+
     if (const auto& v = r.notary_bind_inproc_; v.has_value()) {
         l.notary_bind_inproc_ = v.value();
     }
@@ -711,6 +745,10 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         l.test_mode_ = v.value();
     }
 
+    if (const auto& v = r.ui_update_interval_; v.has_value()) {
+        l.ui_update_interval_ = v.value();
+    }
+
     return out;
 }
 
@@ -864,6 +902,11 @@ auto Options::LogLevel() const noexcept -> int
     return Imp::get(imp_->log_level_);
 }
 
+auto Options::MetricsEndpoint() const noexcept -> const char*
+{
+    return Imp::get(imp_->metrics_endpoint_);
+}
+
 auto Options::NotaryBindIP() const noexcept -> const char*
 {
     return Imp::get(imp_->notary_bind_ip_);
@@ -1014,6 +1057,13 @@ auto Options::SetLogLevel(int level) noexcept -> Options&
     return *this;
 }
 
+auto Options::SetMetricsEndpoint(const char* endpoint) noexcept -> Options&
+{
+    imp_->metrics_endpoint_ = endpoint;
+
+    return *this;
+}
+
 auto Options::SetNotaryBindIP(const char* value) noexcept -> Options&
 {
     imp_->notary_bind_ip_ = value;
@@ -1077,6 +1127,13 @@ auto Options::SetTestMode(bool test) noexcept -> Options&
     return *this;
 }
 
+auto Options::SetUIUpdateInterval(int milliseconds) noexcept -> Options&
+{
+    imp_->ui_update_interval_ = milliseconds;
+
+    return *this;
+}
+
 auto Options::StoragePrimaryPlugin() const noexcept -> const char*
 {
     return Imp::get(imp_->storage_primary_plugin_);
@@ -1087,6 +1144,14 @@ auto Options::TestMode() const noexcept -> bool
     return Imp::get(imp_->test_mode_);
 }
 
+auto Options::UIUpdateInterval() const noexcept -> int
+{
+    // NOTE approximately 60 Hz
+    static constexpr auto defaultInterval = 16;
+
+    return std::max(Imp::get(imp_->ui_update_interval_, defaultInterval), 0);
+}
+
 Options::~Options()
 {
     if (nullptr != imp_) {
@@ -32,6 +32,7 @@ struct Options::Imp final {
     std::optional<ConnectionMode> ipv4_connection_mode_;
     std::optional<ConnectionMode> ipv6_connection_mode_;
     std::optional<int> log_level_;
+    std::optional<UnallocatedCString> metrics_endpoint_;
     std::optional<bool> notary_bind_inproc_;
     std::optional<UnallocatedCString> notary_bind_ip_;
     std::optional<std::uint16_t> notary_bind_port_;
@@ -45,6 +46,7 @@ struct Options::Imp final {
     std::optional<QObject*> qt_root_object_;
     std::optional<UnallocatedCString> storage_primary_plugin_;
     std::optional<bool> test_mode_;
+    std::optional<int> ui_update_interval_;
 
     template <typename T>
     static auto get(const std::optional<T>& data, T defaultValue = {}) noexcept
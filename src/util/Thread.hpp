@@ -18,5 +18,8 @@ enum class ThreadPriority {
 };
 
 auto print(ThreadPriority priority) noexcept -> const char*;
+/// Returns false if the platform does not support thread affinity or if the
+/// core does not exist
+auto SetThisThreadsAffinity(unsigned int core) noexcept -> bool;
 auto SetThisThreadsPriority(ThreadPriority priority) noexcept -> void;
 }  // namespace opentxs
@@ -17,7 +17,6 @@ auto LicenseData() noexcept -> const LicenseMap&
         auto out = LicenseMap{};
         license_argon(out);
         license_base58(out);
-        license_base64(out);
         license_bech32(out);
         license_chaiscript(out);
         license_irrxml(out);
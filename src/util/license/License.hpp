@@ -14,7 +14,6 @@ namespace opentxs
 {
 auto license_argon(LicenseMap& out) noexcept -> void;
 auto license_base58(LicenseMap& out) noexcept -> void;
-auto license_base64(LicenseMap& out) noexcept -> void;
 auto license_bech32(LicenseMap& out) noexcept -> void;
 auto license_chaiscript(LicenseMap& out) noexcept -> void;
 auto license_irrxml(LicenseMap& out) noexcept -> void;
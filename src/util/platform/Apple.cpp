@@ -18,6 +18,14 @@ extern "C" {
 
 namespace opentxs
 {
+auto SetThisThreadsAffinity(unsigned int) noexcept -> bool
+{
+    // NOTE macOS and iOS only support affinity hints between threads, not
+    // binding a thread to a particular core
+
+    return false;
+}
+
 auto SetThisThreadsPriority(ThreadPriority) noexcept -> void
 {
     // TODO
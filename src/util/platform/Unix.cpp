@@ -11,6 +11,7 @@
 #include "util/Thread.hpp"                     // IWYU pragma: associated
 
 extern "C" {
+#include <sched.h>
 #include <sys/resource.h>
 }
 
@@ -24,6 +25,29 @@ extern "C" {
 
 namespace opentxs
 {
+auto SetThisThreadsAffinity(unsigned int core) noexcept -> bool
+{
+    if (CPU_SETSIZE <= core) { return false; }
+
+    auto set = ::cpu_set_t{};
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    const auto rc = ::sched_setaffinity(0, sizeof(set), &set);
+    const auto error = errno;
+
+    if (-1 == rc) {
+        auto buf = std::array<char, 1024>{};
+        const auto* text = ::strerror_r(error, buf.data(), buf.size());
+        LogDebug()(__func__)(": failed to set thread affinity to core ")(
+            core)(" due to: ")(text)
+            .Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
 auto SetThisThreadsPriority(ThreadPriority priority) noexcept -> void
 {
     static const auto map = robin_hood::unordered_flat_map<ThreadPriority, int>{
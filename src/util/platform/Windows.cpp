@@ -31,6 +31,23 @@ extern "C" {
 
 namespace opentxs
 {
+auto SetThisThreadsAffinity(unsigned int core) noexcept -> bool
+{
+    if ((8u * sizeof(DWORD_PTR)) <= core) { return false; }
+
+    const auto mask = DWORD_PTR{1} << core;
+    const auto handle = GetCurrentThread();
+
+    if (0 == SetThreadAffinityMask(handle, mask)) {
+        LogDebug()(__func__)(": failed to set thread affinity to core ")(core)
+            .Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
 auto SetThisThreadsPriority(ThreadPriority priority) noexcept -> void
 {
     static const auto map = robin_hood::unordered_flat_map<ThreadPriority, int>{
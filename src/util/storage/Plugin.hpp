@@ -137,7 +137,7 @@ auto Driver::LoadProto(
     auto valid{false};
 
     if (loaded) {
-        serialized = proto::DynamicFactory<T>(raw.data(), raw.size());
+        serialized = proto::SharedArenaFactory<T>(raw.data(), raw.size());
 
         OT_ASSERT(serialized);
 
@@ -0,0 +1,535 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                         // IWYU pragma: associated
+#include "1_Internal.hpp"                       // IWYU pragma: associated
+#include "util/storage/tree/AccountEvents.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "Proto.hpp"
+#include "internal/serialization/protobuf/Check.hpp"
+#include "internal/serialization/protobuf/verify/StorageAccountEventList.hpp"
+#include "internal/serialization/protobuf/verify/StorageAccountEventSources.hpp"
+#include "internal/serialization/protobuf/verify/StorageAccountEvents.hpp"
+#include "internal/serialization/protobuf/verify/StorageNymList.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
+#include "opentxs/util/storage/Driver.hpp"
+#include "serialization/protobuf/AccountEvent.pb.h"
+#include "serialization/protobuf/StorageAccountEvent.pb.h"
+#include "serialization/protobuf/StorageAccountEventBucket.pb.h"
+#include "serialization/protobuf/StorageAccountEventList.pb.h"
+#include "serialization/protobuf/StorageAccountEventSource.pb.h"
+#include "serialization/protobuf/StorageAccountEventSources.pb.h"
+#include "serialization/protobuf/StorageAccountEvents.pb.h"
+#include "serialization/protobuf/StorageItemHash.pb.h"
+#include "serialization/protobuf/StorageNymList.pb.h"
+#include "util/storage/Plugin.hpp"
+#include "util/storage/tree/Node.hpp"
+
+namespace opentxs::storage
+{
+namespace
+{
+using Position = std::tuple<std::int64_t, UnallocatedCString, std::uint32_t>;
+
+// NOTE a bucket which grows past this many events is split into halves
+constexpr auto max_bucket_ = 128;
+
+auto make_cursor(const proto::StorageAccountEvent& event) noexcept
+    -> UnallocatedCString
+{
+    return std::to_string(event.event().timestamp()) + ':' + event.source() +
+           ':' + std::to_string(event.index());
+}
+
+auto parse(const UnallocatedCString& input, Position& output) noexcept -> bool
+{
+    const auto first = input.find(':');
+    const auto last = input.rfind(':');
+
+    if ((UnallocatedCString::npos == first) || (first == last)) {
+        return false;
+    }
+
+    const auto time = input.substr(0, first);
+    const auto source = input.substr(first + 1u, last - first - 1u);
+    const auto index = input.substr(last + 1u);
+
+    if (time.empty() || source.empty() || index.empty()) { return false; }
+
+    char* end{nullptr};
+    errno = 0;
+    const auto timestamp = std::strtoll(time.c_str(), &end, 10);
+
+    if ((0 != errno) || ('\0' != *end)) { return false; }
+
+    errno = 0;
+    const auto position = std::strtoul(index.c_str(), &end, 10);
+
+    if ((0 != errno) || ('\0' != *end) || ('-' == index.front())) {
+        return false;
+    }
+
+    output = Position{
+        static_cast<std::int64_t>(timestamp),
+        source,
+        static_cast<std::uint32_t>(position)};
+
+    return true;
+}
+
+auto position(const proto::StorageAccountEvent& event) noexcept -> Position
+{
+    return Position{event.event().timestamp(), event.source(), event.index()};
+}
+
+auto position(const proto::StorageAccountEventBucket& bucket) noexcept
+    -> Position
+{
+    return Position{bucket.time(), bucket.source(), bucket.index()};
+}
+
+// NOTE newest first, ties broken by source and then by position within the
+// source
+auto precedes(const Position& lhs, const Position& rhs) noexcept -> bool
+{
+    const auto& [lTime, lSource, lIndex] = lhs;
+    const auto& [rTime, rSource, rIndex] = rhs;
+
+    if (lTime != rTime) { return lTime > rTime; }
+
+    if (lSource != rSource) { return lSource < rSource; }
+
+    return lIndex < rIndex;
+}
+
+// NOTE each bucket holds every event from its first event up to the first
+// event of the following bucket. Positions newer than every bucket belong to
+// the first one.
+auto find_bucket(
+    const proto::StorageAccountEvents& index,
+    const Position& target) noexcept -> int
+{
+    const auto& buckets = index.bucket();
+    const auto it = std::partition_point(
+        buckets.begin(), buckets.end(), [&](const auto& bucket) {
+            return false == precedes(target, position(bucket));
+        });
+
+    if (buckets.begin() == it) { return 0; }
+
+    return static_cast<int>(std::distance(buckets.begin(), it)) - 1;
+}
+}  // namespace
+
+AccountEvents::AccountEvents(
+    const Driver& storage,
+    const UnallocatedCString& hash)
+    : Node(storage, hash)
+{
+    if (check_hash(hash)) {
+        init(hash);
+    } else {
+        blank(2);
+    }
+}
+
+void AccountEvents::init(const UnallocatedCString& hash)
+{
+    std::shared_ptr<proto::StorageNymList> serialized;
+    driver_.LoadProto(hash, serialized);
+
+    if (!serialized) {
+        std::cerr << __func__ << ": Failed to load account event index file."
+                  << std::endl;
+        abort();
+    }
+
+    init_version(2, *serialized);
+
+    for (const auto& it : serialized->nym()) {
+        item_map_.emplace(
+            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
+    }
+}
+
+auto AccountEvents::load(const Lock& lock, const UnallocatedCString& account)
+    const -> std::shared_ptr<proto::StorageAccountEvents>
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    auto output = std::shared_ptr<proto::StorageAccountEvents>{};
+
+    if (const auto it = item_map_.find(account); item_map_.end() != it) {
+        const auto& hash = std::get<0>(it->second);
+
+        if (check_hash(hash) && (false == driver_.LoadProto(hash, output))) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Failed to load event index for account ")(account)
+                .Flush();
+
+            return {};
+        }
+    }
+
+    if (false == bool(output)) {
+        output = std::make_shared<proto::StorageAccountEvents>();
+        output->set_version(1);
+        output->set_account(account);
+    }
+
+    return output;
+}
+
+auto AccountEvents::load_bucket(
+    const proto::StorageAccountEventBucket& bucket) const
+    -> std::shared_ptr<proto::StorageAccountEventList>
+{
+    auto output = std::shared_ptr<proto::StorageAccountEventList>{};
+
+    if (false == driver_.LoadProto(bucket.hash(), output)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to load event bucket ")(
+            bucket.hash())
+            .Flush();
+
+        return {};
+    }
+
+    return output;
+}
+
+auto AccountEvents::load_sources(const proto::StorageAccountEvents& index) const
+    -> std::shared_ptr<proto::StorageAccountEventSources>
+{
+    auto output = std::shared_ptr<proto::StorageAccountEventSources>{};
+    const auto& hash = index.sources();
+
+    if (check_hash(hash) && (false == driver_.LoadProto(hash, output))) {
+        LogError()(OT_PRETTY_CLASS())("Failed to load event sources for ")(
+            "account ")(index.account())
+            .Flush();
+
+        return {};
+    }
+
+    if (false == bool(output)) {
+        output = std::make_shared<proto::StorageAccountEventSources>();
+        output->set_version(1);
+    }
+
+    return output;
+}
+
+auto AccountEvents::Migrate(const Driver& to) const -> bool
+{
+    auto output = Node::Migrate(to);
+    Lock lock(write_lock_);
+
+    for (const auto& item : item_map_) {
+        const auto index = load(lock, item.first);
+
+        if (false == bool(index)) {
+            output = false;
+
+            continue;
+        }
+
+        output &= migrate(index->sources(), to);
+
+        for (const auto& bucket : index->bucket()) {
+            output &= migrate(bucket.hash(), to);
+        }
+    }
+
+    return output;
+}
+
+auto AccountEvents::Page(
+    const UnallocatedCString& account,
+    const UnallocatedCString& cursor,
+    const std::size_t limit,
+    UnallocatedVector<proto::AccountEvent>& output,
+    UnallocatedCString& next,
+    bool& indexed) const -> bool
+{
+    output.clear();
+    next.clear();
+    indexed = false;
+    auto after = Position{};
+    const auto haveCursor = (false == cursor.empty());
+
+    if (haveCursor && (false == parse(cursor, after))) { return false; }
+
+    Lock lock(write_lock_);
+    const auto index = load(lock, account);
+    lock.unlock();
+
+    if (false == bool(index)) { return true; }
+
+    indexed = index->indexed();
+    const auto& buckets = index->bucket();
+
+    for (auto b = haveCursor ? find_bucket(*index, after) : 0;
+         b < buckets.size();
+         ++b) {
+        const auto list = load_bucket(buckets.Get(b));
+
+        if (false == bool(list)) { return false; }
+
+        const auto& events = list->event();
+        auto i = haveCursor ? std::partition_point(
+                                  events.begin(),
+                                  events.end(),
+                                  [&](const auto& event) {
+                                      return false ==
+                                             precedes(after, position(event));
+                                  })
+                            : events.begin();
+
+        for (; i != events.end(); ++i) {
+            output.emplace_back(i->event());
+
+            if ((0u < limit) && (limit == output.size())) {
+                const auto more = (std::next(i) != events.end()) ||
+                                  ((b + 1) < buckets.size());
+
+                if (more) { next = make_cursor(*i); }
+
+                return true;
+            }
+        }
+    }
+
+    return true;
+}
+
+auto AccountEvents::save(const std::unique_lock<std::mutex>& lock) const -> bool
+{
+    if (!verify_write_lock(lock)) {
+        std::cerr << __func__ << ": Lock failure." << std::endl;
+        abort();
+    }
+
+    auto serialized = serialize();
+
+    if (!proto::Validate(serialized, VERBOSE)) { return false; }
+
+    return driver_.StoreProto(serialized, root_);
+}
+
+auto AccountEvents::serialize() const -> proto::StorageNymList
+{
+    proto::StorageNymList serialized;
+    serialized.set_version(version_);
+
+    for (const auto& item : item_map_) {
+        const bool goodID = !item.first.empty();
+        const bool goodHash = check_hash(std::get<0>(item.second));
+        const bool good = goodID && goodHash;
+
+        if (good) {
+            serialize_index(
+                version_, item.first, item.second, *serialized.add_nym());
+        }
+    }
+
+    return serialized;
+}
+
+auto AccountEvents::SetIndexed(const UnallocatedCString& account) -> bool
+{
+    if (account.empty()) { return false; }
+
+    Lock lock(write_lock_);
+    const auto index = load(lock, account);
+
+    if (false == bool(index)) { return false; }
+
+    if (index->indexed()) { return true; }
+
+    index->set_indexed(true);
+
+    if (false == proto::Validate(*index, VERBOSE)) { return false; }
+
+    auto plaintext = UnallocatedCString{};
+
+    return store_proto(lock, *index, account, "", plaintext);
+}
+
+auto AccountEvents::Store(
+    const UnallocatedCString& account,
+    const UnallocatedCString& source,
+    const UnallocatedVector<proto::AccountEvent>& events) -> bool
+{
+    if (account.empty() || source.empty()) { return false; }
+
+    Lock lock(write_lock_);
+    const auto index = load(lock, account);
+
+    if (false == bool(index)) { return false; }
+
+    const auto sources = load_sources(*index);
+
+    if (false == bool(sources)) { return false; }
+
+    auto& directory = *sources->mutable_source();
+    auto entry = std::lower_bound(
+        directory.begin(),
+        directory.end(),
+        source,
+        [](const auto& lhs, const auto& rhs) { return lhs.source() < rhs; });
+    const auto existing =
+        (directory.end() != entry) && (source == entry->source());
+    const auto offset =
+        static_cast<int>(std::distance(directory.begin(), entry));
+    // NOTE only the buckets which hold an old or a new event of the source
+    // are rewritten
+    auto affected = UnallocatedSet<int>{};
+    auto added =
+        UnallocatedMap<int, UnallocatedVector<proto::StorageAccountEvent>>{};
+
+    if (existing) {
+        auto i = std::uint32_t{0};
+
+        for (const auto time : entry->time()) {
+            affected.emplace(find_bucket(*index, Position{time, source, i++}));
+        }
+    }
+
+    auto i = std::uint32_t{0};
+
+    for (const auto& event : events) {
+        auto item = proto::StorageAccountEvent{};
+        item.set_version(1);
+        item.set_source(source);
+        item.set_index(i++);
+        *item.mutable_event() = event;
+        const auto b = find_bucket(*index, position(item));
+        affected.emplace(b);
+        added[b].emplace_back(std::move(item));
+    }
+
+    if (affected.empty()) { return true; }
+
+    const auto& existingBuckets = index->bucket();
+    // NOTE the first event of an account creates its first bucket
+    const auto count = std::max(existingBuckets.size(), added.empty() ? 0 : 1);
+    auto buckets = UnallocatedVector<proto::StorageAccountEventBucket>{};
+
+    for (auto b = 0; b < count; ++b) {
+        if (0u == affected.count(b)) {
+            buckets.emplace_back(existingBuckets.Get(b));
+
+            continue;
+        }
+
+        auto entries = UnallocatedVector<proto::StorageAccountEvent>{};
+
+        if (b < existingBuckets.size()) {
+            const auto list = load_bucket(existingBuckets.Get(b));
+
+            if (false == bool(list)) { return false; }
+
+            for (auto& event : *list->mutable_event()) {
+                if (source != event.source()) {
+                    entries.emplace_back(std::move(event));
+                }
+            }
+        }
+
+        if (auto it = added.find(b); added.end() != it) {
+            std::move(
+                it->second.begin(),
+                it->second.end(),
+                std::back_inserter(entries));
+        }
+
+        std::sort(entries.begin(), entries.end(), [](auto& lhs, auto& rhs) {
+            return precedes(position(lhs), position(rhs));
+        });
+        const auto size = static_cast<int>(entries.size());
+        const auto step = (max_bucket_ < size) ? (max_bucket_ / 2) : size;
+
+        for (auto first = 0; first < size; first += step) {
+            auto list = proto::StorageAccountEventList{};
+            list.set_version(1);
+
+            for (auto n = first; (n < size) && (n < (first + step)); ++n) {
+                *list.add_event() = std::move(entries.at(n));
+            }
+
+            if (false == store_bucket(list, buckets.emplace_back())) {
+                return false;
+            }
+        }
+    }
+
+    if (events.empty()) {
+        if (existing) { directory.erase(entry); }
+    } else {
+        if (false == existing) {
+            directory.Add();
+
+            for (auto n = directory.size() - 1; n > offset; --n) {
+                directory.SwapElements(n, n - 1);
+            }
+        }
+
+        auto& item = directory.at(offset);
+        item.set_version(1);
+        item.set_source(source);
+        item.clear_time();
+
+        for (const auto& event : events) { item.add_time(event.timestamp()); }
+    }
+
+    if (false == proto::Validate(*sources, VERBOSE)) { return false; }
+
+    if (false == driver_.StoreProto(*sources, *index->mutable_sources())) {
+        return false;
+    }
+
+    index->clear_bucket();
+
+    for (auto& bucket : buckets) { *index->add_bucket() = std::move(bucket); }
+
+    if (false == proto::Validate(*index, VERBOSE)) { return false; }
+
+    auto plaintext = UnallocatedCString{};
+
+    return store_proto(lock, *index, account, "", plaintext);
+}
+
+auto AccountEvents::store_bucket(
+    const proto::StorageAccountEventList& list,
+    proto::StorageAccountEventBucket& bucket) const -> bool
+{
+    OT_ASSERT(0 < list.event_size());
+
+    if (false == proto::Validate(list, VERBOSE)) { return false; }
+
+    const auto& first = list.event(0);
+    bucket.set_version(1);
+    bucket.set_time(first.event().timestamp());
+    bucket.set_source(first.source());
+    bucket.set_index(first.index());
+    bucket.set_count(static_cast<std::uint32_t>(list.event_size()));
+
+    return driver_.StoreProto(list, *bucket.mutable_hash());
+}
+}  // namespace opentxs::storage
@@ -0,0 +1,111 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include "Proto.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/util/Container.hpp"
+#include "serialization/protobuf/StorageNymList.pb.h"
+#include "util/storage/tree/Node.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace proto
+{
+class AccountEvent;
+class StorageAccountEventBucket;
+class StorageAccountEventList;
+class StorageAccountEventSources;
+class StorageAccountEvents;
+}  // namespace proto
+
+namespace storage
+{
+class Driver;
+class Nym;
+}  // namespace storage
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::storage
+{
+/** Account activity events, one index per account
+ *
+ *  Events are stored newest first in buckets of at most 128 events. The
+ *  account index only lists the position of the first event in each bucket,
+ *  so a page loads the index and the buckets it returns events from.
+ *
+ *  Events are grouped by the workflow or blockchain transaction which
+ *  produced them. A separate directory records the timestamps of each
+ *  source's events, so replacing the events of a source only rewrites the
+ *  buckets which held or receive them.
+ *
+ *  Paging cursors have the form "timestamp:source:index" and identify the
+ *  last event returned, so a page remains well defined if events are
+ *  inserted between requests.
+ */
+class AccountEvents final : public Node
+{
+private:
+    friend Nym;
+
+    void init(const UnallocatedCString& hash) final;
+    auto save(const std::unique_lock<std::mutex>& lock) const -> bool final;
+    auto load(const Lock& lock, const UnallocatedCString& account) const
+        -> std::shared_ptr<proto::StorageAccountEvents>;
+    auto load_bucket(const proto::StorageAccountEventBucket& bucket) const
+        -> std::shared_ptr<proto::StorageAccountEventList>;
+    auto load_sources(const proto::StorageAccountEvents& index) const
+        -> std::shared_ptr<proto::StorageAccountEventSources>;
+    auto serialize() const -> proto::StorageNymList;
+    auto store_bucket(
+        const proto::StorageAccountEventList& list,
+        proto::StorageAccountEventBucket& bucket) const -> bool;
+
+    AccountEvents(const Driver& storage, const UnallocatedCString& hash);
+    AccountEvents() = delete;
+    AccountEvents(const AccountEvents&) = delete;
+    AccountEvents(AccountEvents&&) = delete;
+    auto operator=(const AccountEvents&) -> AccountEvents = delete;
+    auto operator=(AccountEvents&&) -> AccountEvents = delete;
+
+public:
+    auto Migrate(const Driver& to) const -> bool final;
+    /** Returns false if the cursor can not be parsed or a bucket can not be
+     *  loaded
+     *
+     *  A limit of zero returns every event after the cursor. next is set to
+     *  the cursor for the following page if more events remain, and is
+     *  cleared otherwise. indexed is false until SetIndexed has been called
+     *  for the account.
+     */
+    auto Page(
+        const UnallocatedCString& account,
+        const UnallocatedCString& cursor,
+        const std::size_t limit,
+        UnallocatedVector<proto::AccountEvent>& output,
+        UnallocatedCString& next,
+        bool& indexed) const -> bool;
+
+    /** Records that events which predate the list have been added */
+    auto SetIndexed(const UnallocatedCString& account) -> bool;
+    /** Replaces all events for the account which were produced by source */
+    auto Store(
+        const UnallocatedCString& account,
+        const UnallocatedCString& source,
+        const UnallocatedVector<proto::AccountEvent>& events) -> bool;
+
+    ~AccountEvents() final = default;
+};
+}  // namespace opentxs::storage
@@ -35,6 +35,7 @@
 #include "serialization/protobuf/StorageNym.pb.h"
 #include "serialization/protobuf/StoragePurse.pb.h"
 #include "util/storage/Plugin.hpp"
+#include "util/storage/tree/AccountEvents.hpp"
 #include "util/storage/tree/Bip47Channels.hpp"
 #include "util/storage/tree/Contexts.hpp"
 #include "util/storage/tree/Issuers.hpp"
@@ -138,6 +139,9 @@ Nym::Nym(
     , workflows_lock_()
     , workflows_(nullptr)
     , purse_id_()
+    , account_events_root_(Node::BLANK_HASH)
+    , account_events_lock_()
+    , account_events_(nullptr)
 {
     if (check_hash(hash)) {
         init(hash);
@@ -146,6 +150,17 @@ Nym::Nym(
     }
 }
 
+auto Nym::account_events() const -> storage::AccountEvents*
+{
+    return construct<storage::AccountEvents>(
+        account_events_lock_, account_events_, account_events_root_);
+}
+
+auto Nym::AccountEvents() const -> const storage::AccountEvents&
+{
+    return *account_events();
+}
+
 auto Nym::Alias() const -> UnallocatedCString { return alias_; }
 
 auto Nym::bip47() const -> storage::Bip47Channels*
@@ -369,6 +384,9 @@ void Nym::init(const UnallocatedCString& hash)
 
     // Fields added in version 9
     // NOTE txo field is no longer used
+
+    // Fields added in version 10
+    account_events_root_ = normalize_hash(serialized->accountevents());
 }
 
 auto Nym::issuers() const -> storage::Issuers*
@@ -486,11 +504,18 @@ auto Nym::Migrate(const Driver& to) const -> bool
     output &= issuers()->Migrate(to);
     output &= workflows()->Migrate(to);
     output &= bip47()->Migrate(to);
+    output &= account_events()->Migrate(to);
     output &= migrate(root_, to);
 
     return output;
 }
 
+auto Nym::mutable_AccountEvents() -> Editor<storage::AccountEvents>
+{
+    return editor<storage::AccountEvents>(
+        account_events_root_, account_events_lock_, &Nym::account_events);
+}
+
 auto Nym::mutable_Bip47Channels() -> Editor<storage::Bip47Channels>
 {
     return editor<storage::Bip47Channels>(
@@ -781,6 +806,7 @@ auto Nym::serialize() const -> proto::StorageNym
     serialized.set_issuers(issuers_root_);
     serialized.set_paymentworkflow(workflows_root_);
     serialized.set_bip47(bip47_root_);
+    serialized.set_accountevents(account_events_root_);
 
     for (const auto& [key, hash] : purse_id_) {
         const auto& [server, unit] = key;
@@ -46,6 +46,7 @@ class Purse;
 
 namespace storage
 {
+class AccountEvents;
 class Bip47Channels;
 class Contexts;
 class Driver;
@@ -74,6 +75,7 @@ public:
     auto BlockchainAccountType(const UnallocatedCString& accountID) const
         -> UnitType;
 
+    auto AccountEvents() const -> const storage::AccountEvents&;
     auto Bip47Channels() const -> const storage::Bip47Channels&;
     auto Contexts() const -> const storage::Contexts&;
     auto FinishedReplyBox() const -> const PeerReplies&;
@@ -90,6 +92,7 @@ public:
     auto Threads() const -> const storage::Threads&;
     auto PaymentWorkflows() const -> const storage::PaymentWorkflows&;
 
+    auto mutable_AccountEvents() -> Editor<storage::AccountEvents>;
     auto mutable_Bip47Channels() -> Editor<storage::Bip47Channels>;
     auto mutable_Contexts() -> Editor<storage::Contexts>;
     auto mutable_FinishedReplyBox() -> Editor<PeerReplies>;
@@ -141,7 +144,7 @@ private:
 
     using PurseID = std::pair<OTNotaryID, OTUnitID>;
 
-    static constexpr auto current_version_ = VersionNumber{9};
+    static constexpr auto current_version_ = VersionNumber{10};
     static constexpr auto blockchain_index_version_ = VersionNumber{1};
     static constexpr auto storage_purse_version_ = VersionNumber{1};
 
@@ -205,6 +208,9 @@ private:
     mutable std::mutex workflows_lock_;
     mutable std::unique_ptr<storage::PaymentWorkflows> workflows_;
     UnallocatedMap<PurseID, UnallocatedCString> purse_id_;
+    UnallocatedCString account_events_root_;
+    mutable std::mutex account_events_lock_;
+    mutable std::unique_ptr<storage::AccountEvents> account_events_;
 
     template <typename T, typename... Args>
     auto construct(
@@ -213,6 +219,7 @@ private:
         const UnallocatedCString& root,
         Args&&... params) const -> T*;
 
+    auto account_events() const -> storage::AccountEvents*;
     auto bip47() const -> storage::Bip47Channels*;
     auto sent_request_box() const -> PeerRequests*;
     auto incoming_request_box() const -> PeerRequests*;
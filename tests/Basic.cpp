@@ -50,7 +50,9 @@ auto Home() noexcept -> const ot::UnallocatedCString&
         const auto path = fs::temp_directory_path() /
                           fs::unique_path("opentxs-test-%%%%-%%%%-%%%%-%%%%");
 
-        assert(fs::create_directories(path));
+        [[maybe_unused]] const auto created = fs::create_directories(path);
+
+        assert(created);
 
         return path.string();
     }();
@@ -58,6 +60,13 @@ auto Home() noexcept -> const ot::UnallocatedCString&
     return output;
 }
 
+auto UIArgs() noexcept -> const ot::Options&
+{
+    static const auto output = ot::Options{}.SetUIUpdateInterval(0);
+
+    return output;
+}
+
 auto WipeHome() noexcept -> void
 {
     try {
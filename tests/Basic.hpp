@@ -32,5 +32,10 @@ auto GetQT() noexcept -> QObject*;
 auto Home() noexcept -> const ot::UnallocatedCString&;
 auto StartQT(bool lowlevel = false) noexcept -> void;
 auto StopQT() noexcept -> void;
+/// Session options for fixtures which count individual widget notifications
+///
+/// Disables the coalescing of widget updates so that every update request
+/// produces its own notification.
+auto UIArgs() noexcept -> const ot::Options&;
 auto WipeHome() noexcept -> void;
 }  // namespace ottest
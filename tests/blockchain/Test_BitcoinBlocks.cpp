@@ -22,6 +22,7 @@
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
+#include "internal/blockchain/node/Node.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Context.hpp"
@@ -35,6 +36,7 @@
 #include "opentxs/blockchain/GCS.hpp"
 #include "opentxs/blockchain/block/Block.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/node/BlockOracle.hpp"
 #include "opentxs/blockchain/node/FilterOracle.hpp"
 #include "opentxs/blockchain/node/HeaderOracle.hpp"
 #include "opentxs/blockchain/node/Manager.hpp"
@@ -104,6 +106,25 @@ struct Test_BitcoinBlock : public ::testing::Test {
         EXPECT_EQ(filter.asHex(), genesisFilter->Encode()->asHex());
         EXPECT_EQ(header.asHex(), genesisHeader->asHex());
 
+        const auto& genesis = hOracle.GenesisBlockHash(chain);
+        auto rawFilter = ot::Space{};
+        auto rawBlock = ot::Space{};
+
+        EXPECT_TRUE(network.Internal().FilterOracleInternal().LoadFilterBytes(
+            filterType, genesis, ot::writer(rawFilter)));
+        EXPECT_EQ(
+            filter.asHex(),
+            api_.Factory().Data(ot::reader(rawFilter))->asHex());
+        EXPECT_TRUE(network.BlockOracle().Internal().LoadRaw(
+            genesis, ot::writer(rawBlock)));
+
+        const auto block =
+            api_.Factory().BitcoinBlock(chain, ot::reader(rawBlock));
+
+        EXPECT_TRUE(block);
+
+        if (block) { EXPECT_EQ(block->ID(), genesis); }
+
         return true;
     }
 
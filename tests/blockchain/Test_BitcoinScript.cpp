@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -1924,4 +1925,114 @@ TEST(Test_BitcoinScript, input)
             std::memcmp(bytes.data(), serialized.data(), serialized.size()), 0);
     }
 }
+
+TEST(Test_BitcoinScript, segwit)
+{
+    const auto program = [](auto version, const auto& data) {
+        auto out = ot::UnallocatedVector<std::byte>{
+            static_cast<std::byte>(version),
+            static_cast<std::byte>(data.size())};
+        out.insert(out.end(), data.begin(), data.end());
+
+        return out;
+    };
+    const auto hash_256 = ot::UnallocatedVector<std::byte>(32, std::byte{0x5a});
+    const auto vectors = ot::UnallocatedVector<
+        std::pair<ot::UnallocatedVector<std::byte>, Script::Pattern>>{
+        {program(0x00, hash_160_), Script::Pattern::PayToWitnessPubkeyHash},
+        {program(0x00, hash_256), Script::Pattern::PayToWitnessScriptHash},
+        {program(0x51, hash_256), Script::Pattern::PayToTaproot},
+        {program(0x52, hash_256), Script::Pattern::Custom},
+    };
+
+    for (const auto& [serialized, pattern] : vectors) {
+        const auto script = ot::factory::BitcoinScript(
+            chain_, ot::reader(serialized), Position::Output, false);
+
+        ASSERT_TRUE(script);
+        EXPECT_EQ(pattern, script->Type());
+        ASSERT_EQ(2, script->size());
+
+        const auto expected = ot::ReadView{
+            reinterpret_cast<const char*>(std::next(serialized.data(), 2)),
+            serialized.size() - 2u};
+        const auto view = [&]() -> std::optional<ot::ReadView> {
+            switch (pattern) {
+                case Script::Pattern::PayToWitnessPubkeyHash: {
+
+                    return script->PubkeyHash();
+                }
+                case Script::Pattern::PayToWitnessScriptHash: {
+
+                    return script->ScriptHash();
+                }
+                case Script::Pattern::PayToTaproot: {
+
+                    return script->Pubkey();
+                }
+                default: {
+
+                    return std::nullopt;
+                }
+            }
+        }();
+
+        if (Script::Pattern::Custom != pattern) {
+            ASSERT_TRUE(view);
+            EXPECT_EQ(view.value(), expected);
+        }
+
+        const auto& [opcode, invalid, bytes, data] = script->at(1);
+
+        ASSERT_TRUE(data);
+        EXPECT_EQ(ot::reader(data.value()), expected);
+
+        auto out = ot::Space{};
+
+        EXPECT_TRUE(script->Serialize(ot::writer(out)));
+        ASSERT_EQ(out.size(), serialized.size());
+        EXPECT_EQ(
+            std::memcmp(out.data(), serialized.data(), serialized.size()), 0);
+    }
+}
+
+TEST(Test_BitcoinScript, elements_round_trip)
+{
+    for (const auto* vectors :
+         {&p2pk_good_,
+          &p2pk_bad_,
+          &p2pkh_good_,
+          &p2pkh_bad_,
+          &p2sh_good_,
+          &p2sh_bad_,
+          &data_good_,
+          &multisig_good_,
+          &multisig_bad_}) {
+        for (const auto& serialized : *vectors) {
+            const auto compact = ot::factory::BitcoinScript(
+                chain_, ot::reader(serialized), Position::Output, false);
+
+            ASSERT_TRUE(compact);
+
+            auto elements = b::ScriptElements{};
+            std::copy(
+                compact->begin(), compact->end(), std::back_inserter(elements));
+            const auto decoded = ot::factory::BitcoinScript(
+                chain_, std::move(elements), Position::Output);
+
+            ASSERT_TRUE(decoded);
+            EXPECT_EQ(compact->Type(), decoded->Type());
+            EXPECT_EQ(compact->size(), decoded->size());
+            EXPECT_EQ(compact->CalculateSize(), serialized.size());
+
+            auto out = ot::Space{};
+
+            EXPECT_TRUE(decoded->Serialize(ot::writer(out)));
+            ASSERT_EQ(out.size(), serialized.size());
+            EXPECT_EQ(
+                std::memcmp(out.data(), serialized.data(), serialized.size()),
+                0);
+        }
+    }
+}
 }  // namespace
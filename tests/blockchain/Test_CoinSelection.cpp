@@ -0,0 +1,149 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+
+#include "internal/blockchain/node/wallet/CoinSelection.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Coin = ot::blockchain::node::wallet::Coin;
+using Coins = ot::UnallocatedVector<Coin>;
+using Selection = ot::blockchain::node::wallet::Selection;
+using Strategy = ot::blockchain::node::wallet::SelectionStrategy;
+using Target = ot::blockchain::node::wallet::SelectionTarget;
+
+constexpr auto strategies_ = {
+    Strategy::Automatic,
+    Strategy::BranchAndBound,
+    Strategy::Knapsack,
+    Strategy::LargestFirst,
+};
+
+auto effective(const Target& target, const Coins& coins, const Selection& in)
+    -> std::int64_t
+{
+    auto fee = std::int64_t{0};
+    auto value = std::int64_t{0};
+
+    for (const auto i : in.coins_) {
+        const auto& coin = coins.at(i);
+        value += coin.value_;
+        fee += ((target.fee_rate_ * static_cast<std::int64_t>(coin.bytes_)) +
+                999) /
+               1000;
+    }
+
+    EXPECT_EQ(fee, in.fee_);
+
+    return value - fee;
+}
+
+TEST(CoinSelection, insufficient_funds)
+{
+    const auto coins = Coins{{500, 148}, {300, 148}};
+    const auto target = Target{801, 0, 0};
+
+    for (const auto strategy : strategies_) {
+        EXPECT_FALSE(ot::blockchain::node::wallet::SelectCoins(
+                         strategy, target, coins)
+                         .has_value());
+    }
+}
+
+TEST(CoinSelection, branch_and_bound_avoids_change)
+{
+    const auto coins = Coins{{7, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}};
+    const auto target = Target{10, 0, 0};
+    const auto selection = ot::blockchain::node::wallet::SelectCoins(
+        Strategy::BranchAndBound, target, coins);
+
+    ASSERT_TRUE(selection.has_value());
+    EXPECT_EQ(selection->strategy_, Strategy::BranchAndBound);
+    EXPECT_EQ(selection->excess_, 0);
+    EXPECT_EQ(effective(target, coins, *selection), 10);
+}
+
+TEST(CoinSelection, automatic_falls_back_to_knapsack)
+{
+    const auto coins = Coins{{100, 0}, {50, 0}};
+    const auto target = Target{60, 0, 5};
+    const auto selection = ot::blockchain::node::wallet::SelectCoins(
+        Strategy::Automatic, target, coins);
+
+    ASSERT_TRUE(selection.has_value());
+    EXPECT_EQ(selection->strategy_, Strategy::Knapsack);
+    ASSERT_EQ(selection->coins_.size(), 1u);
+    EXPECT_EQ(selection->coins_.front(), 0u);
+    EXPECT_EQ(selection->excess_, 40);
+}
+
+TEST(CoinSelection, largest_first)
+{
+    const auto coins = Coins{{1, 0}, {9, 0}, {3, 0}, {8, 0}};
+    const auto target = Target{15, 0, 0};
+    const auto selection = ot::blockchain::node::wallet::SelectCoins(
+        Strategy::LargestFirst, target, coins);
+
+    ASSERT_TRUE(selection.has_value());
+    ASSERT_EQ(selection->coins_.size(), 2u);
+    EXPECT_EQ(selection->coins_.at(0), 1u);
+    EXPECT_EQ(selection->coins_.at(1), 3u);
+    EXPECT_EQ(selection->excess_, 2);
+}
+
+TEST(CoinSelection, input_fees)
+{
+    // NOTE at 1000 units per 1000 bytes the first coin costs as much to spend
+    // as it is worth
+    const auto coins = Coins{{148, 148}, {1148, 148}};
+    const auto target = Target{1000, 1000, 0};
+
+    for (const auto strategy : strategies_) {
+        const auto selection =
+            ot::blockchain::node::wallet::SelectCoins(strategy, target, coins);
+
+        ASSERT_TRUE(selection.has_value());
+        ASSERT_EQ(selection->coins_.size(), 1u);
+        EXPECT_EQ(selection->coins_.front(), 1u);
+        EXPECT_EQ(selection->fee_, 148);
+        EXPECT_EQ(selection->excess_, 0);
+    }
+}
+
+TEST(CoinSelection, large_wallet)
+{
+    constexpr auto count = std::size_t{20000};
+    auto rng = std::mt19937_64{};
+    auto values = std::uniform_int_distribution<std::int64_t>{1000, 1000000};
+    auto coins = Coins{};
+    coins.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        coins.push_back({values(rng), (0u == (i % 2u)) ? 148u : 68u});
+    }
+
+    const auto target = Target{25000000, 10000, 546};
+
+    for (const auto strategy : strategies_) {
+        const auto selection =
+            ot::blockchain::node::wallet::SelectCoins(strategy, target, coins);
+
+        ASSERT_TRUE(selection.has_value());
+
+        const auto value = effective(target, coins, *selection);
+
+        EXPECT_GE(value, target.value_);
+        EXPECT_EQ(value - target.value_, selection->excess_);
+    }
+}
+}  // namespace ottest
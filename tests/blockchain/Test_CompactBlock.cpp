@@ -0,0 +1,298 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "bip158/Bip158.hpp"
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ottest
+{
+namespace b = ot::blockchain;
+using CompactBlock = b::p2p::bitcoin::CompactBlock;
+using Reconstructor = b::p2p::bitcoin::CompactBlockReconstructor;
+using PendingBlocks = b::p2p::bitcoin::PendingCompactBlocks;
+
+class Test_CompactBlock : public ::testing::Test
+{
+public:
+    static constexpr auto chain_{b::Type::Bitcoin_testnet3};
+
+    const ot::api::session::Client& api_;
+
+    auto Blocks() const noexcept -> ot::UnallocatedVector<
+        std::shared_ptr<const b::block::bitcoin::Block>>
+    {
+        auto output = ot::UnallocatedVector<
+            std::shared_ptr<const b::block::bitcoin::Block>>{};
+
+        for (const auto& vector : bip_158_vectors_) {
+            const auto raw = vector.Block(api_);
+            auto block = api_.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+            EXPECT_TRUE(block);
+
+            if (block) { output.emplace_back(std::move(block)); }
+        }
+
+        return output;
+    }
+
+    static auto Serialize(const b::block::bitcoin::Block& block) noexcept
+        -> ot::Space
+    {
+        auto output = ot::Space{};
+        block.Serialize(ot::writer(output));
+
+        return output;
+    }
+
+    static auto Serialize(const Reconstructor& block) noexcept -> ot::Space
+    {
+        auto output = ot::Space{};
+        block.Serialize(ot::writer(output));
+
+        return output;
+    }
+
+    // NOTE returns the blocktxn transactions for every missing slot
+    static auto Missing(
+        const b::block::bitcoin::Block& block,
+        const Reconstructor& reconstructed) noexcept
+        -> ot::UnallocatedVector<ot::Space>
+    {
+        auto output = ot::UnallocatedVector<ot::Space>{};
+
+        for (const auto& index : reconstructed.Missing()) {
+            block.at(index)->Internal().Serialize(
+                ot::writer(output.emplace_back()));
+        }
+
+        return output;
+    }
+
+    auto Pending() const noexcept -> ot::UnallocatedVector<
+        std::shared_ptr<const b::block::bitcoin::Block>>
+    {
+        auto output = Blocks();
+        output.erase(
+            std::remove_if(
+                output.begin(),
+                output.end(),
+                [](const auto& block) { return 2u > block->size(); }),
+            output.end());
+
+        return output;
+    }
+
+    Test_CompactBlock()
+        : api_(ot::Context().StartClientSession(0))
+    {
+    }
+};
+
+TEST_F(Test_CompactBlock, differential_encoding)
+{
+    const auto absolute = ot::UnallocatedVector<std::size_t>{0, 1, 5, 6, 100};
+    const auto expected = ot::UnallocatedVector<std::size_t>{0, 0, 3, 0, 93};
+    const auto encoded = CompactBlock::DifferentialEncode(absolute);
+
+    EXPECT_EQ(encoded, expected);
+    EXPECT_EQ(CompactBlock::DifferentialDecode(encoded), absolute);
+    EXPECT_THROW(CompactBlock::DifferentialEncode({1, 1}), std::runtime_error);
+    EXPECT_THROW(
+        CompactBlock::DifferentialDecode({0xffff, 0}), std::runtime_error);
+}
+
+TEST_F(Test_CompactBlock, serialization)
+{
+    for (const auto& pBlock : Blocks()) {
+        const auto& block = *pBlock;
+        const auto compact = CompactBlock{api_, chain_, block, 42};
+
+        EXPECT_EQ(compact.Hash(), block.ID());
+        EXPECT_EQ(compact.size(), block.size());
+        ASSERT_EQ(compact.Prefill().size(), 1u);
+        EXPECT_EQ(compact.Prefill().front().index_, 0u);
+
+        auto bytes = ot::Space{};
+
+        ASSERT_TRUE(compact.Serialize(ot::writer(bytes)));
+
+        const auto decoded = CompactBlock{api_, chain_, ot::reader(bytes)};
+
+        EXPECT_EQ(decoded.Hash(), block.ID());
+        EXPECT_EQ(decoded.ShortTxIDs(), compact.ShortTxIDs());
+        EXPECT_EQ(
+            decoded.Prefill().front().transaction_,
+            compact.Prefill().front().transaction_);
+
+        for (auto i = std::size_t{1}; i < block.size(); ++i) {
+            const auto& tx = *block.at(i);
+
+            EXPECT_EQ(
+                decoded.ShortTxID(decoded.TransactionID(tx)),
+                compact.ShortTxIDs().at(i - 1u));
+        }
+    }
+}
+
+TEST_F(Test_CompactBlock, reconstruct_from_mempool)
+{
+    for (const auto& pBlock : Blocks()) {
+        const auto& block = *pBlock;
+        auto mempool = Reconstructor::Transactions{};
+
+        for (auto i = std::size_t{1}; i < block.size(); ++i) {
+            mempool.emplace_back(block.at(i));
+        }
+
+        auto reconstructed =
+            Reconstructor{CompactBlock{api_, chain_, block, 7}, mempool};
+
+        EXPECT_TRUE(reconstructed.Complete());
+        EXPECT_TRUE(reconstructed.Missing().empty());
+        EXPECT_EQ(Serialize(reconstructed), Serialize(block));
+    }
+}
+
+TEST_F(Test_CompactBlock, reconstruct_with_blocktxn)
+{
+    for (const auto& pBlock : Blocks()) {
+        const auto& block = *pBlock;
+        auto mempool = Reconstructor::Transactions{};
+
+        // NOTE only every other transaction is known in advance
+        for (auto i = std::size_t{2}; i < block.size(); i += 2u) {
+            mempool.emplace_back(block.at(i));
+        }
+
+        auto reconstructed =
+            Reconstructor{CompactBlock{api_, chain_, block, 7}, mempool};
+        const auto missing = reconstructed.Missing();
+
+        ASSERT_EQ(missing.size(), block.size() / 2u);
+
+        if (block.size() > 1u) {
+            EXPECT_FALSE(reconstructed.Complete());
+        }
+
+        auto transactions = ot::UnallocatedVector<ot::Space>{};
+
+        for (const auto& index : missing) {
+            EXPECT_EQ(index % 2u, 1u);
+
+            block.at(index)->Internal().Serialize(
+                ot::writer(transactions.emplace_back()));
+        }
+
+        auto payload = ot::Space{};
+
+        ASSERT_TRUE(CompactBlock::EncodeTransactions(
+            block.ID(), transactions, ot::writer(payload)));
+
+        auto [hash, decoded] = CompactBlock::DecodeTransactions(
+            api_, chain_, ot::reader(payload));
+
+        EXPECT_EQ(hash, block.ID());
+        EXPECT_EQ(decoded, transactions);
+        EXPECT_TRUE(reconstructed.Add(hash, std::move(decoded)));
+        EXPECT_TRUE(reconstructed.Complete());
+        EXPECT_EQ(Serialize(reconstructed), Serialize(block));
+    }
+}
+
+TEST_F(Test_CompactBlock, interleaved_blocktxn)
+{
+    const auto blocks = Pending();
+
+    ASSERT_GE(blocks.size(), 2u);
+
+    const auto& first = *blocks.at(0);
+    const auto& second = *blocks.at(1);
+    const auto now = ot::Clock::now();
+    auto pending = PendingBlocks{};
+
+    EXPECT_TRUE(
+        pending
+            .Add(Reconstructor{CompactBlock{api_, chain_, first, 1}, {}}, now)
+            .empty());
+    EXPECT_TRUE(
+        pending
+            .Add(Reconstructor{CompactBlock{api_, chain_, second, 2}, {}}, now)
+            .empty());
+    EXPECT_EQ(pending.size(), 2u);
+
+    // NOTE the second block's reply arrives before the first block's
+    for (const auto* block : {&second, &first}) {
+        auto reconstructed = pending.Take(block->ID());
+
+        ASSERT_TRUE(reconstructed.has_value());
+        EXPECT_TRUE(reconstructed->Add(
+            block->ID(), Missing(*block, reconstructed.value())));
+        EXPECT_TRUE(reconstructed->Complete());
+        EXPECT_EQ(Serialize(reconstructed.value()), Serialize(*block));
+        EXPECT_FALSE(pending.Take(block->ID()).has_value());
+    }
+
+    EXPECT_EQ(pending.size(), 0u);
+}
+
+TEST_F(Test_CompactBlock, pending_limit_and_timeout)
+{
+    const auto blocks = Pending();
+
+    ASSERT_GE(blocks.size(), 2u);
+
+    const auto& first = *blocks.at(0);
+    const auto& second = *blocks.at(1);
+    const auto timeout = std::chrono::seconds{30};
+    const auto start = ot::Clock::now();
+    auto pending = PendingBlocks{1u, timeout};
+
+    EXPECT_TRUE(
+        pending
+            .Add(Reconstructor{CompactBlock{api_, chain_, first, 1}, {}}, start)
+            .empty());
+
+    const auto displaced = pending.Add(
+        Reconstructor{CompactBlock{api_, chain_, second, 2}, {}},
+        start + std::chrono::seconds{1});
+
+    ASSERT_EQ(displaced.size(), 1u);
+    EXPECT_EQ(displaced.front(), first.ID());
+    EXPECT_EQ(pending.size(), 1u);
+    EXPECT_FALSE(pending.Take(first.ID()).has_value());
+    EXPECT_TRUE(pending.Expire(start + timeout).empty());
+
+    const auto expired =
+        pending.Expire(start + timeout + std::chrono::seconds{2});
+
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired.front(), second.ID());
+    EXPECT_EQ(pending.size(), 0u);
+    EXPECT_FALSE(pending.Take(second.ID()).has_value());
+}
+}  // namespace ottest
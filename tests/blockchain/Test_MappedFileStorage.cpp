@@ -0,0 +1,258 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <lmdb.h>
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+
+#include "Basic.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Index = ot::util::IndexData;
+using LMDB = ot::storage::lmdb::LMDB;
+
+class Storage final : public ot::util::MappedFileStorage
+{
+public:
+    static constexpr auto config_ = 0;
+    static constexpr auto free_ = 1;
+
+    auto Compact(ot::UnallocatedVector<Index>& indices, std::size_t budget)
+        -> std::optional<ot::util::CompactionReport>
+    {
+        auto items = ot::UnallocatedVector<Item>{};
+
+        for (const auto& index : indices) { items.push_back({index, true}); }
+
+        auto tx = lmdb_.TransactionRW();
+
+        return compact(
+            tx,
+            items,
+            [&](auto&, auto item, const auto& index) {
+                indices.at(item) = index;
+
+                return true;
+            },
+            budget);
+    }
+    auto Read(const Index& index) const -> ot::UnallocatedCString
+    {
+        const auto view = get_read_view(index);
+
+        return {view.data(), view.size()};
+    }
+    auto Write(
+        LMDB::Transaction& tx,
+        Index& index,
+        const ot::UnallocatedCString& data) -> bool
+    {
+        auto view = get_write_view(tx, index, data.size());
+
+        if (false == view.valid(data.size())) { return false; }
+
+        std::memcpy(view.data(), data.data(), data.size());
+
+        return true;
+    }
+    auto Write(Index& index, const ot::UnallocatedCString& data) -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        if (false == Write(tx, index, data)) { return false; }
+
+        return tx.Finalize(true);
+    }
+
+    Storage(LMDB& lmdb, const ot::UnallocatedCString& path)
+        : MappedFileStorage(lmdb, path, "test", config_, 0, free_)
+    {
+    }
+};
+
+class Test_MappedFileStorage : public ::testing::Test
+{
+public:
+    static const ot::storage::lmdb::TableNames names_;
+
+    const ot::UnallocatedCString path_;
+    LMDB lmdb_;
+    std::unique_ptr<Storage> storage_;
+
+    static auto data(char c, std::size_t size) -> ot::UnallocatedCString
+    {
+        return ot::UnallocatedCString(size, c);
+    }
+
+    auto reopen() -> void
+    {
+        storage_.reset();
+        storage_ = std::make_unique<Storage>(lmdb_, path_);
+    }
+
+    Test_MappedFileStorage()
+        : path_([] {
+            const auto path = fs::path{Home()} /
+                              fs::unique_path("storage-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path.string();
+        }())
+        , lmdb_(
+              names_,
+              path_,
+              {{Storage::config_, MDB_INTEGERKEY},
+               {Storage::free_, MDB_DUPSORT | MDB_INTEGERKEY}})
+        , storage_(std::make_unique<Storage>(lmdb_, path_))
+    {
+    }
+
+    ~Test_MappedFileStorage() override
+    {
+        storage_.reset();
+
+        try {
+            fs::remove_all(path_);
+        } catch (...) {
+        }
+    }
+};
+
+const ot::storage::lmdb::TableNames Test_MappedFileStorage::names_{
+    {Storage::config_, "config"},
+    {Storage::free_, "free"},
+};
+
+TEST_F(Test_MappedFileStorage, reuses_released_extent)
+{
+    auto a = Index{};
+    auto b = Index{};
+    auto c = Index{};
+
+    ASSERT_TRUE(storage_->Write(a, data('a', 1000)));
+    ASSERT_TRUE(storage_->Write(b, data('b', 500)));
+
+    const auto original = a;
+
+    ASSERT_TRUE(storage_->Write(a, data('A', 2000)));
+    EXPECT_NE(a.position_, original.position_);
+    ASSERT_TRUE(storage_->Write(c, data('c', 800)));
+    EXPECT_EQ(c.position_, original.position_);
+    EXPECT_EQ(storage_->Read(a), data('A', 2000));
+    EXPECT_EQ(storage_->Read(b), data('b', 500));
+    EXPECT_EQ(storage_->Read(c), data('c', 800));
+}
+
+TEST_F(Test_MappedFileStorage, no_reuse_before_commit)
+{
+    auto a = Index{};
+    auto c = Index{};
+
+    ASSERT_TRUE(storage_->Write(a, data('a', 1000)));
+
+    const auto original = a;
+
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        ASSERT_TRUE(storage_->Write(tx, a, data('A', 2000)));
+        ASSERT_TRUE(storage_->Write(tx, c, data('c', 800)));
+        EXPECT_NE(c.position_, original.position_);
+        ASSERT_TRUE(tx.Finalize(true));
+    }
+
+    EXPECT_EQ(storage_->Read(a), data('A', 2000));
+    EXPECT_EQ(storage_->Read(c), data('c', 800));
+}
+
+TEST_F(Test_MappedFileStorage, free_list_is_persistent)
+{
+    auto a = Index{};
+    auto c = Index{};
+
+    ASSERT_TRUE(storage_->Write(a, data('a', 1000)));
+
+    const auto original = a;
+
+    ASSERT_TRUE(storage_->Write(a, data('A', 2000)));
+
+    reopen();
+
+    ASSERT_TRUE(storage_->Write(c, data('c', 1000)));
+    EXPECT_EQ(c.position_, original.position_);
+    EXPECT_EQ(storage_->Read(a), data('A', 2000));
+}
+
+TEST_F(Test_MappedFileStorage, compact)
+{
+    constexpr auto count = std::size_t{32};
+    auto indices = ot::UnallocatedVector<Index>(count);
+    auto expected = ot::UnallocatedVector<ot::UnallocatedCString>{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const auto& item = expected.emplace_back(
+            data(static_cast<char>('a' + (i % 26u)), 4096u + (i * 100u)));
+
+        ASSERT_TRUE(storage_->Write(indices.at(i), item));
+    }
+
+    // NOTE every resized item leaves a hole behind
+    for (auto i = std::size_t{0}; i < count; i += 2u) {
+        auto& item = expected.at(i);
+        item.append(5000u, 'z');
+
+        ASSERT_TRUE(storage_->Write(indices.at(i), item));
+    }
+
+    const auto end = [&] {
+        auto output = std::size_t{0};
+
+        for (const auto& index : indices) {
+            output = std::max(output, index.position_ + index.size_);
+        }
+
+        return output;
+    }();
+    const auto report = storage_->Compact(indices, end);
+
+    ASSERT_TRUE(report.has_value());
+
+    const auto& value = report.value();
+
+    EXPECT_EQ(value.live_items_, count);
+    EXPECT_GT(value.free_bytes_before_, 0u);
+    EXPECT_GT(value.relocated_items_, 0u);
+    EXPECT_GT(value.trimmed_bytes_, 0u);
+    EXPECT_LT(value.free_bytes_after_, value.free_bytes_before_);
+    EXPECT_LE(value.FragmentationAfter(), value.FragmentationBefore());
+    EXPECT_LE(value.reclaimed_bytes_, value.free_bytes_before_);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        EXPECT_EQ(storage_->Read(indices.at(i)), expected.at(i));
+    }
+
+    auto extra = Index{};
+
+    ASSERT_TRUE(storage_->Write(extra, data('!', 100)));
+    EXPECT_EQ(storage_->Read(extra), data('!', 100));
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        EXPECT_EQ(storage_->Read(indices.at(i)), expected.at(i));
+    }
+}
+}  // namespace ottest
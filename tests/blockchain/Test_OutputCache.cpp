@@ -0,0 +1,376 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <lmdb.h>
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Basic.hpp"
+#include "blockchain/database/wallet/OutputCache.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/database/Database.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/blockchain/node/TxoState.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Balance = ot::blockchain::Balance;
+using LMDB = ot::storage::lmdb::LMDB;
+using Outpoint = ot::blockchain::block::Outpoint;
+using OutputCache = ot::blockchain::database::wallet::OutputCache;
+using Outpoints = ot::blockchain::database::wallet::Outpoints;
+using State = ot::blockchain::node::TxoState;
+using Table = ot::blockchain::database::Table;
+using ot::blockchain::database::wallet::all_states;
+
+const auto output_transaction_hex_ = ot::UnallocatedCString{
+    "0100000000010115e180dc28a2327e687facc33f10f2a20da717e5548406f7ae8b4c811072"
+    "f85603000000171600141d7cd6c75c2e86f4cbf98eaed221b30bd9a0b928ffffffff019cae"
+    "f505000000001976a9141d7cd6c75c2e86f4cbf98eaed221b30bd9a0b92888ac0248304502"
+    "2100f764287d3e99b1474da9bec7f7ed236d6c81e793b20c4b5aa1f3051b9a7daa63022016"
+    "a198031d5554dbb855bdbe8534776a4be6958bd8d530dc001c32b828f6f0ab0121038262a6"
+    "c6cec93c2d3ecd6c6072efea86d02ff8e3328bbd0242b20af3425990ac00000000"};
+
+class Test_OutputCache : public ::testing::Test
+{
+public:
+    static constexpr auto chain_ = ot::blockchain::Type::Bitcoin;
+    static const ot::storage::lmdb::TableNames names_;
+
+    const ot::api::session::Client& api_;
+    const ot::UnallocatedCString path_;
+    LMDB lmdb_;
+    const ot::blockchain::block::Position blank_;
+    const std::unique_ptr<const ot::blockchain::block::bitcoin::Transaction>
+        tx_;
+    const ot::OTIdentifier account_a_;
+    const ot::OTIdentifier account_b_;
+    const ot::OTNymID nym_a_;
+    const ot::OTNymID nym_b_;
+    std::shared_mutex lock_;
+    std::unique_ptr<OutputCache> cache_;
+
+    static auto outpoint(std::uint32_t index) -> Outpoint
+    {
+        return {ot::UnallocatedCString(32u, 'a'), index};
+    }
+
+    // NOTE every output belongs to one account and one nym
+    auto add(
+        const ot::eLock& lock,
+        std::uint32_t index,
+        State state,
+        std::int64_t value,
+        const ot::Identifier& account,
+        const ot::identifier::Nym& nym) -> Outpoint
+    {
+        const auto id = outpoint(index);
+        auto output = tx_->Outputs().at(0).Internal().clone();
+        output->SetValue(value);
+        output->SetState(state);
+        output->ForTestingOnlyAddKey(
+            {account.str(), ot::blockchain::crypto::Subchain::External, index});
+        auto tx = lmdb_.TransactionRW();
+
+        EXPECT_TRUE(cache_->AddOutput(lock, id, tx, std::move(output)));
+        EXPECT_TRUE(cache_->AddToState(lock, state, id, tx));
+        EXPECT_TRUE(cache_->AddToAccount(lock, account, id, tx));
+        EXPECT_TRUE(cache_->AddToNym(lock, nym, id, tx));
+        EXPECT_TRUE(tx.Finalize(true));
+
+        return id;
+    }
+    auto change(const ot::eLock& lock, const Outpoint& id, State state)
+        -> void
+    {
+        auto& output = cache_->GetOutput(lock, id);
+        auto tx = lmdb_.TransactionRW();
+
+        ASSERT_TRUE(cache_->ChangeState(lock, output.State(), state, id, tx));
+
+        output.SetState(state);
+
+        ASSERT_TRUE(cache_->UpdateOutput(lock, id, output, tx));
+        ASSERT_TRUE(tx.Finalize(true));
+    }
+    auto expected(const ot::eLock& lock, const Outpoints& outputs) -> Balance
+    {
+        auto confirmed = ot::Amount{0};
+        auto unconfirmed = ot::Amount{0};
+
+        for (const auto& id : outputs) {
+            const auto& output = cache_->GetOutput(lock, id);
+            const auto value = output.Value();
+
+            switch (output.State()) {
+                case State::ConfirmedNew: {
+                    confirmed += value;
+                    unconfirmed += value;
+                } break;
+                case State::UnconfirmedSpend: {
+                    confirmed += value;
+                } break;
+                case State::UnconfirmedNew: {
+                    unconfirmed += value;
+                } break;
+                default: {
+                }
+            }
+        }
+
+        return {confirmed, unconfirmed};
+    }
+    auto populate(const ot::eLock& lock) -> void
+    {
+        add(lock, 0, State::ConfirmedNew, 100, account_a_, nym_a_);
+        add(lock, 1, State::UnconfirmedNew, 200, account_a_, nym_a_);
+        add(lock, 2, State::ConfirmedNew, 400, account_b_, nym_a_);
+        add(lock, 3, State::UnconfirmedSpend, 800, account_b_, nym_b_);
+        add(lock, 4, State::ConfirmedSpend, 1600, account_b_, nym_b_);
+        // NOTE calculate every total so that later changes are applied to
+        // the cached values
+        verify(lock);
+    }
+    // NOTE compares the incrementally maintained totals with totals summed
+    // from the indices and with those of a cache which has not seen any of
+    // the changes
+    auto verify(const ot::eLock& lock) -> void
+    {
+        auto all = Outpoints{};
+
+        for (const auto state : all_states()) {
+            for (const auto& id : cache_->GetState(lock, state)) {
+                all.emplace(id);
+            }
+        }
+
+        EXPECT_EQ(cache_->GetBalance(lock), expected(lock, all));
+
+        auto fresh = OutputCache{api_, lmdb_, chain_, blank_};
+
+        EXPECT_EQ(cache_->GetBalance(lock), fresh.GetBalance(lock));
+
+        for (const auto* account : {&account_a_.get(), &account_b_.get()}) {
+            EXPECT_EQ(
+                cache_->GetAccountBalance(lock, *account),
+                expected(lock, cache_->GetAccount(lock, *account)));
+            EXPECT_EQ(
+                cache_->GetAccountBalance(lock, *account),
+                fresh.GetAccountBalance(lock, *account));
+        }
+
+        // NOTE populates the spendable indices of a second fresh cache
+        // through the shared lock interface
+        auto shared = std::shared_mutex{};
+        auto snapshot = OutputCache{api_, lmdb_, chain_, blank_};
+
+        for (const auto* nym : {&nym_a_.get(), &nym_b_.get()}) {
+            {
+                auto sLock = ot::sLock{shared};
+
+                EXPECT_EQ(
+                    cache_->GetSpendable(lock, *nym),
+                    snapshot.GetSpendable(sLock, *nym));
+            }
+
+            for (const auto& utxo : cache_->GetSpendable(lock, *nym)) {
+                EXPECT_EQ(
+                    utxo.state_,
+                    cache_->GetOutput(lock, utxo.outpoint_).State());
+            }
+
+            EXPECT_EQ(
+                cache_->GetNymBalance(lock, *nym),
+                expected(lock, cache_->GetNym(lock, *nym)));
+            EXPECT_EQ(
+                cache_->GetNymBalance(lock, *nym),
+                fresh.GetNymBalance(lock, *nym));
+            EXPECT_EQ(
+                cache_->GetSpendable(lock, *nym),
+                fresh.GetSpendable(lock, *nym));
+        }
+    }
+
+    Test_OutputCache()
+        : api_(ot::Context().StartClientSession(0))
+        , path_([] {
+            const auto path = fs::path{Home()} /
+                              fs::unique_path("outputs-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path.string();
+        }())
+        , lmdb_(
+              names_,
+              path_,
+              {
+                  {Table::Config, MDB_INTEGERKEY},
+                  {Table::WalletOutputs, 0},
+                  {Table::AccountOutputs, MDB_DUPSORT},
+                  {Table::NymOutputs, MDB_DUPSORT},
+                  {Table::PositionOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                  {Table::ProposalCreatedOutputs, MDB_DUPSORT},
+                  {Table::ProposalSpentOutputs, MDB_DUPSORT},
+                  {Table::OutputProposals, 0},
+                  {Table::StateOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                  {Table::SubchainOutputs, MDB_DUPSORT},
+                  {Table::KeyOutputs, MDB_DUPSORT},
+                  {Table::GenerationOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+              })
+        , blank_(-1, api_.Factory().Data())
+        , tx_([&] {
+            const auto bytes = api_.Factory().Data(
+                output_transaction_hex_, ot::StringStyle::Hex);
+
+            return api_.Factory().BitcoinTransaction(
+                chain_, bytes->Bytes(), false);
+        }())
+        , account_a_([&] {
+            auto out = api_.Factory().Identifier();
+            out->Randomize();
+
+            return out;
+        }())
+        , account_b_([&] {
+            auto out = api_.Factory().Identifier();
+            out->Randomize();
+
+            return out;
+        }())
+        , nym_a_([&] {
+            auto out = api_.Factory().NymID();
+            out->Randomize();
+
+            return out;
+        }())
+        , nym_b_([&] {
+            auto out = api_.Factory().NymID();
+            out->Randomize();
+
+            return out;
+        }())
+        , lock_()
+        , cache_(std::make_unique<OutputCache>(api_, lmdb_, chain_, blank_))
+    {
+    }
+
+    ~Test_OutputCache() override
+    {
+        cache_.reset();
+
+        try {
+            fs::remove_all(path_);
+        } catch (...) {
+        }
+    }
+};
+
+const ot::storage::lmdb::TableNames Test_OutputCache::names_{
+    {Table::Config, "config"},
+    {Table::WalletOutputs, "wallet_outputs"},
+    {Table::AccountOutputs, "account_outputs"},
+    {Table::NymOutputs, "nym_outputs"},
+    {Table::PositionOutputs, "position_outputs"},
+    {Table::ProposalCreatedOutputs, "proposal_created_outputs"},
+    {Table::ProposalSpentOutputs, "proposal_spent_outputs"},
+    {Table::OutputProposals, "output_proposals"},
+    {Table::StateOutputs, "state_outputs"},
+    {Table::SubchainOutputs, "subchain_outputs"},
+    {Table::KeyOutputs, "key_outputs"},
+    {Table::GenerationOutputs, "generation_outputs"},
+};
+
+TEST_F(Test_OutputCache, add)
+{
+    ASSERT_TRUE(tx_);
+
+    auto lock = ot::eLock{lock_};
+    populate(lock);
+    add(lock, 5, State::ConfirmedNew, 3200, account_a_, nym_b_);
+    add(lock, 6, State::UnconfirmedNew, 6400, account_b_, nym_a_);
+    verify(lock);
+
+    EXPECT_EQ(
+        cache_->GetBalance(lock),
+        Balance(ot::Amount{4500}, ot::Amount{10300}));
+}
+
+TEST_F(Test_OutputCache, state_change)
+{
+    ASSERT_TRUE(tx_);
+
+    auto lock = ot::eLock{lock_};
+    populate(lock);
+    const auto confirmed = outpoint(1);
+    const auto spent = outpoint(2);
+    const auto spend = outpoint(3);
+    change(lock, confirmed, State::ConfirmedNew);
+    verify(lock);
+    change(lock, spent, State::UnconfirmedSpend);
+    verify(lock);
+    change(lock, spend, State::ConfirmedSpend);
+    verify(lock);
+}
+
+TEST_F(Test_OutputCache, reorg)
+{
+    ASSERT_TRUE(tx_);
+
+    auto lock = ot::eLock{lock_};
+    populate(lock);
+    const auto received = outpoint(0);
+    const auto spent = outpoint(4);
+    // NOTE the blocks which confirmed both transactions are replaced and the
+    // transactions return to the mempool
+    change(lock, received, State::OrphanedNew);
+    change(lock, spent, State::OrphanedSpend);
+    verify(lock);
+    change(lock, received, State::UnconfirmedNew);
+    change(lock, spent, State::UnconfirmedSpend);
+    verify(lock);
+}
+
+TEST_F(Test_OutputCache, clear)
+{
+    ASSERT_TRUE(tx_);
+
+    auto lock = ot::eLock{lock_};
+    populate(lock);
+    const auto before = cache_->GetBalance(lock);
+    cache_->Clear(lock);
+    verify(lock);
+
+    EXPECT_EQ(cache_->GetBalance(lock), before);
+
+    change(lock, outpoint(1), State::ConfirmedNew);
+    verify(lock);
+}
+}  // namespace ottest
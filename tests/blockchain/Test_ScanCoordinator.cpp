@@ -0,0 +1,250 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "1_Internal.hpp"
+#include "blockchain/node/wallet/subchain/ScanCoordinator.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/blockchain/GCS.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ot = opentxs;
+namespace bc = ot::blockchain::internal;
+
+namespace ottest
+{
+using ScanCoordinator = ot::blockchain::node::wallet::ScanCoordinator;
+
+class Test_ScanCoordinator : public ::testing::Test
+{
+public:
+    using Position = ot::blockchain::block::Position;
+    using Patterns = ot::UnallocatedVector<ot::OTData>;
+
+    static constexpr auto blocks_ = std::size_t{200};
+    static constexpr auto patterns_per_subchain_ = std::size_t{40};
+    static constexpr auto elements_per_block_ = std::size_t{400};
+
+    const ot::api::session::Client& api_;
+    const std::pair<std::uint8_t, std::uint32_t> params_;
+    std::mt19937_64 rng_;
+    ot::UnallocatedVector<Position> chain_;
+    ot::UnallocatedVector<ot::Space> filters_;
+    ot::UnallocatedVector<ot::OTIdentifier> subchains_;
+    ot::UnallocatedVector<Patterns> patterns_;
+    // NOTE expected_[block][subchain]
+    ot::UnallocatedVector<ot::UnallocatedVector<bool>> expected_;
+    std::atomic<std::size_t> loads_;
+
+    auto random() noexcept -> ot::OTData
+    {
+        auto bytes = ot::UnallocatedVector<std::uint64_t>(4u);
+
+        for (auto& word : bytes) { word = rng_(); }
+
+        return ot::Data::Factory(bytes.data(), 32u);
+    }
+
+    // Every block contains random elements, plus one pattern from each of a
+    // few subchains
+    auto make_chain(std::size_t subchains) noexcept -> void
+    {
+        for (auto i = std::size_t{0}; i < subchains; ++i) {
+            subchains_.emplace_back(ot::Identifier::Random());
+            auto& patterns = patterns_.emplace_back();
+
+            for (auto j = std::size_t{0}; j < patterns_per_subchain_; ++j) {
+                patterns.emplace_back(random());
+            }
+        }
+
+        for (auto height = std::size_t{0}; height < blocks_; ++height) {
+            const auto hash = random();
+            auto elements = Patterns{};
+            auto& expected = expected_.emplace_back(subchains, false);
+
+            for (auto i = std::size_t{0}; i < elements_per_block_; ++i) {
+                elements.emplace_back(random());
+            }
+
+            for (auto i = height % 7u; i < subchains; i += 7u) {
+                const auto& patterns = patterns_.at(i);
+                elements.emplace_back(
+                    patterns.at((height + i) % patterns.size()));
+                expected.at(i) = true;
+            }
+
+            const auto pGCS = ot::factory::GCS(
+                api_,
+                params_.first,
+                params_.second,
+                bc::BlockHashToFilterKey(hash->Bytes()),
+                elements);
+
+            ASSERT_TRUE(pGCS);
+
+            chain_.emplace_back(
+                static_cast<ot::blockchain::block::Height>(height), hash);
+            ASSERT_TRUE(pGCS->Serialize(ot::writer(filters_.emplace_back())));
+        }
+    }
+
+    auto load(const Position& position) noexcept
+        -> std::unique_ptr<const ot::blockchain::GCS>
+    {
+        ++loads_;
+
+        return ot::factory::GCS(
+            api_,
+            ot::reader(filters_.at(static_cast<std::size_t>(position.first))));
+    }
+
+    auto make_coordinator() noexcept -> std::unique_ptr<ScanCoordinator>
+    {
+        return std::make_unique<ScanCoordinator>(
+            [this](const auto& position) { return load(position); });
+    }
+
+    auto targets(std::size_t subchain) const noexcept
+        -> ScanCoordinator::pTargets
+    {
+        auto out = std::make_shared<ScanCoordinator::Targets>();
+
+        for (const auto& pattern : patterns_.at(subchain)) {
+            out->emplace_back(pattern->Bytes());
+        }
+
+        return out;
+    }
+
+    Test_ScanCoordinator()
+        : api_(ot::Context().StartClientSession(0))
+        , params_(
+              bc::GetFilterParams(ot::blockchain::filter::Type::Basic_BIP158))
+        , rng_(0x5c4e)
+        , chain_()
+        , filters_()
+        , subchains_()
+        , patterns_()
+        , expected_()
+        , loads_(0)
+    {
+    }
+};
+
+TEST_F(Test_ScanCoordinator, loads_each_filter_once)
+{
+    constexpr auto subchains = std::size_t{10};
+    make_chain(subchains);
+    auto pCoordinator = make_coordinator();
+    auto& coordinator = *pCoordinator;
+
+    for (auto i = std::size_t{0}; i < subchains; ++i) {
+        coordinator.Update(subchains_.at(i), 0, targets(i));
+    }
+
+    for (auto i = std::size_t{0}; i < subchains; ++i) {
+        for (auto height = std::size_t{0}; height < blocks_; ++height) {
+            const auto [filter, match] =
+                coordinator.Match(subchains_.at(i), chain_.at(height));
+
+            ASSERT_TRUE(filter);
+            EXPECT_EQ(match, expected_.at(height).at(i));
+        }
+    }
+
+    EXPECT_EQ(loads_.load(), blocks_);
+}
+
+TEST_F(Test_ScanCoordinator, shared_targets)
+{
+    make_chain(1);
+    auto pCoordinator = make_coordinator();
+    auto& coordinator = *pCoordinator;
+    const auto other = ot::Identifier::Random();
+    coordinator.Update(subchains_.at(0), 0, targets(0));
+    coordinator.Update(other, 0, targets(0));
+
+    for (auto height = std::size_t{0}; height < blocks_; ++height) {
+        const auto& position = chain_.at(height);
+        const auto expected = expected_.at(height).at(0);
+        const auto first = coordinator.Match(subchains_.at(0), position);
+        const auto second = coordinator.Match(other, position);
+
+        EXPECT_EQ(first.second, expected);
+        EXPECT_EQ(second.second, expected);
+    }
+
+    EXPECT_EQ(loads_.load(), blocks_);
+}
+
+TEST_F(Test_ScanCoordinator, updated_targets)
+{
+    constexpr auto subchains = std::size_t{2};
+    make_chain(subchains);
+    auto pCoordinator = make_coordinator();
+    auto& coordinator = *pCoordinator;
+    const auto& position = chain_.at(0);
+
+    ASSERT_TRUE(expected_.at(0).at(0));
+    ASSERT_FALSE(expected_.at(0).at(1));
+
+    coordinator.Update(subchains_.at(0), 0, targets(0));
+    coordinator.Update(subchains_.at(1), 0, targets(1));
+
+    EXPECT_FALSE(coordinator.Match(subchains_.at(1), position).second);
+
+    coordinator.Update(subchains_.at(1), 0, targets(0));
+
+    EXPECT_TRUE(coordinator.Match(subchains_.at(1), position).second);
+
+    coordinator.Remove(subchains_.at(1));
+
+    EXPECT_FALSE(coordinator.Match(subchains_.at(1), position).second);
+    EXPECT_TRUE(coordinator.Match(subchains_.at(0), position).second);
+    EXPECT_EQ(loads_.load(), 1u);
+}
+
+TEST_F(Test_ScanCoordinator, bounded_by_bytes)
+{
+    constexpr auto subchains = std::size_t{2};
+    make_chain(subchains);
+    // NOTE too small to retain any filter after the next one is loaded
+    auto coordinator = ScanCoordinator{
+        [this](const auto& position) { return load(position); }, 1u};
+
+    for (auto i = std::size_t{0}; i < subchains; ++i) {
+        coordinator.Update(subchains_.at(i), 0, targets(i));
+    }
+
+    for (auto i = std::size_t{0}; i < subchains; ++i) {
+        for (auto height = std::size_t{0}; height < blocks_; ++height) {
+            const auto [filter, match] =
+                coordinator.Match(subchains_.at(i), chain_.at(height));
+
+            ASSERT_TRUE(filter);
+            EXPECT_EQ(match, expected_.at(height).at(i));
+        }
+    }
+
+    EXPECT_EQ(loads_.load(), subchains * blocks_);
+}
+}  // namespace ottest
@@ -0,0 +1,137 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "blockchain/database/common/TransactionCache.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using TransactionCache = ot::blockchain::database::common::TransactionCache;
+
+const auto cache_transaction_hex_ = ot::UnallocatedCString{
+    "0100000000010115e180dc28a2327e687facc33f10f2a20da717e5548406f7ae8b4c811072"
+    "f85603000000171600141d7cd6c75c2e86f4cbf98eaed221b30bd9a0b928ffffffff019cae"
+    "f505000000001976a9141d7cd6c75c2e86f4cbf98eaed221b30bd9a0b92888ac0248304502"
+    "2100f764287d3e99b1474da9bec7f7ed236d6c81e793b20c4b5aa1f3051b9a7daa63022016"
+    "a198031d5554dbb855bdbe8534776a4be6958bd8d530dc001c32b828f6f0ab0121038262a6"
+    "c6cec93c2d3ecd6c6072efea86d02ff8e3328bbd0242b20af3425990ac00000000"};
+
+class Test_TransactionCache : public ::testing::Test
+{
+public:
+    const ot::api::session::Client& api_;
+    const TransactionCache::pTransaction tx_;
+
+    static auto key(char c) -> ot::UnallocatedCString
+    {
+        return ot::UnallocatedCString(32u, c);
+    }
+
+    Test_TransactionCache()
+        : api_(ot::Context().StartClientSession(0))
+        , tx_([&] {
+            const auto bytes = api_.Factory().Data(
+                cache_transaction_hex_, ot::StringStyle::Hex);
+
+            return TransactionCache::pTransaction{
+                api_.Factory().BitcoinTransaction(
+                    ot::blockchain::Type::Bitcoin, bytes->Bytes(), false)};
+        }())
+    {
+    }
+};
+
+TEST_F(Test_TransactionCache, hits_and_misses)
+{
+    ASSERT_TRUE(tx_);
+
+    const auto cache = TransactionCache{1000u};
+    const auto a = key('a');
+
+    EXPECT_FALSE(cache.Find(a));
+
+    cache.Add(a, tx_, 100u, cache.Generation());
+    const auto found = cache.Find(a);
+
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found.get(), tx_.get());
+
+    const auto stats = cache.Stats();
+
+    EXPECT_EQ(stats.hits_, 1u);
+    EXPECT_EQ(stats.misses_, 1u);
+    EXPECT_EQ(stats.items_, 1u);
+    EXPECT_EQ(stats.bytes_, 100u);
+}
+
+TEST_F(Test_TransactionCache, evicts_least_recently_used)
+{
+    ASSERT_TRUE(tx_);
+
+    const auto cache = TransactionCache{300u};
+    const auto a = key('a');
+    const auto b = key('b');
+    const auto c = key('c');
+    const auto d = key('d');
+    cache.Add(a, tx_, 100u, cache.Generation());
+    cache.Add(b, tx_, 100u, cache.Generation());
+    cache.Add(c, tx_, 100u, cache.Generation());
+
+    EXPECT_TRUE(cache.Find(a));
+
+    cache.Add(d, tx_, 100u, cache.Generation());
+
+    EXPECT_TRUE(cache.Find(a));
+    EXPECT_FALSE(cache.Find(b));
+    EXPECT_TRUE(cache.Find(c));
+    EXPECT_TRUE(cache.Find(d));
+
+    cache.Add(b, tx_, 301u, cache.Generation());
+
+    EXPECT_FALSE(cache.Find(b));
+
+    const auto stats = cache.Stats();
+
+    EXPECT_EQ(stats.evictions_, 1u);
+    EXPECT_EQ(stats.items_, 3u);
+    EXPECT_EQ(stats.bytes_, 300u);
+}
+
+TEST_F(Test_TransactionCache, remove_discards_stale_loads)
+{
+    ASSERT_TRUE(tx_);
+
+    const auto cache = TransactionCache{1000u};
+    const auto a = key('a');
+    cache.Add(a, tx_, 100u, cache.Generation());
+    const auto generation = cache.Generation();
+    cache.Remove(a);
+
+    EXPECT_FALSE(cache.Find(a));
+
+    cache.Add(a, tx_, 100u, generation);
+
+    EXPECT_FALSE(cache.Find(a));
+
+    cache.Add(a, tx_, 100u, cache.Generation());
+
+    EXPECT_TRUE(cache.Find(a));
+}
+}  // namespace ottest
@@ -9,6 +9,7 @@
 #include <regex>
 #include <sstream>
 
+#include "Basic.hpp"
 #include "internal/api/session/Client.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/otx/client/obsolete/OTAPI_Exec.hpp"
@@ -66,7 +67,7 @@ const ot::UnallocatedCString Test_BlockchainActivity::contact_6_name_{"Frank"};
 const ot::UnallocatedCString Test_BlockchainActivity::contact_7_name_{"Gabe"};
 
 Test_BlockchainActivity::Test_BlockchainActivity()
-    : api_(ot::Context().StartClientSession(0))
+    : api_(ot::Context().StartClientSession(UIArgs(), 0))
     , reason_(api_.Factory().PasswordPrompt(__func__))
 {
 }
@@ -6,8 +6,11 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <optional>
 
 #include "blockchain/DownloadManager.hpp"
+#include "blockchain/DownloadScheduler.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/util/Container.hpp"
 
@@ -57,6 +60,14 @@ struct DownloadManager : public ManagerType {
 
         return output;
     }
+    auto GetBatch(const d::Scheduler::PeerID peer) noexcept -> BatchType
+    {
+        auto output = schedule_batch(peer);
+
+        if (output.data_.size() == 0) { batch_ready_ = false; }
+
+        return output;
+    }
     auto MakePositions(
         bb::Height start,
         ot::UnallocatedVector<ot::UnallocatedCString> hashes) noexcept
@@ -106,8 +117,10 @@ struct DownloadManager : public ManagerType {
     DownloadManager(
         std::size_t batch,
         std::size_t max,
-        std::size_t min) noexcept
+        std::size_t min,
+        std::optional<d::Scheduler::Params> scheduler = std::nullopt) noexcept
         : ManagerType(
+              b::Type::UnitTest,
               genesis_,
               [] {
                   auto promise = std::promise<FinishedType>{};
@@ -117,7 +130,8 @@ struct DownloadManager : public ManagerType {
               }(),
               "test",
               max,
-              min)
+              min,
+              scheduler)
         , batch_ready_(false)
         , state_machine_triggers_(0)
         , ready_()
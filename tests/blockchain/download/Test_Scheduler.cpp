@@ -0,0 +1,161 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <thread>
+
+#include "Helpers.hpp"
+#include "blockchain/DownloadScheduler.hpp"
+#include "blockchain/DownloadTask.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+using PeerID = d::Scheduler::PeerID;
+using Milliseconds = std::chrono::milliseconds;
+
+constexpr auto batchSize{10};
+constexpr auto blocks{200};
+constexpr auto params_ = d::Scheduler::Params{50, 100ms, 50ms, 200ms};
+
+// NOTE a peer which delivers one item every per_item_ after an initial
+// latency_. A peer without a per_item_ value never delivers anything.
+struct SimulatedPeer {
+    const PeerID id_;
+    const Milliseconds latency_;
+    const std::optional<Milliseconds> per_item_;
+    DownloadManager::BatchType batch_{};
+    std::size_t next_{};
+    ot::Time due_{};
+
+    auto Run(DownloadManager& manager, const ot::Time now) noexcept -> void
+    {
+        if (false == bool(batch_)) {
+            batch_ = manager.GetBatch(id_);
+            next_ = 0;
+            due_ = now + latency_;
+
+            return;
+        }
+
+        if (false == per_item_.has_value()) { return; }
+
+        while ((due_ <= now) && (next_ < batch_.data_.size())) {
+            const auto& task = batch_.data_.at(next_++);
+            batch_.Download(
+                task->position_, static_cast<int>(task->position_.first));
+            due_ += per_item_.value();
+        }
+
+        if (batch_.isDownloaded() || (next_ == batch_.data_.size())) {
+            batch_ = {};
+        }
+    }
+};
+
+auto time_to_tip(
+    DownloadManager& manager,
+    ot::UnallocatedVector<SimulatedPeer>& peers,
+    const Milliseconds timeout) noexcept -> std::optional<Milliseconds>
+{
+    manager.UpdatePosition(manager.MakePositions(1, [] {
+        auto output = ot::UnallocatedVector<ot::UnallocatedCString>{};
+
+        for (auto i{1}; i <= blocks; ++i) {
+            output.emplace_back(std::to_string(i));
+        }
+
+        return output;
+    }()));
+    manager.RunStateMachine();
+    const auto& target = manager.GetPosition(blocks - 1);
+    const auto start = ot::Clock::now();
+
+    while (manager.best_position_ != target) {
+        const auto now = ot::Clock::now();
+
+        if ((now - start) > timeout) { return std::nullopt; }
+
+        for (auto& peer : peers) { peer.Run(manager, now); }
+
+        manager.RunStateMachine();
+        manager.ProcessData();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    return std::chrono::duration_cast<Milliseconds>(ot::Clock::now() - start);
+}
+
+auto make_peers() noexcept -> ot::UnallocatedVector<SimulatedPeer>
+{
+    auto output = ot::UnallocatedVector<SimulatedPeer>{};
+    output.push_back({1, 5ms, std::nullopt});
+    output.push_back({2, 5ms, 1ms});
+    output.push_back({3, 5ms, 20ms});
+
+    return output;
+}
+
+TEST(Test_DownloadScheduler, unknown_peer)
+{
+    const auto scheduler = d::Scheduler{params_};
+
+    EXPECT_EQ(scheduler.BatchSize(1, batchSize), batchSize);
+    EXPECT_EQ(scheduler.Deadline(1, batchSize), params_.max_deadline_);
+    EXPECT_EQ(scheduler.Throughput(1), 0.0);
+    EXPECT_TRUE(scheduler.IsFaster(1, 2));
+    EXPECT_FALSE(scheduler.IsFaster(1, 1));
+}
+
+TEST(Test_DownloadScheduler, statistics)
+{
+    auto scheduler = d::Scheduler{{50, 1s, 100ms, 5s}};
+    scheduler.Record(1, 100, 10ms, 1s);
+    scheduler.Record(2, 10, 10ms, 1s);
+
+    EXPECT_DOUBLE_EQ(scheduler.Throughput(1), 100.0);
+    EXPECT_DOUBLE_EQ(scheduler.Throughput(2), 10.0);
+    EXPECT_EQ(scheduler.Latency(2), 10ms);
+    EXPECT_EQ(scheduler.BatchSize(1, 500), 100);
+    EXPECT_EQ(scheduler.BatchSize(1, 50), 50);
+    EXPECT_EQ(scheduler.BatchSize(2, 500), 10);
+    EXPECT_EQ(scheduler.Deadline(1, 1), 100ms);
+    EXPECT_EQ(scheduler.Deadline(2, 10), 2020ms);
+    EXPECT_EQ(scheduler.Deadline(2, 1000), 5s);
+    EXPECT_TRUE(scheduler.IsFaster(1, 2));
+    EXPECT_FALSE(scheduler.IsFaster(2, 1));
+    EXPECT_FALSE(scheduler.IsFaster(3, 1));
+
+    scheduler.Record(2, 0, 0ms, 1s);
+
+    EXPECT_DOUBLE_EQ(scheduler.Throughput(2), 7.0);
+    EXPECT_EQ(scheduler.Latency(2), 10ms);
+}
+
+TEST(Test_DownloadScheduler, stalled_peer_blocks_unscheduled_download)
+{
+    auto manager = DownloadManager{batchSize, 0, 0};
+    auto peers = make_peers();
+
+    EXPECT_FALSE(time_to_tip(manager, peers, 1s).has_value());
+}
+
+TEST(Test_DownloadScheduler, time_to_tip)
+{
+    auto manager = DownloadManager{batchSize, 0, 0, params_};
+    auto peers = make_peers();
+    const auto elapsed = time_to_tip(manager, peers, 10s);
+
+    ASSERT_TRUE(elapsed.has_value());
+
+    RecordProperty("time_to_tip_ms", static_cast<int>(elapsed->count()));
+    EXPECT_EQ(manager.best_position_, manager.GetPosition(blocks - 1));
+}
+}  // namespace ottest
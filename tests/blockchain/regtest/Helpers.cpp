@@ -22,6 +22,7 @@
 #include <utility>
 
 #include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/blockchain/Params.hpp"
@@ -464,7 +465,7 @@ Regtest_fixture_base::Regtest_fixture_base(
     const ot::Options& minerArgs,
     const ot::Options& clientArgs)
     : ot_(ot::Context())
-    , client_args_(clientArgs)
+    , client_args_(ot::Options{UIArgs()} + clientArgs)
     , client_count_(clientCount)
     , miner_(ot_.StartClientSession(
           ot::Options{minerArgs}
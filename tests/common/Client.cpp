@@ -8,6 +8,7 @@
 #include <memory>
 #include <utility>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/Context.hpp"
@@ -115,7 +116,7 @@ auto Client_fixture::SetIntroductionServer(
 auto Client_fixture::StartClient(int index) const noexcept
     -> const ot::api::session::Client&
 {
-    const auto& out = ot_.StartClientSession(index);
+    const auto& out = ot_.StartClientSession(UIArgs(), index);
 
     return out;
 }
@@ -354,4 +354,19 @@ TEST(Options, merge)
     EXPECT_TRUE(check_options(test1 + test2, expected2));
     EXPECT_TRUE(check_options(test2 + test3, expected3));
 }
+
+TEST(Options, ui_update_interval)
+{
+    const auto blank = opentxs::Options{};
+    const auto disabled = opentxs::Options{}.SetUIUpdateInterval(0);
+    const auto slow = opentxs::Options{}.SetUIUpdateInterval(250);
+    const auto invalid = opentxs::Options{}.SetUIUpdateInterval(-1);
+
+    EXPECT_EQ(blank.UIUpdateInterval(), 16);
+    EXPECT_EQ(disabled.UIUpdateInterval(), 0);
+    EXPECT_EQ(slow.UIUpdateInterval(), 250);
+    EXPECT_EQ(invalid.UIUpdateInterval(), 0);
+    EXPECT_EQ((slow + blank).UIUpdateInterval(), 250);
+    EXPECT_EQ((slow + disabled).UIUpdateInterval(), 0);
+}
 }  // namespace ottest
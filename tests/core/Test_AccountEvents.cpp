@@ -0,0 +1,155 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "internal/api/session/Storage.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Storage.hpp"
+#include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "serialization/protobuf/AccountEvent.pb.h"
+#include "serialization/protobuf/RPCEnums.pb.h"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_AccountEvents : public ::testing::Test
+{
+public:
+    // NOTE enough sources to split the account into several buckets
+    static constexpr auto count_ = std::int64_t{300};
+    static constexpr auto size_ = static_cast<std::size_t>(count_);
+
+    const ot::api::session::Client& api_;
+    const ot::UnallocatedCString nym_;
+    const ot::UnallocatedCString account_;
+
+    // NOTE long enough to pass identifier validation
+    static auto source(std::int64_t index) -> ot::UnallocatedCString
+    {
+        return "account-event-source-" + std::to_string(index);
+    }
+
+    auto event(std::int64_t time) const -> ot::proto::AccountEvent
+    {
+        auto out = ot::proto::AccountEvent{};
+        out.set_version(2);
+        out.set_id(account_);
+        out.set_type(ot::proto::ACCOUNTEVENT_OUTGOINGBLOCKCHAIN);
+        out.set_timestamp(time);
+
+        return out;
+    }
+    // NOTE returns every event by following the cursor one page at a time
+    auto pages(std::size_t limit) const
+        -> ot::UnallocatedVector<ot::proto::AccountEvent>
+    {
+        auto out = ot::UnallocatedVector<ot::proto::AccountEvent>{};
+        auto cursor = ot::UnallocatedCString{};
+
+        do {
+            auto page = ot::UnallocatedVector<ot::proto::AccountEvent>{};
+            auto next = ot::UnallocatedCString{};
+            auto indexed{false};
+
+            EXPECT_TRUE(api_.Storage().Internal().AccountEvents(
+                nym_, account_, cursor, limit, page, next, indexed));
+
+            if (0u < limit) { EXPECT_LE(page.size(), limit); }
+
+            if (false == next.empty()) { EXPECT_EQ(page.size(), limit); }
+
+            for (auto& item : page) { out.emplace_back(std::move(item)); }
+
+            cursor = next;
+        } while (false == cursor.empty());
+
+        return out;
+    }
+    auto store(
+        std::int64_t index,
+        const ot::UnallocatedVector<std::int64_t>& times) const -> bool
+    {
+        auto events = ot::UnallocatedVector<ot::proto::AccountEvent>{};
+
+        for (const auto time : times) { events.emplace_back(event(time)); }
+
+        return api_.Storage().Internal().StoreAccountEvents(
+            nym_, account_, source(index), events);
+    }
+
+    Test_AccountEvents()
+        : api_(ot::Context().StartClientSession(0))
+        , nym_([&] {
+            const auto reason = api_.Factory().PasswordPrompt(__func__);
+
+            return api_.Wallet().Nym(reason, "Alice")->ID().str();
+        }())
+        , account_(ot::Identifier::Random()->str())
+    {
+    }
+};
+
+TEST_F(Test_AccountEvents, pages)
+{
+    // NOTE sources are stored out of order to insert into existing buckets
+    for (auto i = std::int64_t{0}; i < count_; ++i) {
+        const auto index = (i * 7) % count_;
+
+        ASSERT_TRUE(store(index, {1000 + index}));
+    }
+
+    for (const auto limit : {std::size_t{1}, std::size_t{50}, std::size_t{0}}) {
+        const auto events = pages(limit);
+
+        ASSERT_EQ(events.size(), size_);
+
+        for (auto i = std::int64_t{0}; i < count_; ++i) {
+            EXPECT_EQ(
+                events.at(static_cast<std::size_t>(i)).timestamp(),
+                1000 + count_ - 1 - i);
+        }
+    }
+}
+
+TEST_F(Test_AccountEvents, replace_source)
+{
+    for (auto i = std::int64_t{0}; i < count_; ++i) {
+        ASSERT_TRUE(store(i, {1000 + i}));
+    }
+
+    // NOTE moves the events of one source between buckets
+    ASSERT_TRUE(store(10, {5000, 10}));
+
+    auto events = pages(64);
+
+    ASSERT_EQ(events.size(), size_ + 1u);
+    EXPECT_EQ(events.front().timestamp(), 5000);
+    EXPECT_EQ(events.back().timestamp(), 10);
+
+    for (const auto& item : events) { EXPECT_NE(item.timestamp(), 1010); }
+
+    ASSERT_TRUE(store(10, {}));
+
+    events = pages(64);
+
+    ASSERT_EQ(events.size(), size_ - 1u);
+    EXPECT_EQ(events.front().timestamp(), 1000 + count_ - 1);
+    EXPECT_EQ(events.back().timestamp(), 1000);
+}
+}  // namespace ottest
@@ -0,0 +1,195 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "internal/util/Base64.hpp"
+#include "opentxs/core/Armored.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_Armored : public ::testing::Test
+{
+public:
+    // Representative payload sizes for a short message, a typical receipt,
+    // a populated box, and a large contract
+    static constexpr auto sizes_ =
+        std::array<std::size_t, 4>{256, 4096, 65536, 1048576};
+
+    static auto encode(const ot::UnallocatedCString& in, std::size_t width = 0)
+        -> ot::UnallocatedCString
+    {
+        auto out = ot::UnallocatedCString{};
+        out.resize(ot::base64::EncodedSize(in.size(), width));
+        out.resize(ot::base64::Encode(in, out.data(), width));
+
+        return out;
+    }
+
+    static auto decode(const ot::UnallocatedCString& in)
+        -> ot::UnallocatedCString
+    {
+        auto out = ot::UnallocatedCString{};
+        out.resize(ot::base64::DecodedSize(in.size()));
+        out.resize(ot::base64::Decode(in, out.data()));
+
+        return out;
+    }
+
+    // Signed XML interspersed with base64 signature blocks, similar to what
+    // OTX messages and ledgers contain
+    static auto message(std::size_t size) -> ot::UnallocatedCString
+    {
+        auto out = ot::UnallocatedCString{};
+        auto counter = std::uint64_t{0};
+
+        while (out.size() < size) {
+            const auto number = std::to_string(++counter);
+            out.append("<transaction type=\"transferReceipt\" number=\"");
+            out.append(number);
+            out.append("\" inReferenceTo=\"");
+            out.append(std::to_string(counter * 7919u));
+            out.append("\">\n<signature>\n");
+            auto noise = ot::UnallocatedCString{};
+
+            for (auto i = 0u; i < 48u; ++i) {
+                noise.push_back(static_cast<char>((counter * 131u + i * 17u)));
+            }
+
+            out.append(encode(noise, ot::base64::line_width_));
+            out.append("</signature>\n</transaction>\n");
+        }
+
+        out.resize(size);
+
+        return out;
+    }
+};
+
+TEST_F(Test_Armored, rfc4648_vectors)
+{
+    const auto vectors =
+        ot::UnallocatedVector<std::pair<const char*, const char*>>{
+            {"", ""},
+            {"f", "Zg=="},
+            {"fo", "Zm8="},
+            {"foo", "Zm9v"},
+            {"foob", "Zm9vYg=="},
+            {"fooba", "Zm9vYmE="},
+            {"foobar", "Zm9vYmFy"},
+        };
+
+    for (const auto& [plain, coded] : vectors) {
+        EXPECT_EQ(encode(plain), coded);
+        EXPECT_EQ(decode(coded), plain);
+    }
+}
+
+TEST_F(Test_Armored, line_breaks)
+{
+    const auto in = ot::UnallocatedCString(100, 'x');
+    const auto out = encode(in, ot::base64::line_width_);
+
+    ASSERT_EQ(out.size(), ot::base64::EncodedSize(in.size(), 72u));
+    EXPECT_EQ(out.at(72), '\n');
+    EXPECT_EQ(out.back(), '\n');
+    EXPECT_EQ(out.find('\n'), 72u);
+    EXPECT_EQ(decode(out), in);
+}
+
+TEST_F(Test_Armored, ignores_invalid_characters)
+{
+    const auto in = message(1000);
+    auto coded = encode(in, ot::base64::line_width_);
+    auto messy = ot::UnallocatedCString{};
+
+    for (auto i = std::size_t{0}; i < coded.size(); ++i) {
+        messy.push_back(coded.at(i));
+
+        if (3u == (i % 7u)) { messy.append(" \r\t*"); }
+    }
+
+    EXPECT_EQ(decode(messy), in);
+    EXPECT_EQ(decode("Zm9v\nYmFy=ignored"), "foobar");
+}
+
+TEST_F(Test_Armored, all_byte_values)
+{
+    auto in = ot::UnallocatedCString{};
+
+    for (auto i = 0; i < 256; ++i) { in.push_back(static_cast<char>(i)); }
+
+    for (auto length = std::size_t{0}; length <= in.size(); ++length) {
+        const auto plain = in.substr(0, length);
+
+        EXPECT_EQ(decode(encode(plain, 72)), plain);
+    }
+}
+
+TEST_F(Test_Armored, string_round_trip)
+{
+    for (const auto level : {
+             ot::Armored::CompressFastest,
+             ot::Armored::CompressSmallest,
+             0}) {
+        for (const auto size : sizes_) {
+            const auto in = ot::String::Factory(message(size));
+            auto armored = ot::Armored::Factory();
+
+            ASSERT_TRUE(armored->SetStringCompressed(in, level));
+
+            auto out = ot::String::Factory();
+
+            ASSERT_TRUE(armored->GetString(out));
+            EXPECT_EQ(in->Get(), ot::UnallocatedCString{out->Get()});
+        }
+    }
+}
+
+TEST_F(Test_Armored, data_round_trip)
+{
+    auto bytes = ot::UnallocatedVector<std::uint8_t>{};
+
+    for (auto i = 0; i < 1000; ++i) {
+        bytes.emplace_back(static_cast<std::uint8_t>(i));
+    }
+
+    const auto in = ot::Data::Factory(bytes.data(), bytes.size());
+    auto armored = ot::Armored::Factory();
+
+    ASSERT_TRUE(armored->SetData(in));
+
+    auto out = ot::Data::Factory();
+
+    ASSERT_TRUE(armored->GetData(out));
+    EXPECT_EQ(in.get(), out.get());
+}
+
+TEST_F(Test_Armored, corrupt_input)
+{
+    const auto in = ot::String::Factory(message(4096));
+    auto armored = ot::Armored::Factory();
+
+    ASSERT_TRUE(armored->SetString(in));
+
+    auto truncated = ot::UnallocatedCString{armored->Get()};
+    truncated.resize(truncated.size() / 2u);
+    armored->Set(truncated.c_str());
+    auto out = ot::String::Factory();
+
+    EXPECT_FALSE(armored->GetString(out));
+}
+}  // namespace ottest
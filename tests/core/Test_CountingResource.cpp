@@ -0,0 +1,116 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/container/pmr/global_resource.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string_view>
+
+#include "internal/util/BoostPMR.hpp"
+#include "internal/util/CountingResource.hpp"
+#include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Container.hpp"
+#include "util/Metrics.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_CountingResource : public ::testing::Test
+{
+public:
+    ot::alloc::BoostWrap upstream_;
+    ot::alloc::BoostWrap other_;
+
+    // NOTE returns the exported value of a counter for the specified owner
+    static auto Exported(std::string_view name, std::string_view owner)
+        -> std::uint64_t
+    {
+        auto prefix = std::ostringstream{};
+        prefix << name << "{owner=\"" << owner << "\"} ";
+        const auto text = ot::metrics::Get().Prometheus();
+        const auto start = text.find(prefix.str());
+
+        if (ot::UnallocatedCString::npos == start) { return 0u; }
+
+        auto value = std::uint64_t{0};
+        auto stream =
+            std::istringstream{text.substr(start + prefix.str().size())};
+        stream >> value;
+
+        return value;
+    }
+
+    Test_CountingResource()
+        : upstream_(boost::container::pmr::new_delete_resource())
+        , other_(boost::container::pmr::new_delete_resource())
+    {
+    }
+
+    ~Test_CountingResource() override
+    {
+        ot::alloc::ReleaseCounted(&upstream_);
+        ot::alloc::ReleaseCounted(&other_);
+    }
+};
+
+TEST_F(Test_CountingResource, shared_per_owner_and_upstream)
+{
+    auto* a = ot::alloc::Counted("counting-shared-a", &upstream_);
+    auto* b = ot::alloc::Counted("counting-shared-b", &upstream_);
+    auto* c = ot::alloc::Counted("counting-shared-a", &other_);
+
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(ot::alloc::Counted("counting-shared-a", &upstream_), a);
+    EXPECT_NE(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(ot::alloc::CountedSize(&upstream_), 2u);
+    EXPECT_EQ(ot::alloc::CountedSize(&other_), 1u);
+}
+
+TEST_F(Test_CountingResource, counts_allocations)
+{
+    constexpr auto owner = std::string_view{"counting-counts"};
+    auto* resource = ot::alloc::Counted(owner, &upstream_);
+    auto* p = resource->allocate(16u, alignof(std::max_align_t));
+    auto* q = resource->allocate(48u, alignof(std::max_align_t));
+    resource->deallocate(q, 48u, alignof(std::max_align_t));
+    resource->deallocate(p, 16u, alignof(std::max_align_t));
+
+    EXPECT_EQ(Exported("opentxs_allocations_total", owner), 2u);
+    EXPECT_EQ(Exported("opentxs_allocated_bytes_total", owner), 64u);
+}
+
+TEST_F(Test_CountingResource, release)
+{
+    constexpr auto owner = std::string_view{"counting-release"};
+    auto* first = ot::alloc::Counted(owner, &upstream_);
+    ot::alloc::Counted(owner, &other_);
+    auto* p = first->allocate(32u, alignof(std::max_align_t));
+    first->deallocate(p, 32u, alignof(std::max_align_t));
+
+    ASSERT_EQ(ot::alloc::CountedSize(&upstream_), 1u);
+
+    ot::alloc::ReleaseCounted(&upstream_);
+
+    EXPECT_EQ(ot::alloc::CountedSize(&upstream_), 0u);
+    EXPECT_EQ(ot::alloc::CountedSize(&other_), 1u);
+    // NOTE the totals for an owner survive the release of its resources
+    EXPECT_EQ(Exported("opentxs_allocations_total", owner), 1u);
+    EXPECT_EQ(Exported("opentxs_allocated_bytes_total", owner), 32u);
+
+    auto* second = ot::alloc::Counted(owner, &upstream_);
+    p = second->allocate(8u, alignof(std::max_align_t));
+    second->deallocate(p, 8u, alignof(std::max_align_t));
+
+    EXPECT_EQ(ot::alloc::CountedSize(&upstream_), 1u);
+    EXPECT_EQ(Exported("opentxs_allocations_total", owner), 2u);
+    EXPECT_EQ(Exported("opentxs_allocated_bytes_total", owner), 40u);
+}
+}  // namespace ottest
@@ -0,0 +1,115 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+
+#include "opentxs/util/Container.hpp"
+#include "util/Executor.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Executor = ot::Executor;
+using Priority = Executor::Priority;
+
+TEST(Executor, submit_returns_result)
+{
+    auto executor = Executor{"test", 4u};
+    auto future = executor.Submit(Priority::Normal, [] { return 42; });
+
+    EXPECT_EQ(future.get(), 42);
+}
+
+TEST(Executor, exceptions_are_delivered_to_future)
+{
+    auto executor = Executor{"test", 2u};
+    auto future = executor.Submit(
+        Priority::Low, []() -> int { throw std::runtime_error{"failed"}; });
+
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(Executor, stop_drains_nested_jobs)
+{
+    constexpr auto jobs = 1000;
+    auto counter = std::atomic<int>{0};
+    auto executor = Executor{"test", 4u, 1u};
+
+    for (auto i = 0; i < jobs; ++i) {
+        const auto priority = static_cast<Priority>(i % 3);
+        executor.Post(priority, [&, priority] {
+            ++counter;
+            executor.Post(priority, [&] { ++counter; });
+        });
+    }
+
+    executor.Stop();
+
+    EXPECT_EQ(counter.load(), 2 * jobs);
+    EXPECT_EQ(executor.QueueDepth(Priority::High), 0u);
+    EXPECT_EQ(executor.QueueDepth(Priority::Normal), 0u);
+    EXPECT_EQ(executor.QueueDepth(Priority::Low), 0u);
+    EXPECT_FALSE(executor.Post(Priority::High, [] {}));
+}
+
+TEST(Executor, reserved_workers_prevent_starvation)
+{
+    constexpr auto threads = 4u;
+    auto executor = Executor{"test", threads, 1u};
+    auto blocked = std::promise<void>{};
+    auto release = blocked.get_future().share();
+    auto waiting = ot::UnallocatedVector<std::future<bool>>{};
+
+    // NOTE every general worker blocks until a high priority job finishes
+    for (auto i = 0u; i < threads; ++i) {
+        waiting.emplace_back(executor.Submit(Priority::Normal, [&] {
+            return std::future_status::ready ==
+                   release.wait_for(std::chrono::seconds{30});
+        }));
+    }
+
+    executor.Submit(Priority::High, [&] { blocked.set_value(); }).get();
+
+    for (auto& future : waiting) { EXPECT_TRUE(future.get()); }
+}
+
+TEST(Executor, low_priority_progresses_under_load)
+{
+    auto executor = Executor{"test", 1u};
+    auto running = std::atomic<bool>{true};
+    auto normal = std::atomic<int>{0};
+    auto load = Executor::Job{};
+    load = [&] {
+        ++normal;
+
+        if (running) { executor.Post(Priority::Normal, load); }
+    };
+
+    // NOTE the normal priority queue never empties while running is true
+    for (auto i = 0; i < 4; ++i) { executor.Post(Priority::Normal, load); }
+
+    // NOTE with strict priority this job would never run before the timeout
+    auto low = executor.Submit(Priority::Low, [&] { return running.load(); });
+    const auto status = low.wait_for(std::chrono::seconds{30});
+    running = false;
+    executor.Stop();
+
+    ASSERT_EQ(status, std::future_status::ready);
+    EXPECT_TRUE(low.get());
+    EXPECT_LT(0, normal.load());
+}
+
+TEST(Executor, priority_names)
+{
+    EXPECT_EQ(ot::print(Priority::High), "high");
+    EXPECT_EQ(ot::print(Priority::Normal), "normal");
+    EXPECT_EQ(ot::print(Priority::Low), "low");
+}
+}  // namespace ottest
@@ -6,11 +6,13 @@
 #include <gtest/gtest.h>
 
 #include "internal/api/session/FactoryAPI.hpp"
+#include "internal/core/identifier/Fixed.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/session/Client.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/util/Container.hpp"
 #include "serialization/protobuf/Identifier.pb.h"
 
@@ -70,4 +72,51 @@ TEST_F(Random_Identifier, serialize_protobuf)
 
     EXPECT_EQ(identifier_, recovered);
 }
+
+TEST_F(Default_Identifier, fixed_empty)
+{
+    const auto fixed = ot::identifier::Fixed{identifier_};
+
+    EXPECT_TRUE(fixed.empty());
+    EXPECT_EQ(fixed, ot::identifier::Fixed{});
+    EXPECT_EQ(fixed.Hash(), ot::identifier::Fixed{}.Hash());
+    EXPECT_EQ(fixed.Generic(), identifier_);
+}
+
+TEST_F(Random_Identifier, fixed_round_trip)
+{
+    const auto fixed = ot::identifier::Fixed{identifier_};
+    const auto copy = fixed;
+
+    EXPECT_EQ(fixed.size(), identifier_->size());
+    EXPECT_EQ(fixed.Algorithm(), identifier_->Algorithm());
+    EXPECT_EQ(fixed.Type(), identifier_->Type());
+    EXPECT_EQ(fixed.Bytes(), identifier_->Bytes());
+    EXPECT_EQ(fixed.Generic(), identifier_);
+    EXPECT_EQ(fixed.str(), identifier_->str());
+    EXPECT_EQ(copy, fixed);
+    EXPECT_EQ(copy.Hash(), fixed.Hash());
+}
+
+TEST_F(Random_Identifier, fixed_ordering)
+{
+    auto other = ot::Identifier::Factory();
+    other->Randomize();
+    const auto lhs = ot::identifier::Fixed{identifier_};
+    const auto rhs = ot::identifier::Fixed{other};
+
+    EXPECT_NE(lhs, rhs);
+    EXPECT_EQ(lhs < rhs, identifier_ < other);
+    EXPECT_EQ(rhs < lhs, other < identifier_);
+}
+
+TEST_F(Random_Identifier, fixed_map)
+{
+    auto map = ot::identifier::FixedMap<int>{};
+    map.emplace(identifier_, 1);
+
+    EXPECT_EQ(map.count(ot::identifier::Fixed{identifier_}), 1u);
+    EXPECT_EQ(map.at(ot::identifier::Fixed{identifier_}), 1);
+    EXPECT_EQ(map.count(ot::identifier::Fixed{}), 0u);
+}
 }  // namespace ottest
@@ -4,11 +4,15 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <memory>
 
+#include "internal/api/Legacy.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
+#include "internal/api/session/Session.hpp"
 #include "internal/otx/Types.hpp"
 #include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Context.hpp"
@@ -16,6 +20,8 @@
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Notary.hpp"
 #include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/core/Armored.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Notary.hpp"
@@ -25,6 +31,8 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/PasswordPrompt.hpp"
 #include "opentxs/util/SharedPimpl.hpp"
+#include "opentxs/util/Time.hpp"
+#include "otx/common/OTStorage.hpp"
 
 namespace ot = opentxs;
 
@@ -34,11 +42,96 @@ ot::OTNymID nym_id_{ot::identifier::Nym::Factory()};
 ot::OTNotaryID server_id_{ot::identifier::Notary::Factory()};
 
 struct Ledger : public ::testing::Test {
+    static constexpr auto binary_prefix_{"OTLEDGER-PB\n"};
+
     const ot::api::session::Client& client_;
     const ot::api::session::Notary& server_;
     ot::OTPasswordPrompt reason_c_;
     ot::OTPasswordPrompt reason_s_;
 
+    auto add_receipts(ot::Ledger& inbox, std::int64_t count) const -> void
+    {
+        for (auto i = std::int64_t{1}; i <= count; ++i) {
+            auto receipt = client_.Factory().InternalSession().Transaction(
+                nym_id_,
+                nym_id_,
+                server_id_,
+                0,
+                ot::originType::not_applicable,
+                i,
+                i,
+                i,
+                ot::Clock::now(),
+                ot::transactionType::transferReceipt,
+                ot::String::Factory(ot::Identifier::Random()),
+                0,
+                i,
+                0,
+                0,
+                false);
+
+            ASSERT_TRUE(receipt);
+            ASSERT_TRUE(inbox.AddTransaction(
+                std::shared_ptr<ot::OTTransaction>{receipt.release()}));
+        }
+    }
+
+    auto armored(const ot::Ledger& ledger) const -> ot::UnallocatedCString
+    {
+        auto raw = ot::String::Factory();
+        auto output = ot::String::Factory();
+        ledger.SaveContractRaw(raw);
+        ot::Armored::Factory(raw)->WriteArmoredString(output, "LEDGER");
+
+        return output->Get();
+    }
+
+    auto empty_ledger() const -> std::unique_ptr<ot::Ledger>
+    {
+        return client_.Factory().InternalSession().Ledger(
+            nym_id_, nym_id_, server_id_);
+    }
+
+    auto signed_inbox(std::int64_t count) const -> std::unique_ptr<ot::Ledger>
+    {
+        const auto nym = client_.Wallet().Nym(nym_id_);
+        auto inbox = client_.Factory().InternalSession().Ledger(
+            nym_id_, nym_id_, server_id_, ot::ledgerType::inbox, false);
+
+        if (false == bool(nym) || false == bool(inbox)) { return {}; }
+
+        add_receipts(*inbox, count);
+        inbox->ReleaseSignatures();
+
+        if (false == inbox->SignContract(*nym, reason_c_)) { return {}; }
+        if (false == inbox->SaveContract()) { return {}; }
+
+        return inbox;
+    }
+
+    auto store_inbox(const ot::UnallocatedCString& contents) const -> bool
+    {
+        return ot::OTDB::StorePlainString(
+            client_,
+            contents,
+            client_.DataFolder(),
+            client_.Internal().Legacy().Inbox(),
+            server_id_->str(),
+            nym_id_->str(),
+            "");
+    }
+
+    auto stored_inbox() const -> ot::UnallocatedCString
+    {
+        return ot::OTDB::QueryPlainString(
+            client_,
+            client_.DataFolder(),
+            client_.Internal().Legacy().Inbox(),
+            server_id_->str(),
+            nym_id_->str(),
+            "");
+    }
+
     Ledger()
         : client_(ot::Context().StartClientSession(0))
         , server_(ot::Context().StartNotarySession(0))
@@ -89,4 +182,89 @@ TEST_F(Ledger, load_nymbox)
     ASSERT_TRUE(nymbox);
     EXPECT_TRUE(nymbox->LoadNymbox());
 }
+
+TEST_F(Ledger, binary_inbox)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    auto inbox = signed_inbox(3);
+
+    ASSERT_TRUE(inbox);
+    EXPECT_TRUE(inbox->SaveInbox());
+    EXPECT_EQ(stored_inbox().rfind(binary_prefix_, 0), 0);
+
+    auto loaded = empty_ledger();
+
+    ASSERT_TRUE(loaded);
+    ASSERT_TRUE(loaded->LoadInbox());
+    EXPECT_TRUE(loaded->VerifySignature(*nym));
+    EXPECT_EQ(loaded->GetTransactionCount(), 3);
+    EXPECT_TRUE(loaded->GetTransaction(2));
+
+    auto expected = ot::Identifier::Factory();
+    auto actual = ot::Identifier::Factory();
+
+    EXPECT_TRUE(inbox->CalculateInboxHash(expected));
+    EXPECT_TRUE(loaded->CalculateInboxHash(actual));
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(Ledger, migrate_xml_inbox)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    auto inbox = signed_inbox(3);
+
+    ASSERT_TRUE(inbox);
+    ASSERT_TRUE(store_inbox(armored(*inbox)));
+    EXPECT_NE(stored_inbox().rfind(binary_prefix_, 0), 0);
+
+    auto loaded = empty_ledger();
+
+    ASSERT_TRUE(loaded);
+    ASSERT_TRUE(loaded->LoadInbox());
+    EXPECT_TRUE(loaded->VerifySignature(*nym));
+    EXPECT_EQ(loaded->GetTransactionCount(), 3);
+    EXPECT_EQ(stored_inbox().rfind(binary_prefix_, 0), 0);
+
+    auto migrated = empty_ledger();
+
+    ASSERT_TRUE(migrated);
+    ASSERT_TRUE(migrated->LoadInbox());
+    EXPECT_TRUE(migrated->VerifySignature(*nym));
+    EXPECT_EQ(migrated->GetTransactionCount(), 3);
+}
+
+TEST_F(Ledger, tampered_binary_inbox)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    auto inbox = signed_inbox(3);
+
+    ASSERT_TRUE(inbox);
+    ASSERT_TRUE(inbox->SaveInbox());
+
+    auto contents = stored_inbox();
+    const auto position = contents.find("transferReceipt");
+
+    ASSERT_NE(position, ot::UnallocatedCString::npos);
+
+    contents.replace(position, 8, "chequeRe");
+
+    ASSERT_TRUE(store_inbox(contents));
+
+    auto loaded = empty_ledger();
+
+    ASSERT_TRUE(loaded);
+
+    const auto verified = loaded->LoadInbox() && loaded->VerifySignature(*nym);
+
+    EXPECT_FALSE(verified);
+}
 }  // namespace ottest
@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "util/LogBuffer.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using LogRecord = ot::util::LogRecord;
+using LogRing = ot::util::LogRing;
+
+TEST(LogBuffer, format)
+{
+    auto record = LogRecord{};
+    record.Add("height ");
+    record.Add(std::int64_t{-42});
+    record.Add(" of ");
+    record.Add(std::uint64_t{18446744073709551615u});
+    record.Add(" ");
+    record.Add(0.5);
+
+    EXPECT_EQ(
+        LogRecord::Format(record.Bytes()),
+        "height -42 of 18446744073709551615 0.500000");
+
+    record.Clear();
+
+    EXPECT_TRUE(record.empty());
+    EXPECT_EQ(LogRecord::Format(record.Bytes()), "");
+}
+
+TEST(LogBuffer, truncated_record)
+{
+    auto record = LogRecord{};
+    record.Add("complete");
+    record.Add(std::uint64_t{7});
+    const auto bytes = record.Bytes();
+    const auto truncated = bytes.substr(0, bytes.size() - 1u);
+
+    EXPECT_EQ(LogRecord::Format(truncated), "complete");
+}
+
+TEST(LogBuffer, truncate)
+{
+    auto record = LogRecord{};
+    record.Add(ot::UnallocatedCString(100u, 'x'));
+    record.Add(std::uint64_t{7});
+    record.Truncate(40u);
+
+    EXPECT_LE(record.Bytes().size(), 40u);
+    EXPECT_EQ(
+        LogRecord::Format(record.Bytes()),
+        ot::UnallocatedCString(23u, 'x') + " [truncated]");
+
+    record.Clear();
+    record.Add("short");
+    record.Truncate(40u);
+
+    EXPECT_EQ(LogRecord::Format(record.Bytes()), "short");
+
+    record.Truncate(4u);
+
+    EXPECT_TRUE(record.empty());
+}
+
+TEST(LogBuffer, ring_wraps_around)
+{
+    auto ring = LogRing{64u};
+    const auto payload = ot::UnallocatedCString(20u, 'x');
+    auto received = std::size_t{0};
+
+    for (auto i = 0; i < 100; ++i) {
+        ASSERT_TRUE(ring.Push(i, payload));
+
+        const auto count = ring.Pop([&](auto level, auto record) {
+            EXPECT_EQ(level, i);
+            EXPECT_EQ(record, payload);
+            ++received;
+        });
+
+        EXPECT_EQ(count, 1u);
+        EXPECT_TRUE(ring.Empty());
+    }
+
+    EXPECT_EQ(received, 100u);
+}
+
+TEST(LogBuffer, ring_full)
+{
+    auto ring = LogRing{64u};
+    const auto payload = ot::UnallocatedCString(20u, 'x');
+
+    EXPECT_TRUE(ring.Push(0, payload));
+    EXPECT_TRUE(ring.Push(1, payload));
+    EXPECT_FALSE(ring.Push(2, payload));
+    EXPECT_FALSE(ring.Push(3, ot::UnallocatedCString(100u, 'y')));
+    EXPECT_EQ(ring.Pop([](auto, auto) {}), 2u);
+    EXPECT_TRUE(ring.Push(2, payload));
+}
+
+TEST(LogBuffer, oversized_record)
+{
+    auto ring = LogRing{64u};
+    auto record = LogRecord{};
+    record.Add(ot::UnallocatedCString(100u, 'y'));
+
+    ASSERT_GT(record.Bytes().size(), ring.MaxRecord());
+    EXPECT_FALSE(ring.Push(0, record.Bytes()));
+
+    record.Truncate(ring.MaxRecord());
+
+    EXPECT_TRUE(ring.Push(0, record.Bytes()));
+    EXPECT_EQ(ring.Pop([](auto, auto) {}), 1u);
+}
+
+TEST(LogBuffer, concurrent_producer)
+{
+    constexpr auto count = 100000;
+    auto ring = LogRing{4096u};
+    auto producer = std::thread{[&] {
+        for (auto i = 0; i < count; ++i) {
+            const auto text = std::to_string(i);
+
+            while (false == ring.Push(i, text)) { std::this_thread::yield(); }
+        }
+    }};
+    auto next = 0;
+
+    while (next < count) {
+        ring.Pop([&](auto level, auto record) {
+            EXPECT_EQ(level, next);
+            EXPECT_EQ(record, std::to_string(next));
+            ++next;
+        });
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(ring.Empty());
+}
+}  // namespace ottest
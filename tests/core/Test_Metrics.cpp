@@ -0,0 +1,105 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+
+#include "opentxs/util/Container.hpp"
+#include "util/Metrics.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Registry = ot::metrics::Registry;
+
+TEST(Metrics, counter_is_summed_across_threads)
+{
+    constexpr auto threads = 8;
+    constexpr auto increments = 10000;
+    auto registry = Registry{};
+    auto counter = registry.AddCounter("test_events_total", "Events");
+    auto workers = ot::UnallocatedVector<std::thread>{};
+
+    for (auto i = 0; i < threads; ++i) {
+        workers.emplace_back([&] {
+            for (auto j = 0; j < increments; ++j) { counter->Increment(); }
+        });
+    }
+
+    for (auto& thread : workers) { thread.join(); }
+
+    EXPECT_EQ(counter->Value(), std::uint64_t{threads * increments});
+}
+
+TEST(Metrics, histogram_buckets)
+{
+    auto histogram = ot::metrics::Histogram{{10.0, 1.0, 5.0, 5.0}};
+    histogram.Observe(0.5);
+    histogram.Observe(1.0);
+    histogram.Observe(7.0);
+    histogram.Observe(100.0);
+    const auto values = histogram.Values();
+
+    ASSERT_EQ(values.bounds_, (ot::metrics::Bounds{1.0, 5.0, 10.0}));
+    ASSERT_EQ(values.buckets_.size(), 4u);
+    EXPECT_EQ(values.buckets_[0], 2u);
+    EXPECT_EQ(values.buckets_[1], 2u);
+    EXPECT_EQ(values.buckets_[2], 3u);
+    EXPECT_EQ(values.buckets_[3], 4u);
+    EXPECT_DOUBLE_EQ(values.sum_, 108.5);
+}
+
+TEST(Metrics, prometheus_text)
+{
+    auto registry = Registry{};
+    auto a = registry.AddGauge(
+        "test_queue", "Queue \"depth\"", {{"chain", "btc"}, {"type", "a"}});
+    auto b = registry.AddGauge(
+        "test_queue", "Queue \"depth\"", {{"type", "a"}, {"chain", "btc"}});
+    auto c = registry.AddGauge("test_queue", "", {{"chain", "l\"tc"}});
+    auto h = registry.AddHistogram("test_latency", "Latency", {0.5, 2.0});
+    a->Set(3);
+    b->Add(4);
+    c->Set(-1);
+    h->Observe(1.0);
+
+    const auto expected = ot::UnallocatedCString{
+        "# HELP test_latency Latency\n"
+        "# TYPE test_latency histogram\n"
+        "test_latency_bucket{le=\"0.5\"} 0\n"
+        "test_latency_bucket{le=\"2\"} 1\n"
+        "test_latency_bucket{le=\"+Inf\"} 1\n"
+        "test_latency_sum 1\n"
+        "test_latency_count 1\n"
+        "# HELP test_queue Queue \"depth\"\n"
+        "# TYPE test_queue gauge\n"
+        "test_queue{chain=\"btc\",type=\"a\"} 7\n"
+        "test_queue{chain=\"l\\\"tc\"} -1\n"};
+
+    EXPECT_EQ(registry.Prometheus(), expected);
+}
+
+TEST(Metrics, expired_and_invalid_metrics)
+{
+    auto registry = Registry{};
+    auto counter = registry.AddCounter("test_total", "Total");
+    auto invalid = registry.AddCounter("0invalid", "Invalid");
+    auto mismatch = registry.AddGauge("test_total", "Mismatch");
+    counter->Add(2);
+    invalid->Add(5);
+    mismatch->Set(1);
+
+    EXPECT_EQ(invalid->Value(), 5u);
+    EXPECT_EQ(
+        registry.Prometheus(),
+        "# HELP test_total Total\n# TYPE test_total counter\ntest_total 2\n");
+
+    counter.reset();
+
+    EXPECT_EQ(registry.Prometheus(), "");
+}
+}  // namespace ottest
@@ -8,6 +8,8 @@
 #include <utility>
 
 #include "2_Factory.hpp"
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/api/session/Wallet.hpp"
 #include "internal/identity/Identity.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
@@ -21,6 +23,8 @@
 #include "opentxs/crypto/ParameterType.hpp"
 #include "opentxs/crypto/Parameters.hpp"
 #include "opentxs/crypto/key/asymmetric/Algorithm.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/identity/Authority.hpp"
 #include "opentxs/identity/CredentialType.hpp"
 #include "opentxs/identity/IdentityType.hpp"
 #include "opentxs/identity/Nym.hpp"
@@ -37,6 +41,8 @@
 #include "opentxs/util/Options.hpp"
 #include "opentxs/util/PasswordPrompt.hpp"
 #include "opentxs/util/Pimpl.hpp"
+#include "serialization/protobuf/Credential.pb.h"
+#include "serialization/protobuf/Signature.pb.h"
 
 namespace ot = opentxs;
 
@@ -230,6 +236,45 @@ TEST_F(Test_Nym, storage_sqlite) { EXPECT_TRUE(test_storage(client_sqlite_)); }
 TEST_F(Test_Nym, storage_lmdb) { EXPECT_TRUE(test_storage(client_lmdb_)); }
 #endif  // OT_STORAGE_LMDB
 
+TEST_F(Test_Nym, verified_credential_cache)
+{
+    const auto alias = ot::UnallocatedCString{"cache"};
+    const auto pNym = std::unique_ptr<ot::identity::internal::Nym>{
+        ot::Factory::Nym(
+            client_, {}, ot::identity::Type::individual, alias, reason_)};
+
+    ASSERT_TRUE(pNym);
+
+    const auto& nym = *pNym;
+    const auto& wallet = client_.Wallet().Internal();
+    const auto hash = [&](const auto& credential) {
+        return client_.Factory().InternalSession().Identifier(credential);
+    };
+    auto credential = std::shared_ptr<ot::proto::Credential>{};
+
+    ASSERT_TRUE(
+        wallet.LoadCredential(nym.at(0).GetMasterCredID()->str(), credential));
+    ASSERT_TRUE(credential);
+    ASSERT_LT(0, credential->signature_size());
+    EXPECT_TRUE(wallet.IsVerifiedCredential(hash(*credential)));
+
+    credential->mutable_signature(0)->set_signature("tampered");
+
+    EXPECT_FALSE(wallet.IsVerifiedCredential(hash(*credential)));
+
+    auto bytes = ot::Space{};
+
+    ASSERT_TRUE(nym.SerializeCredentialIndex(
+        ot::writer(bytes), ot::identity::internal::Nym::Mode::Abbreviated));
+
+    const auto pLoaded = std::unique_ptr<ot::identity::internal::Nym>{
+        ot::Factory::Nym(client_, ot::reader(bytes), alias)};
+
+    ASSERT_TRUE(pLoaded);
+    EXPECT_TRUE(pLoaded->CompareID(nym.ID()));
+    EXPECT_TRUE(pLoaded->VerifyPseudonym());
+}
+
 TEST_F(Test_Nym, default_params)
 {
     const auto pNym = client_.Wallet().Nym(reason_);
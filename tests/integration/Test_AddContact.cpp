@@ -8,6 +8,7 @@
 #include <future>
 #include <utility>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/Context.hpp"
@@ -41,9 +42,9 @@ struct Test_AddContact : public IntegrationFixture {
     const ot::api::session::Notary& api_server_1_;
 
     Test_AddContact()
-        : api_alex_(ot::Context().StartClientSession(0))
-        , api_bob_(ot::Context().StartClientSession(1))
-        , api_chris_(ot::Context().StartClientSession(2))
+        : api_alex_(ot::Context().StartClientSession(UIArgs(), 0))
+        , api_bob_(ot::Context().StartClientSession(UIArgs(), 1))
+        , api_chris_(ot::Context().StartClientSession(UIArgs(), 2))
         , api_server_1_(ot::Context().StartNotarySession(0))
     {
         const_cast<Server&>(server_1_).init(api_server_1_);
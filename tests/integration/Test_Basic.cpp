@@ -10,6 +10,7 @@
 #include <sstream>
 #include <utility>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "internal/api/session/Wallet.hpp"
 #include "internal/otx/common/Account.hpp"
@@ -132,9 +133,9 @@ public:
     }
 
     Integration()
-        : api_alex_(ot::Context().StartClientSession(0))
-        , api_bob_(ot::Context().StartClientSession(1))
-        , api_issuer_(ot::Context().StartClientSession(2))
+        : api_alex_(ot::Context().StartClientSession(UIArgs(), 0))
+        , api_bob_(ot::Context().StartClientSession(UIArgs(), 1))
+        , api_issuer_(ot::Context().StartClientSession(UIArgs(), 2))
         , api_server_1_(ot::Context().StartNotarySession(0))
     {
         const_cast<Server&>(server_1_).init(api_server_1_);
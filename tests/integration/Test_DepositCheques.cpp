@@ -4,6 +4,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <future>
 #include <memory>
 #include <utility>
@@ -57,6 +58,9 @@
 #define UNIT_DEFINITION_UNIT_OF_ACCOUNT ot::UnitType::Usd
 #define CHEQUE_AMOUNT_1 2000
 #define CHEQUE_MEMO_1 "memo"
+#define CHEQUE_AMOUNT_2 10
+#define CHEQUE_MEMO_2 "round trip"
+#define CHEQUE_ROUND_TRIPS 10
 
 namespace ot = opentxs;
 
@@ -437,6 +441,44 @@ TEST_F(Test_DepositCheques, process_inbox_issuer)
     EXPECT_EQ(-1 * CHEQUE_AMOUNT_1, account.get().GetBalance());
 }
 
+TEST_F(Test_DepositCheques, deposit_round_trips)
+{
+    for (auto i = std::size_t{0}; i < CHEQUE_ROUND_TRIPS; ++i) {
+        auto [sendID, sent] = issuer_client_.OTX().SendCheque(
+            issuer_nym_id_,
+            issuer_account_id_,
+            contact_id_issuer_alice_,
+            CHEQUE_AMOUNT_2,
+            CHEQUE_MEMO_2);
+
+        ASSERT_NE(0, sendID);
+        ASSERT_EQ(ot::otx::LastReplyStatus::MessageSuccess, sent.get().first);
+
+        alice_client_.OTX()
+            .DownloadServerContract(
+                alice_nym_id_, server_1_.ID(), server_1_.ID())
+            .second.get();
+        alice_client_.OTX().ContextIdle(alice_nym_id_, server_1_.ID()).get();
+
+        ASSERT_EQ(1, alice_client_.OTX().DepositCheques(alice_nym_id_));
+
+        alice_client_.OTX().ContextIdle(alice_nym_id_, server_1_.ID()).get();
+        auto [processID, processed] = issuer_client_.OTX().ProcessInbox(
+            issuer_nym_id_, server_1_.ID(), issuer_account_id_);
+
+        ASSERT_NE(0, processID);
+        ASSERT_EQ(
+            ot::otx::LastReplyStatus::MessageSuccess, processed.get().first);
+    }
+
+    const auto account =
+        issuer_client_.Wallet().Internal().Account(issuer_account_id_);
+
+    EXPECT_EQ(
+        -1 * (CHEQUE_AMOUNT_1 + CHEQUE_ROUND_TRIPS * CHEQUE_AMOUNT_2),
+        account.get().GetBalance());
+}
+
 TEST_F(Test_DepositCheques, shutdown)
 {
     alice_client_.OTX().ContextIdle(alice_nym_id_, server_1_.ID()).get();
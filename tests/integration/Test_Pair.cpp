@@ -9,6 +9,7 @@
 #include <memory>
 #include <utility>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "internal/api/session/Client.hpp"
 #include "internal/api/session/Wallet.hpp"
@@ -88,8 +89,8 @@ public:
     ot::OTZMQSubscribeSocket chris_rename_notary_listener_;
 
     Test_Pair()
-        : api_issuer_(ot::Context().StartClientSession(0))
-        , api_chris_(ot::Context().StartClientSession(1))
+        : api_issuer_(ot::Context().StartClientSession(UIArgs(), 0))
+        , api_chris_(ot::Context().StartClientSession(UIArgs(), 1))
         , api_server_1_(ot::Context().StartNotarySession(0))
         , issuer_peer_request_cb_(ot::network::zeromq::ListenCallback::Factory(
               [this](auto&& in) { issuer_peer_request(std::move(in)); }))
@@ -0,0 +1,202 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+
+#include "internal/otx/common/trade/OTOrderBook.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Book = ot::OTOrderBook;
+using Side = Book::Side;
+
+// The order book never dereferences the offers it indexes so the tests only
+// need distinct addresses
+class Test_OrderBook : public ::testing::Test
+{
+public:
+    std::array<std::uint64_t, 16> storage_;
+    Book book_;
+
+    auto offer(std::size_t index) noexcept -> ot::OTOffer*
+    {
+        return reinterpret_cast<ot::OTOffer*>(&storage_.at(index));
+    }
+
+    auto visit_bids() noexcept -> ot::UnallocatedVector<ot::OTOffer*>
+    {
+        auto output = ot::UnallocatedVector<ot::OTOffer*>{};
+        book_.VisitBids([&](auto& item) {
+            output.emplace_back(&item);
+
+            return true;
+        });
+
+        return output;
+    }
+
+    auto visit_asks() noexcept -> ot::UnallocatedVector<ot::OTOffer*>
+    {
+        auto output = ot::UnallocatedVector<ot::OTOffer*>{};
+        book_.VisitAsks([&](auto& item) {
+            output.emplace_back(&item);
+
+            return true;
+        });
+
+        return output;
+    }
+
+    Test_OrderBook()
+        : storage_()
+        , book_(8)
+    {
+    }
+};
+
+TEST_F(Test_OrderBook, empty)
+{
+    EXPECT_EQ(book_.BestBid(), 0);
+    EXPECT_EQ(book_.BestAsk(), 0);
+    EXPECT_EQ(book_.BidCount(), 0);
+    EXPECT_EQ(book_.AskCount(), 0);
+    EXPECT_EQ(book_.TotalAsks(), 0);
+    EXPECT_EQ(book_.Sequence(), 0);
+    EXPECT_EQ(book_.Find(1), nullptr);
+    EXPECT_EQ(book_.Remove(1), nullptr);
+}
+
+TEST_F(Test_OrderBook, price_time_priority)
+{
+    EXPECT_TRUE(book_.Add(1, Side::Bid, 10, 5, offer(1)));
+    EXPECT_TRUE(book_.Add(2, Side::Bid, 12, 5, offer(2)));
+    EXPECT_TRUE(book_.Add(3, Side::Bid, 10, 5, offer(3)));
+    EXPECT_TRUE(book_.Add(4, Side::Bid, 0, 5, offer(4)));
+    EXPECT_TRUE(book_.Add(5, Side::Ask, 20, 5, offer(5)));
+    EXPECT_TRUE(book_.Add(6, Side::Ask, 15, 7, offer(6)));
+    EXPECT_TRUE(book_.Add(7, Side::Ask, 0, 1, offer(7)));
+    EXPECT_TRUE(book_.Add(8, Side::Ask, 15, 3, offer(8)));
+    EXPECT_FALSE(book_.Add(8, Side::Ask, 15, 3, offer(9)));
+
+    EXPECT_EQ(book_.BestBid(), 12);
+    EXPECT_EQ(book_.BestAsk(), 15);
+    EXPECT_EQ(book_.BidCount(), 4);
+    EXPECT_EQ(book_.AskCount(), 4);
+    EXPECT_EQ(book_.TotalAsks(), 16);
+
+    const auto bids = visit_bids();
+    const auto asks = visit_asks();
+
+    ASSERT_EQ(bids.size(), 3);
+    EXPECT_EQ(bids.at(0), offer(2));
+    EXPECT_EQ(bids.at(1), offer(1));
+    EXPECT_EQ(bids.at(2), offer(3));
+    ASSERT_EQ(asks.size(), 3);
+    EXPECT_EQ(asks.at(0), offer(6));
+    EXPECT_EQ(asks.at(1), offer(8));
+    EXPECT_EQ(asks.at(2), offer(5));
+}
+
+TEST_F(Test_OrderBook, remove)
+{
+    book_.Add(1, Side::Bid, 10, 5, offer(1));
+    book_.Add(2, Side::Bid, 10, 5, offer(2));
+    book_.Add(3, Side::Bid, 10, 5, offer(3));
+    book_.Add(4, Side::Ask, 0, 5, offer(4));
+
+    EXPECT_EQ(book_.Remove(2), offer(2));
+    EXPECT_EQ(book_.Find(2), nullptr);
+    EXPECT_EQ(book_.Remove(2), nullptr);
+    EXPECT_EQ(book_.Remove(4), offer(4));
+    EXPECT_EQ(book_.TotalAsks(), 0);
+
+    const auto bids = visit_bids();
+
+    ASSERT_EQ(bids.size(), 2);
+    EXPECT_EQ(bids.at(0), offer(1));
+    EXPECT_EQ(bids.at(1), offer(3));
+
+    const auto depth = book_.Snapshot();
+
+    ASSERT_EQ(depth.bids_.size(), 1);
+    EXPECT_EQ(depth.bids_.at(0).price_, 10);
+    EXPECT_EQ(depth.bids_.at(0).quantity_, 10);
+    EXPECT_EQ(depth.bids_.at(0).count_, 2);
+
+    const auto cleared = book_.Clear();
+
+    EXPECT_EQ(cleared.size(), 2);
+    EXPECT_EQ(book_.BidCount(), 0);
+    EXPECT_EQ(book_.BestBid(), 0);
+}
+
+TEST_F(Test_OrderBook, depth)
+{
+    book_.Add(1, Side::Bid, 10, 5, offer(1));
+    book_.Add(2, Side::Bid, 11, 4, offer(2));
+    book_.Add(3, Side::Bid, 10, 3, offer(3));
+    book_.Add(4, Side::Ask, 13, 2, offer(4));
+    book_.Add(5, Side::Ask, 12, 1, offer(5));
+
+    const auto full = book_.Snapshot();
+
+    ASSERT_EQ(full.bids_.size(), 2);
+    EXPECT_EQ(full.bids_.at(0).price_, 11);
+    EXPECT_EQ(full.bids_.at(1).price_, 10);
+    EXPECT_EQ(full.bids_.at(1).quantity_, 8);
+    EXPECT_EQ(full.bids_.at(1).count_, 2);
+    ASSERT_EQ(full.asks_.size(), 2);
+    EXPECT_EQ(full.asks_.at(0).price_, 12);
+    EXPECT_EQ(full.asks_.at(1).price_, 13);
+    EXPECT_EQ(full.sequence_, book_.Sequence());
+
+    const auto top = book_.Snapshot(1);
+
+    ASSERT_EQ(top.bids_.size(), 1);
+    EXPECT_EQ(top.bids_.at(0).price_, 11);
+    ASSERT_EQ(top.asks_.size(), 1);
+    EXPECT_EQ(top.asks_.at(0).price_, 12);
+}
+
+TEST_F(Test_OrderBook, deltas)
+{
+    book_.Add(1, Side::Bid, 10, 5, offer(1));
+    const auto snapshot = book_.Snapshot();
+    book_.Add(2, Side::Bid, 10, 3, offer(2));
+    book_.Update(1, 2);
+    book_.Remove(1);
+    book_.Remove(2);
+
+    auto deltas = ot::UnallocatedVector<Book::Delta>{};
+
+    ASSERT_TRUE(book_.Deltas(snapshot.sequence_, deltas));
+    ASSERT_EQ(deltas.size(), 4);
+    EXPECT_EQ(deltas.at(0).sequence_, snapshot.sequence_ + 1);
+    EXPECT_EQ(deltas.at(0).level_.quantity_, 8);
+    EXPECT_EQ(deltas.at(0).level_.count_, 2);
+    EXPECT_EQ(deltas.at(1).level_.quantity_, 5);
+    EXPECT_EQ(deltas.at(2).level_.quantity_, 3);
+    EXPECT_EQ(deltas.at(2).level_.count_, 1);
+    EXPECT_EQ(deltas.at(3).level_.count_, 0);
+    EXPECT_EQ(deltas.at(3).side_, Side::Bid);
+
+    deltas.clear();
+
+    EXPECT_TRUE(book_.Deltas(book_.Sequence(), deltas));
+    EXPECT_TRUE(deltas.empty());
+
+    for (auto i = std::uint64_t{10}; i < 20u; ++i) {
+        book_.Add(i, Side::Ask, 20, 1, nullptr);
+    }
+
+    EXPECT_FALSE(book_.Deltas(snapshot.sequence_, deltas));
+}
+}  // namespace ottest
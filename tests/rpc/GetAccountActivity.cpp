@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <iterator>
 
 #include "integration/Helpers.hpp"
@@ -19,11 +20,13 @@
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/interface/rpc/CommandType.hpp"
+#include "opentxs/interface/rpc/AccountEvent.hpp"
 #include "opentxs/interface/rpc/ResponseCode.hpp"
 #include "opentxs/interface/rpc/request/Base.hpp"
 #include "opentxs/interface/rpc/request/GetAccountActivity.hpp"
 #include "opentxs/interface/rpc/response/Base.hpp"
 #include "opentxs/interface/rpc/response/GetAccountActivity.hpp"
+#include "opentxs/util/Container.hpp"
 #include "paymentcode/VectorsV3.hpp"
 #include "ui/Helpers.hpp"
 
@@ -280,6 +283,66 @@ TEST_F(RPC_fixture, all_accounts)
     // TODO verify each item in activity
 }
 
+TEST_F(RPC_fixture, paging)
+{
+    constexpr auto index{0};
+    const auto& account = registered_accounts_.at(brian_).front();
+    const auto all = [&] {
+        const auto command = ot::rpc::request::GetAccountActivity{
+            index, ot::rpc::request::Base::Identifiers{account}};
+        const auto base = ot_.RPC(command);
+        const auto& response = base->asGetAccountActivity();
+
+        EXPECT_TRUE(response.Cursor().empty());
+
+        return response.Activity();
+    }();
+
+    ASSERT_GT(all.size(), 1);
+
+    auto paged = ot::rpc::response::GetAccountActivity::Events{};
+    auto cursor = ot::UnallocatedCString{};
+    auto pages = std::size_t{0};
+
+    do {
+        const auto command =
+            ot::rpc::request::GetAccountActivity{index, account, 1, cursor};
+        const auto base = ot_.RPC(command);
+        const auto& response = base->asGetAccountActivity();
+        const auto& codes = response.ResponseCodes();
+        const auto& activity = response.Activity();
+
+        EXPECT_EQ(command.Limit(), 1);
+        EXPECT_EQ(command.Cursor(), cursor);
+        ASSERT_EQ(codes.size(), 1);
+        EXPECT_EQ(codes.at(0).second, rpc::ResponseCode::success);
+        ASSERT_EQ(activity.size(), 1);
+
+        std::copy(activity.begin(), activity.end(), std::back_inserter(paged));
+        cursor = response.Cursor();
+        ++pages;
+    } while ((false == cursor.empty()) && (pages <= all.size()));
+
+    EXPECT_EQ(pages, all.size());
+    ASSERT_EQ(paged.size(), all.size());
+
+    for (auto i{0u}; i < all.size(); ++i) {
+        EXPECT_EQ(paged.at(i).UUID(), all.at(i).UUID());
+        EXPECT_EQ(paged.at(i).Timestamp(), all.at(i).Timestamp());
+        EXPECT_EQ(paged.at(i).State(), all.at(i).State());
+    }
+
+    {
+        const auto command =
+            ot::rpc::request::GetAccountActivity{index, account, 1, "invalid"};
+        const auto base = ot_.RPC(command);
+        const auto& codes = base->ResponseCodes();
+
+        ASSERT_EQ(codes.size(), 1);
+        EXPECT_EQ(codes.at(0).second, rpc::ResponseCode::invalid);
+    }
+}
+
 // TODO test other combinations of accounts
 // TODO track down mystery
 // "opentxs::ui::implementation::TransferBalanceItem::startup: Invalid event
@@ -12,6 +12,7 @@
 #include <mutex>
 #include <utility>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "internal/otx/common/Message.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -711,7 +712,7 @@ auto RPC_fixture::SetIntroductionServer(
 auto RPC_fixture::StartClient(int index) const noexcept
     -> const ot::api::session::Client&
 {
-    const auto& out = ot_.StartClientSession(index);
+    const auto& out = ot_.StartClientSession(UIArgs(), index);
     init_maps(out.Instance());
 
     return out;
@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
@@ -96,7 +97,7 @@ public:
             if (false == alice_s_.has_value()) {
                 const auto& v = GetVectors3().alice_;
                 alice_s_.emplace(v.words_, "Alice");
-                alice_s_->init(ot::Context().StartClientSession(0));
+                alice_s_->init(ot::Context().StartClientSession(UIArgs(), 0));
             }
 
             return alice_s_.value();
@@ -105,7 +106,7 @@ public:
             if (false == bob_s_.has_value()) {
                 const auto& v = GetVectors3().bob_;
                 bob_s_.emplace(v.words_, "Bob");
-                bob_s_->init(ot::Context().StartClientSession(1));
+                bob_s_->init(ot::Context().StartClientSession(UIArgs(), 1));
             }
 
             return bob_s_.value();
@@ -114,7 +115,7 @@ public:
             if (false == chris_s_.has_value()) {
                 chris_s_.emplace(pkt_words_, "Chris", pkt_passphrase_);
                 chris_s_->init(
-                    ot::Context().StartClientSession(1),
+                    ot::Context().StartClientSession(UIArgs(), 1),
                     ot::identity::Type::individual,
                     0,
                     ot::crypto::SeedStyle::PKT);
@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 #include <atomic>
 
+#include "Basic.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/session/Client.hpp"
@@ -44,7 +45,7 @@ public:
     const ot::ui::BlockchainSelection& test_;
 
     Test_BlockchainSelector()
-        : client_(ot::Context().StartClientSession(0))
+        : client_(ot::Context().StartClientSession(UIArgs(), 0))
         , full_([&]() -> auto& {
             static std::atomic_bool init{true};
             static auto cb =
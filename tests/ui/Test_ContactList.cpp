@@ -7,6 +7,7 @@
 #include <atomic>
 #include <memory>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/Context.hpp"
@@ -49,7 +50,7 @@ public:
     const ot::PaymentCode chris_payment_code_;
 
     Test_ContactList()
-        : api_(ot::Context().StartClientSession(0))
+        : api_(ot::Context().StartClientSession(UIArgs(), 0))
         , reason_(api_.Factory().PasswordPrompt(__func__))
         , bob_payment_code_(api_.Factory().PaymentCode(
               ot::UnallocatedCString{payment_code_1_}))
@@ -4,11 +4,14 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 #include <functional>
 #include <iosfwd>
 #include <memory>
 #include <optional>
+#include <random>
 #include <utility>
 
 #include "interface/ui/base/Items.hpp"
@@ -566,4 +569,83 @@ TEST(UI_items, reverse_sort)
     EXPECT_TRUE(test_row(items, 4, vector_.at(1)));
     EXPECT_TRUE(test_row(items, 5, vector_.at(0)));
 }
+
+TEST(UI_items, random_operations)
+{
+    // NOTE compare against a sorted vector after every operation
+    auto items = Type{0, false};
+    auto expected = ot::UnallocatedVector<std::pair<Key, ID>>{};
+    auto rng = std::mt19937{42};
+    auto key = [&] { return std::to_string(rng() % 100u); };
+    auto check = [&] {
+        ASSERT_EQ(items.size(), expected.size());
+
+        auto it = items.begin();
+
+        for (auto i = std::size_t{0}; i < expected.size(); ++i, ++it) {
+            const auto& [eKey, eID] = expected.at(i);
+
+            ASSERT_NE(it, items.end());
+            EXPECT_EQ(it->key_, eKey);
+            EXPECT_EQ(it->id_, eID);
+            EXPECT_EQ(items.at(i).id_, eID);
+            EXPECT_EQ(items.get_index(eID), i);
+        }
+
+        EXPECT_EQ(it, items.end());
+    };
+    auto next = ID{0};
+
+    for (auto round = 0; round < 2000; ++round) {
+        const auto action = (expected.size() < 10u) ? 0u : (rng() % 3u);
+
+        switch (action) {
+            case 0u: {
+                const auto id = next++;
+                const auto k = key();
+                const auto [it, prev] = items.find_insert_position(k, id);
+                items.insert_before(it, k, id, std::make_shared<Value>("x"));
+                expected.emplace(
+                    std::upper_bound(
+                        expected.begin(),
+                        expected.end(),
+                        std::make_pair(k, id)),
+                    k,
+                    id);
+            } break;
+            case 1u: {
+                const auto pos = rng() % expected.size();
+                const auto id = expected.at(pos).second;
+                const auto position = items.find_delete_position(id);
+
+                ASSERT_TRUE(position);
+                EXPECT_EQ(position->second, pos);
+
+                items.delete_row(id, position->first);
+                expected.erase(std::next(expected.begin(), pos));
+            } break;
+            default: {
+                const auto pos = rng() % expected.size();
+                const auto id = expected.at(pos).second;
+                const auto k = key();
+                auto move = items.find_move_position(id, k, id);
+
+                ASSERT_TRUE(move);
+
+                auto& [from, to] = move.value();
+                items.move_before(id, from.first, k, id, to.first);
+                expected.erase(std::next(expected.begin(), pos));
+                expected.emplace(
+                    std::upper_bound(
+                        expected.begin(),
+                        expected.end(),
+                        std::make_pair(k, id)),
+                    k,
+                    id);
+            }
+        }
+
+        check();
+    }
+}
 }  // namespace ottest
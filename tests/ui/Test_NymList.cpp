@@ -7,6 +7,7 @@
 #include <atomic>
 #include <memory>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/Context.hpp"
@@ -37,7 +38,7 @@ public:
     ot::OTPasswordPrompt reason_;
 
     Test_NymList()
-        : api_(ot::Context().StartClientSession(0))
+        : api_(ot::Context().StartClientSession(UIArgs(), 0))
         , reason_(api_.Factory().PasswordPrompt(__func__))
     {
     }
@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 
+#include "Basic.hpp"
 #include "integration/Helpers.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/Context.hpp"
@@ -56,7 +57,7 @@ public:
     ot::OTPasswordPrompt reason_;
 
     Test_SeedTree()
-        : api_(ot::Context().StartClientSession(0))
+        : api_(ot::Context().StartClientSession(UIArgs(), 0))
         , reason_(api_.Factory().PasswordPrompt(__func__))
     {
     }
@@ -0,0 +1,186 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+#include "internal/api/session/UI.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/UI.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Options.hpp"
+#include "opentxs/util/Time.hpp"
+#include "util/Metrics.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_UpdateManager : public ::testing::Test
+{
+public:
+    // NOTE long enough that a burst of activations always fits inside one
+    // interval
+    static constexpr auto interval_ = std::chrono::milliseconds{500};
+    static constexpr auto burst_ = std::size_t{10};
+
+    struct Widget {
+        const ot::OTIdentifier id_;
+        mutable std::mutex lock_{};
+        ot::UnallocatedVector<ot::Time> notified_{};
+
+        auto Notifications() const noexcept
+            -> ot::UnallocatedVector<ot::Time>
+        {
+            auto lock = std::lock_guard<std::mutex>{lock_};
+
+            return notified_;
+        }
+
+        Widget()
+            : id_(ot::Identifier::Random())
+        {
+        }
+    };
+
+    const ot::api::session::Client& api_;
+    Widget first_;
+    Widget second_;
+
+    // NOTE returns the exported value of the update counter with the
+    // specified result
+    static auto Exported(std::string_view result) -> std::uint64_t
+    {
+        auto prefix = std::ostringstream{};
+        prefix << "opentxs_ui_updates_total{result=\"" << result << "\"} ";
+        const auto text = ot::metrics::Get().Prometheus();
+        const auto start = text.find(prefix.str());
+
+        if (ot::UnallocatedCString::npos == start) { return 0u; }
+
+        auto value = std::uint64_t{0};
+        auto stream =
+            std::istringstream{text.substr(start + prefix.str().size())};
+        stream >> value;
+
+        return value;
+    }
+
+    auto Activate(const Widget& widget) const noexcept -> void
+    {
+        api_.UI().Internal().ActivateUICallback(widget.id_);
+    }
+    auto Register(Widget& widget) const noexcept -> void
+    {
+        api_.UI().Internal().RegisterUICallback(widget.id_, [&widget] {
+            auto lock = std::lock_guard<std::mutex>{widget.lock_};
+            widget.notified_.emplace_back(ot::Clock::now());
+        });
+    }
+    // NOTE waits for the expected number of notifications, then for long
+    // enough to observe any unexpected extra ones
+    auto Wait(const Widget& widget, std::size_t count) const noexcept
+        -> ot::UnallocatedVector<ot::Time>
+    {
+        const auto limit = ot::Clock::now() + std::chrono::seconds{10};
+
+        while ((widget.Notifications().size() < count) &&
+               (ot::Clock::now() < limit)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+
+        std::this_thread::sleep_for(2 * interval_);
+
+        return widget.Notifications();
+    }
+
+    Test_UpdateManager()
+        : api_(ot::Context().StartClientSession(
+              ot::Options{}.SetUIUpdateInterval(
+                  static_cast<int>(interval_.count())),
+              0))
+        , first_()
+        , second_()
+    {
+        Register(first_);
+        Register(second_);
+    }
+
+    ~Test_UpdateManager() override
+    {
+        api_.UI().Internal().ClearUICallbacks(first_.id_);
+        api_.UI().Internal().ClearUICallbacks(second_.id_);
+    }
+};
+
+TEST_F(Test_UpdateManager, coalesce_burst)
+{
+    const auto delivered = Exported("delivered");
+    const auto suppressed = Exported("suppressed");
+    const auto start = ot::Clock::now();
+
+    for (auto i = std::size_t{0}; i < burst_; ++i) { Activate(first_); }
+
+    const auto last = ot::Clock::now();
+    const auto notified = Wait(first_, 2u);
+
+    ASSERT_EQ(notified.size(), 2u);
+    // NOTE the first request is delivered immediately and the rest are
+    // combined into one trailing notification which follows the last request
+    EXPECT_LT(notified.front() - start, interval_);
+    EXPECT_GE(notified.back(), last);
+    EXPECT_GE(notified.back() - notified.front(), interval_);
+    EXPECT_EQ(Exported("delivered") - delivered, 2u);
+    EXPECT_EQ(Exported("suppressed") - suppressed, burst_ - 2u);
+}
+
+TEST_F(Test_UpdateManager, single_request)
+{
+    const auto delivered = Exported("delivered");
+    const auto suppressed = Exported("suppressed");
+    Activate(first_);
+    const auto notified = Wait(first_, 1u);
+
+    EXPECT_EQ(notified.size(), 1u);
+    EXPECT_EQ(Exported("delivered") - delivered, 1u);
+    EXPECT_EQ(Exported("suppressed") - suppressed, 0u);
+}
+
+TEST_F(Test_UpdateManager, independent_widgets)
+{
+    const auto delivered = Exported("delivered");
+    const auto suppressed = Exported("suppressed");
+    const auto start = ot::Clock::now();
+
+    for (auto i = std::size_t{0}; i < burst_; ++i) {
+        Activate(first_);
+        Activate(second_);
+    }
+
+    const auto last = ot::Clock::now();
+    const auto first = Wait(first_, 2u);
+    const auto second = Wait(second_, 2u);
+
+    ASSERT_EQ(first.size(), 2u);
+    ASSERT_EQ(second.size(), 2u);
+    // NOTE throttling one widget does not delay the first notification for
+    // another
+    EXPECT_LT(first.front() - start, interval_);
+    EXPECT_LT(second.front() - start, interval_);
+    EXPECT_GE(first.back(), last);
+    EXPECT_GE(second.back(), last);
+    EXPECT_EQ(Exported("delivered") - delivered, 4u);
+    EXPECT_EQ(Exported("suppressed") - suppressed, 2u * (burst_ - 2u));
+}
+}  // namespace ottest